@@ -9,5 +9,8 @@
 #include "APP_audio.h"
 #include "APP_video.h"
 #include "APP_global.h"
+#include "APP_memory.h"
+#include "APP_capture.h"
+#include "APP_movie.h"
 
 #endif
@@ -5,6 +5,8 @@
 #include "APP_ogg.h"
 #include "APP_mp3.h"
 #include "APP_error.h"
+#include "APP_memory.h"
+#include "APP_global.h"
 #include "APP_audio_private.h"
 #include <SDL3/SDL_audio.h>
 #include <SDL3/SDL_mutex.h>
@@ -50,6 +52,8 @@ typedef struct APP_Sound
 	bool looping;
 	bool playing;
 	bool paused;
+	bool prepared;
+	APP_WorkerJobID prepareJob;
 } APP_Sound;
 
 static bool APP_WasAudioInit;
@@ -82,6 +86,18 @@ struct
 	{ ".mp3", APP_CreateStreamingMP3AudioData }
 };
 
+// Offline rendering has no audio device; instead, APP_MixAudio() pulls from the
+// sounds' streams, so they're never bound.
+static bool APP_BindSound(APP_Sound* sound)
+{
+#ifdef APP_REPLAY_RENDER
+	(void)sound;
+	return true;
+#else
+	return SDL_BindAudioStream(APP_AudioDevice, sound->stream);
+#endif
+}
+
 #define APP_SET_SOUND_LOAD_ERROR_MESSAGE(filenameExt) APP_SetError("Audio file \"%s\" failed to load.\nIt might be corrupt, so you would need to replace it.", filenameExt)
 
 bool APP_InitAudio(int wavesCount)
@@ -94,6 +110,12 @@ bool APP_InitAudio(int wavesCount)
 	}
 
 	// Initialize audio device
+#ifdef APP_REPLAY_RENDER
+	APP_AudioDevice = 0;
+	APP_AudioDeviceFormat.format = SDL_AUDIO_S16LE;
+	APP_AudioDeviceFormat.channels = 2;
+	APP_AudioDeviceFormat.freq = 48000;
+#else
 	APP_AudioDevice = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, NULL);
 	if (!APP_AudioDevice) {
 		return APP_SetError("Couldn't open audio device: %s", SDL_GetError());
@@ -101,6 +123,7 @@ bool APP_InitAudio(int wavesCount)
 	if (!SDL_GetAudioDeviceFormat(APP_AudioDevice, &APP_AudioDeviceFormat, NULL)) {
 		return APP_SetError("Couldn't get audio device format: %s", SDL_GetError());
 	}
+#endif
 
 	// サウンドの初期化
 	// Initialize sounds
@@ -129,8 +152,15 @@ bool APP_InitAudio(int wavesCount)
 	return true;
 }
 
+static void APP_FinishPreparingSound(APP_Sound* sound);
+
 static void APP_QuitSound(APP_Sound* sound)
 {
+	// The loading worker is destroyed before audio, having finished all jobs.
+	if (APP_LoadingWorker) {
+		APP_FinishPreparingSound(sound);
+	}
+	sound->prepareJob = 0;
 	SDL_UnbindAudioStream(sound->stream);
 	if (!sound->loaded) {
 		return;
@@ -159,6 +189,7 @@ static void APP_QuitSound(APP_Sound* sound)
 	sound->looping = false;
 	sound->playing = false;
 	sound->paused = false;
+	sound->prepared = false;
 }
 
 void APP_QuitAudio(void)
@@ -181,7 +212,9 @@ void APP_QuitAudio(void)
 	SDL_DestroyAudioStream(APP_Music.stream);
 	APP_Music = (APP_Sound) { 0 };
 
+#ifndef APP_REPLAY_RENDER
 	SDL_CloseAudioDevice(APP_AudioDevice);
+#endif
 	APP_AudioDevice = 0;
 
 	APP_WasAudioInit = false;
@@ -328,7 +361,7 @@ static bool APP_LoadPreloadedSound(APP_Sound* sound, const char* filename, bool
 	sound->playing = false;
 	SDL_free(oldData);
 	sound->loaded = true;
-	if (!SDL_BindAudioStream(APP_AudioDevice, sound->stream)) {
+	if (!APP_BindSound(sound)) {
 		APP_SetError("Could not load sound file: %s", SDL_GetError());
 		APP_Exit(SDL_APP_FAILURE);
 	}
@@ -602,7 +635,7 @@ static bool APP_LoadStreamedSound(APP_Sound* sound, const char* leadinFilename,
 		APP_SetError("Could not load sound file");
 		APP_Exit(SDL_APP_FAILURE);
 	}
-	if (!SDL_BindAudioStream(APP_AudioDevice, sound->stream)) {
+	if (!APP_BindSound(sound)) {
 		APP_SetError("Could not load sound file");
 		APP_Exit(SDL_APP_FAILURE);
 	}
@@ -610,11 +643,14 @@ static bool APP_LoadStreamedSound(APP_Sound* sound, const char* leadinFilename,
 	return true;
 }
 
-static void APP_ReadyStreamedSound(APP_Sound* sound)
+static bool APP_IsSoundPlaying(APP_Sound* sound);
+
+// Also run on the loading worker by APP_PrepareStreamedSound(), so errors are
+// returned instead of exiting.
+static bool APP_ReadyStreamedSound(APP_Sound* sound)
 {
 	if (!SDL_ClearAudioStream(sound->stream)) {
-		APP_SetError("Could not get sound ready for streamed playback");
-		APP_Exit(SDL_APP_FAILURE);
+		return APP_SetError("Could not get sound ready for streamed playback");
 	}
 
 	sound->streamed.pos = 0;
@@ -625,12 +661,10 @@ static void APP_ReadyStreamedSound(APP_Sound* sound)
 
 	if (sound->streamed.leadinData) {
 		if (!APP_RestartStreamingAudioData(sound->streamed.leadinData)) {
-			APP_SetError("Could not get sound ready for streamed playback");
-			APP_Exit(SDL_APP_FAILURE);
+			return APP_SetError("Could not get sound ready for streamed playback");
 		}
 		if (!APP_GetStreamingAudioDataChunk(sound->streamed.leadinData, sound->streamed.chunks, APP_STREAMED_AUDIO_CHUNK_SIZE, &sound->streamed.chunkEnd[0], &sound->streamed.leadinFinished, false)) {
-			APP_SetError("Could not get sound ready for streamed playback");
-			APP_Exit(SDL_APP_FAILURE);
+			return APP_SetError("Could not get sound ready for streamed playback");
 		}
 		sound->streamed.lastChunk[0] = !sound->streamed.mainData && sound->streamed.leadinFinished;
 	}
@@ -639,14 +673,12 @@ static void APP_ReadyStreamedSound(APP_Sound* sound)
 	}
 	if (sound->streamed.mainData) {
 		if (!APP_RestartStreamingAudioData(sound->streamed.mainData)) {
-			APP_SetError("Could not get sound ready for streamed playback");
-			APP_Exit(SDL_APP_FAILURE);
+			return APP_SetError("Could not get sound ready for streamed playback");
 		}
 		if (sound->streamed.leadinFinished) {
 			int mainSize;
 			if (!APP_GetStreamingAudioDataChunk(sound->streamed.mainData, sound->streamed.chunks + sound->streamed.chunkEnd[0], APP_STREAMED_AUDIO_CHUNK_SIZE - sound->streamed.chunkEnd[0], &mainSize, &sound->streamed.mainFinished, sound->looping)) {
-				APP_SetError("Could not get sound ready for streamed playback");
-				APP_Exit(SDL_APP_FAILURE);
+				return APP_SetError("Could not get sound ready for streamed playback");
 			}
 			sound->streamed.chunkEnd[0] += mainSize;
 			sound->streamed.lastChunk[0] = sound->streamed.mainFinished && !sound->looping;
@@ -663,6 +695,27 @@ static void APP_ReadyStreamedSound(APP_Sound* sound)
 	if (!sound->streamed.lastChunk[0]) {
 		SDL_SignalSemaphore(sound->streamed.wakeStreamer);
 	}
+	return true;
+}
+
+static bool APP_PrepareStreamedSoundCallback(void* userdata)
+{
+	return APP_ReadyStreamedSound(userdata);
+}
+
+// Waits for a prepare job on the loading worker, if any, after which the sound
+// may be used from the main thread again.
+static void APP_FinishPreparingSound(APP_Sound* sound)
+{
+	if (!sound->prepareJob) {
+		return;
+	}
+	const APP_WorkerJobID job = sound->prepareJob;
+	sound->prepareJob = 0;
+	if (!APP_WaitWorkerJob(APP_LoadingWorker, job)) {
+		APP_SetError("Could not get sound ready for streamed playback: %s", SDL_GetError());
+		APP_Exit(SDL_APP_FAILURE);
+	}
 }
 
 static void APP_StartStreamedSound(APP_Sound* sound, bool resume)
@@ -671,25 +724,68 @@ static void APP_StartStreamedSound(APP_Sound* sound, bool resume)
 		return;
 	}
 
+	APP_MarkMemoryBusyFrame();
+	APP_FinishPreparingSound(sound);
 	SDL_UnbindAudioStream(sound->stream);
-	if (!resume) {
-		APP_ReadyStreamedSound(sound);
+	// A sound already readied by APP_PrepareStreamedSound() has its first
+	// chunk decoded, so playback starts without doing any decoding here.
+	if (!resume && !sound->prepared && !APP_ReadyStreamedSound(sound)) {
+		APP_Exit(SDL_APP_FAILURE);
 	}
+	sound->prepared = false;
 	sound->paused = false;
 	sound->playing = true;
-	if (!SDL_BindAudioStream(APP_AudioDevice, sound->stream)) {
+	if (!APP_BindSound(sound)) {
 		APP_SetError("Could not start sound playback: %s", SDL_GetError());
 		APP_Exit(SDL_APP_FAILURE);
 	}
 }
 
+static void APP_PrepareStreamedSound(APP_Sound* sound)
+{
+	if (sound->prepared || sound->paused || APP_IsSoundPlaying(sound)) {
+		return;
+	}
+
+	APP_MarkMemoryBusyFrame();
+	sound->prepared = true;
+	// The first chunk is decoded on the loading worker, so the frame asking
+	// for it doesn't wait on the decoder. The sound isn't playing, so the
+	// audio callback doesn't touch it meanwhile; the main thread waits for the
+	// job before starting, or changing the looping of, the sound. The stream
+	// is bound again when the sound is started.
+	SDL_UnbindAudioStream(sound->stream);
+	if (APP_LoadingWorker) {
+		sound->prepareJob = APP_SubmitWorkerJob(APP_LoadingWorker, APP_PrepareStreamedSoundCallback, sound);
+		if (sound->prepareJob) {
+			return;
+		}
+	}
+	if (!APP_ReadyStreamedSound(sound) || !APP_BindSound(sound)) {
+		APP_SetError("Could not prepare sound playback: %s", SDL_GetError());
+		APP_Exit(SDL_APP_FAILURE);
+	}
+}
+
 static void APP_StopStreamedSound(APP_Sound* sound)
 {
+	// Stopping doesn't ready the sound for playback again; that's deferred to
+	// the next start or prepare, so stopping many idle sounds at once (like
+	// all the BGM waves) costs no decoding.
+	if (!sound->paused && !APP_IsSoundPlaying(sound)) {
+		return;
+	}
+
+	APP_MarkMemoryBusyFrame();
 	SDL_UnbindAudioStream(sound->stream);
-	APP_ReadyStreamedSound(sound);
+	if (!SDL_ClearAudioStream(sound->stream)) {
+		APP_SetError("Could not stop sound playback: %s", SDL_GetError());
+		APP_Exit(SDL_APP_FAILURE);
+	}
+	sound->prepared = false;
 	sound->paused = false;
 	sound->playing = false;
-	if (!SDL_BindAudioStream(APP_AudioDevice, sound->stream)) {
+	if (!APP_BindSound(sound)) {
 		APP_SetError("Could not stop sound playback: %s", SDL_GetError());
 		APP_Exit(SDL_APP_FAILURE);
 	}
@@ -736,6 +832,7 @@ static void APP_SetSoundVolume(APP_Sound* sound, int volume)
 
 static void APP_SetSoundLooping(APP_Sound* sound, bool looping)
 {
+	APP_FinishPreparingSound(sound);
 	if (!SDL_LockAudioStream(sound->stream)) {
 		APP_SetError("Could not set sound looping state: %s", SDL_GetError());
 		APP_Exit(SDL_APP_FAILURE);
@@ -789,6 +886,17 @@ static void APP_StartWave(int num, bool resume)
 	}
 }
 
+void APP_PrepareWave(int num)
+{
+	if (num < 0 || num >= APP_WavesCount) {
+		return;
+	}
+
+	if (APP_Waves[num].loaded && APP_Waves[num].streaming) {
+		APP_PrepareStreamedSound(&APP_Waves[num]);
+	}
+}
+
 void APP_PlayWave(int num)
 {
 	if (num < APP_WavesCount) {
@@ -954,3 +1062,54 @@ void APP_SetMusicVolume(int volume)
 		APP_SetSoundVolume(&APP_Music, volume);
 	}
 }
+
+#ifdef APP_REPLAY_RENDER
+const SDL_AudioSpec* APP_GetAudioFormat(void)
+{
+	return &APP_AudioDeviceFormat;
+}
+
+static bool APP_MixSound(APP_Sound* sound, uint8_t* buffer, int size)
+{
+	uint8_t data[4096];
+	int mixed = 0;
+	while (mixed < size) {
+		const int got = SDL_GetAudioStreamData(sound->stream, data, SDL_min(size - mixed, (int)sizeof(data)));
+		if (got < 0) {
+			return APP_SetError("Could not mix sound: %s", SDL_GetError());
+		}
+		else if (got == 0) {
+			// A streamed sound gives nothing while its next chunk is still
+			// being decoded, which in real time would be an audible skip. As
+			// nothing waits on offline rendering, wait for the chunk instead.
+			if (sound->loaded && sound->streaming && APP_IsSoundPlaying(sound)) {
+				if (APP_WasAudioStreamingError()) {
+					return APP_SetError("Failed streaming audio from storage");
+				}
+				SDL_Delay(1);
+				continue;
+			}
+			break;
+		}
+		if (!SDL_MixAudio(buffer + mixed, data, APP_AudioDeviceFormat.format, (Uint32)got, 1.0f)) {
+			return APP_SetError("Could not mix sound: %s", SDL_GetError());
+		}
+		mixed += got;
+	}
+	return true;
+}
+
+bool APP_MixAudio(uint8_t* buffer, int size)
+{
+	SDL_memset(buffer, 0, size);
+	if (!APP_WasAudioInit) {
+		return true;
+	}
+	for (int i = 0; i < APP_WavesCount; i++) {
+		if (APP_Waves[i].loaded && !APP_MixSound(&APP_Waves[i], buffer, size)) {
+			return false;
+		}
+	}
+	return !APP_Music.loaded || APP_MixSound(&APP_Music, buffer, size);
+}
+#endif
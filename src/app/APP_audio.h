@@ -30,6 +30,11 @@ bool APP_WasAudioStreamingError(void);
 // Load a wave. Does not support APP_WAVE_NUM_ALL.
 void APP_LoadWave(int num, const char* leadinFilename, const char* mainFilename, bool looping, bool streaming);
 
+// Get a stopped wave ready to play ahead of time, so a following
+// APP_PlayWave() starts it immediately, without decoding on that call. Does not
+// support APP_WAVE_NUM_ALL.
+void APP_PrepareWave(int num);
+
 // Play waves. APP_WAVE_NUM_ALL plays all waves.
 void APP_PlayWave(int num);
 
@@ -73,4 +78,13 @@ bool APP_IsMusicPlaying(void);
 // Set music volume.
 void APP_SetMusicVolume(int volume);
 
+#ifdef APP_REPLAY_RENDER
+// The format of all audio; signed 16-bit stereo for offline rendering.
+const SDL_AudioSpec* APP_GetAudioFormat(void);
+
+// Mixes the next size bytes of all playing sounds into buffer, replacing its
+// contents. Sounds only advance when mixed.
+bool APP_MixAudio(uint8_t* buffer, int size);
+#endif
+
 #endif
@@ -35,8 +35,18 @@
 
 #cmakedefine APP_ENABLE_QUIT
 
+#cmakedefine APP_ENABLE_FRAME_CAPTURE
+
 #cmakedefine APP_RESOURCE_DAT
 
 #cmakedefine APP_SET_WINDOW_ICON
 
+#cmakedefine APP_REPLAY_BENCHMARK
+
+#cmakedefine APP_REPLAY_RENDER
+
+#cmakedefine APP_ENABLE_MEMORY_TRACKING
+
+#cmakedefine APP_USE_WORKER_THREADS
+
 #endif
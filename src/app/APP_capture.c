@@ -0,0 +1,264 @@
+#include "APP_capture.h"
+#include "APP_global.h"
+#include "APP_filesystem.h"
+#include "APP_error.h"
+#include "APP_main.h"
+#include "APP_memory.h"
+#include <SDL3_image/SDL_image.h>
+
+// How many read back frames may wait for the capture threads. Frames past this
+// are dropped.
+#define APP_CAPTURE_QUEUE_SIZE 16
+
+#define APP_CAPTURE_THREADS_MAX 4
+
+typedef struct APP_CaptureJob
+{
+	SDL_Surface* surface;
+	int index;
+} APP_CaptureJob;
+
+static bool APP_Capturing = false;
+static int APP_CaptureInterval;
+static int APP_CaptureFrames;
+static SDL_Rect APP_CaptureRect;
+static int APP_CaptureNextIndex = 0;
+
+static SDL_Mutex* APP_CaptureLock = NULL;
+static SDL_Condition* APP_CaptureQueued = NULL;
+static APP_CaptureJob APP_CaptureQueue[APP_CAPTURE_QUEUE_SIZE];
+static int APP_CaptureQueueHead = 0;
+static int APP_CaptureQueueCount = 0;
+static int APP_CaptureDropped = 0;
+static bool APP_CaptureShutdown = false;
+static SDL_Thread* APP_CaptureThreads[APP_CAPTURE_THREADS_MAX] = { 0 };
+static int APP_CaptureThreadCount = 0;
+
+static bool APP_WriteCaptureFile(const APP_CaptureJob* job)
+{
+	char filename[32];
+	SDL_snprintf(filename, sizeof(filename), "cap/hc%06d.png", job->index);
+	SDL_IOStream* const file = APP_OpenWrite(filename);
+	if (!file) {
+		return false;
+	}
+	return IMG_SavePNG_IO(job->surface, file, true);
+}
+
+static int SDLCALL APP_CaptureThreadFunction(void* data)
+{
+	(void)data;
+	SDL_LockMutex(APP_CaptureLock);
+	while (true) {
+		while (APP_CaptureQueueCount == 0 && !APP_CaptureShutdown) {
+			SDL_WaitCondition(APP_CaptureQueued, APP_CaptureLock);
+		}
+		// The queue is drained before shutting down, so no frame that was
+		// already read back is lost.
+		if (APP_CaptureQueueCount == 0) {
+			break;
+		}
+		const APP_CaptureJob job = APP_CaptureQueue[APP_CaptureQueueHead];
+		APP_CaptureQueueHead = (APP_CaptureQueueHead + 1) % APP_CAPTURE_QUEUE_SIZE;
+		APP_CaptureQueueCount--;
+		SDL_UnlockMutex(APP_CaptureLock);
+
+		const bool written = APP_WriteCaptureFile(&job);
+		SDL_DestroySurface(job.surface);
+
+		SDL_LockMutex(APP_CaptureLock);
+		if (!written) {
+			APP_CaptureDropped++;
+		}
+	}
+	SDL_UnlockMutex(APP_CaptureLock);
+	return 0;
+}
+
+static bool APP_StartCaptureThreads(void)
+{
+	if (APP_CaptureThreadCount > 0) {
+		return true;
+	}
+
+	APP_CaptureLock = SDL_CreateMutex();
+	if (!APP_CaptureLock) {
+		return APP_SetError("Failed to start capture threads: %s", SDL_GetError());
+	}
+	APP_CaptureQueued = SDL_CreateCondition();
+	if (!APP_CaptureQueued) {
+		APP_SetError("Failed to start capture threads: %s", SDL_GetError());
+		SDL_DestroyMutex(APP_CaptureLock);
+		APP_CaptureLock = NULL;
+		return false;
+	}
+	APP_CaptureShutdown = false;
+
+	// Leave at least half of the cores to the game and the loading worker.
+	int threadsCount = SDL_GetNumLogicalCPUCores() / 2;
+	if (threadsCount < 1) {
+		threadsCount = 1;
+	}
+	else if (threadsCount > APP_CAPTURE_THREADS_MAX) {
+		threadsCount = APP_CAPTURE_THREADS_MAX;
+	}
+	for (int i = 0; i < threadsCount; i++) {
+		APP_CaptureThreads[i] = SDL_CreateThread(APP_CaptureThreadFunction, "APP_CaptureThreadFunction", NULL);
+		if (!APP_CaptureThreads[i]) {
+			if (i == 0) {
+				APP_SetError("Failed to start capture threads: %s", SDL_GetError());
+				SDL_DestroyCondition(APP_CaptureQueued);
+				APP_CaptureQueued = NULL;
+				SDL_DestroyMutex(APP_CaptureLock);
+				APP_CaptureLock = NULL;
+				return false;
+			}
+			// Fewer threads than wanted still work.
+			break;
+		}
+		APP_CaptureThreadCount++;
+	}
+	return true;
+}
+
+static void APP_QueueCaptureSurface(SDL_Surface* surface)
+{
+	SDL_LockMutex(APP_CaptureLock);
+	if (APP_CaptureQueueCount == APP_CAPTURE_QUEUE_SIZE) {
+		APP_CaptureDropped++;
+		SDL_UnlockMutex(APP_CaptureLock);
+		SDL_DestroySurface(surface);
+		return;
+	}
+	APP_CaptureJob* const job = &APP_CaptureQueue[(APP_CaptureQueueHead + APP_CaptureQueueCount) % APP_CAPTURE_QUEUE_SIZE];
+	job->surface = surface;
+	job->index = APP_CaptureNextIndex++;
+	APP_CaptureQueueCount++;
+	SDL_SignalCondition(APP_CaptureQueued);
+	SDL_UnlockMutex(APP_CaptureLock);
+}
+
+bool APP_StartCapture(int interval, int x, int y, int w, int h, int firstIndex)
+{
+#ifndef APP_ENABLE_FRAME_CAPTURE
+	(void)interval;
+	(void)x;
+	(void)y;
+	(void)w;
+	(void)h;
+	(void)firstIndex;
+	return APP_SetError("Frame capture is disabled in this build");
+#else
+	if (APP_Capturing) {
+		APP_StopCapture();
+	}
+	if (!APP_ScreenRenderer) {
+		return APP_SetError("Renderer is not initialized");
+	}
+
+	int screenW, screenH;
+	if (APP_ScreenRenderTarget) {
+		float targetW, targetH;
+		if (!SDL_GetTextureSize(APP_ScreenRenderTarget, &targetW, &targetH)) {
+			return APP_SetError("Could not get render target texture size: %s", SDL_GetError());
+		}
+		screenW = (int)targetW;
+		screenH = (int)targetH;
+	}
+	else if (!SDL_GetRenderLogicalPresentation(APP_ScreenRenderer, &screenW, &screenH, NULL)) {
+		return APP_SetError("Could not get render dimensions: %s", SDL_GetError());
+	}
+	const SDL_Rect screenRect = { 0, 0, screenW, screenH };
+	const SDL_Rect rect = { x, y, w, h };
+	if (!SDL_GetRectIntersection(&rect, &screenRect, &APP_CaptureRect)) {
+		return APP_SetError("Capture rectangle is outside the screen");
+	}
+
+	if (!APP_StartCaptureThreads()) {
+		return false;
+	}
+
+	SDL_LockMutex(APP_CaptureLock);
+	APP_CaptureDropped = 0;
+	SDL_UnlockMutex(APP_CaptureLock);
+
+	APP_CaptureInterval = interval > 0 ? interval : 1;
+	APP_CaptureFrames = 0;
+	APP_CaptureNextIndex = firstIndex;
+	APP_Capturing = true;
+	return true;
+#endif
+}
+
+int APP_StopCapture(void)
+{
+	if (!APP_Capturing) {
+		return APP_CaptureNextIndex;
+	}
+
+	APP_Capturing = false;
+
+	const int dropped = APP_GetCaptureDroppedFrames();
+	if (dropped > 0) {
+		SDL_Log("Frame capture dropped %d frames", dropped);
+	}
+	return APP_CaptureNextIndex;
+}
+
+bool APP_IsCapturing(void)
+{
+	return APP_Capturing;
+}
+
+int APP_GetCaptureDroppedFrames(void)
+{
+	if (!APP_CaptureLock) {
+		return 0;
+	}
+	SDL_LockMutex(APP_CaptureLock);
+	const int dropped = APP_CaptureDropped;
+	SDL_UnlockMutex(APP_CaptureLock);
+	return dropped;
+}
+
+void APP_CaptureFrame(void)
+{
+	if (!APP_Capturing || APP_CaptureFrames++ % APP_CaptureInterval != 0) {
+		return;
+	}
+
+	// SDL_RenderReadPixels() flushes the render queue and waits for the GPU
+	// to finish this frame, so the game stalls for that long on each captured
+	// frame. Only encoding and writing are left to the capture threads.
+	// The read back surface is allocated here, so the frame isn't steady.
+	APP_MarkMemoryBusyFrame();
+	const APP_MemoryTag memoryTag = APP_SetMemoryTag(APP_MEMORY_VIDEO);
+	SDL_Surface* const surface = SDL_RenderReadPixels(APP_ScreenRenderer, &APP_CaptureRect);
+	if (!surface) {
+		APP_SetError("Failed reading back captured frame: %s", SDL_GetError());
+		APP_Exit(SDL_APP_FAILURE);
+	}
+	APP_QueueCaptureSurface(surface);
+	APP_SetMemoryTag(memoryTag);
+}
+
+void APP_QuitCapture(void)
+{
+	APP_StopCapture();
+
+	if (APP_CaptureThreadCount > 0) {
+		SDL_LockMutex(APP_CaptureLock);
+		APP_CaptureShutdown = true;
+		SDL_BroadcastCondition(APP_CaptureQueued);
+		SDL_UnlockMutex(APP_CaptureLock);
+		for (int i = 0; i < APP_CaptureThreadCount; i++) {
+			SDL_WaitThread(APP_CaptureThreads[i], NULL);
+			APP_CaptureThreads[i] = NULL;
+		}
+		APP_CaptureThreadCount = 0;
+		SDL_DestroyCondition(APP_CaptureQueued);
+		APP_CaptureQueued = NULL;
+		SDL_DestroyMutex(APP_CaptureLock);
+		APP_CaptureLock = NULL;
+	}
+}
@@ -0,0 +1,42 @@
+#ifndef APP_capture_h_
+#define APP_capture_h_
+
+#include "APP_stdinc.h"
+
+// Continuous frame capture. Captured frames are written as PNG files named
+// "cap/hc%06d.png" in the write directory.
+//
+// Capture costs one GPU sync per captured frame: each captured frame's
+// rectangle is read back to the CPU synchronously, which stalls the game until
+// the GPU has finished rendering that frame, as SDL's renderer has no
+// asynchronous readback. Lower the interval's frequency to lower the cost.
+// Encoding and writing are done on capture threads; when their queue is full,
+// frames are dropped and counted instead of stalling the game further.
+//
+// Each captured frame allocates its surface, so captured frames are marked
+// busy for memory tracking. Builds without APP_ENABLE_FRAME_CAPTURE can't start
+// capturing.
+
+// Starts capturing every interval'th frame, of the rectangle in logical screen
+// pixels, numbering files from firstIndex. Returns false if capture couldn't
+// be started.
+bool APP_StartCapture(int interval, int x, int y, int w, int h, int firstIndex);
+
+// Stops capturing. Frames already queued continue to be written in the
+// background. Returns the index for the next captured file.
+int APP_StopCapture(void);
+
+bool APP_IsCapturing(void);
+
+// The number of frames dropped because the capture queue was full, since
+// capture was last started.
+int APP_GetCaptureDroppedFrames(void);
+
+// Called by APP_Update() before presenting, with the screen render target
+// still set.
+void APP_CaptureFrame(void);
+
+// Stops capturing, and waits for all queued frames to be written.
+void APP_QuitCapture(void);
+
+#endif
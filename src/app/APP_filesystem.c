@@ -1,11 +1,25 @@
 #include "APP_filesystem.h"
 #include "APP_main.h"
 #include "APP_error.h"
+#include "APP_memory.h"
+#include "APP_global.h"
+#if defined(SDL_PLATFORM_WINDOWS)
+#include <windows.h>
+#elif defined(SDL_PLATFORM_UNIX) || defined(SDL_PLATFORM_APPLE)
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 static char* APP_PrefPath = NULL;
 
+static void APP_QuitSaveFiles(void);
+
 static SDL_IOStream* APP_OpenFromPath(const char* path, const char* filename, const char* mode)
 {
+	const APP_MemoryTag memoryTag = APP_SetMemoryTag(APP_MEMORY_FILESYSTEM);
 	char* fullPath;
 	if (SDL_asprintf(&fullPath, "%s%s", path, filename) < 0) {
 		APP_SetError("Error allocating string to open a file");
@@ -14,12 +28,8 @@ static SDL_IOStream* APP_OpenFromPath(const char* path, const char* filename, co
 
 	SDL_IOStream* file = SDL_IOFromFile(fullPath, mode);
 	SDL_free(fullPath);
-	if (file) {
-		return file;
-	}
-	else {
-		return NULL;
-	}
+	APP_SetMemoryTag(memoryTag);
+	return file;
 }
 
 #ifdef APP_RESOURCE_DAT
@@ -186,6 +196,7 @@ bool APP_InitFilesystem(int argc, char** argv)
 
 bool APP_FileExists(const char* filename)
 {
+	const APP_MemoryTag memoryTag = APP_SetMemoryTag(APP_MEMORY_FILESYSTEM);
 	char* path;
 	SDL_PathInfo info;
 
@@ -193,13 +204,11 @@ bool APP_FileExists(const char* filename)
 		APP_SetError("Error allocating string to check if file \"%s\" exists", filename);
 		APP_Exit(SDL_APP_FAILURE);
 	}
-	if (SDL_GetPathInfo(path, &info) && info.type == SDL_PATHTYPE_FILE) {
-		SDL_free(path);
-		return true;
-	}
+	const bool exists = SDL_GetPathInfo(path, &info) && info.type == SDL_PATHTYPE_FILE;
 	SDL_free(path);
+	APP_SetMemoryTag(memoryTag);
 
-	return SDL_HasProperty(APP_FilesTable, filename);
+	return exists || SDL_HasProperty(APP_FilesTable, filename);
 }
 
 static int64_t SDLCALL APP_DATFileSize(void* userdata)
@@ -345,6 +354,8 @@ SDL_IOStream* APP_OpenRead(const char* filename)
 
 void APP_QuitFilesystem(void)
 {
+	APP_QuitSaveFiles();
+
 	SDL_free(APP_FilesDATPath);
 	APP_FilesDATPath = NULL;
 	SDL_free(APP_FilesArray);
@@ -432,6 +443,7 @@ bool APP_InitFilesystem(int argc, char** argv)
 
 bool APP_FileExists(const char* filename)
 {
+	const APP_MemoryTag memoryTag = APP_SetMemoryTag(APP_MEMORY_FILESYSTEM);
 	char* path;
 	SDL_PathInfo info;
 
@@ -439,23 +451,20 @@ bool APP_FileExists(const char* filename)
 		APP_SetError("Error allocating string to check if file \"%s\" exists", filename);
 		APP_Exit(SDL_APP_FAILURE);
 	}
-	if (SDL_GetPathInfo(path, &info) && info.type == SDL_PATHTYPE_FILE) {
-		SDL_free(path);
-		return true;
-	}
+	bool exists = SDL_GetPathInfo(path, &info) && info.type == SDL_PATHTYPE_FILE;
 	SDL_free(path);
 
-	if (SDL_asprintf(&path, "%s%s", APP_BasePath, filename) < 0) {
-		APP_SetError("Error allocating string to check if file \"%s\" exists", filename);
-		APP_Exit(SDL_APP_FAILURE);
-	}
-	if (SDL_GetPathInfo(path, &info) && info.type == SDL_PATHTYPE_FILE) {
+	if (!exists) {
+		if (SDL_asprintf(&path, "%s%s", APP_BasePath, filename) < 0) {
+			APP_SetError("Error allocating string to check if file \"%s\" exists", filename);
+			APP_Exit(SDL_APP_FAILURE);
+		}
+		exists = SDL_GetPathInfo(path, &info) && info.type == SDL_PATHTYPE_FILE;
 		SDL_free(path);
-		return true;
 	}
-	SDL_free(path);
 
-	return false;
+	APP_SetMemoryTag(memoryTag);
+	return exists;
 }
 
 SDL_IOStream* APP_OpenRead(const char* filename)
@@ -469,6 +478,8 @@ SDL_IOStream* APP_OpenRead(const char* filename)
 
 void APP_QuitFilesystem(void)
 {
+	APP_QuitSaveFiles();
+
 #ifdef SDL_PLATFORM_EMSCRIPTEN
 	EM_ASM({
 		FS.syncfs(function (err) {
@@ -611,3 +622,315 @@ void APP_AppendFile32(const char* filename, int32_t* values, size_t count)
 
 	APP_Swap32ArrayLEToNative(values, count);
 }
+
+typedef struct APP_SaveFile
+{
+	char* filename;
+	// Held while the file is being written, so writes of the same file
+	// don't overlap.
+	SDL_Mutex* writeLock;
+	// The newest values, in native byte order. NULL if the file doesn't
+	// exist and hasn't been saved.
+	int32_t* values;
+	size_t count;
+	bool writeQueued;
+} APP_SaveFile;
+
+// Guards the values of all save files, which both the main thread and the
+// loading worker access. The array itself is only used on the main thread.
+static SDL_Mutex* APP_SaveFilesLock = NULL;
+static APP_SaveFile** APP_SaveFiles = NULL;
+static size_t APP_SaveFileCount = 0;
+
+static APP_SaveFile* APP_GetSaveFile(const char* filename)
+{
+	for (size_t i = 0; i < APP_SaveFileCount; i++) {
+		if (SDL_strcmp(APP_SaveFiles[i]->filename, filename) == 0) {
+			return APP_SaveFiles[i];
+		}
+	}
+	return NULL;
+}
+
+static APP_SaveFile* APP_AddSaveFile(const char* filename)
+{
+	if (!APP_SaveFilesLock) {
+		APP_SaveFilesLock = SDL_CreateMutex();
+		if (!APP_SaveFilesLock) {
+			APP_SetError("Failed creating the save files lock: %s", SDL_GetError());
+			APP_Exit(SDL_APP_FAILURE);
+		}
+	}
+
+	APP_SaveFile** const saveFiles = SDL_realloc(APP_SaveFiles, (APP_SaveFileCount + 1) * sizeof(APP_SaveFile*));
+	if (!saveFiles) {
+		APP_SetError("Failed allocating the save files array");
+		APP_Exit(SDL_APP_FAILURE);
+	}
+	APP_SaveFiles = saveFiles;
+
+	APP_SaveFile* const saveFile = SDL_calloc(1, sizeof(APP_SaveFile));
+	if (!saveFile) {
+		APP_SetError("Failed allocating save file \"%s\"", filename);
+		APP_Exit(SDL_APP_FAILURE);
+	}
+	saveFile->filename = SDL_strdup(filename);
+	saveFile->writeLock = SDL_CreateMutex();
+	if (!saveFile->filename || !saveFile->writeLock) {
+		APP_SetError("Failed creating save file \"%s\"", filename);
+		APP_Exit(SDL_APP_FAILURE);
+	}
+	APP_SaveFiles[APP_SaveFileCount++] = saveFile;
+	return saveFile;
+}
+
+static void APP_QuitSaveFiles(void)
+{
+	// The loading worker has been destroyed by now, so all writes have
+	// finished.
+	for (size_t i = 0; i < APP_SaveFileCount; i++) {
+		SDL_free(APP_SaveFiles[i]->filename);
+		SDL_DestroyMutex(APP_SaveFiles[i]->writeLock);
+		SDL_free(APP_SaveFiles[i]->values);
+		SDL_free(APP_SaveFiles[i]);
+	}
+	SDL_free(APP_SaveFiles);
+	APP_SaveFiles = NULL;
+	APP_SaveFileCount = 0;
+	SDL_DestroyMutex(APP_SaveFilesLock);
+	APP_SaveFilesLock = NULL;
+}
+
+size_t APP_LoadFile32(const char* filename, int32_t* values, size_t count)
+{
+	const APP_MemoryTag memoryTag = APP_SetMemoryTag(APP_MEMORY_FILESYSTEM);
+	APP_SaveFile* saveFile = APP_GetSaveFile(filename);
+	if (!saveFile) {
+		saveFile = APP_AddSaveFile(filename);
+
+		SDL_IOStream* src = APP_OpenRead(filename);
+		if (src) {
+			size_t size;
+			void* const data = SDL_LoadFile_IO(src, &size, true);
+			if (!data) {
+				APP_SetError("Error reading file \"%s\": %s", filename, SDL_GetError());
+				APP_Exit(SDL_APP_FAILURE);
+			}
+			saveFile->values = data;
+			saveFile->count = size / sizeof(int32_t);
+			APP_Swap32ArrayLEToNative(saveFile->values, saveFile->count);
+		}
+	}
+	APP_SetMemoryTag(memoryTag);
+
+	// No write changes the values, only saves on this thread do, so they can
+	// be read without the lock.
+	const size_t loaded = SDL_min(count, saveFile->count);
+	if (loaded > 0) {
+		SDL_memcpy(values, saveFile->values, loaded * sizeof(int32_t));
+	}
+	if (loaded < count) {
+		SDL_memset(values + loaded, 0, (count - loaded) * sizeof(int32_t));
+	}
+	return loaded;
+}
+
+// Flushes the written data of the file out of the OS's cache onto the disk.
+// Without this, the rename can reach the disk before the data does, so a
+// power loss could leave an empty file in place of the previous one.
+static bool APP_SyncFile(SDL_IOStream* file)
+{
+	const SDL_PropertiesID props = SDL_GetIOProperties(file);
+#if defined(SDL_PLATFORM_WINDOWS)
+	HANDLE handle = SDL_GetPointerProperty(props, SDL_PROP_IOSTREAM_WINDOWS_HANDLE_POINTER, NULL);
+	if (handle && !FlushFileBuffers(handle)) {
+		return APP_SetError("FlushFileBuffers failed with error %lu", (unsigned long)GetLastError());
+	}
+#elif defined(SDL_PLATFORM_UNIX) || defined(SDL_PLATFORM_APPLE)
+	FILE* fp = SDL_GetPointerProperty(props, SDL_PROP_IOSTREAM_STDIO_FILE_POINTER, NULL);
+	if (fp && fsync(fileno(fp)) < 0) {
+		return APP_SetError("fsync failed: %s", strerror(errno));
+	}
+#else
+	(void)props;
+#endif
+	return true;
+}
+
+// Flushes the directory containing the path, so a rename into it is on the
+// disk too. Only POSIX systems support this; elsewhere, it does nothing.
+static bool APP_SyncDirectory(const char* path)
+{
+#if defined(SDL_PLATFORM_UNIX) || defined(SDL_PLATFORM_APPLE)
+	const char* const slash = SDL_strrchr(path, '/');
+	if (!slash) {
+		return true;
+	}
+	char* directory;
+	if (SDL_asprintf(&directory, "%.*s", (int)(slash - path + 1), path) < 0) {
+		return APP_SetError("Error allocating string to sync directory of \"%s\"", path);
+	}
+	const int fd = open(directory, O_RDONLY);
+	SDL_free(directory);
+	if (fd < 0) {
+		// A directory that can't be opened can't be synced, but the
+		// rename itself succeeded.
+		return true;
+	}
+	// Some filesystems don't support syncing directories, with EINVAL.
+	const bool success = fsync(fd) == 0 || errno == EINVAL;
+	if (!success) {
+		APP_SetError("fsync failed: %s", strerror(errno));
+	}
+	close(fd);
+	return success;
+#else
+	(void)path;
+	return true;
+#endif
+}
+
+// Writes the data into a temporary file, syncs it to the disk, then replaces
+// the file with it. If writing is interrupted, the previous file is still
+// intact.
+static bool APP_WriteFileReplacing(const char* filename, const void* data, size_t size)
+{
+	char* path;
+	char* tempPath;
+	if (SDL_asprintf(&path, "%s%s", APP_PrefPath, filename) < 0) {
+		return APP_SetError("Error allocating string to write file \"%s\"", filename);
+	}
+	if (SDL_asprintf(&tempPath, "%s.tmp", path) < 0) {
+		SDL_free(path);
+		return APP_SetError("Error allocating string to write file \"%s\"", filename);
+	}
+
+	SDL_IOStream* dst = SDL_IOFromFile(tempPath, "wb");
+	if (!dst) {
+		// Like APP_WriteFile32(), a file that can't be opened is skipped.
+		SDL_free(tempPath);
+		SDL_free(path);
+		return true;
+	}
+
+	bool success = SDL_WriteIO(dst, data, size) == size && SDL_FlushIO(dst);
+	if (!success) {
+		APP_SetError("Error writing file \"%s\": %s", filename, SDL_GetError());
+		SDL_CloseIO(dst);
+	}
+	else if (!APP_SyncFile(dst)) {
+		success = APP_SetError("Error syncing file \"%s\": %s", filename, SDL_GetError());
+		SDL_CloseIO(dst);
+	}
+	else if (!SDL_CloseIO(dst)) {
+		success = APP_SetError("Error closing file \"%s\": %s", filename, SDL_GetError());
+	}
+	else if (!SDL_RenamePath(tempPath, path)) {
+		success = APP_SetError("Error replacing file \"%s\": %s", filename, SDL_GetError());
+	}
+	else if (!APP_SyncDirectory(path)) {
+		// The file was replaced, so the temporary file is already gone.
+		APP_SetError("Error syncing directory of file \"%s\": %s", filename, SDL_GetError());
+		SDL_free(tempPath);
+		SDL_free(path);
+		return false;
+	}
+	if (!success) {
+		SDL_RemovePath(tempPath);
+	}
+
+	SDL_free(tempPath);
+	SDL_free(path);
+	return success;
+}
+
+static bool APP_WriteSaveFile(APP_SaveFile* saveFile)
+{
+	SDL_LockMutex(saveFile->writeLock);
+
+	// Saves made after this point queue another write.
+	SDL_LockMutex(APP_SaveFilesLock);
+	saveFile->writeQueued = false;
+	const size_t count = saveFile->count;
+	int32_t* const values = SDL_malloc(SDL_max(count, 1) * sizeof(int32_t));
+	if (values && count > 0) {
+		SDL_memcpy(values, saveFile->values, count * sizeof(int32_t));
+	}
+	SDL_UnlockMutex(APP_SaveFilesLock);
+
+	bool success;
+	if (!values) {
+		success = APP_SetError("Failed allocating data to write file \"%s\"", saveFile->filename);
+	}
+	else {
+		APP_Swap32ArrayNativeToLE(values, count);
+		success = APP_WriteFileReplacing(saveFile->filename, values, count * sizeof(int32_t));
+		SDL_free(values);
+	}
+
+	SDL_UnlockMutex(saveFile->writeLock);
+	return success;
+}
+
+// A failed write is only logged, as failing the job would fail whichever
+// unrelated wait on the loading worker comes next. The values are still kept
+// in memory, and the next save of the file tries writing it again.
+static bool APP_WriteSaveFileCallback(void* userdata)
+{
+	APP_SaveFile* const saveFile = userdata;
+	if (!APP_WriteSaveFile(saveFile)) {
+		SDL_Log("Failed saving file \"%s\": %s", saveFile->filename, SDL_GetError());
+	}
+	return true;
+}
+
+void APP_SaveFile32(const char* filename, const int32_t* values, size_t count)
+{
+	const APP_MemoryTag memoryTag = APP_SetMemoryTag(APP_MEMORY_FILESYSTEM);
+	APP_SaveFile* saveFile = APP_GetSaveFile(filename);
+	if (!saveFile) {
+		saveFile = APP_AddSaveFile(filename);
+	}
+
+	SDL_LockMutex(APP_SaveFilesLock);
+	if (count != saveFile->count || !saveFile->values) {
+		int32_t* const newValues = SDL_realloc(saveFile->values, SDL_max(count, 1) * sizeof(int32_t));
+		if (!newValues) {
+			SDL_UnlockMutex(APP_SaveFilesLock);
+			APP_SetError("Failed allocating data to save file \"%s\"", filename);
+			APP_Exit(SDL_APP_FAILURE);
+		}
+		saveFile->values = newValues;
+		saveFile->count = count;
+	}
+	if (count > 0) {
+		SDL_memcpy(saveFile->values, values, count * sizeof(int32_t));
+	}
+	const bool writeQueued = saveFile->writeQueued;
+	saveFile->writeQueued = true;
+	SDL_UnlockMutex(APP_SaveFilesLock);
+	APP_SetMemoryTag(memoryTag);
+
+	// A write that hasn't started yet will write the values just saved.
+	if (writeQueued) {
+		return;
+	}
+
+	if (!APP_LoadingWorker) {
+		APP_WriteSaveFileCallback(saveFile);
+		return;
+	}
+	const APP_WorkerJobID job = APP_SubmitWorkerJob(APP_LoadingWorker, APP_WriteSaveFileCallback, saveFile);
+	if (!job) {
+		APP_SetError("Failed saving file \"%s\": %s", filename, SDL_GetError());
+		APP_Exit(SDL_APP_FAILURE);
+	}
+#ifndef APP_USE_WORKER_THREADS
+	// Without worker threads, jobs only run when waited for, so the file is
+	// written now rather than whenever loading next waits.
+	if (!APP_WaitWorkerJob(APP_LoadingWorker, job)) {
+		APP_SetError("%s", SDL_GetError());
+		APP_Exit(SDL_APP_FAILURE);
+	}
+#endif
+}
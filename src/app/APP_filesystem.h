@@ -17,6 +17,24 @@ void APP_ReadFile32(const char* filename, int32_t* values, size_t count, size_t
 void APP_WriteFile32(const char* filename, int32_t* values, size_t count);
 void APP_AppendFile32(const char* filename, int32_t* values, size_t count);
 
+// Save files are files of 32-bit values that are read from disk only once,
+// then kept in memory. Saving one snapshots the values and writes them on the
+// loading worker, into a temporary file that then replaces the file, so
+// neither the game loop waits for the disk, nor does an interrupted write
+// leave a broken file. Saving a file again before its previous save started
+// writing only writes the newest values. A failed write is logged instead of
+// exiting, and the file is written again on its next save.
+//
+// Once saved, a file should only be read with APP_LoadFile32(), as the file on
+// disk might not have been written yet.
+
+// Loads up to count values of a save file, zeroing the values past the end of
+// a shorter file. Returns how many values were loaded, which is 0 if the file
+// doesn't exist.
+size_t APP_LoadFile32(const char* filename, int32_t* values, size_t count);
+
+void APP_SaveFile32(const char* filename, const int32_t* values, size_t count);
+
 void APP_QuitFilesystem(void);
 
 #endif
@@ -1,5 +1,6 @@
 #include "APP_input.h"
 #include "APP_error.h"
+#include "APP_memory.h"
 #ifdef APP_ENABLE_GAME_CONTROLLER_DB_FILE
 #include "APP_filesystem.h"
 #endif
@@ -18,6 +19,16 @@ static struct gpiod_line	*APP_GPIOLines[10];
 
 #ifdef APP_ENABLE_KEYBOARD_INPUT
 static int			APP_KeyRepeat[APP_KEY_MAX];
+static bool			APP_KeyHeld[APP_KEY_MAX];
+static bool			APP_KeyLatched[APP_KEY_MAX];
+static Uint64			APP_KeyPushNS[APP_KEY_MAX];
+static Uint64			APP_KeyReleaseNS[APP_KEY_MAX];
+
+// Keys that are held, latched or have a nonzero repeat count. Only these are
+// visited by APP_InputsUpdate(), instead of every scancode.
+static bool			APP_KeyActive[APP_KEY_MAX];
+static int			APP_ActiveKeys[APP_KEY_MAX];
+static int			APP_NumActiveKeys = 0;
 #endif
 
 #ifdef APP_ENABLE_JOYSTICK_INPUT
@@ -30,6 +41,9 @@ typedef struct APP_Joy
 	int* axesRepeat;
 	int* hatsRepeat;
 	int* buttonsRepeat;
+	Uint8* hatsLatched;
+	bool* buttonsLatched;
+	Uint64* buttonsPushNS;
 } APP_Joy;
 #endif
 
@@ -39,6 +53,8 @@ typedef struct APP_Con
 	SDL_Gamepad* controller;
 	int axesRepeat[APP_CONAXIS_MAX];
 	int buttonsRepeat[APP_CONBUTTON_MAX];
+	bool buttonsLatched[APP_CONBUTTON_MAX];
+	Uint64 buttonsPushNS[APP_CONBUTTON_MAX];
 } APP_Con;
 static int APP_LastActiveCon = -1;
 #endif
@@ -126,10 +142,59 @@ int APP_GetMaxKey(void)
 {
 	return APP_KEY_MAX;
 }
+
+Uint64 APP_GetKeyPushTime(int key)
+{
+	return key >= 0 && key < APP_KEY_MAX ? APP_KeyPushNS[key] : 0;
+}
+
+Uint64 APP_GetKeyReleaseTime(int key)
+{
+	return key >= 0 && key < APP_KEY_MAX ? APP_KeyReleaseNS[key] : 0;
+}
+
+static void APP_KeyEvent(const SDL_KeyboardEvent* const event)
+{
+	const int key = event->scancode;
+	if (key < 0 || key >= APP_KEY_MAX || event->repeat) return;
+
+	if (event->down)
+	{
+		if (!APP_KeyHeld[key])
+		{
+			APP_KeyHeld[key] = true;
+			APP_KeyLatched[key] = true;
+			APP_KeyPushNS[key] = event->timestamp;
+		}
+	}
+	else if (APP_KeyHeld[key])
+	{
+		APP_KeyHeld[key] = false;
+		APP_KeyReleaseNS[key] = event->timestamp;
+	}
+
+	if (!APP_KeyActive[key] && APP_KeyHeld[key])
+	{
+		APP_KeyActive[key] = true;
+		APP_ActiveKeys[APP_NumActiveKeys++] = key;
+	}
+}
 #endif
 
 #if defined(APP_ENABLE_JOYSTICK_INPUT) || defined(APP_ENABLE_GAME_CONTROLLER_INPUT)
 
+#ifdef APP_ENABLE_JOYSTICK_INPUT
+static void APP_FreeJoyArrays(APP_Joy* const joy)
+{
+	if (joy->axesRepeat) SDL_free(joy->axesRepeat);
+	if (joy->hatsRepeat) SDL_free(joy->hatsRepeat);
+	if (joy->buttonsRepeat) SDL_free(joy->buttonsRepeat);
+	if (joy->hatsLatched) SDL_free(joy->hatsLatched);
+	if (joy->buttonsLatched) SDL_free(joy->buttonsLatched);
+	if (joy->buttonsPushNS) SDL_free(joy->buttonsPushNS);
+}
+#endif
+
 static bool APP_IsCon ( SDL_JoystickID joy )
 {
 	if ( !joy ) {
@@ -204,9 +269,7 @@ bool APP_UpdatePlayerSlots(void) {
 		#ifdef APP_ENABLE_JOYSTICK_INPUT
 		case APP_PLAYERSLOT_JOY:
 			if (!SDL_JoystickConnected(slot->joy.joystick)) {
-				if (slot->joy.axesRepeat) SDL_free(slot->joy.axesRepeat);
-				if (slot->joy.hatsRepeat) SDL_free(slot->joy.hatsRepeat);
-				if (slot->joy.buttonsRepeat) SDL_free(slot->joy.buttonsRepeat);
+				APP_FreeJoyArrays(&slot->joy);
 				*slot = (APP_PlayerSlot) { 0 };
 			}
 			break;
@@ -307,16 +370,26 @@ bool APP_UpdatePlayerSlots(void) {
 				APP_SetError("Failed to allocate hats repeat array for joystick");
 				goto fail;
 			}
+			if (APP_PlayerSlots[player].joy.numHats > 0 && !(APP_PlayerSlots[player].joy.hatsLatched = (Uint8*)SDL_calloc((size_t)APP_PlayerSlots[player].joy.numHats, sizeof(Uint8)))) {
+				APP_SetError("Failed to allocate hats latch array for joystick");
+				goto fail;
+			}
 			if (APP_PlayerSlots[player].joy.numButtons > 0 && !(APP_PlayerSlots[player].joy.buttonsRepeat = (int*)SDL_calloc((size_t)APP_PlayerSlots[player].joy.numButtons, sizeof(int)))) {
 				APP_SetError("Failed to allocate buttons repeat array for joystick");
 				goto fail;
 			}
+			if (APP_PlayerSlots[player].joy.numButtons > 0 && !(APP_PlayerSlots[player].joy.buttonsLatched = (bool*)SDL_calloc((size_t)APP_PlayerSlots[player].joy.numButtons, sizeof(bool)))) {
+				APP_SetError("Failed to allocate buttons latch array for joystick");
+				goto fail;
+			}
+			if (APP_PlayerSlots[player].joy.numButtons > 0 && !(APP_PlayerSlots[player].joy.buttonsPushNS = (Uint64*)SDL_calloc((size_t)APP_PlayerSlots[player].joy.numButtons, sizeof(Uint64)))) {
+				APP_SetError("Failed to allocate buttons timestamp array for joystick");
+				goto fail;
+			}
 		}
 		if (false) {
 		fail:
-			if (APP_PlayerSlots[player].joy.axesRepeat) SDL_free(APP_PlayerSlots[player].joy.axesRepeat);
-			if (APP_PlayerSlots[player].joy.hatsRepeat) SDL_free(APP_PlayerSlots[player].joy.hatsRepeat);
-			if (APP_PlayerSlots[player].joy.buttonsRepeat) SDL_free(APP_PlayerSlots[player].joy.buttonsRepeat);
+			APP_FreeJoyArrays(&APP_PlayerSlots[player].joy);
 			if (joystick) SDL_CloseJoystick(joystick);
 			SDL_free(joys);
 			return false;
@@ -352,9 +425,7 @@ static void APP_PlayerSlotsClose(void)
 				{
 					SDL_CloseJoystick(joy->joystick);
 				}
-				if (joy->axesRepeat) SDL_free(joy->axesRepeat);
-				if (joy->hatsRepeat) SDL_free(joy->hatsRepeat);
-				if (joy->buttonsRepeat) SDL_free(joy->buttonsRepeat);
+				APP_FreeJoyArrays(joy);
 				break;
 			}
 			#endif
@@ -451,7 +522,9 @@ static void APP_JoyInputsUpdate(void)
 
 		for (int hat = 0; hat < joy->numHats; hat++)
 		{
-			Uint8 value = SDL_GetJoystickHat(joy->joystick, hat);
+			// Directions pressed and released since the last update still count.
+			Uint8 value = SDL_GetJoystickHat(joy->joystick, hat) | joy->hatsLatched[hat];
+			joy->hatsLatched[hat] = 0;
 			const Uint8 hatValues[4] =
 			{
 				SDL_HAT_LEFT,
@@ -474,8 +547,9 @@ static void APP_JoyInputsUpdate(void)
 
 		for (int button = 0; button < joy->numButtons; button++)
 		{
-			if (SDL_GetJoystickButton(joy->joystick, button))
+			if (SDL_GetJoystickButton(joy->joystick, button) || joy->buttonsLatched[button])
 			{
+				joy->buttonsLatched[button] = false;
 				if (++joy->buttonsRepeat[button] == 1) APP_LastInputType = APP_INPUT_JOYSTICK;
 			}
 			else
@@ -774,6 +848,64 @@ int APP_GetJoyKeyRepeat ( const APP_JoyKey* const key )
 	return maxRepeat;
 }
 
+Uint64 APP_GetJoyKeyPushTime ( const APP_JoyKey* const key )
+{
+	if (!APP_PlayerSlots || APP_NumPlayerSlots <= 0 || key == NULL || key->player >= APP_NumPlayerSlots || key->type != APP_JOYKEY_BUTTON) return 0;
+
+	int player = 0;
+	int playerMax = 0;
+	Uint64 maxPushNS = 0;
+	if (key->player >= 0)
+	{
+		APP_JoyGUID checkGUID = APP_GetJoyGUID(key->player);
+		APP_JoyGUID zeroGUID = { 0 };
+		if (SDL_memcmp(checkGUID.data, zeroGUID.data, sizeof(checkGUID.data)) != 0 && SDL_memcmp(key->guid.data, checkGUID.data, sizeof(checkGUID.data)) == 0)
+		{
+			player = key->player;
+			playerMax = key->player + 1;
+		}
+	}
+	else
+	{
+		player = 0;
+		playerMax = APP_NumPlayerSlots;
+	}
+	for (; player < playerMax; player++)
+	{
+		if (APP_PlayerSlots[player].type != APP_PLAYERSLOT_JOY) continue;
+		APP_Joy* const joy = &APP_PlayerSlots[player].joy;
+		if (key->setting.button >= 0 && key->setting.button < joy->numButtons && joy->buttonsPushNS[key->setting.button] > maxPushNS)
+		{
+			maxPushNS = joy->buttonsPushNS[key->setting.button];
+		}
+	}
+	return maxPushNS;
+}
+
+static void APP_JoyEvent(const SDL_Event* const event)
+{
+	if (!APP_PlayerSlots) return;
+
+	const SDL_JoystickID which = event->type == SDL_EVENT_JOYSTICK_HAT_MOTION ? event->jhat.which : event->jbutton.which;
+	for (int player = 0; player < APP_NumPlayerSlots; player++)
+	{
+		if (APP_PlayerSlots[player].type != APP_PLAYERSLOT_JOY) continue;
+		APP_Joy* const joy = &APP_PlayerSlots[player].joy;
+		if (SDL_GetJoystickID(joy->joystick) != which) continue;
+
+		if (event->type == SDL_EVENT_JOYSTICK_HAT_MOTION)
+		{
+			if (event->jhat.hat < joy->numHats) joy->hatsLatched[event->jhat.hat] |= event->jhat.value;
+		}
+		else if (event->jbutton.button < joy->numButtons)
+		{
+			joy->buttonsLatched[event->jbutton.button] = true;
+			joy->buttonsPushNS[event->jbutton.button] = event->jbutton.timestamp;
+		}
+		break;
+	}
+}
+
 int APP_GetNumJoys(void)
 {
 	int foundJoys = 0;
@@ -1030,8 +1162,9 @@ static void APP_ConInputsUpdate(void)
 
 		for (SDL_GamepadButton button = 0; button < SDL_GAMEPAD_BUTTON_COUNT; button++)
 		{
-			if (SDL_GetGamepadButton(APP_BuiltinCon.controller, button))
+			if (SDL_GetGamepadButton(APP_BuiltinCon.controller, button) || APP_BuiltinCon.buttonsLatched[button])
 			{
+				APP_BuiltinCon.buttonsLatched[button] = false;
 				if (++APP_BuiltinCon.buttonsRepeat[button] == 1)
 				{
 					APP_LastInputType = inputType;
@@ -1204,8 +1337,9 @@ static void APP_ConInputsUpdate(void)
 
 		for (SDL_GamepadButton button = 0; button < SDL_GAMEPAD_BUTTON_COUNT; button++)
 		{
-			if (SDL_GetGamepadButton(con->controller, button))
+			if (SDL_GetGamepadButton(con->controller, button) || con->buttonsLatched[button])
 			{
+				con->buttonsLatched[button] = false;
 				if (++con->buttonsRepeat[button] == 1)
 				{
 					APP_LastInputType = inputType;
@@ -1437,6 +1571,64 @@ int APP_GetConKeyRepeat ( const int player, const APP_ConKey* const key )
 	return maxRepeat;
 }
 
+Uint64 APP_GetConKeyPushTime ( const int player, const APP_ConKey* const key )
+{
+	if (!key || key->type != APP_CONKEY_BUTTON || key->index < 0 || key->index >= APP_CONBUTTON_MAX) return 0;
+
+	Uint64 maxPushNS = 0;
+	if (player <= 0 && APP_BuiltinCon.controller)
+	{
+		maxPushNS = APP_BuiltinCon.buttonsPushNS[key->index];
+	}
+	if (!APP_PlayerSlots || APP_NumPlayerSlots == 0 || player >= APP_NumPlayerSlots) return maxPushNS;
+
+	int playerStart = 0;
+	int playerMax = 0;
+	if (player >= 0)
+	{
+		playerStart = player;
+		playerMax = player + 1;
+	}
+	else
+	{
+		playerStart = 0;
+		playerMax = APP_NumPlayerSlots;
+	}
+	for (; playerStart < playerMax; playerStart++)
+	{
+		if (APP_PlayerSlots[playerStart].type != APP_PLAYERSLOT_CON) continue;
+		const APP_Con* const con = &APP_PlayerSlots[playerStart].con;
+		if (con->buttonsPushNS[key->index] > maxPushNS) maxPushNS = con->buttonsPushNS[key->index];
+	}
+	return maxPushNS;
+}
+
+static void APP_ConEvent(const SDL_GamepadButtonEvent* const event)
+{
+	if (event->button >= APP_CONBUTTON_MAX) return;
+
+	APP_Con* con = NULL;
+	if (APP_BuiltinCon.controller && SDL_GetGamepadID(APP_BuiltinCon.controller) == event->which)
+	{
+		con = &APP_BuiltinCon;
+	}
+	else if (APP_PlayerSlots)
+	{
+		for (int player = 0; player < APP_NumPlayerSlots; player++)
+		{
+			if (APP_PlayerSlots[player].type == APP_PLAYERSLOT_CON && SDL_GetGamepadID(APP_PlayerSlots[player].con.controller) == event->which)
+			{
+				con = &APP_PlayerSlots[player].con;
+				break;
+			}
+		}
+	}
+	if (!con) return;
+
+	con->buttonsLatched[event->button] = true;
+	con->buttonsPushNS[event->button] = event->timestamp;
+}
+
 int APP_GetNumCons(void)
 {
 	int foundCons = 0;
@@ -1832,6 +2024,26 @@ void APP_OpenInputs(void)
 	// キーリピートバッファ初期化
 	// Key repeat buffer init
 	SDL_memset(APP_KeyRepeat, 0, sizeof(APP_KeyRepeat));
+	SDL_memset(APP_KeyHeld, 0, sizeof(APP_KeyHeld));
+	SDL_memset(APP_KeyLatched, 0, sizeof(APP_KeyLatched));
+	SDL_memset(APP_KeyPushNS, 0, sizeof(APP_KeyPushNS));
+	SDL_memset(APP_KeyReleaseNS, 0, sizeof(APP_KeyReleaseNS));
+	SDL_memset(APP_KeyActive, 0, sizeof(APP_KeyActive));
+	APP_NumActiveKeys = 0;
+
+	// 起動前から押されているキーを拾う（以降はイベントで更新）
+	// Pick up keys already held at startup; events keep the state after this
+	int numKeys = 0;
+	const bool* keyStates = SDL_GetKeyboardState(&numKeys);
+	for (int key = 0; key < numKeys && key < APP_KEY_MAX; key++)
+	{
+		if (keyStates[key])
+		{
+			APP_KeyHeld[key] = true;
+			APP_KeyActive[key] = true;
+			APP_ActiveKeys[APP_NumActiveKeys++] = key;
+		}
+	}
 	#endif
 
 	// ゲームコントローラーデータベースの初期化
@@ -1867,6 +2079,10 @@ void APP_CloseInputs(void)
 
 	#ifdef APP_ENABLE_KEYBOARD_INPUT
 	SDL_memset(APP_KeyRepeat, 0, sizeof(APP_KeyRepeat));
+	SDL_memset(APP_KeyHeld, 0, sizeof(APP_KeyHeld));
+	SDL_memset(APP_KeyLatched, 0, sizeof(APP_KeyLatched));
+	SDL_memset(APP_KeyActive, 0, sizeof(APP_KeyActive));
+	APP_NumActiveKeys = 0;
 	#endif
 
 	#if defined(APP_ENABLE_JOYSTICK_INPUT) || defined(APP_ENABLE_GAME_CONTROLLER_INPUT)
@@ -1882,6 +2098,8 @@ void APP_CloseInputs(void)
 
 void APP_InputsUpdate(void)
 {
+	const APP_MemoryTag memoryTag = APP_SetMemoryTag(APP_MEMORY_INPUT);
+
 	#ifdef APP_ENABLE_LINUX_GPIO_INPUT
 	for (int line = 0; line < 10; line++)
 	{
@@ -1897,18 +2115,20 @@ void APP_InputsUpdate(void)
 	#endif
 
 	#ifdef APP_ENABLE_KEYBOARD_INPUT
-	int numKeys = 0;
-	const bool* keyStates = SDL_GetKeyboardState(&numKeys);
-
-	for (int i = 0; i < APP_KEY_MAX; i++)
+	for (int i = 0; i < APP_NumActiveKeys; )
 	{
-		if (i < numKeys && keyStates[i])
+		const int key = APP_ActiveKeys[i];
+		if (APP_KeyHeld[key] || APP_KeyLatched[key])
 		{
-			if (++APP_KeyRepeat[i] == 1) APP_LastInputType = APP_INPUT_KEYBOARD;
+			APP_KeyLatched[key] = false;
+			if (++APP_KeyRepeat[key] == 1) APP_LastInputType = APP_INPUT_KEYBOARD;
+			i++;
 		}
 		else
 		{
-			APP_KeyRepeat[i] = 0;
+			APP_KeyRepeat[key] = 0;
+			APP_KeyActive[key] = false;
+			APP_ActiveKeys[i] = APP_ActiveKeys[--APP_NumActiveKeys];
 		}
 	}
 	#endif
@@ -1920,4 +2140,35 @@ void APP_InputsUpdate(void)
 	#ifdef APP_ENABLE_GAME_CONTROLLER_INPUT
 	APP_ConInputsUpdate();
 	#endif
+
+	APP_SetMemoryTag(memoryTag);
+}
+
+void APP_InputsEvent(const SDL_Event* event)
+{
+	switch (event->type)
+	{
+	#ifdef APP_ENABLE_KEYBOARD_INPUT
+	case SDL_EVENT_KEY_DOWN:
+	case SDL_EVENT_KEY_UP:
+		APP_KeyEvent(&event->key);
+		break;
+	#endif
+
+	#ifdef APP_ENABLE_JOYSTICK_INPUT
+	case SDL_EVENT_JOYSTICK_HAT_MOTION:
+	case SDL_EVENT_JOYSTICK_BUTTON_DOWN:
+		APP_JoyEvent(event);
+		break;
+	#endif
+
+	#ifdef APP_ENABLE_GAME_CONTROLLER_INPUT
+	case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
+		APP_ConEvent(&event->gbutton);
+		break;
+	#endif
+
+	default:
+		break;
+	}
 }
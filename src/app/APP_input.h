@@ -61,6 +61,12 @@ APP_InputType APP_GetLastInputType();
 
 void APP_InputsUpdate(void);
 
+// Feeds an SDL event to the input system. Key, joystick button/hat and game
+// controller button presses are latched here, so a press that is released
+// again before the next APP_InputsUpdate() still counts as a push on that
+// update. The timestamp of each press/release edge is also recorded.
+void APP_InputsEvent(const SDL_Event* event);
+
 #define APP_INPUTREPEAT_MAX INT_MAX
 
 #ifdef APP_ENABLE_LINUX_GPIO_INPUT
@@ -76,6 +82,11 @@ bool APP_IsPushKey(int key);
 bool APP_IsPressKey(int key);
 int APP_GetKeyRepeat(int key);
 int APP_GetMaxKey(void);
+
+// Nanosecond timestamps (SDL_GetTicksNS() base) of the key's last press and
+// release edges, or zero if there hasn't been one since inputs were opened.
+Uint64 APP_GetKeyPushTime(int key);
+Uint64 APP_GetKeyReleaseTime(int key);
 #endif
 
 #if defined(APP_ENABLE_JOYSTICK_INPUT) || defined(APP_ENABLE_GAME_CONTROLLER_INPUT)
@@ -121,6 +132,7 @@ typedef struct APP_JoyKey {
 bool APP_IsPushJoyKey(const APP_JoyKey* const key);
 bool APP_IsPressJoyKey(const APP_JoyKey* const key);
 int APP_GetJoyKeyRepeat(const APP_JoyKey* const key); // If key->type == APP_JOYKEY_ANY, checks all inputs of the key's joystick and returns the max repeat value.
+Uint64 APP_GetJoyKeyPushTime(const APP_JoyKey* const key); // Only button keys have timestamps; zero is returned for other key types.
 
 // If game controller support is enabled, a joystick player can possibly
 // correspond to a game controller, in which case these functions return -1 if
@@ -163,6 +175,7 @@ typedef struct APP_ConKey {
 bool APP_IsPushConKey(const int player, const APP_ConKey* const key);
 bool APP_IsPressConKey(const int player, const APP_ConKey* const key);
 int APP_GetConKeyRepeat(const int player, const APP_ConKey* const key);
+Uint64 APP_GetConKeyPushTime(const int player, const APP_ConKey* const key); // Only button keys have timestamps; zero is returned for other key types.
 
 int APP_GetNumCons(void);
 void APP_ResetLastActiveCon(void);
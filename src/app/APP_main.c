@@ -5,6 +5,9 @@
 #include "APP_input.h"
 #include "APP_error.h"
 #include "APP_global.h"
+#include "APP_memory.h"
+#include "APP_capture.h"
+#include "APP_movie.h"
 #include "game/gamestart.h"
 #include <SDL3/SDL_stdinc.h>
 #define SDL_MAIN_USE_CALLBACKS 1
@@ -20,6 +23,7 @@ static size_t APP_WriteDirectoryCount = 0;
 static int APP_WaveCount = 0;
 static int APP_PlaneCount = 0;
 static int APP_TextLayerCount = 0;
+static int APP_CacheLayerCount = 0;
 static uint64_t APP_LastRealFPSNS;
 static unsigned int APP_FramesThisSecond;
 static unsigned int APP_RealFPS;
@@ -27,6 +31,7 @@ static unsigned int APP_SettingFPS = 1;
 static unsigned int APP_CursorFrames = 0;
 static bool APP_RenderWhileSkippingFrames;
 static bool APP_LastFrameSkipped;
+static bool APP_Headless = false;
 static uint64_t APP_NowNS;
 static int64_t APP_FrameNS;
 static int64_t APP_AccumulatedNS = 0;
@@ -46,6 +51,13 @@ SDL_AppResult SDLCALL SDL_AppInit(void** appstate, int argc, char** argv)
 	APP_argc = argc;
 	APP_argv = argv;
 
+#ifdef APP_ENABLE_MEMORY_TRACKING
+	// SDLが何かを確保する前にフックを入れる || Hooks must be in before SDL allocates anything
+	if (!APP_InitMemoryTracking()) {
+		return SDL_APP_FAILURE;
+	}
+#endif
+
 	APP_QuitLevel = 0;
 
 	// TODO: Remove this once the issue with WASAPI crackling with the move sound in-game is fixed
@@ -80,6 +92,11 @@ SDL_AppResult SDLCALL SDL_AppInit(void** appstate, int argc, char** argv)
 SDL_AppResult SDLCALL SDL_AppEvent(void* appstate, SDL_Event* event)
 {
 	(void)appstate;
+
+	// 入力イベントの記録（フレーム内で離された入力も拾うため）
+	// Record input edges, so presses released within a frame aren't lost
+	APP_InputsEvent(event);
+
 	switch (event->type) {
 		// ウィンドウの×ボタンが押された時など
 		// When the window's X-button was pressed, etc.
@@ -101,6 +118,24 @@ SDL_AppResult SDLCALL SDL_AppEvent(void* appstate, SDL_Event* event)
 		break;
 #endif
 
+		// 描画先テクスチャの内容が失われたので、キャッシュレイヤーを作り直す
+		// Render target contents were lost, so cache layers have to be redrawn
+	case SDL_EVENT_RENDER_TARGETS_RESET:
+	case SDL_EVENT_RENDER_DEVICE_RESET:
+		APP_LoseCacheLayers();
+		break;
+
+		// ディスプレイの構成が変わったので、画面モードの一覧を取り直す
+		// The displays changed, so the list of screen modes has to be fetched again
+	case SDL_EVENT_DISPLAY_ORIENTATION:
+	case SDL_EVENT_DISPLAY_ADDED:
+	case SDL_EVENT_DISPLAY_REMOVED:
+	case SDL_EVENT_DISPLAY_MOVED:
+	case SDL_EVENT_DISPLAY_DESKTOP_MODE_CHANGED:
+	case SDL_EVENT_DISPLAY_CONTENT_SCALE_CHANGED:
+		APP_InvalidateDisplays();
+		break;
+
 	case SDL_EVENT_MOUSE_MOTION:
 	case SDL_EVENT_MOUSE_BUTTON_DOWN:
 	case SDL_EVENT_MOUSE_BUTTON_UP:
@@ -161,7 +196,9 @@ SDL_AppResult SDLCALL SDL_AppIterate(void* appstate)
 
 	APP_ScreenSubpixelOffset = APP_GetScreenSubpixelOffset();
 
+	const APP_MemoryTag memoryTag = APP_SetMemoryTag(APP_MEMORY_GAME);
 	mainUpdate();
+	APP_SetMemoryTag(memoryTag);
 
 	return SDL_APP_CONTINUE;
 }
@@ -173,6 +210,9 @@ void SDLCALL SDL_AppQuit(void* appstate, SDL_AppResult result)
 		SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_ERROR, APP_PROJECT_NAME " Error", SDL_GetError(), APP_ScreenWindow);
 	}
 	APP_Quit();
+#ifdef APP_ENABLE_MEMORY_TRACKING
+	APP_QuitMemoryTracking();
+#endif
 }
 
 void APP_ResetFrameStep(void)
@@ -207,7 +247,7 @@ static bool APP_FrameStep(void)
 	return skipped;
 }
 
-void APP_SetResourceSettings(int waveCount, const char* const* writeDirectories, size_t writeDirectoryCount, int planeCount, int textLayerCount)
+void APP_SetResourceSettings(int waveCount, const char* const* writeDirectories, size_t writeDirectoryCount, int planeCount, int textLayerCount, int cacheLayerCount)
 {
 	if (APP_WasSetResourceSettings) {
 		APP_SetError("Resource settings already set, they can only be set once");
@@ -219,6 +259,7 @@ void APP_SetResourceSettings(int waveCount, const char* const* writeDirectories,
 	APP_WriteDirectoryCount = writeDirectoryCount;
 	APP_PlaneCount = planeCount;
 	APP_TextLayerCount = textLayerCount;
+	APP_CacheLayerCount = cacheLayerCount;
 
 	APP_WasSetResourceSettings = true;
 }
@@ -265,7 +306,7 @@ void APP_Init(void)
 		}
 		APP_QuitLevel++;
 
-		APP_InitVideo(APP_PlaneCount, APP_TextLayerCount);
+		APP_InitVideo(APP_PlaneCount, APP_TextLayerCount, APP_CacheLayerCount);
 		APP_QuitLevel++;
 
 		APP_OpenInputs();
@@ -308,9 +349,42 @@ bool APP_Update(void)
 		APP_Exit(SDL_APP_FAILURE);
 	}
 
+	if (APP_Headless) {
+		#ifdef APP_ENABLE_MEMORY_TRACKING
+		APP_EndMemoryFrame();
+		#endif
+		// Headless frames don't run in real time, so the game sees the set
+		// frame rate, as it would in real play.
+		APP_FramesThisSecond++;
+		APP_RealFPS = APP_SettingFPS;
+		return !APP_QuitNow;
+	}
+
+	const APP_MemoryTag memoryTag = APP_SetMemoryTag(APP_MEMORY_VIDEO);
+
+	#ifdef APP_REPLAY_RENDER
+	// オフライン描画：表示もフレームレート待ちもせず、描画結果を動画へ書き出す
+	// Offline rendering: nothing is presented or waited for, frames go to the movie
+	APP_WriteMovieFrame();
+	if (!SDL_RenderClear(APP_ScreenRenderer)) {
+		APP_SetError("Failed render clear: %s", SDL_GetError());
+		APP_Exit(SDL_APP_FAILURE);
+	}
+
+	// 動画のフレームは実時間と関係ないので、設定したフレームレートを実測値とする
+	// Movie frames aren't real time, so the set frame rate is the real one
+	APP_FramesThisSecond++;
+	APP_RealFPS = APP_SettingFPS;
+	#else
 	#ifdef NDEBUG
 	if (APP_RenderWhileSkippingFrames || !APP_LastFrameSkipped) {
 	#endif
+		APP_CaptureFrame();
+
+		#ifdef APP_ENABLE_MEMORY_TRACKING
+		APP_DrawMemoryOverlay();
+		#endif
+
 		/* バックサーフェスをフロントに転送 */
 		if (APP_ScreenRenderTarget) {
 			if (
@@ -358,6 +432,12 @@ bool APP_Update(void)
 		APP_FramesThisSecond = 0;
 		APP_LastRealFPSNS = APP_NowNS;
 	}
+	#endif
+
+	APP_SetMemoryTag(memoryTag);
+	#ifdef APP_ENABLE_MEMORY_TRACKING
+	APP_EndMemoryFrame();
+	#endif
 
 	return !APP_QuitNow;
 }
@@ -395,5 +475,11 @@ void APP_SetRenderWhileSkippingFrames(bool render)
 
 bool APP_RenderThisFrame(void)
 {
-	return APP_RenderWhileSkippingFrames || !APP_LastFrameSkipped;
+	return !APP_Headless && (APP_RenderWhileSkippingFrames || !APP_LastFrameSkipped);
+}
+
+void APP_SetHeadless(bool headless)
+{
+	APP_Headless = headless;
+	APP_ResetFrameStep();
 }
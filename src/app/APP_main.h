@@ -17,7 +17,11 @@ void APP_SetRenderWhileSkippingFrames(bool render);
 
 bool APP_RenderThisFrame(void);
 
-void APP_SetResourceSettings(int waveCount, const char* const* writeDirectories, size_t writeDirectoryCount, int planeCount, int textLayerCount);
+// While headless, nothing is drawn or presented and APP_Update() doesn't wait
+// for the frame rate, so the game runs as fast as its logic allows.
+void APP_SetHeadless(bool headless);
+
+void APP_SetResourceSettings(int waveCount, const char* const* writeDirectories, size_t writeDirectoryCount, int planeCount, int textLayerCount, int cacheLayerCount);
 
 void APP_WaitToFinishLoading(void);
 
@@ -0,0 +1,362 @@
+#include "APP_memory.h"
+
+#ifdef APP_ENABLE_MEMORY_TRACKING
+
+#include "APP_filesystem.h"
+#include "APP_global.h"
+#include "APP_error.h"
+
+// Live allocations are kept in a fixed size, open addressing table allocated
+// with the original memory functions, so the hooks never call back into
+// themselves. Pointers allocated before the hooks were installed aren't in the
+// table, so they're passed through untracked when freed.
+#define APP_MEMORY_TABLE_SIZE ((size_t)1 << 18)
+#define APP_MEMORY_TABLE_MASK (APP_MEMORY_TABLE_SIZE - 1)
+#define APP_MEMORY_TABLE_MAX_COUNT (APP_MEMORY_TABLE_SIZE / 4 * 3)
+
+// How many consecutive steady-state frames must pass before allocations in
+// steady-state frames are treated as errors.
+#define APP_MEMORY_STEADY_FRAMES 60
+
+typedef struct APP_MemoryEntry
+{
+	void* ptr;
+	size_t size;
+} APP_MemoryEntry;
+
+typedef struct APP_MemoryCounts
+{
+	uint64_t allocs;
+	uint64_t bytes;
+} APP_MemoryCounts;
+
+static const char* const APP_MemoryTagNames[APP_MEMORY_TAG_COUNT] = {
+	"other",
+	"game",
+	"video",
+	"filesystem",
+	"input",
+	"threads"
+};
+
+static SDL_malloc_func APP_OriginalMalloc;
+static SDL_calloc_func APP_OriginalCalloc;
+static SDL_realloc_func APP_OriginalRealloc;
+static SDL_free_func APP_OriginalFree;
+
+// Everything from here to APP_MemoryFrameCounts is protected by the lock.
+static SDL_SpinLock APP_MemoryLock = 0;
+static APP_MemoryEntry* APP_MemoryTable = NULL;
+static size_t APP_MemoryTableCount = 0;
+static uint64_t APP_LiveBytes = 0;
+static uint64_t APP_PeakLiveBytes = 0;
+static APP_MemoryCounts APP_MemoryFrameCounts[APP_MEMORY_TAG_COUNT];
+
+// Only used on the main thread.
+static SDL_ThreadID APP_MemoryMainThread;
+static APP_MemoryTag APP_CurrentMemoryTag = APP_MEMORY_OTHER;
+static bool APP_MemorySuspended = false;
+static APP_MemoryCounts APP_LastMemoryFrameCounts[APP_MEMORY_TAG_COUNT];
+static uint64_t APP_MemoryFrame = 0;
+static bool APP_MemorySteadyFrame = false;
+static bool APP_MemoryBusyFrame = false;
+static int APP_MemorySteadyFrames = 0;
+static SDL_IOStream* APP_MemoryTrace = NULL;
+static bool APP_MemoryTraceFailed = false;
+
+SDL_FORCE_INLINE size_t APP_GetMemoryEntryIndex(const void* ptr)
+{
+	uint64_t hash = (uint64_t)(uintptr_t)ptr;
+	hash ^= hash >> 33;
+	hash *= UINT64_C(0xFF51AFD7ED558CCD);
+	hash ^= hash >> 33;
+	return (size_t)hash & APP_MEMORY_TABLE_MASK;
+}
+
+static bool APP_InsertMemoryEntry(void* ptr, size_t size)
+{
+	if (APP_MemoryTableCount >= APP_MEMORY_TABLE_MAX_COUNT) {
+		return false;
+	}
+
+	size_t i = APP_GetMemoryEntryIndex(ptr);
+	while (APP_MemoryTable[i].ptr) {
+		i = (i + 1) & APP_MEMORY_TABLE_MASK;
+	}
+	APP_MemoryTable[i].ptr = ptr;
+	APP_MemoryTable[i].size = size;
+	APP_MemoryTableCount++;
+	return true;
+}
+
+static bool APP_RemoveMemoryEntry(const void* ptr, size_t* size)
+{
+	size_t i = APP_GetMemoryEntryIndex(ptr);
+	while (APP_MemoryTable[i].ptr != ptr) {
+		if (!APP_MemoryTable[i].ptr) {
+			return false;
+		}
+		i = (i + 1) & APP_MEMORY_TABLE_MASK;
+	}
+	*size = APP_MemoryTable[i].size;
+
+	// Shift following entries of the probe sequence back into the hole, so
+	// lookups never need tombstones.
+	for (size_t j = (i + 1) & APP_MEMORY_TABLE_MASK; APP_MemoryTable[j].ptr; j = (j + 1) & APP_MEMORY_TABLE_MASK) {
+		const size_t home = APP_GetMemoryEntryIndex(APP_MemoryTable[j].ptr);
+		const bool stays = i <= j ? (i < home && home <= j) : (i < home || home <= j);
+		if (!stays) {
+			APP_MemoryTable[i] = APP_MemoryTable[j];
+			i = j;
+		}
+	}
+	APP_MemoryTable[i].ptr = NULL;
+	APP_MemoryTable[i].size = 0;
+	APP_MemoryTableCount--;
+	return true;
+}
+
+static void APP_TrackAllocation(void* oldPtr, void* newPtr, size_t size)
+{
+	APP_MemoryTag tag;
+	if (SDL_GetCurrentThreadID() == APP_MemoryMainThread) {
+		if (APP_MemorySuspended) {
+			tag = APP_MEMORY_TAG_COUNT;
+		}
+		else {
+			tag = APP_CurrentMemoryTag;
+		}
+	}
+	else {
+		tag = APP_MEMORY_THREADS;
+	}
+
+	SDL_LockSpinlock(&APP_MemoryLock);
+	size_t oldSize;
+	if (oldPtr && APP_RemoveMemoryEntry(oldPtr, &oldSize)) {
+		APP_LiveBytes -= oldSize;
+	}
+	if (tag != APP_MEMORY_TAG_COUNT) {
+		if (APP_InsertMemoryEntry(newPtr, size)) {
+			APP_LiveBytes += size;
+			if (APP_LiveBytes > APP_PeakLiveBytes) {
+				APP_PeakLiveBytes = APP_LiveBytes;
+			}
+		}
+		APP_MemoryFrameCounts[tag].allocs++;
+		APP_MemoryFrameCounts[tag].bytes += size;
+	}
+	SDL_UnlockSpinlock(&APP_MemoryLock);
+}
+
+static void* SDLCALL APP_TrackedMalloc(size_t size)
+{
+	void* const ptr = APP_OriginalMalloc(size);
+	if (ptr) {
+		APP_TrackAllocation(NULL, ptr, size);
+	}
+	return ptr;
+}
+
+static void* SDLCALL APP_TrackedCalloc(size_t nmemb, size_t size)
+{
+	void* const ptr = APP_OriginalCalloc(nmemb, size);
+	if (ptr) {
+		APP_TrackAllocation(NULL, ptr, nmemb * size);
+	}
+	return ptr;
+}
+
+static void* SDLCALL APP_TrackedRealloc(void* mem, size_t size)
+{
+	void* const ptr = APP_OriginalRealloc(mem, size);
+	if (ptr) {
+		APP_TrackAllocation(mem, ptr, size);
+	}
+	return ptr;
+}
+
+static void SDLCALL APP_TrackedFree(void* mem)
+{
+	if (mem) {
+		SDL_LockSpinlock(&APP_MemoryLock);
+		size_t size;
+		if (APP_RemoveMemoryEntry(mem, &size)) {
+			APP_LiveBytes -= size;
+		}
+		SDL_UnlockSpinlock(&APP_MemoryLock);
+	}
+	APP_OriginalFree(mem);
+}
+
+bool APP_InitMemoryTracking(void)
+{
+	SDL_GetMemoryFunctions(&APP_OriginalMalloc, &APP_OriginalCalloc, &APP_OriginalRealloc, &APP_OriginalFree);
+
+	APP_MemoryTable = APP_OriginalCalloc(APP_MEMORY_TABLE_SIZE, sizeof(APP_MemoryEntry));
+	if (!APP_MemoryTable) {
+		return APP_SetError("Failed allocating memory tracking table");
+	}
+	APP_MemoryMainThread = SDL_GetCurrentThreadID();
+
+	if (!SDL_SetMemoryFunctions(APP_TrackedMalloc, APP_TrackedCalloc, APP_TrackedRealloc, APP_TrackedFree)) {
+		APP_OriginalFree(APP_MemoryTable);
+		APP_MemoryTable = NULL;
+		return APP_SetError("Failed installing memory tracking functions: %s", SDL_GetError());
+	}
+	return true;
+}
+
+void APP_QuitMemoryTracking(void)
+{
+	if (APP_MemoryTrace) {
+		APP_MemorySuspended = true;
+		SDL_CloseIO(APP_MemoryTrace);
+		APP_MemoryTrace = NULL;
+		APP_MemorySuspended = false;
+	}
+}
+
+APP_MemoryTag APP_SetMemoryTag(APP_MemoryTag tag)
+{
+	// Shared code like file opening also runs on worker threads, whose
+	// allocations are always counted as APP_MEMORY_THREADS.
+	if (SDL_GetCurrentThreadID() != APP_MemoryMainThread) {
+		return tag;
+	}
+	// All file access goes through the filesystem tag.
+	if (tag == APP_MEMORY_FILESYSTEM) {
+		APP_MemoryBusyFrame = true;
+	}
+	const APP_MemoryTag oldTag = APP_CurrentMemoryTag;
+	APP_CurrentMemoryTag = tag;
+	return oldTag;
+}
+
+void APP_MarkMemorySteadyFrame(void)
+{
+	APP_MemorySteadyFrame = true;
+}
+
+void APP_MarkMemoryBusyFrame(void)
+{
+	if (SDL_GetCurrentThreadID() == APP_MemoryMainThread) {
+		APP_MemoryBusyFrame = true;
+	}
+}
+
+void APP_DrawMemoryOverlay(void)
+{
+	if (!APP_ScreenRenderer) {
+		return;
+	}
+
+	APP_MemorySuspended = true;
+
+	SDL_LockSpinlock(&APP_MemoryLock);
+	const uint64_t liveBytes = APP_LiveBytes;
+	const uint64_t peakLiveBytes = APP_PeakLiveBytes;
+	SDL_UnlockSpinlock(&APP_MemoryLock);
+
+	APP_MemoryCounts frame = { 0 };
+	for (int tag = 0; tag < APP_MEMORY_TAG_COUNT; tag++) {
+		if (tag == APP_MEMORY_THREADS) continue;
+		frame.allocs += APP_LastMemoryFrameCounts[tag].allocs;
+		frame.bytes += APP_LastMemoryFrameCounts[tag].bytes;
+	}
+
+	Uint8 r, g, b, a;
+	char text[64];
+	SDL_GetRenderDrawColor(APP_ScreenRenderer, &r, &g, &b, &a);
+	SDL_SetRenderDrawColor(APP_ScreenRenderer, 255, 255, 255, SDL_ALPHA_OPAQUE);
+	SDL_snprintf(text, sizeof(text), "HEAP %" SDL_PRIu64 "K PEAK %" SDL_PRIu64 "K", liveBytes / 1024, peakLiveBytes / 1024);
+	SDL_RenderDebugText(APP_ScreenRenderer, 0.0f, 0.0f, text);
+	SDL_snprintf(text, sizeof(text), "FRAME %" SDL_PRIu64 " ALLOC %" SDL_PRIu64 "B", frame.allocs, frame.bytes);
+	SDL_RenderDebugText(APP_ScreenRenderer, 0.0f, 8.0f, text);
+	SDL_SetRenderDrawColor(APP_ScreenRenderer, r, g, b, a);
+
+	APP_MemorySuspended = false;
+}
+
+static void APP_WriteMemoryTrace(const APP_MemoryCounts* counts, uint64_t liveBytes, uint64_t peakLiveBytes, bool steady)
+{
+	char line[512];
+	size_t length;
+
+	if (!APP_MemoryTrace) {
+		if (APP_MemoryTraceFailed) {
+			return;
+		}
+		APP_MemoryTrace = APP_OpenWrite("memory_trace.csv");
+		if (!APP_MemoryTrace) {
+			SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "Failed opening memory trace file: %s", SDL_GetError());
+			APP_MemoryTraceFailed = true;
+			return;
+		}
+		length = (size_t)SDL_snprintf(line, sizeof(line), "frame,steady,live_bytes,peak_bytes");
+		for (int tag = 0; tag < APP_MEMORY_TAG_COUNT && length < sizeof(line); tag++) {
+			length += (size_t)SDL_snprintf(line + length, sizeof(line) - length, ",%s_allocs,%s_bytes", APP_MemoryTagNames[tag], APP_MemoryTagNames[tag]);
+		}
+		if (length < sizeof(line) - 1) {
+			line[length++] = '\n';
+			SDL_WriteIO(APP_MemoryTrace, line, length);
+		}
+	}
+
+	length = (size_t)SDL_snprintf(line, sizeof(line), "%" SDL_PRIu64 ",%d,%" SDL_PRIu64 ",%" SDL_PRIu64, APP_MemoryFrame, steady, liveBytes, peakLiveBytes);
+	for (int tag = 0; tag < APP_MEMORY_TAG_COUNT && length < sizeof(line); tag++) {
+		length += (size_t)SDL_snprintf(line + length, sizeof(line) - length, ",%" SDL_PRIu64 ",%" SDL_PRIu64, counts[tag].allocs, counts[tag].bytes);
+	}
+	if (length < sizeof(line) - 1) {
+		line[length++] = '\n';
+		SDL_WriteIO(APP_MemoryTrace, line, length);
+	}
+}
+
+void APP_EndMemoryFrame(void)
+{
+	APP_MemoryCounts counts[APP_MEMORY_TAG_COUNT];
+
+	SDL_LockSpinlock(&APP_MemoryLock);
+	SDL_memcpy(counts, APP_MemoryFrameCounts, sizeof(counts));
+	SDL_memset(APP_MemoryFrameCounts, 0, sizeof(APP_MemoryFrameCounts));
+	const uint64_t liveBytes = APP_LiveBytes;
+	const uint64_t peakLiveBytes = APP_PeakLiveBytes;
+	SDL_UnlockSpinlock(&APP_MemoryLock);
+
+	SDL_memcpy(APP_LastMemoryFrameCounts, counts, sizeof(counts));
+
+	APP_MemorySuspended = true;
+
+	// Other threads (audio streaming, loading workers) don't count against the
+	// steady-state budget, only the main thread's frame work does.
+	uint64_t frameAllocs = 0;
+	for (int tag = 0; tag < APP_MEMORY_TAG_COUNT; tag++) {
+		if (tag != APP_MEMORY_THREADS) {
+			frameAllocs += counts[tag].allocs;
+		}
+	}
+	const bool steady = APP_MemorySteadyFrame && !APP_MemoryBusyFrame;
+	if (steady) {
+		if (APP_MemorySteadyFrames >= APP_MEMORY_STEADY_FRAMES && frameAllocs > 0) {
+			SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "Steady-state frame %" SDL_PRIu64 " made %" SDL_PRIu64 " heap allocations", APP_MemoryFrame, frameAllocs);
+			SDL_assert(frameAllocs == 0);
+		}
+		if (APP_MemorySteadyFrames < APP_MEMORY_STEADY_FRAMES) {
+			APP_MemorySteadyFrames++;
+		}
+	}
+	else {
+		APP_MemorySteadyFrames = 0;
+	}
+
+	APP_WriteMemoryTrace(counts, liveBytes, peakLiveBytes, steady);
+
+	APP_MemorySuspended = false;
+
+	APP_MemorySteadyFrame = false;
+	APP_MemoryBusyFrame = false;
+	APP_MemoryFrame++;
+}
+
+#endif
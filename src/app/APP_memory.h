@@ -0,0 +1,72 @@
+#ifndef APP_memory_h_
+#define APP_memory_h_
+
+#include "APP_stdinc.h"
+
+// Heap allocation tracking, enabled with APP_ENABLE_MEMORY_TRACKING. When
+// disabled, all of these compile down to nothing.
+//
+// Allocations made on the main thread are attributed to the current memory tag;
+// allocations made on any other thread are attributed to APP_MEMORY_THREADS.
+// Counts are collected per frame, where a frame ends at each APP_Update(), then
+// shown in an overlay and written to "memory_trace.csv" in the write directory.
+
+typedef enum APP_MemoryTag
+{
+	APP_MEMORY_OTHER,
+	APP_MEMORY_GAME,
+	APP_MEMORY_VIDEO,
+	APP_MEMORY_FILESYSTEM,
+	APP_MEMORY_INPUT,
+	APP_MEMORY_THREADS,
+	APP_MEMORY_TAG_COUNT
+} APP_MemoryTag;
+
+#ifdef APP_ENABLE_MEMORY_TRACKING
+
+// Installs the SDL memory function hooks. Must be called before SDL_Init().
+bool APP_InitMemoryTracking(void);
+
+// Closes the trace file. The hooks stay installed, as memory allocated through
+// them may still be freed after this.
+void APP_QuitMemoryTracking(void);
+
+// Sets the tag for allocations made on the main thread, returning the previous
+// tag, so the caller can restore it afterwards.
+APP_MemoryTag APP_SetMemoryTag(APP_MemoryTag tag);
+
+// Marks the current frame as a steady-state frame, which must not allocate.
+// Once enough consecutive frames have been marked, any allocation in a marked
+// frame triggers an assertion.
+void APP_MarkMemorySteadyFrame(void);
+
+// Marks the current frame as doing file or music work, which may allocate, so
+// it isn't checked even if marked as a steady-state frame. Opening files marks
+// the frame automatically. Calls from other threads are ignored.
+void APP_MarkMemoryBusyFrame(void);
+
+// Draws the overlay into the current render target.
+void APP_DrawMemoryOverlay(void);
+
+// Ends the current frame's counting and writes its trace line.
+void APP_EndMemoryFrame(void);
+
+#else
+
+SDL_FORCE_INLINE APP_MemoryTag APP_SetMemoryTag(APP_MemoryTag tag)
+{
+	(void)tag;
+	return APP_MEMORY_OTHER;
+}
+
+SDL_FORCE_INLINE void APP_MarkMemorySteadyFrame(void)
+{
+}
+
+SDL_FORCE_INLINE void APP_MarkMemoryBusyFrame(void)
+{
+}
+
+#endif
+
+#endif
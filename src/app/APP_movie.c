@@ -0,0 +1,277 @@
+#include "APP_movie.h"
+
+#ifdef APP_REPLAY_RENDER
+
+#include "APP_global.h"
+#include "APP_filesystem.h"
+#include "APP_audio.h"
+#include "APP_main.h"
+#include "APP_error.h"
+
+// How many read back frames may wait for the writer thread, before
+// APP_WriteMovieFrame() waits for it.
+#define APP_MOVIE_QUEUE_SIZE 8
+
+static bool APP_MovieOpen = false;
+static SDL_IOStream* APP_MovieVideo = NULL;
+static SDL_IOStream* APP_MovieAudio = NULL;
+static int APP_MovieWidth;
+static int APP_MovieHeight;
+static int APP_MovieFPS;
+static uint64_t APP_MovieFrames;
+static uint64_t APP_MovieAudioBytes;
+static uint8_t* APP_MovieAudioBuffer = NULL;
+static uint8_t* APP_MovieYUV = NULL;
+static int APP_MovieYUVSize;
+
+static SDL_Mutex* APP_MovieLock = NULL;
+static SDL_Condition* APP_MovieQueued = NULL;
+static SDL_Condition* APP_MovieDequeued = NULL;
+static SDL_Surface* APP_MovieQueue[APP_MOVIE_QUEUE_SIZE];
+static int APP_MovieQueueHead;
+static int APP_MovieQueueCount;
+static bool APP_MovieShutdown;
+static bool APP_MovieFailed;
+static SDL_Thread* APP_MovieWriter = NULL;
+
+static bool APP_WriteMovieVideoFrame(SDL_Surface* surface)
+{
+	return
+		SDL_ConvertPixels(surface->w, surface->h, surface->format, surface->pixels, surface->pitch, SDL_PIXELFORMAT_IYUV, APP_MovieYUV, APP_MovieWidth) &&
+		SDL_WriteIO(APP_MovieVideo, "FRAME\n", 6) == 6 &&
+		SDL_WriteIO(APP_MovieVideo, APP_MovieYUV, APP_MovieYUVSize) == (size_t)APP_MovieYUVSize;
+}
+
+static int SDLCALL APP_MovieWriterFunction(void* data)
+{
+	(void)data;
+	SDL_LockMutex(APP_MovieLock);
+	while (true) {
+		while (APP_MovieQueueCount == 0 && !APP_MovieShutdown) {
+			SDL_WaitCondition(APP_MovieQueued, APP_MovieLock);
+		}
+		if (APP_MovieQueueCount == 0) {
+			break;
+		}
+		SDL_Surface* const surface = APP_MovieQueue[APP_MovieQueueHead];
+		APP_MovieQueueHead = (APP_MovieQueueHead + 1) % APP_MOVIE_QUEUE_SIZE;
+		APP_MovieQueueCount--;
+		SDL_SignalCondition(APP_MovieDequeued);
+		const bool failed = APP_MovieFailed;
+		SDL_UnlockMutex(APP_MovieLock);
+
+		// After a failure, frames are only discarded, so the main thread never
+		// waits on a queue that stopped draining.
+		const bool written = failed || APP_WriteMovieVideoFrame(surface);
+		SDL_DestroySurface(surface);
+
+		SDL_LockMutex(APP_MovieLock);
+		if (!written) {
+			APP_MovieFailed = true;
+		}
+	}
+	SDL_UnlockMutex(APP_MovieLock);
+	return 0;
+}
+
+static bool APP_WriteMovieWAVHeader(uint64_t dataSize)
+{
+	const SDL_AudioSpec* const spec = APP_GetAudioFormat();
+	const int frameSize = SDL_AUDIO_FRAMESIZE(*spec);
+	const uint32_t size = dataSize > UINT32_MAX - 36 ? UINT32_MAX - 36 : (uint32_t)dataSize;
+	return
+		SDL_SeekIO(APP_MovieAudio, 0, SDL_IO_SEEK_SET) == 0 &&
+		SDL_WriteIO(APP_MovieAudio, "RIFF", 4) == 4 &&
+		SDL_WriteU32LE(APP_MovieAudio, 36 + size) &&
+		SDL_WriteIO(APP_MovieAudio, "WAVEfmt ", 8) == 8 &&
+		SDL_WriteU32LE(APP_MovieAudio, 16) &&
+		SDL_WriteU16LE(APP_MovieAudio, 1) &&
+		SDL_WriteU16LE(APP_MovieAudio, spec->channels) &&
+		SDL_WriteU32LE(APP_MovieAudio, spec->freq) &&
+		SDL_WriteU32LE(APP_MovieAudio, spec->freq * frameSize) &&
+		SDL_WriteU16LE(APP_MovieAudio, frameSize) &&
+		SDL_WriteU16LE(APP_MovieAudio, SDL_AUDIO_BITSIZE(spec->format)) &&
+		SDL_WriteIO(APP_MovieAudio, "data", 4) == 4 &&
+		SDL_WriteU32LE(APP_MovieAudio, size);
+}
+
+static void APP_FreeMovie(void)
+{
+	if (APP_MovieVideo) {
+		SDL_CloseIO(APP_MovieVideo);
+		APP_MovieVideo = NULL;
+	}
+	if (APP_MovieAudio) {
+		SDL_CloseIO(APP_MovieAudio);
+		APP_MovieAudio = NULL;
+	}
+	if (APP_MovieDequeued) {
+		SDL_DestroyCondition(APP_MovieDequeued);
+		APP_MovieDequeued = NULL;
+	}
+	if (APP_MovieQueued) {
+		SDL_DestroyCondition(APP_MovieQueued);
+		APP_MovieQueued = NULL;
+	}
+	if (APP_MovieLock) {
+		SDL_DestroyMutex(APP_MovieLock);
+		APP_MovieLock = NULL;
+	}
+	SDL_free(APP_MovieYUV);
+	APP_MovieYUV = NULL;
+	SDL_free(APP_MovieAudioBuffer);
+	APP_MovieAudioBuffer = NULL;
+}
+
+bool APP_OpenMovie(const char* videoFilename, const char* audioFilename)
+{
+	if (APP_MovieOpen) {
+		return APP_SetError("A movie is already open");
+	}
+	else if (!APP_ScreenRenderTarget) {
+		return APP_SetError("Movies can only be rendered with a screen render target");
+	}
+
+	float w, h;
+	if (!SDL_GetTextureSize(APP_ScreenRenderTarget, &w, &h)) {
+		return APP_SetError("Could not get render target texture size: %s", SDL_GetError());
+	}
+	APP_MovieWidth = (int)w;
+	APP_MovieHeight = (int)h;
+	APP_MovieFPS = APP_GetFPS();
+	APP_MovieFrames = 0;
+	APP_MovieAudioBytes = 0;
+
+	APP_MovieYUVSize = APP_MovieWidth * APP_MovieHeight + 2 * (((APP_MovieWidth + 1) / 2) * ((APP_MovieHeight + 1) / 2));
+	APP_MovieYUV = SDL_malloc(APP_MovieYUVSize);
+	const SDL_AudioSpec* const spec = APP_GetAudioFormat();
+	APP_MovieAudioBuffer = SDL_malloc(((spec->freq + APP_MovieFPS - 1) / APP_MovieFPS) * SDL_AUDIO_FRAMESIZE(*spec));
+	if (!APP_MovieYUV || !APP_MovieAudioBuffer) {
+		APP_FreeMovie();
+		return APP_SetError("Failed allocating movie buffers");
+	}
+
+	APP_MovieVideo = APP_OpenWrite(videoFilename);
+	if (!APP_MovieVideo) {
+		APP_SetError("Could not open movie video file \"%s\": %s", videoFilename, SDL_GetError());
+		APP_FreeMovie();
+		return false;
+	}
+	APP_MovieAudio = APP_OpenWrite(audioFilename);
+	if (!APP_MovieAudio) {
+		APP_SetError("Could not open movie audio file \"%s\": %s", audioFilename, SDL_GetError());
+		APP_FreeMovie();
+		return false;
+	}
+	if (
+		!SDL_IOprintf(APP_MovieVideo, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", APP_MovieWidth, APP_MovieHeight, APP_MovieFPS) ||
+		!APP_WriteMovieWAVHeader(0)
+	) {
+		APP_SetError("Could not write movie file headers: %s", SDL_GetError());
+		APP_FreeMovie();
+		return false;
+	}
+
+	APP_MovieLock = SDL_CreateMutex();
+	APP_MovieQueued = SDL_CreateCondition();
+	APP_MovieDequeued = SDL_CreateCondition();
+	if (!APP_MovieLock || !APP_MovieQueued || !APP_MovieDequeued) {
+		APP_SetError("Could not start movie writer: %s", SDL_GetError());
+		APP_FreeMovie();
+		return false;
+	}
+	APP_MovieQueueHead = 0;
+	APP_MovieQueueCount = 0;
+	APP_MovieShutdown = false;
+	APP_MovieFailed = false;
+	APP_MovieWriter = SDL_CreateThread(APP_MovieWriterFunction, "APP_MovieWriterFunction", NULL);
+	if (!APP_MovieWriter) {
+		APP_SetError("Could not start movie writer: %s", SDL_GetError());
+		APP_FreeMovie();
+		return false;
+	}
+
+	APP_MovieOpen = true;
+	return true;
+}
+
+void APP_WriteMovieFrame(void)
+{
+	if (!APP_MovieOpen) {
+		return;
+	}
+
+	SDL_Surface* const surface = SDL_RenderReadPixels(APP_ScreenRenderer, NULL);
+	if (!surface) {
+		APP_SetError("Failed reading back movie frame: %s", SDL_GetError());
+		APP_Exit(SDL_APP_FAILURE);
+	}
+	SDL_LockMutex(APP_MovieLock);
+	while (APP_MovieQueueCount == APP_MOVIE_QUEUE_SIZE) {
+		SDL_WaitCondition(APP_MovieDequeued, APP_MovieLock);
+	}
+	APP_MovieQueue[(APP_MovieQueueHead + APP_MovieQueueCount) % APP_MOVIE_QUEUE_SIZE] = surface;
+	APP_MovieQueueCount++;
+	SDL_SignalCondition(APP_MovieQueued);
+	const bool failed = APP_MovieFailed;
+	SDL_UnlockMutex(APP_MovieLock);
+	if (failed) {
+		APP_SetError("Failed writing movie video: %s", SDL_GetError());
+		APP_Exit(SDL_APP_FAILURE);
+	}
+
+	// Each frame gets the samples up to the end of its time, so the audio
+	// never drifts from the video even when the rate doesn't divide evenly.
+	const SDL_AudioSpec* const spec = APP_GetAudioFormat();
+	const uint64_t start = APP_MovieFrames * spec->freq / APP_MovieFPS;
+	const uint64_t end = (APP_MovieFrames + 1) * spec->freq / APP_MovieFPS;
+	const int size = (int)(end - start) * SDL_AUDIO_FRAMESIZE(*spec);
+	if (!APP_MixAudio(APP_MovieAudioBuffer, size)) {
+		APP_SetError("Failed mixing movie audio: %s", SDL_GetError());
+		APP_Exit(SDL_APP_FAILURE);
+	}
+	if (SDL_WriteIO(APP_MovieAudio, APP_MovieAudioBuffer, size) != (size_t)size) {
+		APP_SetError("Failed writing movie audio: %s", SDL_GetError());
+		APP_Exit(SDL_APP_FAILURE);
+	}
+	APP_MovieAudioBytes += size;
+	APP_MovieFrames++;
+}
+
+bool APP_CloseMovie(void)
+{
+	if (!APP_MovieOpen) {
+		return APP_SetError("No movie is open");
+	}
+
+	SDL_LockMutex(APP_MovieLock);
+	APP_MovieShutdown = true;
+	SDL_SignalCondition(APP_MovieQueued);
+	SDL_UnlockMutex(APP_MovieLock);
+	SDL_WaitThread(APP_MovieWriter, NULL);
+	APP_MovieWriter = NULL;
+
+	bool success = !APP_MovieFailed;
+	if (!success) {
+		APP_SetError("Failed writing movie video");
+	}
+	else if (!APP_WriteMovieWAVHeader(APP_MovieAudioBytes)) {
+		APP_SetError("Failed finishing movie audio file: %s", SDL_GetError());
+		success = false;
+	}
+	if (!SDL_CloseIO(APP_MovieVideo) && success) {
+		APP_SetError("Failed finishing movie video file: %s", SDL_GetError());
+		success = false;
+	}
+	APP_MovieVideo = NULL;
+	if (!SDL_CloseIO(APP_MovieAudio) && success) {
+		APP_SetError("Failed finishing movie audio file: %s", SDL_GetError());
+		success = false;
+	}
+	APP_MovieAudio = NULL;
+	APP_FreeMovie();
+	APP_MovieOpen = false;
+	return success;
+}
+
+#endif
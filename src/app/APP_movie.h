@@ -0,0 +1,27 @@
+#ifndef APP_movie_h_
+#define APP_movie_h_
+
+#include "APP_stdinc.h"
+
+#ifdef APP_REPLAY_RENDER
+
+// Offline movie writing, for APP_REPLAY_RENDER builds. While a movie is open,
+// every APP_Update() reads the frame back from the screen render target and
+// mixes one frame's worth of audio. The video is written as a Y4M file, and
+// the audio as a 16-bit stereo WAV file, both in the write directory.
+//
+// Frames are converted to YUV and written on a writer thread. When the writer
+// falls behind, APP_Update() waits for it, so no frames are dropped.
+
+bool APP_OpenMovie(const char* videoFilename, const char* audioFilename);
+
+// Called by APP_Update().
+void APP_WriteMovieFrame(void);
+
+// Waits for all frames to be written, then finishes both files. Returns false
+// if writing failed at any point.
+bool APP_CloseMovie(void);
+
+#endif
+
+#endif
@@ -5,6 +5,8 @@
 #include "APP_global.h"
 #include "APP_bdf.h"
 #include "APP_error.h"
+#include "APP_memory.h"
+#include "APP_capture.h"
 #include <SDL3_image/SDL_image.h>
 
 #define APP_WINDOW_TITLE "Heboris C.E."
@@ -24,16 +26,46 @@ typedef struct APP_TextLayer
 	float textureH;
 } APP_TextLayer;
 
+// Plane filenames, without the image type extension, are at most this long,
+// including the terminator.
+#define APP_PLANE_FILENAME_SIZE 256
+
 typedef struct APP_LoadPlaneData
 {
-	char* filename;
+	// Kept in the data instead of allocated, so queueing a load doesn't
+	// allocate.
+	char filename[APP_PLANE_FILENAME_SIZE];
 	SDL_Surface* surface;
 	APP_WorkerJobID job;
 } APP_LoadPlaneData;
 
+// How many frames of a plane stream are decoded ahead, including the frame
+// to be shown. There's one more slot, that keeps the shown frame while the
+// next one is still decoding. Each has its own texture.
+#define APP_PLANE_STREAM_AHEAD 4
+#define APP_PLANE_STREAM_SLOTS (APP_PLANE_STREAM_AHEAD + 1)
+
+typedef struct APP_PlaneStreamSlot
+{
+	int frame;
+	APP_LoadPlaneData load;
+	SDL_Texture* texture;
+} APP_PlaneStreamSlot;
+
+typedef struct APP_PlaneStream
+{
+	char* filename;
+	int frameCount;
+	// -1 until the first frame is shown.
+	int shownFrame;
+	APP_PlaneStreamSlot slots[APP_PLANE_STREAM_SLOTS];
+} APP_PlaneStream;
+
 static int APP_PlaneCount = 0;
 static SDL_Texture** APP_Planes = NULL;
 static APP_LoadPlaneData* APP_PlanesLoadData = NULL;
+static APP_PlaneStream** APP_PlaneStreams = NULL;
+static SDL_PixelFormat APP_PlaneTextureFormat = SDL_PIXELFORMAT_ARGB8888;
 
 #define APP_BDF_FONT_FILE_COUNT	3
 static APP_BDFFont* APP_BDFFonts[APP_BDF_FONT_FILE_COUNT] = { 0 };
@@ -47,6 +79,14 @@ static APP_TextLayer* APP_TextLayers = NULL;
 static int32_t APP_ScreenMode;
 static int32_t APP_ScreenIndex;
 
+static int APP_DisplayCount = 0;
+static SDL_DisplayID* APP_Displays = NULL;
+static SDL_DisplayMode*** APP_DisplayModes = NULL;
+static int* APP_DisplayModeCounts = NULL;
+// Set when the displays change, so the next APP_SetScreen sets up the window
+// again even if the screen settings are the same.
+static bool APP_DisplaysChanged = false;
+
 static size_t APP_TextDataLength = 0;
 static SDL_Vertex* APP_TextVertices = NULL;
 static int* APP_TextIndices = NULL;
@@ -54,7 +94,31 @@ static int* APP_TextIndices = NULL;
 static int APP_PlaneDrawOffsetX = 0;
 static int APP_PlaneDrawOffsetY = 0;
 
+static int APP_CacheLayerCount = 0;
+static SDL_Texture** APP_CacheLayers = NULL;
+static int APP_CurrentCacheLayer = -1;
+
 static SDL_IOStream* APP_OpenImage(const char* filename, const char** type);
+static void APP_ClosePlaneStream(int plane);
+static void APP_FreeDisplays(void);
+
+// The offset added to all draw positions. While drawing into a cache layer,
+// neither the plane draw offset nor the subpixel offset apply; they're applied
+// when the cache layer is drawn to the screen.
+static void APP_GetDrawOffset(float* x, float* y)
+{
+	if (APP_CurrentCacheLayer >= 0) {
+		*x = 0.0f;
+		*y = 0.0f;
+		return;
+	}
+	*x = (float)APP_PlaneDrawOffsetX;
+	*y = (float)APP_PlaneDrawOffsetY;
+	if (!APP_ScreenRenderTarget) {
+		*x += APP_ScreenSubpixelOffset;
+		*y += APP_ScreenSubpixelOffset;
+	}
+}
 
 static void APP_PrivateBDFFontInitialize(void)
 {
@@ -96,7 +160,7 @@ static void APP_PrivateBDFFontFinalize(void)
 	}
 }
 
-void APP_InitVideo(int planeCount, int textLayerCount)
+void APP_InitVideo(int planeCount, int textLayerCount, int cacheLayerCount)
 {
 	// Initialize the planes
 	if (planeCount > 0) {
@@ -110,11 +174,17 @@ void APP_InitVideo(int planeCount, int textLayerCount)
 			APP_SetError("Failed to allocate memory for plane loading data");
 			APP_Exit(SDL_APP_FAILURE);
 		}
+		APP_PlaneStreams = SDL_calloc(planeCount, sizeof(APP_PlaneStream*));
+		if (!APP_PlaneStreams) {
+			APP_SetError("Failed to allocate memory for plane streams");
+			APP_Exit(SDL_APP_FAILURE);
+		}
 		APP_PlaneCount = planeCount;
 	}
 	else {
 		APP_Planes = NULL;
 		APP_PlanesLoadData = NULL;
+		APP_PlaneStreams = NULL;
 		APP_PlaneCount = 0;
 	}
 
@@ -137,12 +207,29 @@ void APP_InitVideo(int planeCount, int textLayerCount)
 		APP_TextLayerCount = 0;
 	}
 
+	/* Initialize the cache layers */
+	if (cacheLayerCount > 0) {
+		APP_CacheLayers = SDL_calloc(cacheLayerCount, sizeof(SDL_Texture*));
+		if (!APP_CacheLayers) {
+			APP_SetError("Failed to allocate memory for cache layers");
+			APP_Exit(SDL_APP_FAILURE);
+		}
+		APP_CacheLayerCount = cacheLayerCount;
+	}
+	else {
+		APP_CacheLayers = NULL;
+		APP_CacheLayerCount = 0;
+	}
+	APP_CurrentCacheLayer = -1;
+
 	APP_PrivateBDFFontInitialize();
 }
 
 void APP_QuitVideo(void)
 {
 	if (APP_ScreenRenderer) {
+		APP_QuitCapture();
+
 		for (int i = 0; i < APP_TextLayerCount; i++) {
 			SDL_DestroyTexture(APP_TextLayers[i].texture);
 			SDL_free(APP_TextLayers[i].string);
@@ -151,6 +238,7 @@ void APP_QuitVideo(void)
 		APP_TextLayers = NULL;
 
 		for (int i = 0; i < APP_PlaneCount; i++) {
+			APP_ClosePlaneStream(i);
 			if (APP_PlanesLoadData[i].job) {
 				APP_WaitWorkerJob(APP_LoadingWorker, APP_PlanesLoadData[i].job);
 				SDL_DestroySurface(APP_PlanesLoadData[i].surface);
@@ -159,9 +247,18 @@ void APP_QuitVideo(void)
 		}
 		SDL_free(APP_PlanesLoadData);
 		APP_PlanesLoadData = NULL;
+		SDL_free(APP_PlaneStreams);
+		APP_PlaneStreams = NULL;
 		SDL_free(APP_Planes);
 		APP_Planes = NULL;
 
+		for (int i = 0; i < APP_CacheLayerCount; i++) {
+			SDL_DestroyTexture(APP_CacheLayers[i]);
+		}
+		SDL_free(APP_CacheLayers);
+		APP_CacheLayers = NULL;
+		APP_CacheLayerCount = 0;
+
 		if (APP_ScreenRenderTarget) {
 			SDL_SetRenderTarget(APP_ScreenRenderer, NULL);
 			SDL_DestroyTexture(APP_ScreenRenderTarget);
@@ -182,68 +279,107 @@ void APP_QuitVideo(void)
 	APP_TextIndices = NULL;
 	APP_TextDataLength = 0;
 
+	APP_FreeDisplays();
+	APP_DisplaysChanged = false;
+
 	APP_PrivateBDFFontFinalize();
 }
 
-void APP_SetScreen(APP_ScreenModeFlag* screenMode, int32_t* screenIndex)
+// The renderer's first choice of 8-bit-per-channel format with alpha. Plane
+// images are converted to it while loading, so creating their textures needs
+// no conversion.
+static SDL_PixelFormat APP_GetPlaneTextureFormat(SDL_Renderer* renderer)
 {
-	int windowX, windowY;
-	int logicalWidth, logicalHeight;
-	SDL_DisplayID* displays = NULL;
-	SDL_DisplayMode** displayModes = NULL;
-
-	/* 画面の設定 || Set up the screen */
-
-	/* Validate the window type */
-	APP_ScreenModeFlag windowType = *screenMode & APP_SCREEN_MODE_WINDOW_TYPE;
-	if (windowType >= APP_SCREEN_MODE_WINDOW_TYPES_COUNT) {
-		APP_SetError("Invalid window type value of %d", (int)windowType);
-		goto fail;
+	const SDL_PixelFormat* const formats = SDL_GetPointerProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_TEXTURE_FORMATS_POINTER, NULL);
+	if (formats) {
+		for (int i = 0; formats[i] != SDL_PIXELFORMAT_UNKNOWN; i++) {
+			if (
+				!SDL_ISPIXELFORMAT_FOURCC(formats[i]) &&
+				!SDL_ISPIXELFORMAT_10BIT(formats[i]) &&
+				!SDL_ISPIXELFORMAT_FLOAT(formats[i]) &&
+				SDL_BYTESPERPIXEL(formats[i]) == 4 &&
+				SDL_ISPIXELFORMAT_ALPHA(formats[i])
+			) {
+				return formats[i];
+			}
+		}
 	}
+	return SDL_PIXELFORMAT_ARGB8888;
+}
 
-	int displayIndex = APP_SCREEN_INDEX_DISPLAY_TO_VALUE(*screenIndex);
-	int displayModeIndex = APP_SCREEN_INDEX_MODE_TO_VALUE(*screenIndex);
+// The display list and each display's fullscreen modes are fetched once, and
+// kept until SDL reports a display change; the config menu queries them every
+// frame while the screen mode pages are shown.
+static bool APP_UpdateDisplays(void)
+{
+	if (APP_Displays) {
+		return true;
+	}
 	int displayCount;
-	displays = SDL_GetDisplays(&displayCount);
+	SDL_DisplayID* const displays = SDL_GetDisplays(&displayCount);
 	if (!displays) {
-		APP_SetError("Could not get list of displays: %s", SDL_GetError());
-		goto fail;
+		return false;
 	}
-	const SDL_DisplayID display = displays[displayIndex];
-	SDL_free(displays);
-	displays = NULL;
-	// TODO: There's a bug in the Vita port of SDL 3.2.24 where displayModeCount is set to 0. An issue/PR should be submitted to libsdl-org/SDL. We avoid needing to deal with the bug by using APP_SCREEN_MODE_FULLSCREEN_DESKTOP on Vita.
-	int displayModeCount;
-	displayModes = SDL_GetFullscreenDisplayModes(display, &displayModeCount);
-	if (!displayModes) {
-		APP_SetError("Could not get list of fullscreen display modes: %s", SDL_GetError());
-		goto fail;
+	SDL_DisplayMode*** const displayModes = SDL_calloc(displayCount + 1, sizeof(SDL_DisplayMode**));
+	int* const displayModeCounts = SDL_calloc(displayCount + 1, sizeof(int));
+	if (!displayModes || !displayModeCounts) {
+		SDL_free(displayModeCounts);
+		SDL_free(displayModes);
+		SDL_free(displays);
+		return false;
 	}
+	APP_Displays = displays;
+	APP_DisplayModes = displayModes;
+	APP_DisplayModeCounts = displayModeCounts;
+	APP_DisplayCount = displayCount;
+	return true;
+}
 
-	windowX = SDL_WINDOWPOS_CENTERED_DISPLAY(display);
-	windowY = SDL_WINDOWPOS_CENTERED_DISPLAY(display);
-	if (
-		displayIndex >= displayCount ||
-		(windowType == APP_SCREEN_MODE_FULLSCREEN && displayModeCount > 0 && displayModeIndex >= displayModeCount)
-	) {
-		*screenMode = APP_DEFAULT_SCREEN_MODE;
-		*screenIndex = 0;
-		displayModeIndex = 0;
-		displayIndex = 0;
+// The display index must be valid for the current display list.
+static SDL_DisplayMode** APP_GetFullscreenDisplayModes(int displayIndex, int* count)
+{
+	if (!APP_DisplayModes[displayIndex]) {
+		APP_DisplayModes[displayIndex] = SDL_GetFullscreenDisplayModes(APP_Displays[displayIndex], &APP_DisplayModeCounts[displayIndex]);
+		if (!APP_DisplayModes[displayIndex]) {
+			return NULL;
+		}
 	}
-	const bool maximized = windowType == APP_SCREEN_MODE_WINDOW_MAXIMIZED;
+	*count = APP_DisplayModeCounts[displayIndex];
+	return APP_DisplayModes[displayIndex];
+}
 
-	if (*screenMode & APP_SCREEN_MODE_DETAIL_LEVEL) {
-		logicalWidth  = 640;
-		logicalHeight = 480;
-	}
-	else {
-		logicalWidth  = 320;
-		logicalHeight = 240;
+static void APP_FreeDisplays(void)
+{
+	if (APP_DisplayModes) {
+		for (int i = 0; i < APP_DisplayCount; i++) {
+			SDL_free(APP_DisplayModes[i]);
+		}
 	}
+	SDL_free(APP_DisplayModes);
+	APP_DisplayModes = NULL;
+	SDL_free(APP_DisplayModeCounts);
+	APP_DisplayModeCounts = NULL;
+	SDL_free(APP_Displays);
+	APP_Displays = NULL;
+	APP_DisplayCount = 0;
+}
 
-	APP_LogicalWidth  = logicalWidth;
-	APP_LogicalHeight = logicalHeight;
+void APP_InvalidateDisplays(void)
+{
+	APP_FreeDisplays();
+	APP_DisplaysChanged = true;
+}
+
+// Creates the window, or changes the existing window, for the screen mode.
+// In windowed modes, the mode index is the window scale, and is reset to 1x if
+// the scale doesn't fit the desktop.
+static bool APP_SetScreenWindow(APP_ScreenModeFlag windowType, int32_t* screenIndex, SDL_DisplayID display, const SDL_DisplayMode* fullscreenMode, int logicalWidth, int logicalHeight)
+{
+	const int displayIndex = APP_SCREEN_INDEX_DISPLAY_TO_VALUE(*screenIndex);
+	const int displayModeIndex = APP_SCREEN_INDEX_MODE_TO_VALUE(*screenIndex);
+	const int windowX = SDL_WINDOWPOS_CENTERED_DISPLAY(display);
+	const int windowY = SDL_WINDOWPOS_CENTERED_DISPLAY(display);
+	const bool maximized = windowType == APP_SCREEN_MODE_WINDOW_MAXIMIZED;
 
 	/* ウィンドウの作成 || Create and set up the window */
 #ifdef APP_SET_WINDOW_ICON
@@ -277,7 +413,7 @@ void APP_SetScreen(APP_ScreenModeFlag* screenMode, int32_t* screenIndex)
 				APP_SetError("Could not create window: %s", SDL_GetError());
 				goto fail;
 			}
-			if (windowType == APP_SCREEN_MODE_FULLSCREEN && !SDL_SetWindowFullscreenMode(APP_ScreenWindow, displayModes[displayModeIndex])) {
+			if (fullscreenMode && !SDL_SetWindowFullscreenMode(APP_ScreenWindow, fullscreenMode)) {
 				APP_SetError("Could not set window fullscreen mode: %s", SDL_GetError());
 				goto fail;
 			}
@@ -294,7 +430,7 @@ void APP_SetScreen(APP_ScreenModeFlag* screenMode, int32_t* screenIndex)
 				APP_SetError("Could not set window size: %s", SDL_GetError());
 				goto fail;
 			}
-			if (!SDL_SetWindowFullscreenMode(APP_ScreenWindow, (windowType == APP_SCREEN_MODE_FULLSCREEN) ? displayModes[displayModeIndex] : NULL)) {
+			if (!SDL_SetWindowFullscreenMode(APP_ScreenWindow, fullscreenMode)) {
 				APP_SetError("Could not set window fullscreen mode: %s", SDL_GetError());
 				goto fail;
 			}
@@ -382,8 +518,6 @@ void APP_SetScreen(APP_ScreenModeFlag* screenMode, int32_t* screenIndex)
 			}
 		}
 	}
-	SDL_free(displayModes);
-	displayModes = NULL;
 #ifdef APP_SET_WINDOW_ICON
 	if (createdWindow) {
 		const char* type;
@@ -404,6 +538,88 @@ void APP_SetScreen(APP_ScreenModeFlag* screenMode, int32_t* screenIndex)
 	}
 #endif
 
+	return true;
+
+	fail:
+	return false;
+}
+
+void APP_SetScreen(APP_ScreenModeFlag* screenMode, int32_t* screenIndex)
+{
+	int logicalWidth, logicalHeight;
+
+	/* 画面の設定 || Set up the screen */
+
+	// The capture rectangle is clipped to the current screen.
+	APP_StopCapture();
+
+	/* Validate the window type */
+	APP_ScreenModeFlag windowType = *screenMode & APP_SCREEN_MODE_WINDOW_TYPE;
+	if (windowType >= APP_SCREEN_MODE_WINDOW_TYPES_COUNT) {
+		APP_SetError("Invalid window type value of %d", (int)windowType);
+		goto fail;
+	}
+
+	if (!APP_UpdateDisplays()) {
+		APP_SetError("Could not get list of displays: %s", SDL_GetError());
+		goto fail;
+	}
+	int displayIndex = APP_SCREEN_INDEX_DISPLAY_TO_VALUE(*screenIndex);
+	int displayModeIndex = APP_SCREEN_INDEX_MODE_TO_VALUE(*screenIndex);
+	if (displayIndex >= APP_DisplayCount) {
+		*screenMode = APP_DEFAULT_SCREEN_MODE;
+		*screenIndex = 0;
+		displayModeIndex = 0;
+		displayIndex = 0;
+	}
+	// TODO: There's a bug in the Vita port of SDL 3.2.24 where displayModeCount is set to 0. An issue/PR should be submitted to libsdl-org/SDL. We avoid needing to deal with the bug by using APP_SCREEN_MODE_FULLSCREEN_DESKTOP on Vita.
+	int displayModeCount;
+	SDL_DisplayMode** displayModes = APP_GetFullscreenDisplayModes(displayIndex, &displayModeCount);
+	if (!displayModes) {
+		APP_SetError("Could not get list of fullscreen display modes: %s", SDL_GetError());
+		goto fail;
+	}
+	if (windowType == APP_SCREEN_MODE_FULLSCREEN && displayModeCount > 0 && displayModeIndex >= displayModeCount) {
+		*screenMode = APP_DEFAULT_SCREEN_MODE;
+		*screenIndex = 0;
+		displayModeIndex = 0;
+		displayIndex = 0;
+		displayModes = APP_GetFullscreenDisplayModes(displayIndex, &displayModeCount);
+		if (!displayModes) {
+			APP_SetError("Could not get list of fullscreen display modes: %s", SDL_GetError());
+			goto fail;
+		}
+	}
+	const SDL_DisplayID display = APP_Displays[displayIndex];
+	const SDL_DisplayMode* const fullscreenMode = (windowType == APP_SCREEN_MODE_FULLSCREEN && displayModeIndex < displayModeCount) ? displayModes[displayModeIndex] : NULL;
+
+	if (*screenMode & APP_SCREEN_MODE_DETAIL_LEVEL) {
+		logicalWidth  = 640;
+		logicalHeight = 480;
+	}
+	else {
+		logicalWidth  = 320;
+		logicalHeight = 240;
+	}
+
+	APP_LogicalWidth  = logicalWidth;
+	APP_LogicalHeight = logicalHeight;
+
+	// Restarting for a setting that doesn't change the window (vsync, scale
+	// mode, render level, or any non-video setting) leaves the window as it
+	// is, and doesn't wait on the window system to apply the same state again.
+	const APP_ScreenModeFlag windowModeMask = APP_SCREEN_MODE_WINDOW_TYPE | APP_SCREEN_MODE_DETAIL_LEVEL;
+	const bool setWindow =
+		!APP_ScreenWindow || APP_DisplaysChanged ||
+		(*screenMode & windowModeMask) != (APP_ScreenMode & windowModeMask) ||
+		*screenIndex != APP_ScreenIndex;
+	if (setWindow) {
+		if (!APP_SetScreenWindow(windowType, screenIndex, display, fullscreenMode, logicalWidth, logicalHeight)) {
+			goto fail;
+		}
+		APP_DisplaysChanged = false;
+	}
+
 	// Create the renderer, if not already created. It's important to not
 	// recreate the renderer if it's already created, so restarting without
 	// changing the detail level doesn't require reloading graphics. If the
@@ -411,11 +627,21 @@ void APP_SetScreen(APP_ScreenModeFlag* screenMode, int32_t* screenIndex)
 	// to reload the graphics every restart, even when detail level isn't
 	// changed.
 	if (!APP_ScreenRenderer) {
+#ifdef APP_REPLAY_RENDER
+		// Offline rendering runs on the CPU, and never shows the window.
+		if (!SDL_HideWindow(APP_ScreenWindow)) {
+			APP_SetError("Could not hide window: %s", SDL_GetError());
+			goto fail;
+		}
+		APP_ScreenRenderer = SDL_CreateRenderer(APP_ScreenWindow, SDL_SOFTWARE_RENDERER);
+#else
 		APP_ScreenRenderer = SDL_CreateRenderer(APP_ScreenWindow, NULL);
+#endif
 		if (!APP_ScreenRenderer) {
 			APP_SetError("Could not create renderer: %s", SDL_GetError());
 			goto fail;
 		}
+		APP_PlaneTextureFormat = APP_GetPlaneTextureFormat(APP_ScreenRenderer);
 	}
 	if (
 		!SDL_RenderClear(APP_ScreenRenderer) ||
@@ -461,7 +687,13 @@ void APP_SetScreen(APP_ScreenModeFlag* screenMode, int32_t* screenIndex)
 	}
 
 	/* Set up the render target, if required */
-	if (!(*screenMode & APP_SCREEN_MODE_RENDER_LEVEL)) {
+#ifdef APP_REPLAY_RENDER
+	// Movie frames are read back from the render target.
+	const bool useRenderTarget = true;
+#else
+	const bool useRenderTarget = !(*screenMode & APP_SCREEN_MODE_RENDER_LEVEL);
+#endif
+	if (useRenderTarget) {
 		// There's no need to create a render target texture if the
 		// currently created render target texture is already the current
 		// logicalWidth x logicalHeight.
@@ -527,8 +759,10 @@ void APP_SetScreen(APP_ScreenModeFlag* screenMode, int32_t* screenIndex)
 		goto fail;
 	}
 
-	while (!SDL_SyncWindow(APP_ScreenWindow)) {
-		SDL_Delay(1);
+	if (setWindow) {
+		while (!SDL_SyncWindow(APP_ScreenWindow)) {
+			SDL_Delay(1);
+		}
 	}
 
 	/* Setup was successful, so return with success */
@@ -546,8 +780,6 @@ void APP_SetScreen(APP_ScreenModeFlag* screenMode, int32_t* screenIndex)
 	if (APP_ScreenWindow) {
 		SDL_DestroyWindow(APP_ScreenWindow);
 	}
-	SDL_free(displayModes);
-	SDL_free(displays);
 	APP_ScreenRenderTarget = NULL;
 	APP_ScreenRenderer = NULL;
 	APP_ScreenWindow = NULL;
@@ -556,14 +788,11 @@ void APP_SetScreen(APP_ScreenModeFlag* screenMode, int32_t* screenIndex)
 
 int APP_GetMaxDisplayIndex(void)
 {
-	int displayCount;
-	SDL_DisplayID* displays = SDL_GetDisplays(&displayCount);
-	if (!displays) {
+	if (!APP_UpdateDisplays()) {
 		APP_SetError("Failed getting list of displays: %s", SDL_GetError());
 		return -1;
 	}
-	SDL_free(displays);
-	return displayCount;
+	return APP_DisplayCount;
 }
 
 int APP_GetMaxDisplayMode(int displayIndex)
@@ -572,26 +801,19 @@ int APP_GetMaxDisplayMode(int displayIndex)
 		APP_SetError("displayIndex invalid, must be at least 0");
 		return -1;
 	}
-	int displayCount;
-	SDL_DisplayID* displays = SDL_GetDisplays(&displayCount);
-	if (!displays) {
+	if (!APP_UpdateDisplays()) {
 		APP_SetError("Failed getting list of displays: %s", SDL_GetError());
 		return -1;
 	}
-	if (displayIndex >= displayCount) {
-		SDL_free(displays);
+	if (displayIndex >= APP_DisplayCount) {
 		APP_SetError("Display index is too high");
 		return -1;
 	}
 	int modeCount;
-	SDL_DisplayMode** modes = SDL_GetFullscreenDisplayModes(displays[displayIndex], &modeCount);
-	if (!modes) {
-		SDL_free(displays);
+	if (!APP_GetFullscreenDisplayModes(displayIndex, &modeCount)) {
 		APP_SetError("Could not get list of fullscreen display modes");
 		return -1;
 	}
-	SDL_free(displays);
-	SDL_free(modes);
 	return modeCount;
 }
 
@@ -609,22 +831,21 @@ void APP_GetDisplayMode(int displayIndex, int modeIndex, SDL_DisplayMode* mode)
 		APP_SetError("%s", SDL_InvalidParamError("mode"));
 		APP_Exit(SDL_APP_FAILURE);
 	}
-	int displayCount;
-	SDL_DisplayID* displays = SDL_GetDisplays(&displayCount);
-	if (!displays) {
+	if (!APP_UpdateDisplays()) {
 		APP_SetError("Could not get list of displays: %s", SDL_GetError());
 		APP_Exit(SDL_APP_FAILURE);
 	}
-	if (displayIndex >= displayCount) {
-		SDL_free(displays);
-		APP_SetError("Number of displays is %d but requested display index is too high at %d", displayCount, displayIndex);
+	if (displayIndex >= APP_DisplayCount) {
+		APP_SetError("Number of displays is %d but requested display index is too high at %d", APP_DisplayCount, displayIndex);
 		APP_Exit(SDL_APP_FAILURE);
 	}
 	int modeCount;
-	SDL_DisplayMode** modes = SDL_GetFullscreenDisplayModes(displays[displayIndex], &modeCount);
-	SDL_free(displays);
+	SDL_DisplayMode** const modes = APP_GetFullscreenDisplayModes(displayIndex, &modeCount);
+	if (!modes) {
+		APP_SetError("Could not get list of fullscreen display modes: %s", SDL_GetError());
+		APP_Exit(SDL_APP_FAILURE);
+	}
 	if (modeIndex >= modeCount) {
-		SDL_free(modes);
 		APP_SetError("Number of display modes is %d but requested display mode index is too high at %d", modeCount, modeIndex);
 		APP_Exit(SDL_APP_FAILURE);
 	}
@@ -637,19 +858,15 @@ const SDL_DisplayMode* APP_GetDesktopDisplayMode(int displayIndex)
 		APP_SetError("Invalid display index of %d, must be at least 0", displayIndex);
 		APP_Exit(SDL_APP_FAILURE);
 	}
-	int displayCount;
-	SDL_DisplayID* displays = SDL_GetDisplays(&displayCount);
-	if (!displays) {
+	if (!APP_UpdateDisplays()) {
 		APP_SetError("Error getting list of displays: %s", SDL_GetError());
 		APP_Exit(SDL_APP_FAILURE);
 	}
-	if (displayIndex >= displayCount) {
-		SDL_free(displays);
+	if (displayIndex >= APP_DisplayCount) {
 		APP_SetError("Display index is too high");
 		APP_Exit(SDL_APP_FAILURE);
 	}
-	const SDL_DisplayMode* mode = SDL_GetDesktopDisplayMode(displays[displayIndex]);
-	SDL_free(displays);
+	const SDL_DisplayMode* mode = SDL_GetDesktopDisplayMode(APP_Displays[displayIndex]);
 	if (!mode) {
 		APP_SetError("Error getting desktop display mode: %s", SDL_GetError());
 		APP_Exit(SDL_APP_FAILURE);
@@ -742,7 +959,9 @@ void APP_PutTextLayerString(int layer, const char* string)
 	if (!APP_TextLayers[layer].string || SDL_strcmp(string, APP_TextLayers[layer].string) != 0) {
 		const size_t newStringSize = SDL_strlen(string) + 1;
 		if (newStringSize > APP_TextLayers[layer].stringSize) {
+			const APP_MemoryTag memoryTag = APP_SetMemoryTag(APP_MEMORY_VIDEO);
 			char* const newString = SDL_realloc(APP_TextLayers[layer].string, newStringSize);
+			APP_SetMemoryTag(memoryTag);
 			if (!newString) {
 				APP_SetError("Failed allocating memory for putting a string into a text layer");
 				APP_Exit(SDL_APP_FAILURE);
@@ -784,6 +1003,7 @@ void APP_DrawTextLayer(int layer)
 	}
 
 	if (APP_TextLayers[layer].updateTexture) {
+		const APP_MemoryTag memoryTag = APP_SetMemoryTag(APP_MEMORY_VIDEO);
 		if (APP_TextLayers[layer].texture) {
 			SDL_DestroyTexture(APP_TextLayers[layer].texture);
 		}
@@ -797,19 +1017,18 @@ void APP_DrawTextLayer(int layer)
 			APP_Exit(SDL_APP_FAILURE);
 		}
 		APP_TextLayers[layer].updateTexture = false;
+		APP_SetMemoryTag(memoryTag);
 	}
 
 	if (APP_TextLayers[layer].texture) {
-		SDL_FRect dstRect = {
-			APP_TextLayers[layer].x + APP_PlaneDrawOffsetX,
-			APP_TextLayers[layer].y + APP_PlaneDrawOffsetY,
+		float offsetX, offsetY;
+		APP_GetDrawOffset(&offsetX, &offsetY);
+		const SDL_FRect dstRect = {
+			APP_TextLayers[layer].x + offsetX,
+			APP_TextLayers[layer].y + offsetY,
 			APP_TextLayers[layer].textureW,
 			APP_TextLayers[layer].textureH
 		};
-		if (!APP_ScreenRenderTarget) {
-			dstRect.x += APP_ScreenSubpixelOffset;
-			dstRect.y += APP_ScreenSubpixelOffset;
-		}
 		if (!SDL_RenderTexture(APP_ScreenRenderer, APP_TextLayers[layer].texture, NULL, &dstRect)) {
 			APP_SetError("Error rendering text layer: %s", SDL_GetError());
 			APP_Exit(SDL_APP_FAILURE);
@@ -884,13 +1103,22 @@ static bool APP_LoadPlaneCallback(void* userdata)
 	APP_LoadPlaneData* const data = userdata;
 	const char* type;
 	SDL_IOStream* const file = APP_OpenImage(data->filename, &type);
-	SDL_free(data->filename);
-	data->filename = NULL;
 	if (!file) {
 		data->surface = NULL;
 		return true;
 	}
 	data->surface = IMG_LoadTyped_IO(file, true, type);
+	if (!data->surface) {
+		return false;
+	}
+
+	// Convert here on the worker, so the main thread only has to upload the
+	// pixels as-is. Color keys become alpha in the conversion.
+	if (data->surface->format != APP_PlaneTextureFormat || SDL_SurfaceHasColorKey(data->surface)) {
+		SDL_Surface* const converted = SDL_ConvertSurface(data->surface, APP_PlaneTextureFormat);
+		SDL_DestroySurface(data->surface);
+		data->surface = converted;
+	}
 	return data->surface != NULL;
 }
 
@@ -900,19 +1128,19 @@ void APP_LoadPlane(int plane, const char* filename)
 		return;
 	}
 
+	APP_ClosePlaneStream(plane);
 	if (APP_Planes[plane]) {
 		SDL_DestroyTexture(APP_Planes[plane]);
 	}
 	APP_Planes[plane] = NULL;
-	APP_PlanesLoadData[plane].filename = SDL_strdup(filename);
-	if (!APP_PlanesLoadData[plane].filename) {
-		APP_SetError("Failed loading a plane");
+	// Cache layers might have the old image drawn into them.
+	APP_LoseCacheLayers();
+	if (SDL_strlcpy(APP_PlanesLoadData[plane].filename, filename, APP_PLANE_FILENAME_SIZE) >= APP_PLANE_FILENAME_SIZE) {
+		APP_SetError("Failed loading a plane, filename \"%s\" is too long", filename);
 		APP_Exit(SDL_APP_FAILURE);
 	}
 	APP_PlanesLoadData[plane].job = APP_SubmitWorkerJob(APP_LoadingWorker, APP_LoadPlaneCallback, &APP_PlanesLoadData[plane]);
 	if (!APP_PlanesLoadData[plane].job) {
-		SDL_free(APP_PlanesLoadData[plane].filename);
-		APP_PlanesLoadData[plane].filename = NULL;
 		APP_SetError("Failed loading a plane: %s", SDL_GetError());
 		APP_Exit(SDL_APP_FAILURE);
 	}
@@ -927,8 +1155,15 @@ static bool APP_HaveSinglePlane(int plane)
 		APP_SetError("Failed to finish loading a plane: %s", SDL_GetError());
 		APP_Exit(SDL_APP_FAILURE);
 	}
-	APP_Planes[plane] = SDL_CreateTextureFromSurface(APP_ScreenRenderer, APP_PlanesLoadData[plane].surface);
-	SDL_DestroySurface(APP_PlanesLoadData[plane].surface);
+	SDL_Surface* const surface = APP_PlanesLoadData[plane].surface;
+	if (surface) {
+		APP_Planes[plane] = SDL_CreateTexture(APP_ScreenRenderer, surface->format, SDL_TEXTUREACCESS_STATIC, surface->w, surface->h);
+		if (APP_Planes[plane] && !SDL_UpdateTexture(APP_Planes[plane], NULL, surface->pixels, surface->pitch)) {
+			SDL_DestroyTexture(APP_Planes[plane]);
+			APP_Planes[plane] = NULL;
+		}
+	}
+	SDL_DestroySurface(surface);
 	APP_PlanesLoadData[plane].surface = NULL;
 	APP_PlanesLoadData[plane].job = 0;
 	if (!APP_Planes[plane]) {
@@ -964,6 +1199,232 @@ bool APP_HavePlane(int plane)
 	}
 }
 
+static bool APP_ImageExists(const char* filename)
+{
+	char* filenameExt;
+	for (size_t i = 0; i < SDL_arraysize(APP_ImageTypes); i++) {
+		if (SDL_asprintf(&filenameExt, "%s.%s", filename, APP_ImageTypes[i]) < 0) {
+			APP_SetError("Error checking for image file");
+			APP_Exit(SDL_APP_FAILURE);
+		}
+		const bool exists = APP_FileExists(filenameExt);
+		SDL_free(filenameExt);
+		if (exists) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// Waits for the slot's frame to finish decoding, then uploads it into the
+// slot's texture.
+static void APP_FinishPlaneStreamSlot(APP_PlaneStreamSlot* slot)
+{
+	if (!slot->load.job) {
+		return;
+	}
+	else if (!APP_WaitWorkerJob(APP_LoadingWorker, slot->load.job)) {
+		APP_SetError("Failed to finish loading a plane stream frame: %s", SDL_GetError());
+		APP_Exit(SDL_APP_FAILURE);
+	}
+	slot->load.job = 0;
+	SDL_Surface* const surface = slot->load.surface;
+	slot->load.surface = NULL;
+	if (!surface) {
+		APP_SetError("Plane stream frame %d was not found", slot->frame);
+		APP_Exit(SDL_APP_FAILURE);
+	}
+
+	// Every frame has been converted to the same format, so the texture is
+	// reused unless the size changes.
+	float w, h;
+	if (slot->texture && (!SDL_GetTextureSize(slot->texture, &w, &h) || (int)w != surface->w || (int)h != surface->h)) {
+		SDL_DestroyTexture(slot->texture);
+		slot->texture = NULL;
+	}
+	if (!slot->texture) {
+		APP_MarkMemoryBusyFrame();
+		slot->texture = SDL_CreateTexture(APP_ScreenRenderer, surface->format, SDL_TEXTUREACCESS_STATIC, surface->w, surface->h);
+		if (
+			!slot->texture ||
+			!SDL_SetTextureScaleMode(slot->texture, SDL_SCALEMODE_NEAREST) ||
+			!SDL_SetTextureBlendMode(slot->texture, SDL_BLENDMODE_BLEND)
+		) {
+			APP_SetError("Failed to create texture for a plane stream frame: %s", SDL_GetError());
+			APP_Exit(SDL_APP_FAILURE);
+		}
+	}
+	if (!SDL_UpdateTexture(slot->texture, NULL, surface->pixels, surface->pitch)) {
+		APP_SetError("Failed to upload a plane stream frame: %s", SDL_GetError());
+		APP_Exit(SDL_APP_FAILURE);
+	}
+	SDL_DestroySurface(surface);
+}
+
+static void APP_DiscardPlaneStreamSlot(APP_PlaneStreamSlot* slot)
+{
+	if (slot->load.job) {
+		APP_WaitWorkerJob(APP_LoadingWorker, slot->load.job);
+		SDL_DestroySurface(slot->load.surface);
+		slot->load.surface = NULL;
+		slot->load.job = 0;
+	}
+	slot->frame = -1;
+}
+
+static APP_PlaneStreamSlot* APP_FindPlaneStreamSlot(APP_PlaneStream* stream, int frame)
+{
+	for (int i = 0; i < APP_PLANE_STREAM_SLOTS; i++) {
+		if (stream->slots[i].frame == frame) {
+			return &stream->slots[i];
+		}
+	}
+	return NULL;
+}
+
+// Makes sure the frame and the ones following it are decoded or decoding,
+// reusing the slots of frames that aren't needed anymore. The shown frame's
+// slot is never reused.
+static void APP_QueuePlaneStreamFrames(APP_PlaneStream* stream, int frame)
+{
+	const int ahead = SDL_min(APP_PLANE_STREAM_AHEAD, stream->frameCount);
+	for (int i = 0; i < ahead; i++) {
+		const int wanted = (frame + i) % stream->frameCount;
+		if (APP_FindPlaneStreamSlot(stream, wanted)) {
+			continue;
+		}
+
+		// There's always a free slot, as no more frames than there are slots
+		// are wanted, besides the shown frame.
+		APP_PlaneStreamSlot* slot = NULL;
+		for (int j = 0; j < APP_PLANE_STREAM_SLOTS; j++) {
+			const int slotFrame = stream->slots[j].frame;
+			if (slotFrame < 0 || (slotFrame != stream->shownFrame && (slotFrame - frame + stream->frameCount) % stream->frameCount >= ahead)) {
+				slot = &stream->slots[j];
+				break;
+			}
+		}
+		APP_DiscardPlaneStreamSlot(slot);
+		if (SDL_snprintf(slot->load.filename, APP_PLANE_FILENAME_SIZE, "%s_%03d", stream->filename, wanted) >= APP_PLANE_FILENAME_SIZE) {
+			APP_SetError("Failed loading a plane stream frame, filename \"%s\" is too long", stream->filename);
+			APP_Exit(SDL_APP_FAILURE);
+		}
+		APP_MarkMemoryBusyFrame();
+		slot->load.job = APP_SubmitWorkerJob(APP_LoadingWorker, APP_LoadPlaneCallback, &slot->load);
+		if (!slot->load.job) {
+			APP_SetError("Failed loading a plane stream frame: %s", SDL_GetError());
+			APP_Exit(SDL_APP_FAILURE);
+		}
+		slot->frame = wanted;
+	}
+}
+
+static void APP_ClosePlaneStream(int plane)
+{
+	APP_PlaneStream* const stream = APP_PlaneStreams[plane];
+	if (!stream) {
+		return;
+	}
+
+	for (int i = 0; i < APP_PLANE_STREAM_SLOTS; i++) {
+		APP_DiscardPlaneStreamSlot(&stream->slots[i]);
+		if (stream->slots[i].texture) {
+			SDL_DestroyTexture(stream->slots[i].texture);
+		}
+	}
+	SDL_free(stream->filename);
+	SDL_free(stream);
+	APP_PlaneStreams[plane] = NULL;
+	// The plane only pointed at one of the slots' textures.
+	APP_Planes[plane] = NULL;
+}
+
+bool APP_LoadPlaneStream(int plane, const char* filename, int frameCount)
+{
+	if (!APP_ScreenRenderer || !filename || !*filename || plane < 0 || plane >= APP_PlaneCount || frameCount <= 0) {
+		return false;
+	}
+
+	char* firstFrame;
+	if (SDL_asprintf(&firstFrame, "%s_%03d", filename, 0) < 0) {
+		APP_SetError("Failed loading a plane stream");
+		APP_Exit(SDL_APP_FAILURE);
+	}
+	const bool exists = APP_ImageExists(firstFrame);
+	SDL_free(firstFrame);
+	if (!exists) {
+		return false;
+	}
+
+	APP_ClosePlaneStream(plane);
+	if (APP_PlanesLoadData[plane].job) {
+		APP_WaitWorkerJob(APP_LoadingWorker, APP_PlanesLoadData[plane].job);
+		SDL_DestroySurface(APP_PlanesLoadData[plane].surface);
+		APP_PlanesLoadData[plane].surface = NULL;
+		APP_PlanesLoadData[plane].job = 0;
+	}
+	if (APP_Planes[plane]) {
+		SDL_DestroyTexture(APP_Planes[plane]);
+	}
+	APP_Planes[plane] = NULL;
+	// Cache layers might have the old image drawn into them.
+	APP_LoseCacheLayers();
+
+	APP_PlaneStream* const stream = SDL_calloc(1, sizeof(APP_PlaneStream));
+	if (!stream) {
+		APP_SetError("Failed to allocate memory for a plane stream");
+		APP_Exit(SDL_APP_FAILURE);
+	}
+	stream->filename = SDL_strdup(filename);
+	if (!stream->filename) {
+		SDL_free(stream);
+		APP_SetError("Failed loading a plane stream");
+		APP_Exit(SDL_APP_FAILURE);
+	}
+	stream->frameCount = frameCount;
+	stream->shownFrame = -1;
+	for (int i = 0; i < APP_PLANE_STREAM_SLOTS; i++) {
+		stream->slots[i].frame = -1;
+	}
+	APP_PlaneStreams[plane] = stream;
+	APP_QueuePlaneStreamFrames(stream, 0);
+	return true;
+}
+
+bool APP_SetPlaneStreamFrame(int plane, int frame)
+{
+	if (plane < 0 || plane >= APP_PlaneCount || !APP_PlaneStreams[plane]) {
+		return false;
+	}
+
+	APP_PlaneStream* const stream = APP_PlaneStreams[plane];
+	frame %= stream->frameCount;
+	if (frame < 0) {
+		frame += stream->frameCount;
+	}
+	APP_QueuePlaneStreamFrames(stream, frame);
+
+	// Frames decoded ahead are uploaded as soon as they're ready, so the
+	// uploads are spread out instead of all happening when shown.
+	for (int i = 0; i < APP_PLANE_STREAM_SLOTS; i++) {
+		APP_PlaneStreamSlot* const slot = &stream->slots[i];
+		if (slot->load.job && APP_GetWorkerJobStatus(APP_LoadingWorker, slot->load.job) != APP_WORKER_JOB_IN_PROGRESS) {
+			APP_FinishPlaneStreamSlot(slot);
+		}
+	}
+
+	// If the frame is still decoding, the previous frame stays shown instead
+	// of the game loop waiting for it. Only the first frame is waited for.
+	APP_PlaneStreamSlot* const current = APP_FindPlaneStreamSlot(stream, frame);
+	if (current->load.job && stream->shownFrame >= 0) {
+		return true;
+	}
+	APP_FinishPlaneStreamSlot(current);
+	stream->shownFrame = frame;
+	APP_Planes[plane] = current->texture;
+	return true;
+}
+
 void APP_DrawPlane(int plane, int dstX, int dstY)
 {
 	if (plane < 0 || plane >= APP_PlaneCount || !APP_HavePlane(plane) || !APP_RenderThisFrame()) {
@@ -983,23 +1444,42 @@ void APP_DrawPlaneRect(int plane, int dstX, int dstY, int srcX, int srcY, int w,
 		return;
 	}
 
+	float offsetX, offsetY;
+	APP_GetDrawOffset(&offsetX, &offsetY);
 	const SDL_FRect src = { srcX, srcY, w, h };
-	SDL_FRect dst = {
-		dstX + APP_PlaneDrawOffsetX,
-		dstY + APP_PlaneDrawOffsetY,
+	const SDL_FRect dst = {
+		dstX + offsetX,
+		dstY + offsetY,
 		w,
 		h
 	};
-	if (!APP_ScreenRenderTarget) {
-		dst.x += APP_ScreenSubpixelOffset;
-		dst.y += APP_ScreenSubpixelOffset;
-	}
 
 	if (!SDL_RenderTexture(APP_ScreenRenderer, APP_Planes[plane], &src, &dst)) {
 		APP_Exit(SDL_APP_FAILURE);
 	}
 }
 
+void APP_DrawPlaneRectTiled(int plane, int dstX, int dstY, int dstW, int dstH, int srcX, int srcY, int w, int h)
+{
+	if (plane < 0 || plane >= APP_PlaneCount || !APP_HavePlane(plane) || w == 0 || h == 0 || dstW == 0 || dstH == 0 || !APP_RenderThisFrame()) {
+		return;
+	}
+
+	float offsetX, offsetY;
+	APP_GetDrawOffset(&offsetX, &offsetY);
+	const SDL_FRect src = { srcX, srcY, w, h };
+	const SDL_FRect dst = {
+		dstX + offsetX,
+		dstY + offsetY,
+		dstW,
+		dstH
+	};
+
+	if (!SDL_RenderTextureTiled(APP_ScreenRenderer, APP_Planes[plane], &src, 1.0f, &dst)) {
+		APP_Exit(SDL_APP_FAILURE);
+	}
+}
+
 void APP_DrawPlaneTransparent(int plane, int dstX, int dstY, uint8_t a)
 {
 	if (plane < 0 || plane >= APP_PlaneCount || !APP_HavePlane(plane) || !APP_RenderThisFrame()) {
@@ -1046,17 +1526,15 @@ void APP_DrawPlaneRectScaled(int plane, int dstX, int dstY, int srcX, int srcY,
 	}
 
 	// ちゃんと拡大して描画する
+	float offsetX, offsetY;
+	APP_GetDrawOffset(&offsetX, &offsetY);
 	const SDL_FRect src = { srcX, srcY, w, h };
-	SDL_FRect dst = {
-		dstX + APP_PlaneDrawOffsetX,
-		dstY + APP_PlaneDrawOffsetY,
+	const SDL_FRect dst = {
+		dstX + offsetX,
+		dstY + offsetY,
 		(int)(w * (scaleW / 65536.0f)),
 		(int)(h * (scaleH / 65536.0f))
 	};
-	if (!APP_ScreenRenderTarget) {
-		dst.x += APP_ScreenSubpixelOffset;
-		dst.y += APP_ScreenSubpixelOffset;
-	}
 	if (!SDL_RenderTexture(APP_ScreenRenderer, APP_Planes[plane], &src, &dst)) {
 		APP_SetError("Error rendering graphics: %s", SDL_GetError());
 		APP_Exit(SDL_APP_FAILURE);
@@ -1075,17 +1553,15 @@ void APP_DrawPlaneRectTransparentScaled(int plane, int dstX, int dstY, int srcX,
 	}
 
 	// ちゃんと拡大して描画する
+	float offsetX, offsetY;
+	APP_GetDrawOffset(&offsetX, &offsetY);
 	const SDL_FRect src = { srcX, srcY, w, h };
-	SDL_FRect dst = {
-		dstX + APP_PlaneDrawOffsetX,
-		dstY + APP_PlaneDrawOffsetX,
+	const SDL_FRect dst = {
+		dstX + offsetX,
+		dstY + offsetY,
 		w * (scaleW / 65536.0f),
 		h * (scaleH / 65536.0f)
 	};
-	if (!APP_ScreenRenderTarget) {
-		dst.x += APP_ScreenSubpixelOffset;
-		dst.y += APP_ScreenSubpixelOffset;
-	}
 	if (
 		!SDL_SetTextureAlphaMod(APP_Planes[plane], a) ||
 		!SDL_RenderTexture(APP_ScreenRenderer, APP_Planes[plane], &src, &dst) ||
@@ -1096,29 +1572,14 @@ void APP_DrawPlaneRectTransparentScaled(int plane, int dstX, int dstY, int srcX,
 	}
 }
 
-void APP_DrawPlaneText(int plane, const char* text, char firstChar, int charW, int charH, int dstX, int dstY, int sheetX, int sheetY, int sheetW)
+// Grows the vertex and index arrays shared by text drawing to hold length
+// characters.
+static bool APP_ReserveTextData(size_t length)
 {
-	if (
-		plane < 0 || plane >= APP_PlaneCount || !APP_HavePlane(plane) ||
-		!text || !*text || charW <= 0 || charH <= 0 || dstX >= APP_LogicalWidth || dstY >= APP_LogicalHeight || dstY + charH <= 0 ||
-		!APP_RenderThisFrame()
-	) {
-		return;
-	}
-	const size_t length = SDL_strlen(text);
-	if (length > INT_MAX / 6) {
-		APP_SetError("Length of text to draw is too long, %d is max supported", INT_MAX / 6);
-		goto fail;
-	}
-	if (dstX + length * charW <= 0) {
-		return;
-	}
-
 	if (length > APP_TextDataLength) {
 		SDL_Vertex* const vertices = SDL_realloc(APP_TextVertices, length * 4 * sizeof(SDL_Vertex));
 		if (!vertices) {
-			APP_SetError("Could not allocate vertex array");
-			goto fail;
+			return APP_SetError("Could not allocate vertex array");
 		}
 		APP_TextVertices = vertices;
 		for (
@@ -1131,8 +1592,7 @@ void APP_DrawPlaneText(int plane, const char* text, char firstChar, int charW, i
 
 		int* const indices = SDL_realloc(APP_TextIndices, length * 6 * sizeof(int));
 		if (!indices) {
-			APP_SetError("Could not allocate index array");
-			goto fail;
+			return APP_SetError("Could not allocate index array");
 		}
 		APP_TextIndices = indices;
 		int* index = APP_TextIndices + APP_TextDataLength * 6;
@@ -1153,16 +1613,38 @@ void APP_DrawPlaneText(int plane, const char* text, char firstChar, int charW, i
 
 		APP_TextDataLength = length;
 	}
+	return true;
+}
+
+void APP_DrawPlaneText(int plane, const char* text, char firstChar, int charW, int charH, int dstX, int dstY, int sheetX, int sheetY, int sheetW)
+{
+	if (
+		plane < 0 || plane >= APP_PlaneCount || !APP_HavePlane(plane) ||
+		!text || !*text || charW <= 0 || charH <= 0 || dstX >= APP_LogicalWidth || dstY >= APP_LogicalHeight || dstY + charH <= 0 ||
+		!APP_RenderThisFrame()
+	) {
+		return;
+	}
+	const size_t length = SDL_strlen(text);
+	if (length > INT_MAX / 6) {
+		APP_SetError("Length of text to draw is too long, %d is max supported", INT_MAX / 6);
+		goto fail;
+	}
+	if (dstX + length * charW <= 0) {
+		return;
+	}
+
+	if (!APP_ReserveTextData(length)) {
+		goto fail;
+	}
 
 	SDL_Vertex* vertex = APP_TextVertices;
 	const char* c = text;
 	SDL_Vertex* const verticesEnd = APP_TextVertices + length * 4;
-	float x = dstX + APP_PlaneDrawOffsetX;
-	float y = dstY + APP_PlaneDrawOffsetY;
-	if (!APP_ScreenRenderTarget) {
-		x += APP_ScreenSubpixelOffset;
-		y += APP_ScreenSubpixelOffset;
-	}
+	float x, y;
+	APP_GetDrawOffset(&x, &y);
+	x += dstX;
+	y += dstY;
 	float texW, texH;
 	if (!SDL_GetTextureSize(APP_Planes[plane], &texW, &texH)) {
 		goto fail;
@@ -1203,12 +1685,210 @@ void APP_DrawPlaneText(int plane, const char* text, char firstChar, int charW, i
 	APP_Exit(SDL_APP_FAILURE);
 }
 
+void APP_DrawPlaneGlyphs(int plane, const APP_Glyph* glyphs, int count, int w, int h, int scale)
+{
+	if (
+		plane < 0 || plane >= APP_PlaneCount || !APP_HavePlane(plane) ||
+		!glyphs || count <= 0 || w <= 0 || h <= 0 || scale <= 0 ||
+		!APP_RenderThisFrame()
+	) {
+		return;
+	}
+	if (!APP_ReserveTextData((size_t)count)) {
+		goto fail;
+	}
+
+	float offsetX, offsetY;
+	APP_GetDrawOffset(&offsetX, &offsetY);
+	float texW, texH;
+	if (!SDL_GetTextureSize(APP_Planes[plane], &texW, &texH)) {
+		goto fail;
+	}
+	const float charW = (float)(w * scale);
+	const float charH = (float)(h * scale);
+	const float texCharW = charW / texW;
+	const float texCharH = charH / texH;
+	SDL_Vertex* vertex = APP_TextVertices;
+	for (const APP_Glyph* glyph = glyphs, * const glyphsEnd = glyphs + count; glyph < glyphsEnd; glyph++) {
+		const float x = offsetX + glyph->dstX * scale;
+		const float y = offsetY + glyph->dstY * scale;
+		const float texX = glyph->srcX * scale / texW;
+		const float texY = glyph->srcY * scale / texH;
+
+		vertex[0].position = (SDL_FPoint) { x, y };
+		vertex[0].tex_coord = (SDL_FPoint) { texX, texY };
+
+		vertex[1].position = (SDL_FPoint) { x + charW, y };
+		vertex[1].tex_coord = (SDL_FPoint) { texX + texCharW, texY };
+
+		vertex[2].position = (SDL_FPoint) { x, y + charH };
+		vertex[2].tex_coord = (SDL_FPoint) { texX, texY + texCharH };
+
+		vertex[3].position = (SDL_FPoint) { x + charW, y + charH };
+		vertex[3].tex_coord = (SDL_FPoint) { texX + texCharW, texY + texCharH };
+
+		vertex += 4;
+	}
+
+	if (!SDL_RenderGeometry(APP_ScreenRenderer, APP_Planes[plane], APP_TextVertices, count * 4, APP_TextIndices, count * 6)) {
+		APP_SetError("Failed rendering: %s", SDL_GetError());
+		goto fail;
+	}
+	return;
+
+	fail:
+	APP_Exit(SDL_APP_FAILURE);
+}
+
 void APP_SetPlaneDrawOffset(int x, int y)
 {
 	APP_PlaneDrawOffsetX = x;
 	APP_PlaneDrawOffsetY = y;
 }
 
+static void APP_CheckCacheLayer(int layer)
+{
+	if (layer < 0 || layer >= APP_CacheLayerCount) {
+		if (APP_CacheLayerCount == 0) {
+			APP_SetError("Zero cache layers are available");
+		}
+		else {
+			APP_SetError("Invalid cache layer number requested, must be in range 0 to %d", APP_CacheLayerCount - 1);
+		}
+		APP_Exit(SDL_APP_FAILURE);
+	}
+}
+
+bool APP_BeginCacheLayer(int layer, int w, int h)
+{
+	APP_CheckCacheLayer(layer);
+	if (APP_CurrentCacheLayer >= 0) {
+		APP_SetError("A cache layer is already being drawn into");
+		APP_Exit(SDL_APP_FAILURE);
+	}
+
+	bool lost = false;
+	if (APP_CacheLayers[layer]) {
+		float textureW, textureH;
+		if (!SDL_GetTextureSize(APP_CacheLayers[layer], &textureW, &textureH)) {
+			APP_SetError("Could not get cache layer size: %s", SDL_GetError());
+			APP_Exit(SDL_APP_FAILURE);
+		}
+		if ((int)textureW != w || (int)textureH != h) {
+			SDL_DestroyTexture(APP_CacheLayers[layer]);
+			APP_CacheLayers[layer] = NULL;
+		}
+	}
+	if (!APP_CacheLayers[layer]) {
+		const APP_MemoryTag memoryTag = APP_SetMemoryTag(APP_MEMORY_VIDEO);
+		APP_CacheLayers[layer] = SDL_CreateTexture(APP_ScreenRenderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, w, h);
+		APP_SetMemoryTag(memoryTag);
+		if (!APP_CacheLayers[layer]) {
+			APP_SetError("Could not create cache layer: %s", SDL_GetError());
+			APP_Exit(SDL_APP_FAILURE);
+		}
+		// Planes are blended into the transparent layer, which leaves the
+		// layer's colors premultiplied by its alpha.
+		if (
+			!SDL_SetTextureScaleMode(APP_CacheLayers[layer], SDL_SCALEMODE_NEAREST) ||
+			!SDL_SetTextureBlendMode(APP_CacheLayers[layer], SDL_BLENDMODE_BLEND_PREMULTIPLIED)
+		) {
+			APP_SetError("Could not set up cache layer: %s", SDL_GetError());
+			APP_Exit(SDL_APP_FAILURE);
+		}
+		lost = true;
+	}
+
+	if (!SDL_SetRenderTarget(APP_ScreenRenderer, APP_CacheLayers[layer])) {
+		APP_SetError("Could not set cache layer as render target: %s", SDL_GetError());
+		APP_Exit(SDL_APP_FAILURE);
+	}
+	APP_CurrentCacheLayer = layer;
+	if (lost) {
+		APP_ClearCacheLayerRect(0, 0, w, h);
+		if (!SDL_SetRenderClipRect(APP_ScreenRenderer, NULL)) {
+			APP_SetError("Could not clear cache layer: %s", SDL_GetError());
+			APP_Exit(SDL_APP_FAILURE);
+		}
+	}
+	return lost;
+}
+
+void APP_ClearCacheLayerRect(int x, int y, int w, int h)
+{
+	if (APP_CurrentCacheLayer < 0) {
+		APP_SetError("No cache layer is being drawn into");
+		APP_Exit(SDL_APP_FAILURE);
+	}
+
+	// SDL_RenderClear() ignores the clip rectangle, so the rectangle is
+	// filled without blending instead.
+	const SDL_Rect clip = { x, y, w, h };
+	const SDL_FRect rect = { x, y, w, h };
+	Uint8 r, g, b, a;
+	SDL_BlendMode blendMode;
+	if (
+		!SDL_SetRenderClipRect(APP_ScreenRenderer, &clip) ||
+		!SDL_GetRenderDrawColor(APP_ScreenRenderer, &r, &g, &b, &a) ||
+		!SDL_GetRenderDrawBlendMode(APP_ScreenRenderer, &blendMode) ||
+		!SDL_SetRenderDrawColor(APP_ScreenRenderer, 0, 0, 0, SDL_ALPHA_TRANSPARENT) ||
+		!SDL_SetRenderDrawBlendMode(APP_ScreenRenderer, SDL_BLENDMODE_NONE) ||
+		!SDL_RenderFillRect(APP_ScreenRenderer, &rect) ||
+		!SDL_SetRenderDrawColor(APP_ScreenRenderer, r, g, b, a) ||
+		!SDL_SetRenderDrawBlendMode(APP_ScreenRenderer, blendMode)
+	) {
+		APP_SetError("Could not clear cache layer: %s", SDL_GetError());
+		APP_Exit(SDL_APP_FAILURE);
+	}
+}
+
+void APP_EndCacheLayer(void)
+{
+	if (APP_CurrentCacheLayer < 0) {
+		APP_SetError("No cache layer is being drawn into");
+		APP_Exit(SDL_APP_FAILURE);
+	}
+	if (
+		!SDL_SetRenderClipRect(APP_ScreenRenderer, NULL) ||
+		!SDL_SetRenderTarget(APP_ScreenRenderer, APP_ScreenRenderTarget)
+	) {
+		APP_SetError("Could not restore render target: %s", SDL_GetError());
+		APP_Exit(SDL_APP_FAILURE);
+	}
+	APP_CurrentCacheLayer = -1;
+}
+
+void APP_DrawCacheLayer(int layer, int dstX, int dstY)
+{
+	APP_CheckCacheLayer(layer);
+	if (!APP_CacheLayers[layer] || !APP_RenderThisFrame()) {
+		return;
+	}
+
+	float w, h;
+	if (!SDL_GetTextureSize(APP_CacheLayers[layer], &w, &h)) {
+		APP_SetError("Error rendering graphics: %s", SDL_GetError());
+		APP_Exit(SDL_APP_FAILURE);
+	}
+	float offsetX, offsetY;
+	APP_GetDrawOffset(&offsetX, &offsetY);
+	const SDL_FRect dst = { dstX + offsetX, dstY + offsetY, w, h };
+	if (!SDL_RenderTexture(APP_ScreenRenderer, APP_CacheLayers[layer], NULL, &dst)) {
+		APP_SetError("Error rendering graphics: %s", SDL_GetError());
+		APP_Exit(SDL_APP_FAILURE);
+	}
+}
+
+void APP_LoseCacheLayers(void)
+{
+	for (int i = 0; i < APP_CacheLayerCount; i++) {
+		if (APP_CacheLayers[i]) {
+			SDL_DestroyTexture(APP_CacheLayers[i]);
+			APP_CacheLayers[i] = NULL;
+		}
+	}
+}
+
 float APP_GetScreenSubpixelOffset(void)
 {
 	// The returned subpixel offset nudges all draws to have pixel coordinates
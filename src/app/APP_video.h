@@ -33,7 +33,7 @@ typedef enum APP_ScreenIndexMask {
 #define APP_SCREEN_HEIGHT 240
 #define APP_SCREEN_WIDE ((float)APP_SCREEN_WIDTH / APP_SCREEN_HEIGHT)
 
-void APP_InitVideo(int planeCount, int textLayerCount);
+void APP_InitVideo(int planeCount, int textLayerCount, int cacheLayerCount);
 void APP_QuitVideo(void);
 
 void APP_ResetFrameStep(void);
@@ -42,6 +42,9 @@ int APP_GetMaxDisplayIndex();
 int APP_GetMaxDisplayMode(int displayIndex);
 void APP_GetDisplayMode(int displayIndex, int modeIndex, SDL_DisplayMode* mode);
 const SDL_DisplayMode* APP_GetDesktopDisplayMode(int displayIndex);
+// Drops the cached display list and display modes. Called when SDL reports a
+// display being added, removed or changed.
+void APP_InvalidateDisplays(void);
 
 void APP_EnableTextLayer(int layer, int x, int y);
 void APP_SetTextLayerDrawPosition(int layer, int x, int y);
@@ -61,9 +64,27 @@ void APP_LoadPlane(int plane, const char* filename);
 // If plane < 0, returns whether at least one plane is loaded.
 bool APP_HavePlane(int plane);
 
+// Plane streams are planes that show one frame of an animation at a time.
+// Each frame is its own image file, named filename with "_000", "_001" and so
+// on appended. Frames are decoded on the loading worker a few frames ahead of
+// the shown frame, into a small ring of textures, so the memory used doesn't
+// depend on how long the animation is.
+//
+// Returns false, leaving the plane as it was, if the first frame's file isn't
+// found. Loading the plane with APP_LoadPlane() closes the stream.
+bool APP_LoadPlaneStream(int plane, const char* filename, int frameCount);
+
+// Selects the frame drawn by the plane stream, waiting for it if it's not
+// decoded yet. Returns false if the plane isn't a plane stream.
+bool APP_SetPlaneStreamFrame(int plane, int frame);
+
 void APP_DrawPlane(int plane, int dstX, int dstY);
 void APP_DrawPlaneRect(int plane, int dstX, int dstY, int srcX, int srcY, int w, int h);
 
+// Fills the destination rectangle by repeating the source rectangle, in one
+// draw call.
+void APP_DrawPlaneRectTiled(int plane, int dstX, int dstY, int dstW, int dstH, int srcX, int srcY, int w, int h);
+
 void APP_DrawPlaneTransparent(int plane, int dstX, int dstY, uint8_t a);
 void APP_DrawPlaneRectTransparent(int plane, int dstX, int dstY, int srcX, int srcY, int w, int h, uint8_t a);
 
@@ -75,8 +96,44 @@ void APP_DrawPlaneRectTransparentScaled(int plane, int dstX, int dstY, int srcX,
 
 void APP_DrawPlaneText(int plane, const char* text, char firstChar, int charW, int charH, int dstX, int dstY, int sheetX, int sheetY, int sheetW);
 
+// One character of a string drawn with APP_DrawPlaneGlyphs().
+typedef struct APP_Glyph
+{
+	int dstX, dstY;
+	int srcX, srcY;
+} APP_Glyph;
+
+// Draws w by h glyphs from the plane, all in one draw call. The glyph
+// positions and size are multiplied by scale, so the same glyphs can be kept
+// and drawn at any zoom rate.
+void APP_DrawPlaneGlyphs(int plane, const APP_Glyph* glyphs, int count, int w, int h, int scale);
+
 void APP_SetPlaneDrawOffset(int x, int y);
 
+// Cache layers are offscreen images that planes can be drawn into, so drawing
+// that rarely changes is done once, then put on the screen with one draw call
+// per frame. Between APP_BeginCacheLayer() and APP_EndCacheLayer(), all plane
+// and text drawing goes into the layer, at the layer's own coordinates; the
+// plane draw offset applies when the layer is drawn, not while drawing into it.
+//
+// APP_BeginCacheLayer() (re)creates the layer at the given size when needed,
+// and returns true if the layer is blank, because it was just created or its
+// contents were lost; the caller must then redraw all of it. Contents are lost
+// when planes are reloaded or the renderer resets its render targets.
+// Only update a layer when APP_RenderThisFrame() is true, as drawing does
+// nothing otherwise.
+bool APP_BeginCacheLayer(int layer, int w, int h);
+
+// Clears the rectangle to transparent, then limits drawing to it until
+// APP_EndCacheLayer().
+void APP_ClearCacheLayerRect(int x, int y, int w, int h);
+
+void APP_EndCacheLayer(void);
+void APP_DrawCacheLayer(int layer, int dstX, int dstY);
+
+// Called by SDL_AppEvent() and APP_LoadPlane().
+void APP_LoseCacheLayers(void);
+
 float APP_GetScreenSubpixelOffset(void);
 
 #endif
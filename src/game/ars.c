@@ -11,19 +11,20 @@ int32_t	acol[7] = {5,2,3,1,7,6,4};
 void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 	int32_t		bak, bottom, move, don, flash, kosa, rolling,synchro,landing, fsmooth;
 	int32_t		i, k, l,lockT;
+	const RulesProfile *rules = getRulesProfile();
 
 	fsmooth = 0;
 	don = 0;
 	synchro = 0;
 	landing = 0;
-	if((repversw >= 35) && (kickm != -1)) kickm++;
+	if((rules->landingReset) && (kickm != -1)) kickm++;
 	hiddenProc (player);
 
 	if(!statusc[player * 10 + 2]) {
 		padRepeat(player);
 
 		// Hold
-		if((repversw >= 64) && (!statusc[player * 10 + 6])){
+		if((rules->holdTiming == HOLD_TIMING_FIRST) && (!statusc[player * 10 + 6])){
 			doHold(player, 0);
 			// HOLDしてゲームオーバーになった場合はここで止める #1.60c7m2
 			if(status[player] == 7) return;
@@ -42,7 +43,7 @@ void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 		if( (spawn_y_type) && (sp[player] >= 1200) ) bs[player] = 1320;
 
 		// Hold
-		if(repversw < 35){
+		if(rules->holdTiming == HOLD_TIMING_AFTER_GRAVITY){
 			doHold(player, 0);
 			// HOLDしてゲームオーバーになった場合はここで止める #1.60c7m2
 			if(status[player] == 7) return;
@@ -52,14 +53,14 @@ void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 		rolling = 0;
 		if(isrollroll[player]) {
 			// 回るタイミングを「ステージタイムが30フレームで割り切れる」時に変更 #1.60c7m5
-			if((ending[player] == 2) && (repversw >= 44)){
+			if((ending[player] == 2) && (rules->rollRollTimer)){
 				/* エンディング・ロール */
 				if( edrec[player] % p_rollroll_timer == 0 )
 					rolling = 1;
 			} else if( gameMode[player] == 6 ) {
 				/* TOMOYO */
 				//ステージ20以降（ステージタイム無し）
-				if((repversw >= 44) && (stage[player] > 19) && (ltime[player] % p_rollroll_timer == 0))
+				if((rules->rollRollTimer) && (stage[player] > 19) && (ltime[player] % p_rollroll_timer == 0))
 					rolling = 1;
 				//ステージ19まで
 				else if( stime[player] % p_rollroll_timer == 0 )
@@ -72,12 +73,12 @@ void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 		}
 
 		// 回転
-		if((statusc[player * 10 + 6] != 0) && (repversw >= 59))
+		if((statusc[player * 10 + 6] != 0) && (rules->holdRotateLock))
 			move = 0;
 		else
 			move = (getPushState(player, APP_BUTTON_B) || rolling) - (getPushState(player, APP_BUTTON_A) || getPushState(player, APP_BUTTON_C));
 		// for old style, force negative
-		if (repversw > 65 && (heboGB[player] == 2)&& !segacheat) // sega rotation
+		if (rules->segaRules && (heboGB[player] == 2)&& !segacheat) // sega rotation
 			move = SDL_abs(move)*-1;
 
 		if((move) && (isrotatelock[player] == 0)) {
@@ -92,7 +93,7 @@ void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 				}
 			if(bak < 0) bak = 3;
 			if(bak > 3) bak = 0;
-			if((repversw >= 35) && (judgeBlock (player, bx[player], by[player] + 1, blk[player], rt[player]) != 0)) landing = 1;
+			if((rules->landingReset) && (judgeBlock (player, bx[player], by[player] + 1, blk[player], rt[player]) != 0)) landing = 1;
 			if(judgeBlock(player, bx[player], by[player], k, bak) == 0) {
 				// 地形に重ならずに回転できる場合
 				if(rotate_snd) PlaySE(WAVE_SE_ROTATE);	// 回転音設定#1.60c7f7
@@ -199,7 +200,7 @@ void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 							move = -2 -i;
 
 						// 接地していない場合は蹴らない #1.60c7k5
-						if( (judgeBlock(player,bx[player],by[player]+1+i,k,rt[player]) == 0) && (repversw >= 8) )
+						if( (judgeBlock(player,bx[player],by[player]+1+i,k,rt[player]) == 0) && (rules->groundKick) )
 							move = 0;
 
 						if(move) {
@@ -222,12 +223,12 @@ void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 				}
 			}
 			l = judgeBlock (player, bx[player], by[player] + 1, blk[player], rt[player]);
-			if((rt[player] == bak) && ((l != 0) || ((landing) && (repversw >= 35))) && (heboGB[player]==0)) {
-				if(repversw < 40) kickc[player]++;	// 接地した状態での回転回数をカウント
+			if((rt[player] == bak) && ((l != 0) || ((landing) && (rules->landingReset))) && (heboGB[player]==0)) {
+				if(!rules->rotateCount) kickc[player]++;	// 接地した状態での回転回数をカウント
 				else kickc3[player]++;
 				if((world_drop_snd != 0) && (world_drop_snd != 3) && (l != 0))
 					PlaySE(WAVE_SE_KON);
-				if(((kickc[player] < kickm) && (repversw < 40)) || (kickc3[player] < kickr)){
+				if(((kickc[player] < kickm) && (!rules->rotateCount)) || (kickc3[player] < kickr)){
 				 	bk[player] = 0;		// 固定時間リセット
 				 }
 			}
@@ -248,14 +249,14 @@ void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 			}
 			// BIG時、2マス単位モードの場合は移動量を2倍する #1.60c7m6
 			if(IsBig[player] && BigMove[player]) move = move * 2;
-			if((repversw >= 44) && (judgeBlock (player, bx[player], by[player] + 1, blk[player], rt[player]) != 0)) landing = 1;
+			if((rules->arsSlideLanding) && (judgeBlock (player, bx[player], by[player] + 1, blk[player], rt[player]) != 0)) landing = 1;
 			if((mpc[player] == 1) || (mpc[player] >= waitt[player]) || ((isremote[player]) && (gameMode[player] != 4)))
 				if(judgeBlock (player, bx[player] + move, by[player], blk[player], rt[player]) == 0) {
 					bx[player] = bx[player] + move;
 					if(movesound) PlaySE(WAVE_SE_MOVE);	// 移動音設定が反映されないのを修正#1.60c7f7
 					l = judgeBlock (player, bx[player], by[player] + 1, blk[player], rt[player]);
-					if(((l != 0) || ((landing) && (repversw >= 35))) && (heboGB[player]==0)) {	// 横移動でも固定時間リセット
-						if((!synchro) || (repversw < 40))kickc[player]++;
+					if(((l != 0) || ((landing) && (rules->landingReset))) && (heboGB[player]==0)) {	// 横移動でも固定時間リセット
+						if((!synchro) || (!rules->rotateCount))kickc[player]++;
 						if((world_drop_snd != 0) && (world_drop_snd != 3) && (l != 0))
 							PlaySE(WAVE_SE_KON);
 						if(kickc[player] < kickm){
@@ -272,18 +273,18 @@ void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 
 		//	↓を離している、またはdowntypeが0の場合、下入れ制限解除#1.60c7f9
         uint32_t downtypetemp=downtype;
-		if (heboGB[player]==2 && repversw>65)
+		if (heboGB[player]==2 && rules->segaRules)
 		{
 			downtypetemp=0;
 		}
 		if((!getPressState(player, 1-(1*(isUDreverse[player])))) || (!downtypetemp)) down_flag[player] = 0;
-		if((!getPressState(player, 0+(1*(isUDreverse[player])))) || (!downtypetemp) || (repversw < 12)) up_flag[player] = 0;
+		if((!getPressState(player, 0+(1*(isUDreverse[player])))) || (!downtypetemp) || (!rules->upFlag)) up_flag[player] = 0;
 
 		//	高速落下!! 下入れ改造#1.60c7f9
-		if((!move) && getPressState(player , 1-(1*(isUDreverse[player]))) && (sp[player] < 60) && (!down_flag[player]) && ((statusc[player * 10 + 4]) || (repversw < 27))) {
-			if((heboGB[player])&&(repversw >= 52)){
+		if((!move) && getPressState(player , 1-(1*(isUDreverse[player]))) && (sp[player] < 60) && (!down_flag[player]) && ((statusc[player * 10 + 4]) || (!rules->firstFrameWait))) {
+			if((heboGB[player])&&(rules->heboSoftDrop)){
 				bs[player] = 61;
-			}else if(repversw >= 20){						//このバージョンから
+			}else if(rules->slowSoftDrop){						//このバージョンから
 				bs[player] = bs[player] + 30;		//高速落下を遅く
 			}else{
 				bs[player] = 61;
@@ -295,14 +296,14 @@ void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 				}
 		}
 
-		if((ismagnetblock[player]) && (repversw >= 41)) bs[player] = bs[player] + 30;
+		if((ismagnetblock[player]) && (rules->magnetGravity)) bs[player] = bs[player] + 30;
 
-		for(bottom = by[player]; judgeBlock (player, bx[player], bottom, blk[player], rt[player]) == 0; bottom++);
+		bottom = findBlockBottom(player, bx[player], by[player], blk[player], rt[player]);
 
 		//	地面にくっついた
 		if((judgeBlock (player, bx[player], by[player] + 1, blk[player], rt[player]) != 0)) {
 
-			if((ismagnetblock[player] == 1) || ((kickc[player] > kickm) && (kickm != -1) && (repversw >= 30)) ||
+			if((ismagnetblock[player] == 1) || ((kickc[player] > kickm) && (kickm != -1) && (rules->kickLimitLock)) ||
 			((kickc3[player] >= kickr) && (kickr != -1)))
 				bk[player] = 100;
 
@@ -316,7 +317,7 @@ void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 
 			// 下キーで固定速度アップ
 			if((getPressState(player , 1-(1*(isUDreverse[player])))) && (!down_flag[player])
-						&& (statusc[player * 10 + 4] || (repversw < 27)) && (!move || nanamedown)) {
+						&& (statusc[player * 10 + 4] || (!rules->firstFrameWait)) && (!move || nanamedown)) {
 				if((rotspl[player] == 5) || (heboGB[player])){	// ARS2では下入れ即接着
 					if(heboGB[player]==0) PlaySE(WAVE_SE_ACE_SONIC_LOCK);
 					bk[player] = 100;
@@ -326,15 +327,15 @@ void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 			}
 
 			// 上キーで即固定(ARS1のみ)
-			if( ( (getPressState(player , 0+(1*(isUDreverse[player]))) && (repversw >= 43)) ||
-				  (getPushState(player , 0+(1*(isUDreverse[player]))) && (repversw < 43)) )
-				&& (rotspl[player] == 4) && ( (repversw <= 13) || !up_flag[player] ) && (heboGB[player]==0)
-						&& (((statusc[player * 10 + 4]) && (!move || nanamedown)) || (repversw < 27))) {
+			if( ( (getPressState(player , 0+(1*(isUDreverse[player]))) && (rules->upLockHold)) ||
+				  (getPushState(player , 0+(1*(isUDreverse[player]))) && (!rules->upLockHold)) )
+				&& (rotspl[player] == 4) && ( (!rules->upLockLimit) || !up_flag[player] ) && (heboGB[player]==0)
+						&& (((statusc[player * 10 + 4]) && (!move || nanamedown)) || (!rules->firstFrameWait))) {
 				bk[player] = bk[player] + lockT;
 					PlaySE(WAVE_SE_ACE_SONIC_LOCK);
 
 				// 上入れ制限追加 #1.60c7q8
-				if( downtype && (repversw >= 14) && (repversw < 54)) up_flag[player] = 1;
+				if( downtype && (rules->upLockLimit) && (!rules->lockFlags)) up_flag[player] = 1;
 			}
 
 			// 固定
@@ -350,14 +351,14 @@ void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 				drawCBlock (player, 0, 0, 10 , 0);
 
 				if((getPressState(player , 1)) && (downtype) && (!move || nanamedown)) down_flag[player] = 1;
-				if(repversw >= 57) goto lockflash;	// SUPERなSKIP
+				if(rules->superSkip) goto lockflash;	// SUPERなSKIP
 				return;
 			}
 		} else {
 			// T.L.S. (Temporary Landing System)  (c)1998 AR●KA(^^;
 			drawTLSBlock(player, bottom);
 
-			if(getPressState(player , 0+(1*(isUDreverse[player]))) && (!move) && (!sonicdrop) && (!up_flag[player]) && (heboGB[player]==0) && ((statusc[player * 10 + 4]) || (repversw < 27))) {
+			if(getPressState(player , 0+(1*(isUDreverse[player]))) && (!move) && (!sonicdrop) && (!up_flag[player]) && (heboGB[player]==0) && ((statusc[player * 10 + 4]) || (!rules->firstFrameWait))) {
 				if(rotspl[player] == 4) {
 					// 上キーで一瞬で落下&固定
 					if(gameMode[player]==10){
@@ -393,9 +394,9 @@ void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 					kickc3[player] = 0;
 					statusc[player * 10 + 2] ++;
 					drawCBlock (player, 0, 0, 10, 0);
-					if((downtype) && (repversw < 54)) up_flag[player] = 1;
+					if((downtype) && (!rules->lockFlags)) up_flag[player] = 1;
 					statusc[player * 10 + 5] = 0;	// 回転させた数リセット #1.60c7s6
-					if(repversw >= 57) goto lockflash;	// SUPERなSKIP
+					if(rules->superSkip) goto lockflash;	// SUPERなSKIP
 					return;
 				} else {
 					// ARS2では固定しない
@@ -417,16 +418,13 @@ void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 					bs[player] = 0;
 					bk[player] = 0;
 					if(!smooth) don = 1;
-					if((downtype) && (repversw < 54)) up_flag[player] = 1;
+					if((downtype) && (!rules->lockFlags)) up_flag[player] = 1;
 					statusc[player * 10 + 5] = 0;	// 回転させた数リセット #1.60c7s6
 				}
 			}
 		}
 		// correct gravity for 1g and higher
-		int one_g = 60;
-		if (repversw > 65) // new replay version
-			one_g--;
-		while (bs[player] > one_g) {
+		while (bs[player] > rules->oneG) {
 			bk[player] = 0;
 			tspin_flag[player] = 0;	// T-SPIN権利剥奪 #1.60c7o9
 
@@ -448,13 +446,13 @@ void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 				bs[player] = 0;
 				if(!smooth) don = 1;
 
-				if((ismagnetblock[player] == 1) || ((kickc[player] >= kickm) && (repversw >= 30)) ||
+				if((ismagnetblock[player] == 1) || ((kickc[player] >= kickm) && (rules->kickLimitLock)) ||
 				((kickc3[player] >= kickr)))
 					bk[player] = 100;
 
 				// 下キー #1.60c7r3
-				if((getPressState(player, 1-(1*(isUDreverse[player])))) && (!down_flag[player]) && (repversw >= 15)
-							&& (statusc[player * 10 + 4] || (repversw < 27)) && (!move || nanamedown)) {
+				if((getPressState(player, 1-(1*(isUDreverse[player])))) && (!down_flag[player]) && (rules->gravityLock)
+							&& (statusc[player * 10 + 4] || (!rules->firstFrameWait)) && (!move || nanamedown)) {
 					if((rotspl[player] == 5) || (heboGB[player])) {	// ARS2では下入れ即接着
 						PlaySE(WAVE_SE_KON);
 						if(heboGB[player]==0){
@@ -467,7 +465,7 @@ void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 						statusc[player * 10 + 2]++;
 						drawCBlock (player, 0, 0, 10, 0);
 						if(downtype) down_flag[player] = 1;
-						if(repversw >= 57) goto lockflash;	// SUPERなSKIP
+						if(rules->superSkip) goto lockflash;	// SUPERなSKIP
 						return;
 					} else {				// ARS1では固定速度アップのみ
 						bk[player]++;
@@ -475,10 +473,10 @@ void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 				}
 
 				// 上キーで即固定(ARS1のみ) #1.60c7r3
-				if( ( (getPressState(player , 0+(1*(isUDreverse[player]))) && (repversw >= 43)) ||
-					  (getPushState(player , 0+(1*(isUDreverse[player]))) && (repversw < 43)) )
-					&& (rotspl[player] == 4) && (!up_flag[player]) && (repversw >= 15) && (heboGB[player]==0)
-					&& (((statusc[player * 10 + 4]) && (!move || nanamedown)) || (repversw < 27))) {
+				if( ( (getPressState(player , 0+(1*(isUDreverse[player]))) && (rules->upLockHold)) ||
+					  (getPushState(player , 0+(1*(isUDreverse[player]))) && (!rules->upLockHold)) )
+					&& (rotspl[player] == 4) && (!up_flag[player]) && (rules->gravityLock) && (heboGB[player]==0)
+					&& (((statusc[player * 10 + 4]) && (!move || nanamedown)) || (!rules->firstFrameWait))) {
 					PlaySE(WAVE_SE_KACHI);
 					PlaySE(WAVE_SE_ACE_SONIC_LOCK);
 					kickc[player] = 0;
@@ -487,7 +485,7 @@ void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 					statusc[player * 10 + 2]++;
 					drawCBlock (player, 0, 0, 10, 0);
 					if( downtype ) up_flag[player] = 1;
-					if(repversw >= 57) goto lockflash;	// SUPERなSKIP
+					if(rules->superSkip) goto lockflash;	// SUPERなSKIP
 					return;
 				}
 			} else {
@@ -514,25 +512,25 @@ void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 			drawCBlock (player, kosa, 0 , flash, 0);
 
 		// Hold
-		if((repversw >= 35) && (repversw < 64) && (!statusc[player * 10 + 2]) && (!statusc[player * 10 + 6])){doHold(player, 0);
+		if((rules->holdTiming == HOLD_TIMING_LAST) && (!statusc[player * 10 + 2]) && (!statusc[player * 10 + 6])){doHold(player, 0);
 			// HOLDしてゲームオーバーになった場合はここで止める #1.60c7m2
 			if(status[player] == 7) return;
 		}
 
 		statusc[player * 10 + 6] = 0;
-		if((repversw >= 57) && (statusc[player * 10 + 2] != 0)) goto lockflash;	// SUPERなSKIP
+		if((rules->superSkip) && (statusc[player * 10 + 2] != 0)) goto lockflash;	// SUPERなSKIP
 	} else {
 		lockflash:
 		statusc[player * 10 + 2] ++;
 		if((c_nblk[0 + player * 6] != 8) && (c_nblk[0 + player * 6] >= 0))drawCBlock (player, 0, 0, 10, 0);
 
 		// ↓を離している場合、下入れ制限解除#1.60c7n6
-		if((!getPressState(player, 1-(1*(isUDreverse[player])))) && (repversw >= 10)) down_flag[player] = 0;
-		else if((downtype) && (repversw >= 54)) down_flag[player] = 1;
+		if((!getPressState(player, 1-(1*(isUDreverse[player])))) && (rules->releaseDownFlag)) down_flag[player] = 0;
+		else if((downtype) && (rules->lockFlags)) down_flag[player] = 1;
 		if(!getPressState(player, 0+(1*(isUDreverse[player])))) up_flag[player] = 0;
-		else if((downtype) && (repversw >= 54)) up_flag[player] = 1;
+		else if((downtype) && (rules->lockFlags)) up_flag[player] = 1;
 
-		if((statusc[player * 10 + 2] > 2 - (repversw >= 9)) || (repversw >= 57)) {	// 接着時の灰色化を1フレ短縮 #1.60c7k8
+		if((statusc[player * 10 + 2] > rules->lockFlashFrames) || (rules->superSkip)) {	// 接着時の灰色化を1フレ短縮 #1.60c7k8
 			setBlock (player, bx[player], by[player], blk[player], rt[player]);
 			if(status[player] == 7) return;
 
@@ -564,14 +562,14 @@ void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 			}
 
 			// エンディング中の花火発生 #1.60c7s8
-			if( (ending[player] == 2) && (gameMode[player] == 0) && (repversw <= 37)) {
+			if( (ending[player] == 2) && (gameMode[player] == 0) && (rules->endingHanabi)) {
 				hanabi_total[player]++;
 				hanabi_waiting[player]++;
 			}
 			// ACEカスタム式IRS
-			if((ace_irs == 2) && (repversw >= 35)) doIRS2plus(player);
+			if((ace_irs == 2) && (rules->aceIrs)) doIRS2plus(player);
 			// ブロック消去判断により1フレ短縮 #1.60c7k8
-			if ((blockEraseJudge(player)) || (repversw < 9)) {
+			if ((blockEraseJudge(player)) || (!rules->eraseJudge)) {
 				status[player] = 8;
 				statusc[player * 10] = 0;
 				statusc[player * 10 + 1] = 0;
@@ -581,7 +579,7 @@ void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 				statusc[player * 10 + 5] = 0;
 				statusc[player * 10 + 6] = 0;
 				//ステータス変更と同時に次のステータス関数を実行する事で1フレ短縮　C7V2.1
-				if(repversw >= 54) statEraseBlock(player);
+				if(rules->eraseShortcut) statEraseBlock(player);
 			} else {
 				status[player] = 6;
 				statusc[player * 10] = wait1[player];
@@ -600,7 +598,7 @@ void statAMove(int32_t player, int32_t kickm, int32_t kickr) {
 				scrate[player] = 100;//oriモード用のスコアレート
 				pinchCheck(player);
 				//ステータス変更と同時に次のステータス関数を実行する事で1フレ短縮　C7V2.1
-				if(repversw >= 54) statErase(player);
+				if(rules->eraseShortcut) statErase(player);
 			}
 
 			return;
@@ -0,0 +1,156 @@
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  リプレイベンチマーク
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+// APP_REPLAY_BENCHMARK を有効にしてビルドすると、タイトルの代わりにここへ来る。
+// replay/REPLAYxx.SAV と demo/DEMOxx.SAV を描画なしで順番に再生し、
+// モードごとの処理速度（1秒あたりのフレーム数）を出力する。
+// 再生後のスコア・レベル・ライン・タイム（VSでは両プレイヤーのリプレイ時間も）が
+// ヘッダの値と違えば失敗として終了する。
+
+#include "common.h"
+
+#ifdef APP_REPLAY_BENCHMARK
+
+#define BENCH_REPLAY_MAX	99	// 1〜40はreplay、41〜99はdemo
+#define BENCH_MODE_COUNT	11
+
+static const char* const benchModeName[BENCH_MODE_COUNT] = {
+	"BEGINNER", "MASTER", "20G", "DEVIL", "VERSUS", "PRACTICE",
+	"TOMOYO", "ACE", "MISSION", "SIMPLE", "ORIGINAL"
+};
+
+static int32_t	benchNumber;			// 再生中のリプレイ番号（0なら未開始）
+static int32_t	benchHeader[300];		// 再生中のリプレイのヘッダ
+static int32_t	benchMode, benchRot;
+static uint64_t	benchFrames, benchNS;
+static uint64_t	benchModeFrames[BENCH_MODE_COUNT], benchModeNS[BENCH_MODE_COUNT];
+static int32_t	benchModeCount[BENCH_MODE_COUNT];
+static int32_t	benchRuns, benchFailures;
+
+static const char* getBenchReplayName(int32_t number) {
+	if(number <= 40)
+		SDL_snprintf(string[0], STRING_LENGTH, "replay/REPLAY%02d.SAV", number);
+	else
+		SDL_snprintf(string[0], STRING_LENGTH, "demo/DEMO%02d.SAV", number - 40);
+	return string[0];
+}
+
+// ヘッダの値と再生後の値を比べる
+static bool benchCheck(const char* name, int32_t expected, int32_t actual) {
+	if(expected == actual) return true;
+
+	SDL_Log("REPLAY %02d: %s mismatch (expected %d, got %d)", (int)benchNumber, name, (int)expected, (int)actual);
+	return false;
+}
+
+// 再生が終わったリプレイの結果を記録
+static void benchFinishReplay(void) {
+	bool ok = true;
+
+	// VSのヘッダはフォーマットが異なり、タイム以外の結果を持たない
+	if(benchMode != 4) {
+		// TOMOYOではスコアに到達ステージが入っている
+		if((benchMode == 6) && (stage[0] < 100))
+			ok = benchCheck("stage", benchHeader[202], stage[0] + 1) && ok;
+		else
+			ok = benchCheck("score", benchHeader[202], sc[0]) && ok;
+		ok = benchCheck("level", benchHeader[203], lv[0]) && ok;
+		ok = benchCheck("lines", benchHeader[204], li[0]) && ok;
+	}
+	ok = benchCheck("time", benchHeader[200], gametime[0]) && ok;
+
+	// 2人プレイのときは、ヘッダに残っているプレイヤー毎のリプレイ時間も比べる
+	if(maxPlay && (benchMode == 4)) {
+		ok = benchCheck("1P replay time", benchHeader[204], time2[0]) && ok;
+		ok = benchCheck("2P replay time", benchHeader[205], time2[1]) && ok;
+	}
+
+	SDL_Log(
+		"REPLAY %02d: %-8s rot %d ver %3d  %8u frames  %9.3f ms  %10.0f fps  %s",
+		(int)benchNumber, benchModeName[benchMode], (int)benchRot, (int)benchHeader[256],
+		(unsigned)benchFrames, benchNS / 1e6,
+		benchNS ? benchFrames * 1e9 / benchNS : 0.0,
+		ok ? "OK" : "FAILED"
+	);
+
+	benchModeFrames[benchMode] += benchFrames;
+	benchModeNS[benchMode] += benchNS;
+	benchModeCount[benchMode]++;
+	benchRuns++;
+	if(!ok) benchFailures++;
+}
+
+// 次のリプレイの再生を開始（なければfalse）
+static bool benchStartNextReplay(void) {
+	while(++benchNumber <= BENCH_REPLAY_MAX) {
+		if(!APP_FileExists(getBenchReplayName(benchNumber))) continue;
+
+		SDL_memset(benchHeader, 0, sizeof(benchHeader));
+		APP_ReadFile32(string[0], benchHeader, 300, 0);
+		if(
+			(benchHeader[0] != 0x4F424548) || (benchHeader[1] != 0x20534952) ||
+			(benchHeader[2] != 0x4C504552) || (benchHeader[3] != 0x31765941) ||
+			(benchHeader[201] < 0) || (benchHeader[201] >= BENCH_MODE_COUNT)
+		) {
+			SDL_Log("REPLAY %02d: invalid header, skipped", (int)benchNumber);
+			benchFailures++;
+			continue;
+		}
+
+		benchMode = benchHeader[201];
+		benchRot = benchHeader[201] == 4 ? benchHeader[218] : benchHeader[294];
+		benchFrames = 0;
+		benchNS = 0;
+
+		// リプレイ選択画面で選んだときと同じ手順で開始する
+		flag = benchNumber;
+		init = false;
+		ReplaySelectProc();
+		mainLoopState = MAIN_REPLAY_BENCHMARK;
+		init = true;
+		return true;
+	}
+	return false;
+}
+
+void replayBenchmarkProc(void) {
+	if(init && (benchNumber == 0)) {
+		APP_SetHeadless(true);
+		SDL_memset(benchModeFrames, 0, sizeof(benchModeFrames));
+		SDL_memset(benchModeNS, 0, sizeof(benchModeNS));
+		SDL_memset(benchModeCount, 0, sizeof(benchModeCount));
+		benchRuns = 0;
+		benchFailures = 0;
+		if(!benchStartNextReplay()) {
+			SDL_Log("No replays found in replay/ or demo/");
+			APP_Exit(SDL_APP_FAILURE);
+		}
+	}
+
+	// 1フレーム分のゲーム処理（描画はAPP_SetHeadlessで省かれる）
+	const uint64_t startNS = SDL_GetTicksNS();
+	gameExecute();
+	benchNS += SDL_GetTicksNS() - startNS;
+	benchFrames++;
+
+	// 再生が終わるとタイトルへ戻ろうとする
+	if(mainLoopState == MAIN_REPLAY_BENCHMARK) return;
+
+	benchFinishReplay();
+	freeReplayData();
+	mainLoopState = MAIN_REPLAY_BENCHMARK;
+	if(benchStartNextReplay()) return;
+
+	for(int32_t mode = 0; mode < BENCH_MODE_COUNT; mode++) {
+		if(!benchModeCount[mode]) continue;
+		SDL_Log(
+			"%-8s %2d replays  %10.0f fps",
+			benchModeName[mode], (int)benchModeCount[mode],
+			benchModeNS[mode] ? benchModeFrames[mode] * 1e9 / benchModeNS[mode] : 0.0
+		);
+	}
+	SDL_Log("%d replays, %d failed", (int)benchRuns, (int)benchFailures);
+	APP_Exit(benchFailures ? SDL_APP_FAILURE : SDL_APP_SUCCESS);
+}
+
+#endif
@@ -0,0 +1,10 @@
+#ifndef benchmark_h_
+#define benchmark_h_
+
+#include "app/APP.h"
+
+#ifdef APP_REPLAY_BENCHMARK
+void replayBenchmarkProc(void);
+#endif
+
+#endif
@@ -0,0 +1,127 @@
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  ブロックの形のマスク
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+
+#include "common.h"
+
+// 0:classic 1:world 2:D.R.S
+static BlockMask blockMasks[3][7][4];
+static bool blockMasksReady = false;
+
+static void makeBlockMask(BlockMask *mask, const int32_t *dataX, const int32_t *dataY) {
+	int32_t i, x, y, top;
+
+	mask->left = mask->right = dataX[0];
+	mask->top = mask->bottom = dataY[0];
+	for(i = 1; i < 4; i++) {
+		mask->left = SDL_min(mask->left, dataX[i]);
+		mask->right = SDL_max(mask->right, dataX[i]);
+		mask->top = SDL_min(mask->top, dataY[i]);
+		mask->bottom = SDL_max(mask->bottom, dataY[i]);
+	}
+
+	SDL_memset(mask->rows, 0, sizeof(mask->rows));
+	for(i = 0; i < 4; i++)
+		mask->rows[dataY[i]] |= 1u << (dataX[i] - mask->left);
+
+	mask->solid = true;
+	for(x = 0; x < 4; x++) {
+		mask->columnBottom[x] = -1;
+		top = -1;
+		for(y = 0; y < 4; y++) {
+			if(!(mask->rows[y] & (1u << x))) continue;
+			if(top < 0) top = y;
+			else if(mask->columnBottom[x] != y - 1) mask->solid = false;
+			mask->columnBottom[x] = y;
+		}
+	}
+}
+
+static void makeBlockMasks(void) {
+	int32_t kind, rotate, i;
+
+	for(kind = 0; kind < 7; kind++) {
+		for(rotate = 0; rotate < 4; rotate++) {
+			i = kind * 16 + rotate * 4;
+			makeBlockMask(&blockMasks[0][kind][rotate], &blkDataX[i], &blkDataY[i]);
+			makeBlockMask(&blockMasks[1][kind][rotate], &blkWDataX[i], &blkWDataY[i]);
+			makeBlockMask(&blockMasks[2][kind][rotate], &blkDDataX[i], &blkDDataY[i]);
+		}
+	}
+	blockMasksReady = true;
+}
+
+const BlockMask *getBlockMask(int32_t player, int32_t kind, int32_t rotate) {
+	if(!blockMasksReady) makeBlockMasks();
+
+	if(rotspl[player] == 8 && ((segacheat == 2) || (heboGB[player] != 2) || !getRulesProfile()->segaRules))
+		return &blockMasks[2][kind][rotate];
+	else if( isWRule(player) )
+		return &blockMasks[1][kind][rotate];
+	else
+		return &blockMasks[0][kind][rotate];
+}
+
+bool isBlockMaskBlocked(int32_t player, int32_t bx1, int32_t by1, const BlockMask *mask) {
+	const uint32_t *rowBlocks;
+	int32_t y, shift;
+
+	if((by1 + mask->top < 2) && (heboGB[player] == 2)) return true;
+	if((bx1 + mask->left < 0) || (bx1 + mask->right >= fldsizew[player]) || (by1 + mask->bottom > fldsizeh[player]))
+		return true;
+
+	// フィールドより上のブロックは判定しない
+	rowBlocks = fldSummary[player].rowBlocks;
+	shift = bx1 + mask->left;
+	for(y = SDL_max(mask->top, -by1); y <= mask->bottom; y++) {
+		if((rowBlocks[by1 + y] >> shift) & mask->rows[y]) return true;
+	}
+
+	return false;
+}
+
+int32_t findBlockKick(int32_t player, int32_t bx1, int32_t by1, int32_t kind, int32_t rotate, const int32_t *sx, const int32_t *sy, int32_t count) {
+	const BlockMask *mask;
+	int32_t i;
+
+	if(IsBig[player]) {
+		for(i = 0; i < count; i++)
+			if(judgeBigBlock(player, bx1 + sx[i], by1 + sy[i], kind, rotate) == 0) return i;
+		return -1;
+	}
+
+	mask = getBlockMask(player, kind, rotate);
+	for(i = 0; i < count; i++)
+		if(!isBlockMaskBlocked(player, bx1 + sx[i], by1 + sy[i], mask)) return i;
+	return -1;
+}
+
+int32_t findBlockBottom(int32_t player, int32_t bx1, int32_t by1, int32_t kind, int32_t rotate) {
+	const BlockMask *mask;
+	const uint32_t *columns;
+	int32_t x, row, bottom;
+	uint32_t below;
+
+	mask = getBlockMask(player, kind, rotate);
+	if(IsBig[player] || !mask->solid) {
+		for(bottom = by1; judgeBlock(player, bx1, bottom, kind, rotate) == 0; bottom++);
+		return bottom;
+	}
+
+	if(isBlockMaskBlocked(player, bx1, by1, mask)) return by1;
+
+	// 床
+	bottom = fldsizeh[player] - mask->bottom + 1;
+
+	// 各列の一番下のブロックより下で一番上にあるフィールドのブロック
+	columns = fldSummary[player].columns;
+	for(x = 0; x <= mask->right - mask->left; x++) {
+		if(mask->columnBottom[x] < 0) continue;
+		row = SDL_max(by1 + mask->columnBottom[x] + 1, 0);
+		below = columns[bx1 + mask->left + x] >> row;
+		if(below)
+			bottom = SDL_min(bottom, row + SDL_MostSignificantBitIndex32(below & (~below + 1)) - mask->columnBottom[x]);
+	}
+
+	return bottom;
+}
@@ -0,0 +1,43 @@
+#ifndef blockmask_h_
+#define blockmask_h_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ブロックの形のマスク
+// Each piece shape (classic, world and D.R.S tables, 7 kinds, 4 rotations) as
+// row bitmasks, built once from blkDataX/Y, blkWDataX/Y and blkDDataX/Y. A
+// position is tested against the field summary's row bitmasks, a few ANDs per
+// test, instead of looking up each block in the shape tables and in fld.
+// Every shape table offset is 0〜3, so one mask covers any shape.
+
+typedef struct BlockMask {
+	int32_t left, right;	// 相対X位置の範囲
+	int32_t top, bottom;	// 相対Y位置の範囲
+	uint32_t rows[4];		// 相対Y位置ごとのブロック (bit xが相対X位置left + x)
+	int32_t columnBottom[4];	// 相対X位置left + xの列の一番下のブロックの相対Y位置 (ブロックのない列は-1)
+	bool solid;				// どの列もブロックが縦に続いている
+} BlockMask;
+
+// judgeBlock()と同じ条件で、今のルールの形を選ぶ
+const BlockMask *getBlockMask(int32_t player, int32_t kind, int32_t rotate);
+
+// judgeBlock()と同じ判定 (BIG以外) 置けなければtrue
+bool isBlockMaskBlocked(int32_t player, int32_t bx1, int32_t by1, const BlockMask *mask);
+
+// 壁蹴り
+// Tests the kick candidates (sx[i], sy[i]) in order from (bx1, by1), and
+// returns the index of the first one the block fits at, or -1 if none fit.
+// BIG blocks are tested with judgeBigBlock().
+int32_t findBlockKick(int32_t player, int32_t bx1, int32_t by1, int32_t kind, int32_t rotate, const int32_t *sx, const int32_t *sy, int32_t count);
+
+// 落下先
+// Returns the first row from by1 down where the block doesn't fit, the same as
+// for(bottom = by1; judgeBlock(...) == 0; bottom++);
+// so the block lands at one row above it. Moving down from a position it fits
+// at, a block first hits the field with the lowest block of some column, so
+// it's found from the field summary's column bitmasks, one lookup per column.
+// BIG blocks are stepped down with judgeBlock().
+int32_t findBlockBottom(int32_t player, int32_t bx1, int32_t by1, int32_t kind, int32_t rotate);
+
+#endif
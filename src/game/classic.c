@@ -33,6 +33,7 @@ int32_t	ccol[7] = {1,2,3,4,5,6,7};
 //▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
 void statCMove(int32_t player) {
 	int32_t		i, bak, bottom, move, don, flash, kosa, rolling,k,synchro,lockT, fsmooth;
+	const RulesProfile *rules = getRulesProfile();
 
 	fsmooth = 0;
 	don = 0;
@@ -43,7 +44,7 @@ void statCMove(int32_t player) {
 		padRepeat(player);
 
 		// Hold
-		if((repversw >= 64) && (!statusc[player * 10 + 6])){
+		if((rules->holdTiming == HOLD_TIMING_FIRST) && (!statusc[player * 10 + 6])){
 			doHold(player, 0);
 			// HOLDしてゲームオーバーになった場合はここで止める #1.60c7m2
 			if(status[player] == 7) return;
@@ -61,7 +62,7 @@ void statCMove(int32_t player) {
 		if( (spawn_y_type) && (sp[player] >= 1200) ) bs[player] = 1320;
 
 		// Hold
-		if(repversw < 35){
+		if(rules->holdTiming == HOLD_TIMING_AFTER_GRAVITY){
 			doHold(player, 0);
 			// HOLDしてゲームオーバーになった場合はここで止める #1.60c7m2
 			if(status[player] == 7) return;
@@ -71,14 +72,14 @@ void statCMove(int32_t player) {
 		rolling = 0;
 		if(isrollroll[player]) {
 			// 回るタイミングを「ステージタイムが30フレームで割り切れる」時に変更 #1.60c7m5
-			if((ending[player] == 2) && (repversw >= 44)){
+			if((ending[player] == 2) && (rules->rollRollTimer)){
 				/* エンディング・ロール */
 				if( edrec[player] % p_rollroll_timer == 0 )
 					rolling = 1;
 			} else if( gameMode[player] == 6 ) {
 				/* TOMOYO */
 				//ステージ20以降（ステージタイム無し）
-				if((repversw >= 44) && (stage[player] > 19) && (ltime[player] % p_rollroll_timer == 0))
+				if((rules->rollRollTimer) && (stage[player] > 19) && (ltime[player] % p_rollroll_timer == 0))
 					rolling = 1;
 				//ステージ19まで
 				else if( stime[player] % p_rollroll_timer == 0 )
@@ -91,12 +92,12 @@ void statCMove(int32_t player) {
 		}
 
 		// 回転!!
-		if((statusc[player * 10 + 6] != 0) && (repversw >= 59))
+		if((statusc[player * 10 + 6] != 0) && (rules->holdRotateLock))
 			move = 0;
 		else
 			move = (getPushState(player, APP_BUTTON_B) || rolling) - (getPushState(player, APP_BUTTON_A) || getPushState(player, APP_BUTTON_C));
 				    // for old style, force negative
-		if (repversw > 65 && (heboGB[player] == 2) && !segacheat) // sega rotation
+		if (rules->segaRules && (heboGB[player] == 2) && !segacheat) // sega rotation
 			move = SDL_abs(move)*-1;
 		if((move) && (isrotatelock[player] == 0)) {
 			bak = (rt[player] + move);
@@ -218,7 +219,7 @@ void statCMove(int32_t player) {
 								move = -2 -i;
 
 							// 接地していない場合は蹴らない #1.60c7k5
-							if( (judgeBlock(player,bx[player],by[player]+1+i,k,rt[player]) == 0) && (repversw >= 8) )
+							if( (judgeBlock(player,bx[player],by[player]+1+i,k,rt[player]) == 0) && (rules->groundKick) )
 								move = 0;
 
 							if(move) {
@@ -275,15 +276,15 @@ void statCMove(int32_t player) {
 
 		// ↓を離している、またはdowntypeが0の場合、下入れ制限解除#1.60c7f9
 		int32_t downtypetemp=downtype;
-		if (heboGB[player]==2 && repversw>65)
+		if (heboGB[player]==2 && rules->segaRules)
 		{
 			downtypetemp=0;
 		}
 		if((!getPressState(player, 1-(1*(isUDreverse[player])))) || (!downtypetemp)) down_flag[player] = 0;
-		if((!getPressState(player, 0+(1*(isUDreverse[player])))) || (!downtypetemp) || (repversw < 12)) up_flag[player] = 0;
+		if((!getPressState(player, 0+(1*(isUDreverse[player])))) || (!downtypetemp) || (!rules->upFlag)) up_flag[player] = 0;
 
 		// 高速落下!! 下入れ制限改造#1.60c7f9
-		if((!move) && getPressState(player, 1-(1*(isUDreverse[player]))) && (sp[player] < 60) && (!down_flag[player]) && ((statusc[player * 10 + 4]) || (repversw < 27))) {
+		if((!move) && getPressState(player, 1-(1*(isUDreverse[player]))) && (sp[player] < 60) && (!down_flag[player]) && ((statusc[player * 10 + 4]) || (!rules->firstFrameWait))) {
 			bs[player] = 61;
 			if((gameMode[player]>=9)||((gameMode[player]==6)&&(anothermode[player]==4))||((gameMode[player]==7)&&(anothermode[player]==3))){
 				sc[player]++;//直入れ
@@ -291,9 +292,9 @@ void statCMove(int32_t player) {
 				qdrop[player]++;	//遅い分のドロップボーナス半減は、スコア計算時に
 			}
 		}
-		if((ismagnetblock[player]) && (repversw >= 41)) bs[player] = bs[player] + 30;
+		if((ismagnetblock[player]) && (rules->magnetGravity)) bs[player] = bs[player] + 30;
 
-		for(bottom = by[player]; judgeBlock(player, bx[player], bottom, blk[player], rt[player]) == 0; bottom++);
+		bottom = findBlockBottom(player, bx[player], by[player], blk[player], rt[player]);
 
 		// 地面にくっついた
 		if((judgeBlock(player, bx[player], by[player] + 1, blk[player], rt[player]) != 0)) {
@@ -315,8 +316,8 @@ void statCMove(int32_t player) {
 			// 下入れ制限#1.60c7f9
 			// 下入れ即接着 #1.60c7k8
 			if((getPressState(player, 1-(1*(isUDreverse[player])))) && (!down_flag[player])
-						&& (statusc[player * 10 + 4] || (repversw < 27)) && (!move || nanamedown)) {
-				if (repversw < 9)
+						&& (statusc[player * 10 + 4] || (!rules->firstFrameWait)) && (!move || nanamedown)) {
+				if (!rules->softDropLock)
 					bk[player] = bk[player] + 8;
 				else
 					bk[player] = 100;
@@ -333,7 +334,7 @@ void statCMove(int32_t player) {
 				drawCBlock(player, 0, 0, 10, 0);
 				// 下入れ制限#1.60c7f9
 				if((getPressState(player, APP_BUTTON_DOWN)) && (downtype) && (!move || nanamedown)) down_flag[player] = 1;
-				if(repversw >= 57) goto lockflash;	// SUPERなSKIP
+				if(rules->superSkip) goto lockflash;	// SUPERなSKIP
 				return;
 			}
 		} else {
@@ -344,7 +345,7 @@ void statCMove(int32_t player) {
 
 			// 上キーで一瞬で落下
 			// 上入れ制限追加 #1.60c7p1
-			if(getPressState(player, 0+(1*(isUDreverse[player]))) && (!move) && (!sonicdrop) && (!up_flag[player]) && (heboGB[player]==0) && ((statusc[player * 10 + 4]) || (repversw < 27))) {
+			if(getPressState(player, 0+(1*(isUDreverse[player]))) && (!move) && (!sonicdrop) && (!up_flag[player]) && (heboGB[player]==0) && ((statusc[player * 10 + 4]) || (!rules->firstFrameWait))) {
 				if((sp[player] <= 240) && (!ending[player])) {
 					if(gameMode[player]==10){
 						sc[player] = sc[player] + ( bottom - by[player] - 1 ) * 23 / 20;
@@ -374,16 +375,13 @@ void statCMove(int32_t player) {
 				bs[player] = 0;
 				bk[player] = 0;
 				if(!smooth) don = 1;
-				if((downtype) && (repversw < 54)) up_flag[player] = 1;
+				if((downtype) && (!rules->lockFlags)) up_flag[player] = 1;
 				statusc[player * 10 + 5] = 0;	// 回転させた数リセット #1.60c7s6
 			}
 		}
 
 		// ブロックが落ちる
-		int one_g = 60;
-		if (repversw > 65)
-			one_g--;
-		while (bs[player] > one_g) {
+		while (bs[player] > rules->oneG) {
 			bk[player] = 0;
 			tspin_flag[player] = 0;	// T-SPIN権利剥奪 #1.60c7o9
 
@@ -406,8 +404,8 @@ void statCMove(int32_t player) {
 				if(!smooth) don = 1;
 
 				// 下キーで即固定 #1.60c7r3
-				if((getPressState(player, 1-(1*(isUDreverse[player])))) && (!down_flag[player]) && (repversw >= 15)
-							&& (statusc[player * 10 + 4] || (repversw < 27)) && (!move || nanamedown)) {
+				if((getPressState(player, 1-(1*(isUDreverse[player])))) && (!down_flag[player]) && (rules->gravityLock)
+							&& (statusc[player * 10 + 4] || (!rules->firstFrameWait)) && (!move || nanamedown)) {
 					PlaySE(WAVE_SE_KON);
 					if(heboGB[player]==0)
 						PlaySE(WAVE_SE_KACHI);
@@ -415,7 +413,7 @@ void statCMove(int32_t player) {
 					statusc[player * 10 + 2]++;
 					drawCBlock(player, 0, 0, 10, 0);
 					if(downtype) down_flag[player] = 1;	// 下入れ制限
-					if(repversw >= 57) goto lockflash;	// SUPERなSKIP
+					if(rules->superSkip) goto lockflash;	// SUPERなSKIP
 					return;
 				}
 			} else {
@@ -438,26 +436,26 @@ void statCMove(int32_t player) {
 			drawCBlock(player, kosa, 0, flash, 0);
 
 		// Hold
-		if((repversw >= 35) && (repversw < 64) && (!statusc[player * 10 + 2]) && (!statusc[player * 10 + 6])){
+		if((rules->holdTiming == HOLD_TIMING_LAST) && (!statusc[player * 10 + 2]) && (!statusc[player * 10 + 6])){
 			doHold(player, 0);
 			// HOLDしてゲームオーバーになった場合はここで止める #1.60c7m2
 			if(status[player] == 7) return;
 		}
 
 		statusc[player * 10 + 6] = 0;
-		if((repversw >= 59) && (statusc[player * 10 + 2] != 0)) goto lockflash;	// SUPERなSKIP
+		if((rules->classicSuperSkip) && (statusc[player * 10 + 2] != 0)) goto lockflash;	// SUPERなSKIP
 	} else {
 		lockflash:
 		statusc[player * 10 + 2]++;
 		if((c_nblk[0 + player * 6] != 8) && (c_nblk[0 + player * 6] >= 0))drawCBlock (player, 0, 0, 10, 0);
 
 		// ↓を離している場合、下入れ制限解除#1.60c7n6
-		if((!getPressState(player, 1-(1*(isUDreverse[player])))) && (repversw >= 10)) down_flag[player] = 0;
-		else if((downtype) && (repversw >= 54)) down_flag[player] = 1;
+		if((!getPressState(player, 1-(1*(isUDreverse[player])))) && (rules->releaseDownFlag)) down_flag[player] = 0;
+		else if((downtype) && (rules->lockFlags)) down_flag[player] = 1;
 		if(!getPressState(player, 0+(1*(isUDreverse[player])))) up_flag[player] = 0;
-		else if((downtype) && (repversw >= 54)) up_flag[player] = 1;
+		else if((downtype) && (rules->lockFlags)) up_flag[player] = 1;
 
-		if(statusc[player * 10 + 2] > 2 - (repversw >= 9)) {	// 接着時の灰色化を1フレ短縮 #1.60c7k8
+		if(statusc[player * 10 + 2] > rules->lockFlashFrames) {	// 接着時の灰色化を1フレ短縮 #1.60c7k8
 			setBlock(player, bx[player], by[player], blk[player], rt[player]);
 			if(status[player] == 7) return;
 
@@ -487,14 +485,14 @@ void statCMove(int32_t player) {
 			}
 
 			// エンディング中の花火発生 #1.60c7s8
-			if( (ending[player] == 2) && (gameMode[player] == 0) && (repversw <= 37)) {
+			if( (ending[player] == 2) && (gameMode[player] == 0) && (rules->endingHanabi)) {
 				hanabi_total[player]++;
 				hanabi_waiting[player]++;
 			}
 			// ACEカスタム式IRS
-			if((ace_irs == 2) && (repversw >= 35)) doIRS2plus(player);
+			if((ace_irs == 2) && (rules->aceIrs)) doIRS2plus(player);
 			// ブロック消去判断により1フレ短縮 #1.60c7k8
-			if ((blockEraseJudge(player)) || (repversw < 9)) {
+			if ((blockEraseJudge(player)) || (!rules->eraseJudge)) {
 				status[player] = 8;
 				statusc[player * 10] = 0;
 				statusc[player * 10 + 1] = 0;
@@ -504,7 +502,7 @@ void statCMove(int32_t player) {
 				statusc[player * 10 + 5] = 0;
 				statusc[player * 10 + 6] = 0;
 				//ステータス変更と同時に次のステータス関数を実行する事で1フレ短縮　C7V2.1
-				if(repversw >= 54) statEraseBlock(player);
+				if(rules->eraseShortcut) statEraseBlock(player);
 			} else {
 				status[player] = 6;
 				statusc[player * 10] = wait1[player];
@@ -523,7 +521,7 @@ void statCMove(int32_t player) {
 				scrate[player] = 100;//oriモード用のスコアレート
 				pinchCheck(player);
 				//ステータス変更と同時に次のステータス関数を実行する事で1フレ短縮　C7V2.1
-				if(repversw >= 54) statErase(player);
+				if(rules->eraseShortcut) statErase(player);
 			}
 
 			return;
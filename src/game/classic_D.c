@@ -78,6 +78,7 @@ int32_t		blkDDataY[7 * 4 * 4] =	// ユニットを構成するブロックの相
 //▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
 void statDMove(int32_t player) {
 	int32_t		i, bak, bottom, move, don, flash, kosa, rolling,k,synchro,y_hosei,hosei_type,lockT, fsmooth;
+	const RulesProfile *rules = getRulesProfile();
 
 	fsmooth = 0;
 	y_hosei=0;
@@ -90,7 +91,7 @@ void statDMove(int32_t player) {
 		padRepeat(player);
 
 		// Hold
-		if((repversw >= 64) && (!statusc[player * 10 + 6])){
+		if((rules->holdTiming == HOLD_TIMING_FIRST) && (!statusc[player * 10 + 6])){
 			doHold(player, 0);
 			// HOLDしてゲームオーバーになった場合はここで止める #1.60c7m2
 			if(status[player] == 7) return;
@@ -112,14 +113,14 @@ void statDMove(int32_t player) {
 		rolling = 0;
 		if(isrollroll[player]) {
 			// 回るタイミングを「ステージタイムが30フレームで割り切れる」時に変更 #1.60c7m5
-			if((ending[player] == 2) && (repversw >= 44)){
+			if((ending[player] == 2) && (rules->rollRollTimer)){
 				/* エンディング・ロール */
 				if( edrec[player] % p_rollroll_timer == 0 )
 					rolling = 1;
 			} else if( gameMode[player] == 6 ) {
 				/* TOMOYO */
 				//ステージ20以降（ステージタイム無し）
-				if((repversw >= 44) && (stage[player] > 19) && (ltime[player] % p_rollroll_timer == 0))
+				if((rules->rollRollTimer) && (stage[player] > 19) && (ltime[player] % p_rollroll_timer == 0))
 					rolling = 1;
 				//ステージ19まで
 				else if( stime[player] % p_rollroll_timer == 0 )
@@ -132,7 +133,7 @@ void statDMove(int32_t player) {
 		}
 
 		// 回転!!
-		if((statusc[player * 10 + 6] != 0) && (repversw >= 59))
+		if((statusc[player * 10 + 6] != 0) && (rules->holdRotateLock))
 			move = 0;
 		else
 			move = (getPushState(player, APP_BUTTON_B) || rolling) - (getPushState(player, APP_BUTTON_A));
@@ -140,7 +141,7 @@ void statDMove(int32_t player) {
 
 		if((getPushState(player, APP_BUTTON_C) != 0) && (statusc[player * 10 + 6] == 0)) move = 2;
 		// different for DRS
-		if (repversw > 65 && (heboGB[player] == 2) && (move!=0) && ((!segacheat) || (heboGB[player] != 2)) ) // sega rotation
+		if (rules->segaRules && (heboGB[player] == 2) && (move!=0) && ((!segacheat) || (heboGB[player] != 2)) ) // sega rotation
 			move = -1;                // safe because roll roll can't happen in old style
 
 		if((move != 0) && (isrotatelock[player] == 0)) {
@@ -318,7 +319,7 @@ void statDMove(int32_t player) {
 										move = -2 -i;
 
 									// 接地していない場合は蹴らない #1.60c7k5
-									if( (judgeBlock(player,bx[player],by[player]+1+i,k,rt[player]) == 0) && (repversw >= 8) )
+									if( (judgeBlock(player,bx[player],by[player]+1+i,k,rt[player]) == 0) && (rules->groundKick) )
 										move = 0;
 
 									if(move) {
@@ -359,7 +360,7 @@ void statDMove(int32_t player) {
 			// BIG時、2マス単位モードの場合は移動量を2倍する #1.60c7m6
 			if(IsBig[player] && BigMove[player]) move = move * 2;
 
-			if((mpc[player] == 1) || (mpc[player] >= waitt[player]) || ((isremote[player]) && (gameMode[player] != 4)) || (((segacheat == 2) || (heboGB[player] != 2) || repversw < 66)&&(mpc[player] >= 10 - (2 * (repversw >= 64)))))
+			if((mpc[player] == 1) || (mpc[player] >= waitt[player]) || ((isremote[player]) && (gameMode[player] != 4)) || (((segacheat == 2) || (heboGB[player] != 2) || !rules->segaRules)&&(mpc[player] >= rules->classicDDasDelay)))
 				if(judgeBlock(player, bx[player] + move, by[player], blk[player], rt[player]) == 0) {
 					bx[player] = bx[player] + move;
 					if(movesound) PlaySE(WAVE_SE_MOVE);
@@ -374,19 +375,19 @@ void statDMove(int32_t player) {
 
 		// ↓を離している、またはdowntypeが0の場合、下入れ制限解除#1.60c7f9
         uint32_t downtypetemp=downtype;
-		if (heboGB[player]==2 && repversw>65)
+		if (heboGB[player]==2 && rules->segaRules)
 		{
 			downtypetemp=0;
 		}
 
 		if((!getPressState(player, 1-(1*(isUDreverse[player])))) || (!downtypetemp)) down_flag[player] = 0;
-		if((!getPressState(player, 0+(1*(isUDreverse[player])))) || (!downtypetemp) || (repversw < 12)) up_flag[player] = 0;
+		if((!getPressState(player, 0+(1*(isUDreverse[player])))) || (!downtypetemp) || (!rules->upFlag)) up_flag[player] = 0;
 
 		// 高速落下!! 下入れ制限改造#1.60c7f9
-		if((!move) && getPressState(player, 1-(1*(isUDreverse[player]))) && ((sp[player] < 60) || (repversw  >= 42)) && (!down_flag[player]) && ((statusc[player * 10 + 4]) || (repversw < 27))) {
-			if(repversw >= 44) bs[player] = bs[player] + 91;
+		if((!move) && getPressState(player, 1-(1*(isUDreverse[player]))) && ((sp[player] < 60) || (rules->softDrop20G)) && (!down_flag[player]) && ((statusc[player * 10 + 4]) || (!rules->firstFrameWait))) {
+			if(rules->softDropAdd) bs[player] = bs[player] + 91;
 			else bs[player] = 91;
-			if((heboGB[player])&&(repversw >= 52)) {
+			if((heboGB[player])&&(rules->heboSoftDrop)) {
 				bs[player] = 61;
 			}
 			if((gameMode[player]>=9)||((gameMode[player]==6)&&(anothermode[player]==4))||((gameMode[player]==7)&&(anothermode[player]==3))){
@@ -396,9 +397,9 @@ void statDMove(int32_t player) {
 			}
 		}
 
-		if((ismagnetblock[player]) && (repversw >= 41)) bs[player] = bs[player] + 30;
+		if((ismagnetblock[player]) && (rules->magnetGravity)) bs[player] = bs[player] + 30;
 
-		for(bottom = by[player]; judgeBlock(player, bx[player], bottom, blk[player], rt[player]) == 0; bottom++);
+		bottom = findBlockBottom(player, bx[player], by[player], blk[player], rt[player]);
 
 		// 地面にくっついた
 		if((judgeBlock(player, bx[player], by[player] + 1, blk[player], rt[player]) != 0)) {
@@ -420,23 +421,23 @@ void statDMove(int32_t player) {
 			// 下入れ制限#1.60c7f9
 			// 固定時間大幅短縮 #1.60c7k8
 			if((getPressState(player, 1-(1*(isUDreverse[player])))) && (!down_flag[player])
-						&& (statusc[player * 10 + 4] || (repversw < 27)) && (!move || nanamedown)){
+						&& (statusc[player * 10 + 4] || (!rules->firstFrameWait)) && (!move || nanamedown)){
 				if((sp[player] >= 60) || (heboGB[player]!=0))	// 1G以上即接着
 					bk[player] = 100;
 				else
 					bk_D[player] = bk_D[player] + 4;
 			}
 			// 上入れ即接着
-			if( ( (getPressState(player , 0+(1*(isUDreverse[player]))) && (repversw >= 43)) ||
-				  (getPushState(player , 0+(1*(isUDreverse[player]))) && (repversw < 43)) )
-				&& (rotspl[player] != 7) && ( (repversw <= 13) || !up_flag[player] ) && (heboGB[player]==0)
-				&& (statusc[player * 10 + 4] || (repversw < 27)) && (!move || nanamedown)) {
+			if( ( (getPressState(player , 0+(1*(isUDreverse[player]))) && (rules->upLockHold)) ||
+				  (getPushState(player , 0+(1*(isUDreverse[player]))) && (!rules->upLockHold)) )
+				&& (rotspl[player] != 7) && ( (!rules->upLockLimit) || !up_flag[player] ) && (heboGB[player]==0)
+				&& (statusc[player * 10 + 4] || (!rules->firstFrameWait)) && (!move || nanamedown)) {
 				bk[player] = bk[player] + lockT;
 				PlaySE(WAVE_SE_ACE_SONIC_LOCK);
 				harddrop[player]=1;
 
 				// 上入れ制限追加 #1.60c7q8
-				if( downtype && (repversw >= 14) ) up_flag[player] = 1;
+				if( downtype && (rules->upLockLimit) ) up_flag[player] = 1;
 			}
 
 			// 固定
@@ -450,7 +451,7 @@ void statDMove(int32_t player) {
 				drawCBlock(player, 0, 0, 10, 0);
 				// 下入れ制限#1.60c7f9
 				if((getPressState(player, APP_BUTTON_DOWN)) && (downtype) && (!move || nanamedown)) down_flag[player] = 1;
-				if((repversw >= 57) && (!harddrop[player])) goto lockflash;	// SUPERなSKIP
+				if((rules->superSkip) && (!harddrop[player])) goto lockflash;	// SUPERなSKIP
 				return;
 			}
 		} else {
@@ -461,7 +462,7 @@ void statDMove(int32_t player) {
 
 			// 上キーで一瞬で落下&固定
 			// 上入れ制限追加 #1.60c7p1
-			if(getPressState(player , 0+(1*(isUDreverse[player]))) && (!move) && (!sonicdrop) && (!up_flag[player]) && (heboGB[player]==0) && ((statusc[player * 10 + 4]) || (repversw < 27))) {
+			if(getPressState(player , 0+(1*(isUDreverse[player]))) && (!move) && (!sonicdrop) && (!up_flag[player]) && (heboGB[player]==0) && ((statusc[player * 10 + 4]) || (!rules->firstFrameWait))) {
 					if(gameMode[player]==10){
 						if ( sp[player] <= 240 )
 	 					sc[player] = sc[player] + ( bottom - by[player] - 1 ) * 23 / 20;
@@ -496,16 +497,13 @@ void statDMove(int32_t player) {
 					drawCBlock (player, 0, 0, 10, 0);
 					if(downtype) up_flag[player] = 1;
 					statusc[player * 10 + 5] = 0;	// 回転させた数リセット #1.60c7s6
-					if((repversw >= 57) && (!harddrop[player])) goto lockflash;	// SUPERなSKIP
+					if((rules->superSkip) && (!harddrop[player])) goto lockflash;	// SUPERなSKIP
 					return;
 			}
 		}
 
 		// ブロックが落ちる
-		int one_g = 60;
-		if (repversw > 65)
-			one_g--;
-		while (bs[player] > one_g) {
+		while (bs[player] > rules->oneG) {
 			bk[player] = 0;
 			bk_D[player] = 0;
 			tspin_flag[player] = 0;	// T-SPIN権利剥奪 #1.60c7o9
@@ -529,7 +527,7 @@ void statDMove(int32_t player) {
 				if(!smooth) don = 1;
 
 				// 下キーで固定速度大幅アップ #1.60c7r3
-				if( getPressState(player, 1-(1*(isUDreverse[player]))) && (!down_flag[player]) && ((!move || nanamedown) || (repversw < 61))) {
+				if( getPressState(player, 1-(1*(isUDreverse[player]))) && (!down_flag[player]) && ((!move || nanamedown) || (!rules->nanameDownLock))) {
 					if((heboGB[player]==0) && (sp[player] < 60)) bk_D[player] = bk_D[player] + 4;
 					else {
 						PlaySE(WAVE_SE_KON);
@@ -540,23 +538,23 @@ void statDMove(int32_t player) {
 						statusc[player * 10 + 2]++;
 						drawCBlock (player, 0, 0, 10, 0);
 						if(downtype) down_flag[player] = 1;
-						if((repversw >= 57) && (!harddrop[player])) goto lockflash;	// SUPERなSKIP
+						if((rules->superSkip) && (!harddrop[player])) goto lockflash;	// SUPERなSKIP
 						return;
 					}
 				}
 				// 上入れ即接着 #1.60c7r3
-				if( ( (getPressState(player , 0+(1*(isUDreverse[player]))) && (repversw >= 43)) ||
-					  (getPushState(player , 0+(1*(isUDreverse[player]))) && (repversw < 43)) )
-					&&(!up_flag[player]) && (repversw >= 15) && (heboGB[player]==0)
-					&& (statusc[player * 10 + 4] || (repversw < 27)) && (!move || nanamedown)) {
+				if( ( (getPressState(player , 0+(1*(isUDreverse[player]))) && (rules->upLockHold)) ||
+					  (getPushState(player , 0+(1*(isUDreverse[player]))) && (!rules->upLockHold)) )
+					&&(!up_flag[player]) && (rules->gravityLock) && (heboGB[player]==0)
+					&& (statusc[player * 10 + 4] || (!rules->firstFrameWait)) && (!move || nanamedown)) {
 					PlaySE(WAVE_SE_KACHI);
 					kickc[player] = 0;
 					harddrop[player]=1;
 					statusc[player * 10 + 2]++;
 					drawCBlock (player, 0, 0, 10, 0);
 					if(downtype) up_flag[player] = 1;
-					if((repversw >= 57) && (!harddrop[player])) goto lockflash;	// SUPERなSKIP
-					if(repversw >= 57) return;
+					if((rules->superSkip) && (!harddrop[player])) goto lockflash;	// SUPERなSKIP
+					if(rules->superSkip) return;
 				}
 			} else {
 				// 回転させた数リセット #1.60c7s6
@@ -580,26 +578,26 @@ void statDMove(int32_t player) {
 			drawCBlock(player, kosa, 0, flash, 0);
 
 		// Hold	#1.60c
-		if((repversw < 64) && (!statusc[player * 10 + 2]) && (!statusc[player * 10 + 6])){
+		if((rules->holdTiming != HOLD_TIMING_FIRST) && (!statusc[player * 10 + 2]) && (!statusc[player * 10 + 6])){
 			doHold(player, 0);
 			// HOLDしてゲームオーバーになった場合はここで止める #1.60c7m2
 			if(status[player] == 7) return;
 		}
 
 		statusc[player * 10 + 6] = 0;
-		if((repversw >= 57) && (repversw < 61) && (statusc[player * 10 + 2] != 0) && (!harddrop[player])) goto lockflash;	// SUPERなSKIP
+		if((rules->classicDSuperSkip) && (statusc[player * 10 + 2] != 0) && (!harddrop[player])) goto lockflash;	// SUPERなSKIP
 	} else {
 		lockflash:
 		statusc[player * 10 + 2]++;
 		if((c_nblk[0 + player * 6] != 8) && (c_nblk[0 + player * 6] >= 0))drawCBlock (player, 0, 0, 10, 0);
 
 		// ↓を離している場合、下入れ制限解除#1.60c7n6
-		if((!getPressState(player, 1-(1*(isUDreverse[player])))) && (repversw >= 10)) down_flag[player] = 0;
-		else if((downtype) && (repversw >= 61)) down_flag[player] = 1;
+		if((!getPressState(player, 1-(1*(isUDreverse[player])))) && (rules->releaseDownFlag)) down_flag[player] = 0;
+		else if((downtype) && (rules->classicDLockFlags)) down_flag[player] = 1;
 		if(!getPressState(player, 0+(1*(isUDreverse[player])))) up_flag[player] = 0;
-		else if((downtype) && (repversw >= 61)) up_flag[player] = 1;
+		else if((downtype) && (rules->classicDLockFlags)) up_flag[player] = 1;
 
-		if(statusc[player * 10 + 2] > 2 - (repversw >= 9)) {	// 接着時の灰色化を1フレ短縮 #1.60c7k8
+		if(statusc[player * 10 + 2] > rules->lockFlashFrames) {	// 接着時の灰色化を1フレ短縮 #1.60c7k8
 			setBlock(player, bx[player], by[player], blk[player], rt[player]);
 			if(status[player] == 7) return;
 
@@ -628,14 +626,14 @@ void statDMove(int32_t player) {
 			}
 
 			// エンディング中の花火発生 #1.60c7s8
-			if( (ending[player] == 2) && (gameMode[player] == 0) && (repversw <= 37)) {
+			if( (ending[player] == 2) && (gameMode[player] == 0) && (rules->endingHanabi)) {
 				hanabi_total[player]++;
 				hanabi_waiting[player]++;
 			}
 			// ACEカスタム式IRS
-			if((ace_irs == 2) && (repversw >= 35)) doIRS2plus(player);
+			if((ace_irs == 2) && (rules->aceIrs)) doIRS2plus(player);
 			// ブロック消去判断により1フレ短縮 #1.60c7k8
-			if ((blockEraseJudge(player)) || (repversw < 9)) {
+			if ((blockEraseJudge(player)) || (!rules->eraseJudge)) {
 				status[player] = 8;
 				statusc[player * 10] = 0;
 				statusc[player * 10 + 1] = 0;
@@ -645,7 +643,7 @@ void statDMove(int32_t player) {
 				statusc[player * 10 + 5] = 0;
 				statusc[player * 10 + 6] = 0;
 				//ステータス変更と同時に次のステータス関数を実行する事で1フレ短縮　C7V2.1
-				if(repversw >= 54) statEraseBlock(player);
+				if(rules->eraseShortcut) statEraseBlock(player);
 			} else {
 				status[player] = 6;
 				statusc[player * 10] = wait1[player];
@@ -664,7 +662,7 @@ void statDMove(int32_t player) {
 				scrate[player] = 100;//oriモード用のスコアレート
 				pinchCheck(player);
 				//ステータス変更と同時に次のステータス関数を実行する事で1フレ短縮　C7V2.1
-				if(repversw >= 54) statErase(player);
+				if(rules->eraseShortcut) statErase(player);
 			}
 
 			return;
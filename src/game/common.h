@@ -15,6 +15,11 @@
 #include "sound.h"		// 音の処理
 #include "practice.h"		// PRACTICEモード
 #include "tomoyo.h"		// TOMOYOモード
+#include "stagedata.h"		// ステージ・ミッションのデータ
+#include "field.h"		// フィールドの集計
+#include "rules.h"		// リプレイのバージョンごとの動作
+#include "blockmask.h"		// ブロックの形のマスク
+#include "fieldops.h"		// フィールドの変形
 #include "ranking.h"		// ランキング
 #include "setdef.h"		// 設定初期化
 #include "replay.h"		// リプレイ
@@ -26,6 +31,9 @@
 #include "grade.h"		// 段位
 #include "ranking2.h"		// ランキング2
 #include "ranking3.h"		// ランキング3
+#include "benchmark.h"		// リプレイベンチマーク
+#include "replayrender.h"	// リプレイ動画書き出し
+#include "randomizer.h"		// TGM系ツモ生成
 #include "plane.h"
 
 #endif
@@ -69,7 +69,7 @@ APP_ConKey conKeyAssign[8 * 2];
 #endif
 
 int32_t restart = 0;		// 再起動フラグ
-int32_t load = 1;		// Indicates if resources should be loaded.
+int32_t load = LOAD_ALL;	// 読み込むリソース（LOAD_xxx） || Resources to be loaded (LOAD_xxx)
 
 // 設定をバイナリデータに保存 1.60c5
 int32_t SaveConfig(void) {
@@ -203,7 +203,7 @@ int32_t SaveConfig(void) {
 
 	cfgbuf[34] = ConfigChecksum(cfgbuf);
 
-	APP_WriteFile32("config/data/CONFIG.SAV", cfgbuf, SDL_arraysize(cfgbuf));
+	APP_SaveFile32("config/data/CONFIG.SAV", cfgbuf, SDL_arraysize(cfgbuf));
 
 	return (0);
 }
@@ -211,8 +211,7 @@ int32_t SaveConfig(void) {
 // 設定をバイナリデータから読み込み 1.60c5
 int32_t LoadConfig(void) {
 	int32_t cfgbuf[CFG_LENGTH];
-	SDL_memset(cfgbuf, 0, sizeof(cfgbuf));
-	APP_ReadFile32("config/data/CONFIG.SAV", cfgbuf, SDL_arraysize(cfgbuf), 0);
+	APP_LoadFile32("config/data/CONFIG.SAV", cfgbuf, SDL_arraysize(cfgbuf));
 	if(cfgbuf[0] != 0x4F424550) return (1);
 	if(cfgbuf[1] != 0x20534953) return (1);
 	if(cfgbuf[2] != 0x464E4F44) return (1);
@@ -2262,7 +2261,7 @@ void ConfigMenu() {
 					else if(statusc[0] == MENU_AV_DETAIL_LEVEL) {
 						if((ncfg[0] & APP_SCREEN_MODE_WINDOW_TYPE) == APP_SCREEN_MODE_WINDOW) ncfg[1] &= ~APP_SCREEN_INDEX_MODE;
 						ncfg[0] ^= APP_SCREEN_MODE_DETAIL_LEVEL;
-						load = 1;
+						load |= LOAD_GRAPHICS;
 						need_reset = 1;
 					}
 #ifdef APP_ENABLE_ALL_VIDEO_SETTINGS
@@ -2317,19 +2316,19 @@ void ConfigMenu() {
 					else if(statusc[0] == MENU_AV_PLAY_SE) {
 						// se
 						ncfg[44] ^= 0x1 << 23;
-						load = 1;
+						load |= LOAD_SE;
 						need_reset = 1;
 					}
 					else if(statusc[0] == MENU_AV_PLAY_BGM) {
 						// bgm
 						ncfg[44] ^= 0x1 << 15;
-						load = 1;
+						load |= LOAD_BGM;
 						need_reset = 1;
 					}
 					else if(statusc[0] == MENU_AV_BGM_TYPE) {
 						// wavebgm type
 						ncfg[44] ^= WAVE_BGM_SIMPLE;
-						load = 1;
+						load |= LOAD_BGM;
 						need_reset = 1;
 					}
 				}
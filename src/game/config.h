@@ -17,6 +17,13 @@ int32_t LoadConfig(void);
 int32_t SaveConfig(void);
 uint32_t ConfigChecksum(int32_t *cfgbuf);
 extern int32_t restart;
+
+// 再読み込みが必要なリソース（loadのビット）
+// 設定ごとに影響するリソースだけを立て、再起動時にそれだけを読み直す
+#define LOAD_GRAPHICS	0x1	// 画像（画面の精細度で lowDetail/highDetail が変わる）
+#define LOAD_SE		0x2	// 効果音
+#define LOAD_BGM	0x4	// BGM（BGMの種類で読むファイルが変わる）
+#define LOAD_ALL	(LOAD_GRAPHICS | LOAD_SE | LOAD_BGM)
 extern int32_t load;
 #ifdef APP_ENABLE_JOYSTICK_INPUT
 extern APP_JoyKey joyKeyAssign[10 *2];
@@ -390,14 +390,8 @@ void cpuCopyField(int32_t player) {
 }
 
 int32_t cpu_checkFieldTop(int32_t player,int32_t x) {
-	int32_t i;
-
-	for(i = 0; i <= fldsizeh[player]; i++)
-		if(fld[x + i * fldsizew[player] + player * 220])
-			return i;
-
-	// 空っぽの場合
-	return 22;
+	// 空っぽの場合は22
+	return getFieldColumnTop(player, x);
 }
 //穴が始まる位置を探す
 //■　■
@@ -447,7 +441,7 @@ void cpuCheckBestSpot(int32_t player) {
 	for(j=mrot_s; j<mrot; j++) { /* 回転方向 */
 		for(i=-3; i<fldsizew[player]; i++) { /* X座標 */
 			// 底を調べる
-			for(bottom = 0; judgeBlock(player, i, bottom, blk[player], j) == 0; bottom++);
+			bottom = findBlockBottom(player, i, 0, blk[player], j);
 			bottom = bottom - 1;
 
 			if( judgeBlock(player, i, bottom, blk[player], j) == 0 ) {
@@ -542,7 +536,7 @@ void cpuCheckBestSpot(int32_t player) {
 			for(j=0; j<mrot; j++) { /* 回転方向 */
 				for(i=-3; i<fldsizew[player]; i++) { /* X座標 */
 					// 底を調べる
-					for(bottom = 0; judgeBlock(player, i, bottom, blk[player], j) == 0; bottom++);
+					bottom = findBlockBottom(player, i, 0, blk[player], j);
 					bottom = bottom - 1;
 
 					if( judgeBlock(player, i, bottom, blk[player], j) == 0 ) {
@@ -602,7 +596,7 @@ void cpuCheckBestSpot(int32_t player) {
 		}
 	}/* if(mfilled == 0) */
 	// BEGINNERナビゲーション用に、最善手の場所へ、仮想フィールドにブロックを設置
-	for(bottom = 0; judgeBlock(player, cp_x[player], bottom, blk[player], cp_rt[player]) == 0; bottom++) {}
+	bottom = findBlockBottom(player, cp_x[player], 0, blk[player], cp_rt[player]);
 		bottom = bottom - 1;
 	cpuCopyField(player);
 	cpu_setBlock(player, cp_x[player], bottom, blk[player], cp_rt[player]);
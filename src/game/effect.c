@@ -21,97 +21,139 @@ void effect(int32_t player) {
 //▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
 //  オブジェクト関連
 //▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+// 空きスロットのスタックと、動作中スロットの一覧（生成順）
+// 生成と消去を O(1)、毎フレームの更新を動作中のオブジェクト数に比例させる
+static int32_t	objfree[OBJECT_MAX];
+static int32_t	objfreecnt = 0;
+static int32_t	objlist[OBJECT_MAX];
+static int32_t	objcnt = 0;
+static bool		objinit = false;
+
+// オブジェクトの種類ごとの処理（obj[]の値 - 1で引く）
+static void (* const objectFunc[OBJECT_TYPE_COUNT])(int32_t no) = {
+	objectStatBlock,		// 01 -> 飛び散るブロック
+	objectStatLine,			// 02 -> 何列消したか表示
+	objectStatBlock,		// 03 -> 飛び散るブロック (速いバージョン)
+	objectAllCrear,			// 04 -> 全けし
+	objectStatBlock2,		// 05 -> 飛び散るブロック (遅いバージョン)
+	objectPopBlock,			// 06 -> 弾け飛ぶブロック
+	objectHanabi,			// 07 -> 花火
+	objectNagareboshiP,		// 08 -> 流れ星（親）
+	objectNagareboshiC,		// 09 -> 流れ星（子）
+	objectItemWarning,		// 10 -> アイテム発動警告
+	objectGetmedal,			// 11 -> メダル獲得演出
+	objectitem_erase,		// 12 -> アイテムブロック消去
+	objectdelfield,			// 13 -> ライン強制消去エフェクト
+	objectplatina_erase		// 14 -> プラチナブロック消去エフェクト
+};
+
+// 種類ごとの描画順（小さいほど奥）
+// 同じプレーンを使う種類をまとめて描くことで、レンダラーの描画バッチがまとまりやすくなる
+// ブロック片 → 花火・流れ星 → 文字類 の順
+static const int32_t objectRank[OBJECT_TYPE_COUNT] = {
+	1, 10, 2, 11, 3, 4, 7, 8, 9, 13, 12, 5, 0, 6
+};
+static const int32_t objectOrder[OBJECT_TYPE_COUNT] = {
+	12, 0, 2, 4, 5, 11, 13, 6, 7, 8, 1, 3, 10, 9
+};
+
+// 空きスロットを1つ確保して動作中一覧の末尾に加える（満杯なら-1）
+static int32_t objectAlloc(void) {
+	int32_t		i;
+
+	if(!objinit) objectClear();
+	if(objfreecnt <= 0) return -1;
+
+	i = objfree[--objfreecnt];
+	objlist[objcnt++] = i;
+	return i;
+}
+
+// obj[]が0になったスロットを動作中一覧から外して空きに戻す（生成順は保つ）
+static void objectCompact(void) {
+	int32_t		i, n, no;
+
+	n = 0;
+	for(i = 0; i < objcnt; i++) {
+		no = objlist[i];
+		if(obj[no])
+			objlist[n++] = no;
+		else
+			objfree[objfreecnt++] = no;
+	}
+	objcnt = n;
+}
+
 void objectCreate(int32_t p, int32_t s, int32_t x, int32_t y, int32_t v, int32_t w, int32_t j, int32_t c) {
 	int32_t		i;
-	for(i = 0; i < 100; i++)
-		if(obj[i] == 0) {
-			obj[i] = s;
-			objx[i] = x * 100;
-			objy[i] = y * 100;
-			objv[i] = v;
-			obja[i] = 0;	// アニメーションの初期化#1.60c7h8
-			objw[i] = w;
-			objj[i] = j - 1;
-			objc[i] = c;
-			objp[i] = p;	// #1.60c7l1
-
-			break;
-		}
+
+	i = objectAlloc();
+	if(i < 0) return;
+
+	obj[i] = s;
+	objx[i] = x * 100;
+	objy[i] = y * 100;
+	objv[i] = v;
+	obja[i] = 0;	// アニメーションの初期化#1.60c7h8
+	objw[i] = w;
+	objj[i] = j - 1;
+	objc[i] = c;
+	objp[i] = p;	// #1.60c7l1
 }
 
 // 全消しだけで使われている
 void objectCreate2(int32_t p, int32_t s, int32_t x, int32_t y, int32_t v, int32_t w, int32_t j, int32_t c) {
 	int32_t		i;
-	for(i = 0; i < 100; i++)
-		if(obj[i] == 0) {
-			obj[i] = s;
-			objx[i] = x;
-			objy[i] = y;
-			objv[i] = v;
-			obja[i] = 0;	// アニメーションの初期化#1.60c7h8
-			objw[i] = w;
-			objj[i] = j - 1;
-			objc[i] = c;
-			objp[i] = p;	// #1.60c7l1
-
-			break;
-		}
+
+	i = objectAlloc();
+	if(i < 0) return;
+
+	obj[i] = s;
+	objx[i] = x;
+	objy[i] = y;
+	objv[i] = v;
+	obja[i] = 0;	// アニメーションの初期化#1.60c7h8
+	objw[i] = w;
+	objj[i] = j - 1;
+	objc[i] = c;
+	objp[i] = p;	// #1.60c7l1
 }
 
 void objectExecute(void) {
-	int32_t		i;
-	for(i = 0; i < 100; i++) {
-		if(obj[i]) {
-			// jump(obj[i] - 1, o00, o01, o02, o03, o04, o05, o06, o07,o08,o09,o10,o11,o12,o13);
-
-			switch (obj[i] - 1) {
-				case 0: goto o00;
-				case 1: goto o01;
-				case 2: goto o02;
-				case 3: goto o03;
-				case 4: goto o04;
-				case 5: goto o05;
-				case 6: goto o06;
-				case 7: goto o07;
-				case 8: goto o08;
-				case 9: goto o09;
-				case 10: goto o10;
-				case 11: goto o11;
-				case 12: goto o12;
-				case 13: goto o13;
-			}
+	static int32_t	sorted[OBJECT_MAX];
+	int32_t		start[OBJECT_TYPE_COUNT + 1];
+	int32_t		i, k, n, no, type;
+
+	n = objcnt;
+	if(n <= 0) return;
+
+	// 動作中のオブジェクトを種類ごとに振り分ける（同じ種類の中では生成順）
+	// 範囲外の値は従来通り 01 として扱う
+	for(i = 0; i <= OBJECT_TYPE_COUNT; i++) start[i] = 0;
+	for(i = 0; i < n; i++) {
+		type = obj[objlist[i]] - 1;
+		if((type < 0) || (type >= OBJECT_TYPE_COUNT)) type = 0;
+		start[objectRank[type] + 1]++;
+	}
+	for(i = 0; i < OBJECT_TYPE_COUNT; i++) start[i + 1] += start[i];
+	for(i = 0; i < n; i++) {
+		no = objlist[i];
+		type = obj[no] - 1;
+		if((type < 0) || (type >= OBJECT_TYPE_COUNT)) type = 0;
+		sorted[start[objectRank[type]]++] = no;
+	}
 
-			o00: objectStatBlock(i);			// 01 -> 飛び散るブロック
-					goto next;
-			o01: objectStatLine(i);				// 02 -> 何列消したか表示
-					goto next;
-			o02: objectStatBlock(i);			// 03 -> 飛び散るブロック (速いバージョン)
-					goto next;
-			o03: objectAllCrear(i);				// 04 -> 全けし
-					goto next;
-			o04: objectStatBlock2(i);			// 05 -> 飛び散るブロック (遅いバージョン)
-					goto next;
-			o05: objectPopBlock(i);				// 06 -> 弾け飛ぶブロック
-					goto next;
-			o06: objectHanabi(i);				// 07 -> 花火
-					goto next;
-			o07: objectNagareboshiP(i);			// 08 -> 流れ星（親）
-					goto next;
-			o08: objectNagareboshiC(i);			// 09 -> 流れ星（子）
-					goto next;
-			o09: objectItemWarning(i);			// 10 -> アイテム発動警告
-					goto next;
-			o10: objectGetmedal(i);				// 11 -> メダル獲得演出
-					goto next;
-			o11: objectitem_erase(i);			// 12 -> アイテムブロック消去
-					goto next;
-			o12: objectdelfield(i);				// 13 -> ライン強制消去エフェクト
-					goto next;
-			o13: objectplatina_erase(i);		// 14 -> プラチナブロック消去エフェクト
-					goto next;
-			next:	;
+	// 種類ごとにまとめて処理する
+	// 処理中に生成されたオブジェクト（流れ星の子など）は次のフレームから動く
+	for(i = 0, k = 0; k < OBJECT_TYPE_COUNT; k++) {
+		type = objectOrder[k];
+		for(; i < start[k]; i++) {
+			no = sorted[i];
+			if(obj[no]) objectFunc[type](no);
 		}
 	}
+
+	objectCompact();
 }
 
 // objectStatBlock / objectStatBlock2
@@ -535,25 +577,32 @@ void objectdelfield(int32_t no) {
 void objectClear(void) {
 	int32_t		i;
 
-	for(i = 0; i < 100; i++) {
+	for(i = 0; i < OBJECT_MAX; i++) {
 		obj[i] = 0;
+		objfree[i] = OBJECT_MAX - 1 - i;	// 若い番号から使う
 	}
+	objfreecnt = OBJECT_MAX;
+	objcnt = 0;
+	objinit = true;
 }
 //指定したプレイヤーのエフェクトのみ全消去
 void objectClearPl(int32_t player) {
 	int32_t		i;
 
-	for(i = 0; i < 100; i++) {
-		if(objp[i] == player)
-			obj[i] = 0;
+	for(i = 0; i < objcnt; i++) {
+		if(objp[objlist[i]] == player)
+			obj[objlist[i]] = 0;
 	}
+	objectCompact();
 }
 
 void objectComboClearPl(int32_t player) {
-	int32_t		i;
+	int32_t		i, no;
 
-	for(i = 0; i < 100; i++) {
-		if((obj[i] == 2) && (objy[i] / 100 == 100 + 32 * player))
-			obj[i] = 0;
+	for(i = 0; i < objcnt; i++) {
+		no = objlist[i];
+		if((obj[no] == 2) && (objy[no] / 100 == 100 + 32 * player))
+			obj[no] = 0;
 	}
+	objectCompact();
 }
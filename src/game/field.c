@@ -0,0 +1,154 @@
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  フィールドの集計
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+
+#include "common.h"
+
+FieldSummary fldSummary[2];
+
+static int32_t countBits(uint32_t bits) {
+	bits = bits - ((bits >> 1) & 0x55555555);
+	bits = (bits & 0x33333333) + ((bits >> 2) & 0x33333333);
+	bits = (bits + (bits >> 4)) & 0x0F0F0F0F;
+	return (int32_t)((bits * 0x01010101) >> 24);
+}
+
+static int32_t lowestBit(uint32_t bits) {
+	return SDL_MostSignificantBitIndex32(bits & (~bits + 1));
+}
+
+// 列の一番上のブロックより下の空白の数
+static int32_t countColumnHoles(uint32_t column) {
+	if(!column) return 0;
+	return (22 - lowestBit(column)) - countBits(column);
+}
+
+void setFieldBlock(int32_t index, int32_t value) {
+	FieldSummary *summary;
+	int32_t player, x, y;
+
+	if((index < 0) || (index >= 10 * 22 * 2)) return;
+	if(fld[index] == value) return;
+
+	player = index / 220;
+	x = index % 220 % 10;
+	y = index % 220 / 10;
+	summary = &fldSummary[player];
+	summary->squareChanged[y] |= 1u << x;
+
+	// ブロックの有無が変わらなければ集計はそのまま
+	if((fld[index] != 0) == (value != 0)) {
+		fld[index] = value;
+		return;
+	}
+	fld[index] = value;
+
+	summary->holes -= countColumnHoles(summary->columns[x]);
+	summary->columns[x] ^= 1u << y;
+	summary->holes += countColumnHoles(summary->columns[x]);
+	summary->top[x] = summary->columns[x] ? lowestBit(summary->columns[x]) : 22;
+
+	summary->rowBlocks[y] ^= 1u << x;
+	if(summary->rowBlocks[y]) summary->rows |= 1u << y;
+	else summary->rows &= ~(1u << y);
+
+	if(value) {
+		summary->rowCount[y]++;
+		summary->blocks++;
+	} else {
+		summary->rowCount[y]--;
+		summary->blocks--;
+	}
+}
+
+void setFieldSquare(int32_t index, int32_t value) {
+	if((index < 0) || (index >= 10 * 22 * 2)) return;
+	if(flds[index] == value) return;
+
+	flds[index] = value;
+	fldSummary[index / 220].squareChanged[index % 220 / 10] |= 1u << (index % 220 % 10);
+}
+
+void updateFieldRows(int32_t player, uint32_t rows) {
+	FieldSummary *summary;
+	uint32_t bits;
+	int32_t x, y;
+
+	summary = &fldSummary[player];
+	for(y = 0; y < 22; y++) {
+		if(!(rows & (1u << y))) continue;
+		bits = 0;
+		for(x = 0; x < 10; x++)
+			bits |= (uint32_t)(fld[x + y * 10 + player * 220] != 0) << x;
+		summary->rowBlocks[y] = bits;
+		summary->squareChanged[y] |= 0x3FFu;
+	}
+
+	// 段以外の集計はrowBlocksから作り直す
+	SDL_memset(summary->columns, 0, sizeof(summary->columns));
+	summary->rows = 0;
+	summary->blocks = 0;
+	summary->holes = 0;
+	for(y = 0; y < 22; y++) {
+		bits = summary->rowBlocks[y];
+		summary->rowCount[y] = countBits(bits);
+		summary->blocks += summary->rowCount[y];
+		if(bits) summary->rows |= 1u << y;
+		while(bits) {
+			x = lowestBit(bits);
+			summary->columns[x] |= 1u << y;
+			bits &= bits - 1;
+		}
+	}
+	for(x = 0; x < 10; x++) {
+		summary->holes += countColumnHoles(summary->columns[x]);
+		summary->top[x] = summary->columns[x] ? lowestBit(summary->columns[x]) : 22;
+	}
+}
+
+void beginSquareCheck(int32_t player) {
+	SDL_memcpy(fldSummary[player].squareChecking, fldSummary[player].squareChanged, sizeof(fldSummary[player].squareChecking));
+	SDL_memset(fldSummary[player].squareChanged, 0, sizeof(fldSummary[player].squareChanged));
+}
+
+// (x, y)からの4x4とその周り1マスが変わったか
+bool isSquareCheckNeeded(int32_t player, int32_t x, int32_t y) {
+	FieldSummary *summary;
+	uint32_t columns;
+	int32_t i;
+
+	summary = &fldSummary[player];
+	columns = (x > 0) ? (0x3Fu << (x - 1)) : 0x1Fu;
+	for(i = SDL_max(y - 1, 0); i <= SDL_min(y + 4, 21); i++)
+		if((summary->squareChanged[i] | summary->squareChecking[i]) & columns) return true;
+
+	return false;
+}
+
+int32_t getFieldTop(int32_t player) {
+	if(!fldSummary[player].rows) return 22;
+	return lowestBit(fldSummary[player].rows);
+}
+
+int32_t getFieldColumnTop(int32_t player, int32_t x) {
+	if(!fldSummary[player].columns[x]) return 22;
+	return fldSummary[player].top[x];
+}
+
+int32_t getFieldRowCount(int32_t player, int32_t y) {
+	return fldSummary[player].rowCount[y];
+}
+
+bool isFieldRangeOccupied(int32_t player, int32_t start, int32_t count) {
+	int32_t y, x, end, n;
+
+	end = start + count;
+	while(start < end) {
+		y = start / 10;
+		x = start % 10;
+		n = SDL_min(10 - x, end - start);
+		if(fldSummary[player].rowBlocks[y] & (((1u << n) - 1) << x)) return true;
+		start += n;
+	}
+	return false;
+}
@@ -0,0 +1,61 @@
+#ifndef field_h_
+#define field_h_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// フィールドの集計
+// A summary of each player's field, kept up to date as blocks are set and
+// removed, so the shape of the field can be looked up without scanning it.
+// Every write to fld must go through setFieldBlock(), and every write to flds
+// through setFieldSquare(), or the summary gets out of sync with the field.
+// Code that rewrites whole rows directly calls updateFieldRows() afterwards.
+
+typedef struct FieldSummary {
+	uint32_t columns[10];	// 各列のブロック (bit yがy段目)
+	uint32_t rows;			// ブロックのある段 (bit yがy段目)
+	uint32_t rowBlocks[22];	// 各段のブロック (bit xがx列目)
+	int32_t rowCount[22];	// 各段のブロック数
+	int32_t top[10];		// 各列の一番上のブロックの段 (空の列では使わない)
+	int32_t blocks;			// ブロックの総数
+	int32_t holes;			// 各列の一番上のブロックより下の空白の総数
+
+	// 正方形判定用
+	// fldかfldsが変わったマス (bit xがx列目)
+	uint32_t squareChanged[22];
+	uint32_t squareChecking[22];	// 判定中のmakeSquare()の前に変わったマス
+} FieldSummary;
+
+extern FieldSummary fldSummary[2];
+
+// fld[index] = value と同じ
+void setFieldBlock(int32_t index, int32_t value);
+
+// flds[index] = value と同じ
+void setFieldSquare(int32_t index, int32_t value);
+
+// fldとfldsを直接書き換えた後に集計し直す
+// rowsのbit yがy段目 (変わった段のマスは全部正方形判定をやり直す)
+void updateFieldRows(int32_t player, uint32_t rows);
+
+// 正方形判定
+// checkSquare() only looks at the 4x4 square and the cells next to it, so an
+// origin only has to be checked again if one of those cells changed since it
+// was last checked. Cells changed while checking, by marking squares, are
+// checked by the rest of the current check, and kept for the next check.
+void beginSquareCheck(int32_t player);
+bool isSquareCheckNeeded(int32_t player, int32_t x, int32_t y);
+
+// フィールドの最上段を返す (空なら22)
+int32_t getFieldTop(int32_t player);
+
+// x列の最上段を返す (空なら22)
+int32_t getFieldColumnTop(int32_t player, int32_t x);
+
+// y段目のブロック数を返す
+int32_t getFieldRowCount(int32_t player, int32_t y);
+
+// fld[start + player * 220]からcount個の中にブロックがあるか
+bool isFieldRangeOccupied(int32_t player, int32_t start, int32_t count);
+
+#endif
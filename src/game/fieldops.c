@@ -0,0 +1,179 @@
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  フィールドの変形
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+
+#include "common.h"
+
+// FIELD_LAYER_*のbitの順
+static int32_t *const fieldLayers[4] = { fld, fldt, fldi, flds };
+static int32_t *const fieldBuffers[4] = { fldbuf, fldtbuf, fldibuf, fldsbuf };
+
+// first段目からlast段目まで
+static uint32_t fieldRows(int32_t first, int32_t last) {
+	if(first > last) return 0;
+	return ((1u << (last + 1)) - 1) & ~((1u << first) - 1);
+}
+
+// firstからstepおきのcount個のマスのブロックをfirstの側に詰める
+// 動いたブロックの中で一番遠かったものの元の位置を返す (動かなければ-1)
+static int32_t compactCells(int32_t first, int32_t step, int32_t count) {
+	int32_t i, l, n, last;
+
+	n = 0;
+	last = -1;
+	for(i = 0; i < count; i++) {
+		if(!fld[first + i * step]) continue;
+		if(n != i) {
+			for(l = 0; l < 4; l++)
+				fieldLayers[l][first + n * step] = fieldLayers[l][first + i * step];
+			last = i;
+		}
+		n++;
+	}
+
+	// 動いたブロックが通ったマスは空になる
+	for(i = n; i <= last; i++)
+		for(l = 0; l < 4; l++)
+			fieldLayers[l][first + i * step] = 0;
+
+	return last;
+}
+
+void compactFieldDown(int32_t player) {
+	int32_t x, last;
+	uint32_t rows;
+
+	rows = 0;
+	for(x = 0; x < fldsizew[player]; x++) {
+		last = compactCells(x + fldsizeh[player] * fldsizew[player] + player * 220, -fldsizew[player], fldsizeh[player] + 1);
+		if(last >= 0) rows |= fieldRows(fldsizeh[player] - last, fldsizeh[player]);
+	}
+	if(rows) updateFieldRows(player, rows);
+}
+
+void compactFieldRows(int32_t player, bool left) {
+	int32_t y, last;
+	uint32_t rows;
+
+	rows = 0;
+	for(y = 0; y <= fldsizeh[player]; y++) {
+		if(left)
+			last = compactCells(y * fldsizew[player] + player * 220, 1, fldsizew[player]);
+		else
+			last = compactCells((fldsizew[player] - 1) + y * fldsizew[player] + player * 220, -1, fldsizew[player]);
+		if(last >= 0) rows |= 1u << y;
+	}
+	if(rows) updateFieldRows(player, rows);
+}
+
+void saveFieldBuffer(int32_t player, int32_t layers, int32_t clearLayers) {
+	int32_t l;
+	size_t size;
+
+	size = fldsizew[player] * (fldsizeh[player] + 1) * sizeof(int32_t);
+	for(l = 0; l < 4; l++) {
+		if(layers & (1 << l)) SDL_memcpy(&fieldBuffers[l][player * 220], &fieldLayers[l][player * 220], size);
+		if(clearLayers & (1 << l)) SDL_memset(&fieldLayers[l][player * 220], 0, size);
+	}
+	if(clearLayers & (FIELD_LAYER_BLOCK | FIELD_LAYER_SQUARE))
+		updateFieldRows(player, fieldRows(0, fldsizeh[player]));
+}
+
+void mirrorFieldColumn(int32_t player, int32_t x, int32_t layers) {
+	int32_t y, l, src, dst;
+
+	for(y = 0; y <= fldsizeh[player]; y++) {
+		src = x + y * fldsizew[player] + player * 220;
+		dst = (fldsizew[player] - x - 1) + y * fldsizew[player] + player * 220;
+		for(l = 0; l < 4; l++)
+			if(layers & (1 << l)) fieldLayers[l][dst] = fieldBuffers[l][src];
+	}
+	if(layers & (FIELD_LAYER_BLOCK | FIELD_LAYER_SQUARE))
+		updateFieldRows(player, fieldRows(0, fldsizeh[player]));
+}
+
+void flipFieldRows(int32_t player, int32_t top) {
+	int32_t y, l, src, dst;
+
+	saveFieldBuffer(player, FIELD_LAYER_ALL, 0);
+	for(y = top; y <= fldsizeh[player]; y++) {
+		src = (fldsizeh[player] - (y - top)) * fldsizew[player] + player * 220;
+		dst = y * fldsizew[player] + player * 220;
+		for(l = 0; l < 4; l++)
+			SDL_memcpy(&fieldLayers[l][dst], &fieldBuffers[l][src], fldsizew[player] * sizeof(int32_t));
+	}
+	updateFieldRows(player, fieldRows(top, fldsizeh[player]));
+}
+
+uint32_t negateFieldRow(int32_t player, int32_t y, uint32_t fillMask, int32_t block, int32_t timer) {
+	int32_t x, i;
+	uint32_t changed;
+
+	changed = 0;
+	for(x = 0; x < fldsizew[player]; x++) {
+		i = x + y * fldsizew[player] + player * 220;
+		if(fld[i]) {					// ブロックを空白に
+			fld[i] = 0;
+			fldt[i] = 0;
+			fldi[i] = 0;
+		} else if(fillMask & (1u << x)) {	// 空白をブロックに
+			fld[i] = block;
+			fldt[i] = timer;
+		} else {
+			continue;
+		}
+		changed |= 1u << x;
+	}
+	if(changed) updateFieldRows(player, 1u << y);
+
+	return changed;
+}
+
+uint32_t clearFieldCells(int32_t player, int32_t y, uint32_t mask, int32_t *squares) {
+	int32_t x, i;
+	uint32_t cleared;
+
+	cleared = 0;
+	for(x = 0; x < fldsizew[player]; x++) {
+		i = x + y * fldsizew[player] + player * 220;
+		if(!(mask & (1u << x)) || !fld[i]) continue;
+		fld[i] = 0;
+		fldt[i] = 0;
+		fldi[i] = 0;
+		if(squares) squares[x] = flds[i];
+		flds[i] = 0;
+		cleared |= 1u << x;
+	}
+	if(cleared) updateFieldRows(player, 1u << y);
+
+	return cleared;
+}
+
+void shiftFieldRowsUp(int32_t player, int32_t layers) {
+	int32_t l;
+	size_t size;
+
+	size = fldsizew[player] * fldsizeh[player] * sizeof(int32_t);
+	for(l = 0; l < 4; l++)
+		if(layers & (1 << l))
+			SDL_memmove(&fieldLayers[l][player * 220], &fieldLayers[l][fldsizew[player] + player * 220], size);
+	SDL_memmove(&erase[player * 22], &erase[1 + player * 22], fldsizeh[player] * sizeof(int32_t));
+
+	if(layers & (FIELD_LAYER_BLOCK | FIELD_LAYER_SQUARE))
+		updateFieldRows(player, fieldRows(0, fldsizeh[player] - 1));
+}
+
+void shiftFieldRowsDown(int32_t player, int32_t y, int32_t layers) {
+	int32_t l;
+
+	for(l = 0; l < 4; l++) {
+		if(!(layers & (1 << l))) continue;
+		SDL_memmove(&fieldLayers[l][fldsizew[player] + player * 220], &fieldLayers[l][player * 220], fldsizew[player] * y * sizeof(int32_t));
+		SDL_memset(&fieldLayers[l][player * 220], 0, fldsizew[player] * sizeof(int32_t));
+	}
+	SDL_memmove(&erase[1 + player * 22], &erase[player * 22], y * sizeof(int32_t));
+	erase[player * 22] = 0;
+
+	if(layers & (FIELD_LAYER_BLOCK | FIELD_LAYER_SQUARE))
+		updateFieldRows(player, fieldRows(0, y));
+}
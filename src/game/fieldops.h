@@ -0,0 +1,54 @@
+#ifndef fieldops_h_
+#define fieldops_h_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// フィールドの変形
+// The item effects move, flip and clear many cells of fld, fldt, fldi and flds
+// at once. These functions do it a row (or a column) at a time, with one
+// updateFieldRows() at the end, instead of the cell by cell setFieldBlock()
+// and setFieldSquare() calls of the original loops. Each one gives the same
+// field as the loop it replaces.
+
+// 書き換える配列
+enum {
+	FIELD_LAYER_BLOCK = 1 << 0,		// fld
+	FIELD_LAYER_TIMER = 1 << 1,		// fldt
+	FIELD_LAYER_ITEM = 1 << 2,		// fldi
+	FIELD_LAYER_SQUARE = 1 << 3,	// flds
+	FIELD_LAYER_ALL = FIELD_LAYER_BLOCK | FIELD_LAYER_TIMER | FIELD_LAYER_ITEM | FIELD_LAYER_SQUARE
+};
+
+// 自由落下 各列のブロックを下に詰める
+void compactFieldDown(int32_t player);
+
+// 各段のブロックを左(leftがfalseなら右)に詰める
+void compactFieldRows(int32_t player, bool left);
+
+// フィールドをバッファ(fldbuf・fldtbuf・fldibuf・fldsbuf)に退避する
+// layersの配列を退避して、clearLayersの配列を空にする
+void saveFieldBuffer(int32_t player, int32_t layers, int32_t clearLayers);
+
+// バッファのx列をフィールドの左右反転した列に戻す
+void mirrorFieldColumn(int32_t player, int32_t x, int32_t layers);
+
+// top段目から最下段までを上下反転する (バッファも書き換わる)
+void flipFieldRows(int32_t player, int32_t top);
+
+// ネガフィールド y段目のブロックを空白にして、fillMaskの列の空白をブロックにする
+// 新しいブロックはfldがblock、fldtがtimerになる
+// 変わったマスを返す(bit xがx列目) fldsはそのままなので、呼ぶ側で破片の判定をしてから空にする
+uint32_t negateFieldRow(int32_t player, int32_t y, uint32_t fillMask, int32_t block, int32_t timer);
+
+// y段目のmaskの列のブロックを消す (空白のマスはそのまま)
+// 消したマスを返し、squaresがNULLでなければ消す前のfldsを入れる
+uint32_t clearFieldCells(int32_t player, int32_t y, uint32_t mask, int32_t *squares);
+
+// せり上がり 2段目から最下段までを1段上にずらす (最下段はそのまま、eraseも一緒にずらす)
+void shiftFieldRowsUp(int32_t player, int32_t layers);
+
+// y段目より上を1段下にずらして、一番上の段を空にする (y段目は消える、eraseも一緒にずらす)
+void shiftFieldRowsDown(int32_t player, int32_t y, int32_t layers);
+
+#endif
@@ -41,6 +41,26 @@ void ExBltText(int32_t pno, const char* str, int32_t cf, int32_t cw, int32_t ch,
 	APP_DrawPlaneText(pno, str, cf, cw * zoomRate, ch * zoomRate, dx * zoomRate, dy * zoomRate, shx * zoomRate, shy * zoomRate, shw * zoomRate);
 }
 
+void ExBltGlyphs(int32_t pno, const APP_Glyph* glyphs, int32_t count, int32_t cw, int32_t ch)
+{
+	APP_DrawPlaneGlyphs(pno, glyphs, count, cw, ch, zoomRate);
+}
+
+int32_t ExCacheLayerBegin(int32_t n, int32_t w, int32_t h)
+{
+	return APP_BeginCacheLayer(n, w * zoomRate, h * zoomRate);
+}
+
+void ExCacheLayerClear(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+	APP_ClearCacheLayerRect(x * zoomRate, y * zoomRate, w * zoomRate, h * zoomRate);
+}
+
+void ExCacheLayerBlt(int32_t n, int32_t dx, int32_t dy)
+{
+	APP_DrawCacheLayer(n, dx * zoomRate, dy * zoomRate);
+}
+
 void ExTextLayerSize(int32_t n, int32_t size)
 {
 	 APP_SetTextLayerSize(n, size * zoomRate);
@@ -15,6 +15,11 @@ void ExBlendBltRect(int32_t pno,int32_t dx,int32_t dy,int32_t sx,int32_t sy,int3
 void ExBlendBltRectScaled(int32_t pno,int32_t dx,int32_t dy,int32_t sx,int32_t sy,int32_t hx,int32_t hy,int32_t a,int32_t scx,int32_t scy);
 
 void ExBltText(int32_t pno, const char* str, int32_t cf, int32_t cw, int32_t ch, int32_t dx, int32_t dy, int32_t shx, int32_t shy, int32_t shw);
+void ExBltGlyphs(int32_t pno, const APP_Glyph* glyphs, int32_t count, int32_t cw, int32_t ch);
+
+int32_t ExCacheLayerBegin(int32_t n,int32_t w,int32_t h);
+void ExCacheLayerClear(int32_t x,int32_t y,int32_t w,int32_t h);
+void ExCacheLayerBlt(int32_t n,int32_t dx,int32_t dy);
 
 void ExTextLayerSize(int32_t n,int32_t size);
 void ExTextLayerMove(int32_t n,int32_t x,int32_t y);
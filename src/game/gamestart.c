@@ -380,7 +380,7 @@ int32_t		bs[2], bk[2];			// ブロックの自然落下とくっつきのタイ
 int32_t		mp[2], mpc[2];			// 前回のパッドの入力内容と時間
 int32_t		mps[2 * 2];			// スタート時のmpとmpc（リプレイ記録用）
 int32_t		erase[22 * 2];			// 消されるブロック
-int32_t		obj[100], objx[100], objy[100], objv[100], objw[100], objj[100], objc[100], obja[100];
+int32_t		obj[OBJECT_MAX], objx[OBJECT_MAX], objy[OBJECT_MAX], objv[OBJECT_MAX], objw[OBJECT_MAX], objj[OBJECT_MAX], objc[OBJECT_MAX], obja[OBJECT_MAX];
 int32_t		lc[2], sp[2];			// レベルアップまでのカウンタと落下スピード
 int32_t		upLines[2];			// 上昇してしまうライン数
 int32_t		wait1[2], wait2[2];		// 固定→次・消滅時の待ち時間
@@ -750,7 +750,7 @@ int32_t		p_goaltypenumlist[10]={5,10,20,30,50,75,100,130,160,200};
 int32_t		dead_blockframe = 1;			// 死んだとき枠を消すか(0=消さない 1=消す)
 
 // #1.60c7l1追加変数
-int32_t		objp[100];						// 破壊エフェクト用プレイヤー番号
+int32_t		objp[OBJECT_MAX];						// 破壊エフェクト用プレイヤー番号
 
 // #1.60c7l2追加変数 [バックアップ]
 int32_t		b_wait1[2]={26,26};		// 固定→次
@@ -1141,6 +1141,7 @@ int32_t		gup3sp_adjust[2];		//ランクにあわせてスピード調整
 int32_t		qualityflag[2];			//2回以上出ないように
 int32_t		skillflag[2];
 int32_t		tr2[2];					//可変速レベル
+SpeedSchedule	speedSchedule[2];		//レベルアップのスケジュール
 int32_t		border_rank[2];			//
 int32_t		border_time[20] =		//ランクごとの基準タイム
 {
@@ -1424,6 +1425,7 @@ uint32_t    SegaSeed[2]={711800410,711800410};     // generates sega's poweron p
 uint32_t	BloxeedSeed[2]={711800411,711800411};   // generates Bloxeed's poweron pattern. on ehigher. but see later.
 uint32_t	SavedSeed[2]={0,0};							// needed to save randomizer states
 uint32_t	PieceSeed=0;							// needed to generate pieces without losing saved seed.
+NextGenerator	nextGenerator[2];					// シードで決まるツモの生成器（リプレイにはシードと種類だけ保存）
 
 bool inmenu = true;
 APP_InputType lastInputType = APP_INPUT_NULL;
@@ -1443,6 +1445,10 @@ APP_Button	pressDirection[2] = { APP_BUTTON_NULL, APP_BUTTON_NULL };
 
 static const char* const writeDirectories[] = {
 	"replay",
+	"cap",
+	#ifdef APP_REPLAY_RENDER
+	"movie",
+	#endif
 	"config",
 	"config/data",
 	"config/mission",
@@ -1463,7 +1469,7 @@ void mainUpdate() {
 	default:
 	case MAIN_INIT:
 		mainLoopState = MAIN_START;
-		APP_SetResourceSettings(WAVE_COUNT, writeDirectories, SDL_arraysize(writeDirectories), PLANE_COUNT, TEXT_LAYER_COUNT);
+		APP_SetResourceSettings(WAVE_COUNT, writeDirectories, SDL_arraysize(writeDirectories), PLANE_COUNT, TEXT_LAYER_COUNT, CACHE_LAYER_COUNT);
 		goto skipSpriteTime;
 
 	case MAIN_START: {
@@ -1472,10 +1478,8 @@ void mainUpdate() {
 		init = true;
 		loopFlag = true;
 
-		if (load) {
-			APP_Quit();
-		}
-
+		// SDLのデバイスやワーカーは作り直さず、設定の変更で影響を受けた
+		// リソース（load）だけを後で読み直す
 		APP_Init();
 		if (APP_IsMusicPlaying()) APP_StopMusic();
 		gameInit();
@@ -1530,9 +1534,12 @@ void mainUpdate() {
 			setDrawRate(1);
 		}
 
-		if (load) {
+		if (load & LOAD_GRAPHICS) {
 			LoadGraphic(PLANE_LOADING, "loading");		// Loading表示
 		}
+
+		// ステージ・ミッションのデータは一度だけ読み込む（グラフィックと並行して読み込まれる）
+		loadStageDatabase();
 		x = SDL_rand(5);
 		if ( getDrawRate() != 1 )
 			y = SDL_rand(2);
@@ -1602,7 +1609,13 @@ void mainUpdate() {
 		break;
 
 	case MAIN_INIT_END: {
+		#if defined(APP_REPLAY_BENCHMARK)
+		mainLoopState = MAIN_REPLAY_BENCHMARK;
+		#elif defined(APP_REPLAY_RENDER)
+		mainLoopState = MAIN_REPLAY_RENDER;
+		#else
 		mainLoopState = MAIN_TITLE;
+		#endif
 		init = true;
 
 		// BGM読み込み
@@ -1726,6 +1739,18 @@ void mainUpdate() {
 		testmenu();
 		break;
 
+	#ifdef APP_REPLAY_BENCHMARK
+	case MAIN_REPLAY_BENCHMARK:
+		replayBenchmarkProc();
+		break;
+	#endif
+
+	#ifdef APP_REPLAY_RENDER
+	case MAIN_REPLAY_RENDER:
+		replayRenderProc();
+		break;
+	#endif
+
 	#ifdef APP_ENABLE_KEYBOARD_INPUT
 	case MAIN_RESET_KEYBOARD: {
 		const char* const lines[] = {
@@ -1788,6 +1813,18 @@ void mainUpdate() {
 	spriteTime();
 }
 
+// ゲーム中のフレームはヒープ確保をしない前提（メモリ追跡ビルドで検査）
+// 検査するのは、参加中の全員がフレームの間ずっとブロック移動中だったフレームだけ
+static bool steadyPlayFrame;
+static bool anyoneInPlay;
+
+static void checkSteadyPlayStatus(int32_t player) {
+	if(status[player] == 5)
+		anyoneInPlay = true;
+	else if(status[player] != 0)	// 途中参加待ちは不参加
+		steadyPlayFrame = false;
+}
+
 void gameExecute() {
 	static int32_t i;
 
@@ -1805,6 +1842,9 @@ void gameExecute() {
 		init = false;
 	}
 
+	steadyPlayFrame = true;
+	anyoneInPlay = false;
+
 	// リプレイ中の早送り
 	noredraw = 0;
 	if(playback && !demo) {
@@ -1840,10 +1880,8 @@ void gameExecute() {
 
 	count = (count + 1) % 65536;
 
-	// 背景非表示設定追加 #1.60c7i9
-	if(!skip_viewbg) viewBack();
-
-	viewFldBackground();
+	// 背景とフィールド背景（変わらない部分はキャッシュから描く）
+	viewBackground();
 
 	// スタッフロール #1.60c7n5
 	for(int32_t j = 0; j < fast + 1; j++) {
@@ -1881,6 +1919,10 @@ void gameExecute() {
 	if (lastProc()) return;
 	afterGameExecuteLastProc:
 
+	// ファイルやBGMの処理をしたフレームはAPP側で対象外になる
+	if(steadyPlayFrame && anyoneInPlay && (flag == 0))
+		APP_MarkMemorySteadyFrame();
+
 	// flagが1以上になるとタイトルへ
 	if(flag > 0) {
 		hnext[0] = dispnext;
@@ -3203,12 +3245,12 @@ void playerInitial(int32_t player) {
 
 	for(i = 0; i < 10; i++)
 		for(j = 0; j < 22; j++) {
-			fld[i + j * 10 + player * 220] = 0;
+			setFieldBlock(i + j * 10 + player * 220, 0);
 			fldt[i + j * 10 + player * 220] = 0;	// #1.60c7j5
 			fldi[i + j * 10 + player * 220] = 0;	// #1.60c7n1
 			fldu[i + j * 10 + player * 220] = 0;
 			fldubuf[i + j * 10 + player * 220] = 0;
-			flds[i + j * 10 + player * 220] = 0;
+			setFieldSquare(i + j * 10 + player * 220, 0);
 			fldsbuf[i + j * 10 + player * 220] = 0;
 		}
 
@@ -3253,11 +3295,14 @@ int32_t standardRand(void) {
 //▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
 // 変数playerを追加しました。#1.60c7m1
 void versusInit(int32_t player) {
-	int32_t i, j, k, same, temp, mae, shu;
+	int32_t i, j, temp;
 	size_t len;
+	bool nextAdjust;
+
+	nextAdjust = ((gameMode[player] != 5) && (next_adjust)) || ((gameMode[player] == 5) && (p_next_adjust));
 
-	same = limit[nextblock];
-	mae = -1;
+	// シードで決まらないツモは生成器を使わない
+	nextGenerator[player].algorithm = NEXT_ALGORITHM_NONE;
 
 	// ツモの読み込み #1.60c7g3
 	len = 0;
@@ -3290,18 +3335,18 @@ void versusInit(int32_t player) {
 		}
 	} else if((nextblock == 9)|| ((p_nextblock ==9)&&(gameMode[player] == 5))) {
 		// ガイドライン対応ゲーム風NEXT生成 #1.60c7s1(nextblock ==11)
-		guidelineNextInit(player);
+		startNextGenerator(player, NEXT_ALGORITHM_GUIDELINE, NEXT_GENERATOR_PARAMS(nextAdjust, 0, 0));
 	}
 	else if ((nextblock == 8) || ((p_nextblock == 8) && (gameMode[player] == 5))) {
 		// TGM風NEXT生成#1.60c7h4
-		tgmNextInit(player);
+		startNextGenerator(player, NEXT_ALGORITHM_TGM, NEXT_GENERATOR_PARAMS(nextAdjust, 0, 0));
 	}
 	else if ((nextblock == 16) || ((p_nextblock == 16) && (gameMode[player] == 5))) {
-		// TGM風NEXT生成#1.60c7h4
-		tgm3NextInit(player);
+		// TGM3風NEXT生成
+		startNextGenerator(player, NEXT_ALGORITHM_TGM3, NEXT_GENERATOR_PARAMS(nextAdjust, 0, 0));
 	} else if((nextblock == 15)|| ((p_nextblock ==15)&&(gameMode[player] == 5))) {
 		// Sakura風NEXT
-		SakuraNextInit(player);
+		startNextGenerator(player, NEXT_ALGORITHM_SAKURA, 0);
 	} else if((nextblock == 10)|| ((p_nextblock ==10)&&(gameMode[player] == 5))) {
 		//電源パターンNEXT生成
 		len = SDL_strlen(nextdengen_list);
@@ -3406,34 +3451,7 @@ void versusInit(int32_t player) {
 		}
 		PlayerdataSave(); // save randomizer state
 	} else {
-		shu = nextblock;
-		for(i = 0; i < 1400 / shu + 1; i++) {
-			for(j = 0; j < 7; j++) nextwork[j] = 0;
-			same = same - (same > 0);
-
-			for(j = 0; j < shu; j++) {
-				do {
-					//初手
-					if((shu * i + j == 0) && ( ((gameMode[player] != 5) && (next_adjust)) || ((gameMode[player] == 5) && (p_next_adjust)) )) {
-						do {
-							temp = TGMPiece(&PieceSeed);
-						} while((temp != 0) && (temp != 1) && (temp != 4) && (temp != 5));
-					} else
-						temp = TGMPiece(&PieceSeed);
-
-					if((same == 0) && (mae == temp)) {
-						k = 1;
-						same = limit[nextblock];
-					}
-					else k = 0;
-
-				} while(((nextwork[temp] != 0) || (mae == temp)) && (k == 0));
-
-				if(shu * i + j < 1400) nextb[i * shu + j + player * 1400] = temp;
-				nextwork[temp] = 1;
-				mae = temp;
-			}
-		}
+		startNextGenerator(player, NEXT_ALGORITHM_HISTORY, NEXT_GENERATOR_PARAMS(nextAdjust, nextblock, limit[nextblock]));
 	}
 
 	nextc[player] = 0;
@@ -3446,327 +3464,29 @@ void versusInit(int32_t player) {
 }
 
 //▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
-//  TGM風なNEXT生成処理#1.60c7h4
+//  ツモ生成器によるNEXT生成
 //▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
-// 変数playerを追加しました。#1.60c7m1
-void tgmNextInit(int32_t player) {
-	int32_t i, j;
-	int32_t history[4];
-	int32_t block;
-
-	//	for(i = 0; i < 4; i++) history[i] = 3; // 履歴を緑で埋める
-
-		// Z S Z Sで埋める c7t3.1
-	history[0] = 3;
-	history[1] = 6;
-	history[2] = 3;
-	history[3] = 6;
-
-	// 初手生成
-	// next_adjustが動作してなかったのでとりあえず修正 #1.60c7i4
-	if (((gameMode[player] != 5) && (next_adjust)) || ((gameMode[player] == 5) && (p_next_adjust))) {
-		do {
-			nextb[0 + player * 1400] = TGMPiece(&PieceSeed);
-		} while ((nextb[0 + player * 1400] == 2) || (nextb[0 + player * 1400] == 3) || (nextb[0 + player * 1400] == 6));
-	}
-	else {
-		nextb[0 + player * 1400] = TGMPiece(&PieceSeed);
-	}
-	// 初手生成時に履歴がずれていなかった LITE30.20より C7U1.5
-	for (j = 0; j < 3; j++) {
-		history[3 - j] = history[3 - (j + 1)];
-	}
-
-	history[0] = nextb[0 + player * 1400];
-
-	// 残りのツモを生成
-	for (i = 1; i < 1400; i++) {
-		// ツモを引く
-
-		// 引いたツモが履歴にあったら最大4回引き直し→6回に変更c7t3.1	これもリプレイには影響なし？
-		for (j = 0; j < 6; j++) {
-			block = TGMPiece(&PieceSeed); //  tap bug. this is supposed to be above the loop.
-
-			// 4つの履歴に無かったらその場で抜ける
-			if ((block != history[0]) && (block != history[1]) && (block != history[2]) && (block != history[3]))
-				break;
-			block = TGMPiece(&PieceSeed); // the actual intended reroll.
-		}
-
-		// 履歴をずらす
-		for (j = 0; j < 3; j++) {
-			history[3 - j] = history[3 - (j + 1)];
-		}
-
-		// 履歴に新しいブロックを入れる
-		history[0] = block;
-
-		// nextbに入れる
-		nextb[i + player * 1400] = block;
-	}
-}
-//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
-//  TGM3 NEXT
-//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
-int32_t MostDroughtedPiece(int32_t histogram[7])
-{
-	int32_t DroughtedPiece = 0; // assume it's an i until we know otherwise
-	int32_t DroughtLength = 0; // get drought length  of I piece
-	for (int32_t position = 0; position < 7; position++)
-	{
-		if (histogram[position] > DroughtLength)
-		{
-			DroughtedPiece = position;
-			DroughtLength = histogram[position];
-		}
-	}
-	return DroughtedPiece; // don't need to convert
+// PieceSeedから生成器を初期化し、nextbを1周分埋める
+// 1周目の途中からはrefillNextBlocksが続きを半分ずつ生成する
+void startNextGenerator(int32_t player, NextAlgorithm algorithm, int32_t params) {
+	nextGeneratorInit(&nextGenerator[player], algorithm, PieceSeed, params);
+	nextGeneratorFill(&nextGenerator[player], &nextb[player * 1400], 1400);
 }
 
-void tgm3NextInit(int32_t player) {
-	int32_t i, j;
-	int32_t history[4] = { 3,6,3,6 }; 	// init history to Z S Z S
-	int32_t block,bagpos,bugdrought,droughtlength,maxdroughtlength;
-	int32_t dp_bag[35]= { 0,0,0,0,0,3,3,3,3,3,6,6,6,6,6,5,5,5,5,5,1,1,1,1,1,2,2,2,2,2,4,4,4,4,4 }; // used to tryand prevent droughts  i,z,s,j,l,o,t
-	int32_t histogram[7] = { 4,4,4,4,4,4,4 }; //
-	// next_adjust
-	if (((gameMode[player] != 5) && (next_adjust)) || ((gameMode[player] == 5) && (p_next_adjust))) {
-		do {
-
-			nextb[0 + player * 1400] = TGMPiece(&PieceSeed);
-		} while ((nextb[0 + player * 1400] == 2) || (nextb[0 + player * 1400] == 3) || (nextb[0 + player * 1400] == 6));
-	}
-	else {
-		nextb[0 + player * 1400] = TGMPiece(&PieceSeed);;
-
-	}
-	// piece falls off history
-	for (j = 0; j < 3; j++) {
-		history[3 - j] = history[3 - (j + 1)];
-	}
-	// queue the non s/z/o piece in it
-	history[0] = nextb[0 + player * 1400];
-	// update histogram
-    // increment all seven
-	histogram[0]++;
-	histogram[1]++;
-	histogram[2]++;
-	histogram[3]++;
-	histogram[4]++;
-	histogram[5]++;
-	histogram[6]++;
-	histogram[nextb[0 + player * 1400]] = 0; // zero the piece we just saw. will be duplicated later
-
-	// fill the rest.
-	for (i = 1; i < 1400; i++) {
-		for (j = 0; j < 6; j++) {
-			bugdrought = -1; // start with no bug.
-
-			bagpos = LCGRand(&PieceSeed)%35;  //  initial roll
-			block = dp_bag[bagpos];
-
-			// is piece in history?
-			if ((block != history[0]) && (block != history[1]) && (block != history[2]) && (block != history[3]))
-				break;  // out of the loop if not
-			// it was in history, so we replace it with the most droughted piece for the reroll.
-			dp_bag[bagpos] = MostDroughtedPiece(histogram);
-			bugdrought= MostDroughtedPiece(histogram);
-			// same bug from tap here. previos roll should have been outside the loop.
-			bagpos = LCGRand(&PieceSeed) % 35;  //  initial roll
-			block = dp_bag[bagpos];
-
-		}
-		// now we have our current piece
-		// but we must check the bug.
-		// calculate highest drought length before update the histogram
-		droughtlength = 0;
-		for (int32_t position = 0; position < 7; position++)
-		{
-			if (histogram[position] > droughtlength)
-			{
-				droughtlength = histogram[position];
-			}
-		}
-		maxdroughtlength = droughtlength;  // remember for later check.
-
-		// update histogram
-	    // increment all seven
-		histogram[0]++;
-		histogram[1]++;
-		histogram[2]++;
-		histogram[3]++;
-		histogram[4]++;
-		histogram[5]++;
-		histogram[6]++;
-		histogram[block] = 0; // zero the piece we just saw.
-		// now for the bug.
-		// if two pieces shared the same drought length, one of them will have incremented.
-		for (int32_t position = 0; position < 7; position++)
-		{
-			if (histogram[position] > droughtlength)
-			{
-				droughtlength = histogram[position];
-			}
-		}
-		if (bugdrought < 0)
-		{
-			// no reroll happened, update the bag regardless
-			dp_bag[bagpos] = MostDroughtedPiece(histogram);
-		}
-		else if (droughtlength > maxdroughtlength)
-		{
-			// no bug, time to update
-			dp_bag[bagpos] = MostDroughtedPiece(histogram);
-		}
-		// update history
-		for (j = 0; j < 3; j++) {
-			history[3 - j] = history[3 - (j + 1)];
-		}
-		history[0] = block;
-
-		// add block to sequence array.
-		nextb[i + player * 1400] = block;
-	}
+// nextcを進めた後に呼ぶ
+// nextbをリングバッファとして使い、nextcが半分を越えるたびに反対側の半分へ続きを生成する
+// 先読みは半分より短いので、読む前に必ず生成が済んでいる
+// VS・PRACTICE・TOMOYOはnextcを戻したり2Pへコピーしたりするので、従来どおり1400個を繰り返す
+void refillNextBlocks(int32_t player) {
+	if(nextGenerator[player].algorithm == NEXT_ALGORITHM_NONE) return;
+	if((gameMode[player] == 4) || (gameMode[player] == 5) || (gameMode[player] == 6)) return;
+
+	if(nextc[player] == 0)
+		nextGeneratorFill(&nextGenerator[player], &nextb[player * 1400 + 700], 700);
+	else if(nextc[player] == 700)
+		nextGeneratorFill(&nextGenerator[player], &nextb[player * 1400], 700);
 }
 
-void SakuraNextInit(int32_t player) {
-	int32_t i, j;
-	int32_t history[6];  // history size SIX for this one.
-	int32_t block;
-
-
-	// empty history. piece can never be a seven, so that's placeholder.
-		history[0] = 7;
-		history[1] = 7;
-		history[2] = 7;
-		history[3] = 7;
-		history[4] = 7;
-		history[5] = 7;
-
-	// by Arika's superplay, next adjust doesn't happen.
-    // so we start at zero.
-	// a bit different from normal memory 4
-	for(i = 0; i < 1400; i++) {
-		// pick random block
-		block = TGMPiece(&PieceSeed);
-
-		// four rerolls, with special roll for 5
-		if((block == history[0]) || (block == history[1]) || (block == history[2]) || (block == history[3]) || (block == history[4]) || (block == history[5])) {
-			for(j = 0; j < 4; j++) {
-				block =TGMPiece(&PieceSeed);
-
-				// 4つの履歴に無かったらその場で抜ける
-				if((block != history[0]) && (block != history[1]) && (block != history[2]) &&(block != history[3]) &&(block != history[4]) && (block != history[5]))
-					break;
-			}
-		}
-		// if still in history.
-		if((block == history[0]) || (block == history[1]) || (block == history[2]) || (block == history[3]) || (block == history[4]) || (block == history[5]))
-		{
-			// flip a coin between second and sixth.
-			block=history[LCGRand(&PieceSeed)%2*4+1]; // can't use shortcut.
-		}
-		// if that was a 7, because it wasn't initialized yet
-		if (block==7)
-		{
-			// then pick a random piece
-			block = TGMPiece(&PieceSeed); // no more repeat checks.
-		}
-		// push up history
-		for(j=0;j<5;j++) {
-			history[5 - j] = history[5 - (j + 1)];
-		}
-
-		// add block to history.
-		history[0] = block;
-
-		// add block to sequence.
-		nextb[i + player * 1400] = block;
-	}
-}
-
-// LCG.  may be used to avoid storing whole piece sequences. ALL TGM games appear to use it :) Slight bias for I piece, since 0=I. Aren't we nice?
-uint32_t LCGRand(uint32_t *lcgseed)
-{
-	uint32_t lcgadd=12345; // default for all TGM games, as far as I know
-
-	uint32_t lcgmultiply=0x41c64e6d; // default for TAP/TI? Good enough for Arika, good enough for us.
-	*lcgseed=(*lcgseed)*lcgmultiply+lcgadd; // happily ignore overflow
-	return (*lcgseed>>10) & 0x7fff; //return 15 bits after discarding 10 least significant, which provides mostly balanced mod 7 distribution, in theory. :)
-}
-// convert pieces from tgm numbers to heboris numbers. Use on pieces you get from LCGRand to duplicate real TGM seeds.
-int32_t TGMConvert(int32_t piece)
-{
-	int32_t retval;
-	switch (piece)	  //
-	{
-	case 1: retval = 3; break;
-	case 2: retval = 6; break;
-	case 3: retval = 5; break;
-	case 4: retval = 1; break;
-	case 5: retval = 2; break;
-	case 6: retval = 4; break;
-	default: retval = piece; break; // I is correct
-	}
-	return retval;
-
-}
-// combine them into one function and mod 7 :)
-int32_t TGMPiece(uint32_t *tgmseed)
-{
-	return TGMConvert(LCGRand(tgmseed)%7); // already a pointer
-}
-
-//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
-//  ガイドライン対応ゲーム風なNEXT生成処理
-//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
-void guidelineNextInit(int32_t player) {
-	int32_t i, j;
-	int32_t tmp;
-	int32_t first;
-	int32_t block[7];	// ブロックが出たかどうかのフラグ
-
-	first = 1;
-	//初手　ガイドライン風にもnextadjustを適用
-	if( ((gameMode[player] != 5) && (next_adjust)) || ((gameMode[player] == 5) && (p_next_adjust)) ) {
-		//初期化
-		for(j = 0; j < 7; j++) block[j] = 0;
-
-		do {
-			tmp = TGMConvert(LCGRand(&PieceSeed)%7);
-		} while((tmp == 2) || (tmp == 3) || (tmp == 6));
-
-		// ブロックが出たフラグON
-		block[tmp] = 1;
-
-		// nextbに入れる
-		nextb[0 + player * 1400] = tmp;
-	} else {
-		first = 0;	//次で初期化を行う
-	}
-
-	for(i = 0; i < 200; i++) {
-		// 初期化	nextadjust適用時、最初は初期化しない
-		if(!first)
-			for(j = 0; j < 7; j++) block[j] = 0;
-
-		// ツモ作成
-		for(j = first; j < 7; j++) {
-			do {
-				tmp = TGMConvert(LCGRand(&PieceSeed)%7);	// ツモを引く
-			} while(block[tmp] == 1);
-
-			// ブロックが出たフラグON
-			block[tmp] = 1;
-
-			// nextbに入れる
-			nextb[i * 7 + j + player * 1400] = tmp;
-		}
-		first = 0;	//フラグOFF
-	}
-}
-
-
 // NEXT領域内のブロックの色を設定 #1.60c7m9
 // 回転法則を変更したりNEXT関係の変数を弄ったりする度に呼び出す必要あり
 void setNextBlockColors(int32_t player, int32_t first) {
@@ -3910,6 +3630,7 @@ void setNextBlockColors(int32_t player, int32_t first) {
 //▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
 bool playerExecute(void) {
 	int32_t		i;
+	const RulesProfile *rules = getRulesProfile();
 //	グローバル変数playerは廃止しました。
 //	代わりに「i」を用いてください。
 
@@ -3978,6 +3699,7 @@ bool playerExecute(void) {
 	for(i = 0; i < 1 + maxPlay; i++) {
 		if ((i == 1) && (tomoyo_domirror[0] == 1))
 			goto skip;
+		checkSteadyPlayStatus(i);
 		// instead all other functions in thos loop that do blitting need tocheck
 		if(pauseGame[i]) {
 			if( (count % 40 < 20) && (!debug) ){
@@ -4132,7 +3854,7 @@ bool playerExecute(void) {
 			}
 		}
 
-		if((istimestop[i]) && (repversw >= 35)){
+		if((istimestop[i]) && (rules->timeStop)){
 			if(status[i] == 5){
 				drawCBlock (i, 3, 0 , 0 , 0);
 				if(spawn_y_type)// フィールド枠
@@ -4264,6 +3986,7 @@ bool playerExecute(void) {
 		l38: statReplaySave(i);			// 38 -> リプレイ保存メニュー
 				goto next;
 		next:
+		checkSteadyPlayStatus(i);
 
 		if(isbanana[i])
 			statBanana(i);				// EX -> SHUFFLE FIELD
@@ -4467,6 +4190,7 @@ int32_t doGiveup() {
 /* 経過タイムを増加 */
 void increment_time(int32_t player) {
 	int32_t		i, j, temp;
+	const RulesProfile *rules = getRulesProfile();
 
 	// ロールクリア
 	if((ending[player] == 2) && (edrec[player] > 3740) && (onRecord[player])) {
@@ -4539,7 +4263,7 @@ void increment_time(int32_t player) {
 		}
 		}
 		if(gameMode[player] == 3) {
-			if((devil_minus[player])&&(gameMode[player] == 3)&&(repversw >= 31) && (tc[player] >= 1000)){//devil-
+			if((devil_minus[player])&&(gameMode[player] == 3)&&(rules->devilMinus) && (tc[player] >= 1000)){//devil-
 				grade[player] = 15;
 				gflash[player]=120;
 			}else if(!devil_minus[player]){
@@ -4638,14 +4362,14 @@ void increment_time(int32_t player) {
 	}
 
 	// エンディング中ならばエンディング経過時間1/60秒プラス
-	if(( ((ending[player] > 0) && (repversw < 33)) || ((ending[player] == 2) && (repversw >= 33))) && (onRecord[player])) {
-		if((repversw >= 50)&&(fastroll[player])){
+	if(( ((ending[player] > 0) && (!rules->rollTimeRollOnly)) || ((ending[player] == 2) && (rules->rollTimeRollOnly))) && (onRecord[player])) {
+		if((rules->fastRollTime)&&(fastroll[player])){
 			edrec[player]= edrec[player]+2;//経過時間が2倍速
 		}else{
 			edrec[player]++;
 		}
 		//無限回転対策（BEGINNER以外）
-		if((repversw >= 55) && (gameMode[player] >= 1) && ((kickc[player] > 10) || (kickc3[player] > 8)) ){
+		if((rules->rollKickLimit) && (gameMode[player] >= 1) && ((kickc[player] > 10) || (kickc3[player] > 8)) ){
 			edrec[player] = edrec[player] - 1 - (fastroll[player]);
 			printFont(13 + 24 * player - 12 * maxPlay, 25, "PUT THE BLOCK!", (count % 4 / 2) * 2);
 		}
@@ -4720,7 +4444,7 @@ void increment_time(int32_t player) {
 			ltime[player]--;	//リミットタイム
 		}
 		if((FP_bonus[player] > 0) && (stage[player] >= 100)){
-			if(repversw < 47) FP_bonus[player]--;
+			if(!rules->stageFpBonus) FP_bonus[player]--;
 			else{
 				if((status[player] != 6) && (status[player] != 8))
 					FP_bonus_c[player]--;
@@ -4752,7 +4476,7 @@ void increment_time(int32_t player) {
 		ltime[player]--;
 
 		//耐久ミッションでの無限回転対策
-		if((gameMode[player] == 8) && (mission_type[c_mission] == 23) && ((kickc[player] > 10) || ((kickc3[player] > 8-(4*(repversw>=43))) && (repversw >= 40))) ){
+		if((gameMode[player] == 8) && (mission_type[c_mission] == 23) && ((kickc[player] > 10) || ((kickc3[player] > rules->missionKickCount) && (rules->missionKickLimit))) ){
 			ltime[player]++;
 			printFont(13 + 24 * player - 12 * maxPlay, 29, "PUT THE BLOCK!", (count % 4 / 2) * 2);
 		}
@@ -4922,11 +4646,11 @@ void statBlockSutter(int32_t player) {
 
 	// フィールド消去
 	for(int32_t i = 0; i < 220; i++) {
-		fld[i + player * 220] = 0;
+		setFieldBlock(i + player * 220, 0);
 		fldt[i + player * 220] = 0;		// #1.60c7j5
 		fldi[i + player * 220] = 0;		// #1.60c7n1
 		fldu[i + player * 220] = 0;
-		flds[i + player * 220] = 0;
+		setFieldSquare(i + player * 220, 0);
 		fldubuf[i + player * 220] = 0;
 	}
 }
@@ -5487,11 +5211,11 @@ void statSelectMode(int32_t player) {
 
 		// フィールド消去 #1.60c7s6
 		for(i = 0; i < 220; i++) {
-			fld[i + player * 220] = 0;
+			setFieldBlock(i + player * 220, 0);
 			fldt[i + player * 220] = 0;
 			fldi[i + player * 220] = 0;
 			fldu[i + player * 220] = 0;
-			flds[i + player * 220] = 0;
+			setFieldSquare(i + player * 220, 0);
 			fldubuf[i + player * 220] = 0;
 		}
 
@@ -6084,6 +5808,71 @@ void statSelectStartLv(int32_t player) {
 }
 
 
+// wait値をテーブルのindex番目にする (テーブルより先は最後の値)
+void setWaits(int32_t player, const WaitTable *table, int32_t index) {
+	if(index >= table->length) index = table->length - 1;
+	wait1[player] = table->are[index];
+	wait2[player] = table->lineDelay[index];
+	wait3[player] = table->lockDelay[index];
+	waitt[player] = table->das[index];
+}
+
+// 今の設定でレベルアップのスケジュールを作る (変わっていなければそのまま)
+void updateSpeedSchedule(int32_t player) {
+	SpeedSettings settings;
+
+	SDL_zero(settings);
+	settings.mode = gameMode[player];
+	settings.version = repversw;
+	settings.grade = enable_grade[player];
+	if(gameMode[player] == 6) settings.option = fpbas_mode[player];
+	else if(gameMode[player] == 7) settings.option = anothermode[player];
+	else if(gameMode[player] == 9) settings.option = std_opt[player];
+	else if(gameMode[player] == 10) settings.option = ori_opt[player];
+	settings.heboGB = heboGB[player];
+	settings.devilMinus = devil_minus[player] != 0;
+	settings.deathPlus = death_plus[player] != 0;
+	settings.randomRise = devil_randrise != 0;
+
+	if(speedSchedule[player].compiled && (SDL_memcmp(&settings, &speedSchedule[player].settings, sizeof(settings)) == 0)) return;
+	compileSpeedSchedule(&speedSchedule[player], &settings);
+}
+
+// スケジュールのindex段目の速度・wait値・演出を適用
+void applySpeedStep(int32_t player, int32_t index) {
+	const SpeedSchedule *schedule = &speedSchedule[player];
+	const SpeedStep *step = getSpeedStep(schedule, index);
+
+	if((step->gravity != SPEED_KEEP) && ((step->gravityIf == 0) || (sp[player] < step->gravityIf)))
+		sp[player] = step->gravity;
+	if(step->are != SPEED_KEEP) wait1[player] = step->are;
+	if(step->lineDelay != SPEED_KEEP) wait2[player] = step->lineDelay;
+	if(step->lockDelay != SPEED_KEEP) wait3[player] = step->lockDelay;
+	if(step->das != SPEED_KEEP) waitt[player] = step->das;
+
+	if(step->cue & SPEED_CUE_LEVELUP) PlaySE(WAVE_SE_LEVELUP);
+	if(step->cue & SPEED_CUE_RANKUP) {
+		PlaySE(WAVE_SE_RANKUP);
+		StopSE(WAVE_SE_HURRYUP);
+	}
+	if(step->cue & SPEED_CUE_BGFADE) bgfadesw = 1;
+	if((step->cue & SPEED_CUE_BGM) && (fadelv[player] != 0)) {
+		if(schedule->bgmList < 0) {
+			bgmlv++;
+		} else {
+			ace_bgmchange[player]++;
+			bgmlv = ace_bgmlist[ace_bgmchange[player] + schedule->bgmList];
+		}
+		changeBGM(player);
+	}
+}
+
+// DEVIL-用のwait値を使うか
+int32_t isDevilMinusWaits(int32_t player) {
+	const RulesProfile *rules = getRulesProfile();
+	return (((enable_grade[player] == 1) && (rules->grade1DevilMinus)) || (devil_minus[player])) && (gameMode[player] == 3) && (rules->devilMinus);
+}
+
 void setStartLevel(int32_t pl) {				// 各種速度設定ロード (loadReplayからも利用) #1.60c3
 	if((!fpbas_mode[pl])&&(gameMode[pl]!=10)) { //TGM
 		tgmRank[pl] = start[pl] / 10;
@@ -6146,20 +5935,11 @@ void setStartLevel(int32_t pl) {				// 各種速度設定ロード (loadReplay
 		} else {
 			sp[pl] = 1200;
 			if(repversw >= 54){
-				wait1[pl] = wait1_master_tbl[tgmRank[pl] / 10];
-				wait2[pl] = wait2_master_tbl[tgmRank[pl] / 10];
-				wait3[pl] = wait3_master_tbl[tgmRank[pl] / 10];
-				waitt[pl] = waitt_master_tbl[tgmRank[pl] / 10];
+				setWaits(pl, &masterWaits, tgmRank[pl] / 10);
 			}else if(repversw >= 29){
-				wait1[pl] = wait1_master_tbl53[tgmRank[pl] / 10];
-				wait2[pl] = wait2_master_tbl53[tgmRank[pl] / 10];
-				wait3[pl] = wait3_master_tbl53[tgmRank[pl] / 10];
-				waitt[pl] = waitt_master_tbl53[tgmRank[pl] / 10];
+				setWaits(pl, &masterWaits53, tgmRank[pl] / 10);
 			}else{
-				wait1[pl] = wait1_master_tbl28[(tgmRank[pl] - 50) / 10 * 2];
-				wait2[pl] = wait2_master_tbl28[(tgmRank[pl] - 50) / 10 * 2];
-				wait3[pl] = wait3_master_tbl28[(tgmRank[pl] - 50) / 10 * 2];
-				waitt[pl] = waitt_master_tbl28[(tgmRank[pl] - 50) / 10 * 2];
+				setWaits(pl, &masterWaits28, (tgmRank[pl] - 50) / 10 * 2);
 			}
 		}
 		if(!playback) timelimit[pl] = timelimit_master;	// 足きりタイム(master)#1.60c7g7
@@ -6174,20 +5954,11 @@ void setStartLevel(int32_t pl) {				// 各種速度設定ロード (loadReplay
 		} else {
 			sp[pl] = 1200;
 			if(repversw >= 54){
-				wait1[pl] = wait1_master_tbl[tgmRank[pl] / 10];
-				wait2[pl] = wait2_master_tbl[tgmRank[pl] / 10];
-				wait3[pl] = wait3_master_tbl[tgmRank[pl] / 10];
-				waitt[pl] = waitt_master_tbl[tgmRank[pl] / 10];
+				setWaits(pl, &masterWaits, tgmRank[pl] / 10);
 			}else if(repversw >= 29){
-				wait1[pl] = wait1_master_tbl53[tgmRank[pl] / 10];
-				wait2[pl] = wait2_master_tbl53[tgmRank[pl] / 10];
-				wait3[pl] = wait3_master_tbl53[tgmRank[pl] / 10];
-				waitt[pl] = waitt_master_tbl53[tgmRank[pl] / 10];
+				setWaits(pl, &masterWaits53, tgmRank[pl] / 10);
 			}else{
-				wait1[pl] = wait1_master_tbl28[(tgmRank[pl] - 50) / 10 * 2];
-				wait2[pl] = wait2_master_tbl28[(tgmRank[pl] - 50) / 10 * 2];
-				wait3[pl] = wait3_master_tbl28[(tgmRank[pl] - 50) / 10 * 2];
-				waitt[pl] = waitt_master_tbl28[(tgmRank[pl] - 50) / 10 * 2];
+				setWaits(pl, &masterWaits28, (tgmRank[pl] - 50) / 10 * 2);
 			}
 		}
 		if(!playback) timelimit[pl] = timelimit_20G;		// 足きりタイム(20G)#1.60c7g7
@@ -6195,47 +5966,7 @@ void setStartLevel(int32_t pl) {				// 各種速度設定ロード (loadReplay
 		goto next;
 	ldvl:	// Devil
 		tgmRank[pl] = start[pl] / 10;
-		if(repversw < 18){
-			wait1[pl] = wait1_devil_tbl17[tgmRank[pl] / 10];
-			wait2[pl] = wait2_devil_tbl17[tgmRank[pl] / 10];
-			wait3[pl] = wait3_devil_tbl17[tgmRank[pl] / 10];
-			waitt[pl] = waitt_devil_tbl17[tgmRank[pl] / 10];
-		}
-		if(repversw == 18){
-			wait1[pl] = wait1_devil_tbl18[tgmRank[pl] / 10];
-			wait2[pl] = wait2_devil_tbl18[tgmRank[pl] / 10];
-			wait3[pl] = wait3_devil_tbl18[tgmRank[pl] / 10];
-			waitt[pl] = waitt_devil_tbl18[tgmRank[pl] / 10];
-		}
-		if(repversw >= 19){
-			if((((enable_grade[pl] == 1) && (repversw < 42)) || (devil_minus[pl]))&&(gameMode[pl] == 3)&&(repversw >= 31)){//devil-
-				wait1[pl] = wait1_devil_m_tbl[tgmRank[pl] / 10];
-				wait2[pl] = wait2_devil_m_tbl[tgmRank[pl] / 10];
-				wait3[pl] = wait3_devil_m_tbl[tgmRank[pl] / 10];
-				waitt[pl] = waitt_devil_m_tbl[tgmRank[pl] / 10];
-			}else if(repversw < 33){
-				wait1[pl] = wait1_devil_tbl32[tgmRank[pl] / 10];
-				wait2[pl] = wait2_devil_tbl32[tgmRank[pl] / 10];
-				wait3[pl] = wait3_devil_tbl32[tgmRank[pl] / 10];
-				waitt[pl] = waitt_devil_tbl32[tgmRank[pl] / 10];
-
-			}else if(repversw < 60){
-				wait1[pl] = wait1_devil_tbl[tgmRank[pl] / 10];
-				wait2[pl] = wait2_devil_tbl[tgmRank[pl] / 10];
-				wait3[pl] = wait3_devil_tbl[tgmRank[pl] / 10];
-				waitt[pl] = waitt_devil_tbl[tgmRank[pl] / 10];
-			}else if(repversw < 62){
-				wait1[pl] = wait1_doom_tbl61[tgmRank[pl] / 10];
-				wait2[pl] = wait2_doom_tbl61[tgmRank[pl] / 10];
-				wait3[pl] = wait3_doom_tbl61[tgmRank[pl] / 10];
-				waitt[pl] = waitt_doom_tbl61[tgmRank[pl] / 10];
-			}else{//普通
-				wait1[pl] = wait1_doom_tbl[tgmRank[pl] / 10];
-				wait2[pl] = wait2_doom_tbl[tgmRank[pl] / 10];
-				wait3[pl] = wait3_doom_tbl[tgmRank[pl] / 10];
-				waitt[pl] = waitt_doom_tbl[tgmRank[pl] / 10];
-			}
-		}
+		setWaits(pl, getDevilWaits(repversw, isDevilMinusWaits(pl)), tgmRank[pl] / 10);
 		if(!playback) {
 			//DOOMの足切りタイムを回転法則ごとに変更
 			if((rotspl[pl]==3) || (rotspl[pl]==4) || (rotspl[pl]==6))
@@ -6289,18 +6020,12 @@ void setStartLevel(int32_t pl) {				// 各種速度設定ロード (loadReplay
 	lace:	// Ace
 		if(anothermode[pl] == 1){//初期アナザー読み込み
 			sp[pl] = lvTableAcea[0];
-			wait1[pl] = wait1_Acea_tbl[0];
-			wait2[pl] = wait2_Acea_tbl[0];
-			wait3[pl] = wait3_Acea_tbl[0];
-			waitt[pl] = waitt_Acea_tbl[0];
+			setWaits(pl, &aceaWaits, 0);
 			goto next;
 
 		}else if(anothermode[pl] == 2){//初期アナザー2読み込み
 			sp[pl] = lvTableAcea[0];
-			wait1[pl] = wait1_Acea_tbl[14];
-			wait2[pl] = wait2_Acea_tbl[14];
-			wait3[pl] = wait3_Acea_tbl[14];
-			waitt[pl] = waitt_Acea_tbl[14];
+			setWaits(pl, &aceaWaits, 14);
 			isblind[pl] = 1;
 			goto next;
 		}else if(anothermode[pl] == 3){//初期アナザー3読み込み
@@ -6377,19 +6102,15 @@ void setStartLevel(int32_t pl) {				// 各種速度設定ロード (loadReplay
 				waitt[pl] = waitt_master_half;
 			} else {
 				sp[pl] = 1200;
-				wait1[pl] = wait1_orimaster_tbl[(lv[pl] - 30) / 3];
-				wait2[pl] = wait2_orimaster_tbl[(lv[pl] - 30) / 3];
-				wait3[pl] = wait3_orimaster_tbl[(lv[pl] - 30) / 3];
-				waitt[pl] = waitt_orimaster_tbl[(lv[pl] - 30) / 3];
+				setWaits(pl, &orimasterWaits, (lv[pl] - 30) / 3);
 			}
 		}else if(ori_opt[pl]==3){
 			sp[pl] = 1200;
-			wait1[pl] = wait1_oridevil_tbl[lv[pl] / 3];
-			wait2[pl] = wait2_oridevil_tbl[lv[pl] / 3];
-			wait3[pl] = wait3_oridevil_tbl[lv[pl] / 3];
-			waitt[pl] = waitt_oridevil_tbl[lv[pl] / 3];
+			setWaits(pl, &oridevilWaits, lv[pl] / 3);
 		}
-	next:	;
+	next:
+	// LevelUp()で使う速度とwait値を先に引いておく
+	updateSpeedSchedule(pl);
 }
 
 //▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
@@ -6397,6 +6118,7 @@ void setStartLevel(int32_t pl) {				// 各種速度設定ロード (loadReplay
 //▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
 void statReady(int32_t player) {
 //	int32_t r_start, r_end, g_start, g_end;
+	const RulesProfile *rules = getRulesProfile();
 
 	inmenu = playback || demo;
 
@@ -6405,7 +6127,7 @@ void statReady(int32_t player) {
 		cpu_flag[player] = 0;	// リプレイ時はCPU解除 #1.60c7o6
 	else
 		if( (!player && cp_player_1p) || (player && cp_player_2p) ) cpu_flag[player] = 1;
-	if((!playback) || (repversw < 37)){
+	if((!playback) || (rules->replayReadyStyle)){
 		if(ready_go_style == 0){	// HEBORIS式
 			if( ((gameMode[player] == 6) && (stage[player] < 100)) || ((gameMode[player] == 5) && (p_nextpass)) ) {
 				/* TOMOYO #1.60c7l7 */
@@ -6450,7 +6172,7 @@ void statReady(int32_t player) {
 	padRepeat(player);
 
 	// DEVILのランダムせり上がり C7U4.9
-	if((statusc[player * 10] == 0) && (gameMode[player] == 3) && (devil_randrise) && (repversw >= 44)){
+	if((statusc[player * 10] == 0) && (gameMode[player] == 3) && (devil_randrise) && (rules->devilRandomRise)){
 		if((devil_rise_min[tgmRank[player] / 10] > 0) && (devil_rise_max[tgmRank[player] / 10] > 0) && (!devil_minus[player])) {
 			do {
 				devil_nextrise[player] = gameRand( devil_rise_max[tgmRank[player] / 10] + 1,player);
@@ -6459,24 +6181,24 @@ void statReady(int32_t player) {
 	}
 
 	// 最初のミッション
-	if((statusc[player * 10] == 0) && (gameMode[player] == 8) && (c_mission == start_mission) && (c_norm[player] == 0) && (repversw >= 54)){
+	if((statusc[player * 10] == 0) && (gameMode[player] == 8) && (c_mission == start_mission) && (c_norm[player] == 0) && (rules->missionReadyStatus)){
 		missionSetStatus();
 	}
 
 	// tomoyoモードでステージを読み込む #1.60c7l6
 	if( (statusc[player * 10] == 0) && (gameMode[player] == 6) ) {
 		loadTomoyoStage(player, stage[player]);
-		if( (repversw >= 58) && ((stage[player] >= 45) && (stage[player] <= 71)) )
+		if( (rules->tomoyoRandPlatinum) && ((stage[player] >= 45) && (stage[player] <= 71)) )
 			randPlatinum(player, ((stage[player] - 44) / 5) + 2);
 		if(stage[player] >= 100){
-			if(repversw >= 47) FP_bonus[player] = 1000 * (((stage[player]-100) / 4) + 1);
+			if(rules->stageFpBonus) FP_bonus[player] = 1000 * (((stage[player]-100) / 4) + 1);
 			else FP_bonus[player] = 10800;
 		}
 		if(!(wavebgm & WAVE_BGM_SIMPLE)) {
 			if( !APP_IsWavePlaying(WAVE_BGM_START+bgmlv) ) APP_PlayWave(WAVE_BGM_START+bgmlv);
 		}
 
-		if(((repversw >= 25) && (sp[player] < min_speed[player]) && (enable_minspeed)) || (tomoyo_waits[player]))
+		if(((rules->tomoyoMinSpeed) && (sp[player] < min_speed[player]) && (enable_minspeed)) || (tomoyo_waits[player]))
 			sp[player] = min_speed[player];
 		if((stage[player] == 44) && (!disable_ehlast_gimmick)){
 			tomoyo_domirror[player] = 1;
@@ -6487,12 +6209,9 @@ void statReady(int32_t player) {
 		}
 		if(tomoyo_waits[player]){
 			if(enable_minspeed){
-				if(repversw >= 50) sp[player] = 1200;
-				wait1[player] = wait1_devil_tbl32[5];
-				wait2[player] = wait2_devil_tbl32[5];
-				wait3[player] = wait3_devil_tbl32[5];
-				waitt[player] = waitt_devil_tbl32[5];
-			}else if(repversw >= 54){
+				if(rules->tomoyoWaits20G) sp[player] = 1200;
+				setWaits(player, &devilWaits32, 5);
+			}else if(rules->tomoyoWaitsBoost){
 				isboost[player] = 1;
 				item_timer[player] = 1500 * 60;
 			}
@@ -6562,7 +6281,7 @@ void statReady(int32_t player) {
 	}
 
 	// TOMOYO用スタート時のキーリピート記録＆再生 #1.60c7n8
-	if((statusc[player * 10] == 0) || (repversw < 57)){
+	if((statusc[player * 10] == 0) || (!rules->readyRepeatOnce)){
 	if( ((gameMode[player] == 6) && (stage[player] == start_stage[player])) || (ace_irs != 0) || ((gameMode[player] == 4) && (vs_round == 1))) {
 		if(playback) {
 			mp [player] = mps[player * 2    ];
@@ -6764,6 +6483,7 @@ void statReady(int32_t player) {
 				}
 
 				nextc[player] = (nextc[player] + 1) % 1400;
+				refillNextBlocks(player);
 				next[player] = nextb[nextc[player] + player * 1400];
 				rt_nblk[0 + 6 * player] = 0;
 				// ブロックの色を設定 #1.60c7m9
@@ -6787,6 +6507,7 @@ void statReady(int32_t player) {
 //▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
 void statBlock(int32_t player) {
 	int32_t i, tmp[2],tmp2[2];
+	const RulesProfile *rules = getRulesProfile();
 
 	if(dolaser[player]){	//レーザー発動
 		status[player] = 26;
@@ -6870,13 +6591,13 @@ void statBlock(int32_t player) {
 	}
 	harddrop[player]=0;
 	// tgmカウンタ上昇(移転)#1.60c7i8
-	if((ending[player] == 0) && (gameMode[player] <= 6) && ((!ismiss[player]) || (repversw < 62))) {
-		if((repversw > 4) && (gameMode[player] >= 3))
+	if((ending[player] == 0) && (gameMode[player] <= 6) && ((!ismiss[player]) || (rules->missLevelUp))) {
+		if((rules->levelStop99) && (gameMode[player] >= 3))
 			i = 99;//99でストップ
 		else
 			i = 99 - ((tc[player] > 900));//マスター、20Gの998ストップ用
 
-		if((gameMode[player] == 4) && (repversw >= 61) && (wintype==0) && (vs_goal != 0)){
+		if((gameMode[player] == 4) && (rules->vsGoalStop) && (wintype==0) && (vs_goal != 0)){
 			if((tc[player] != vs_goal - 1) && ((!start_flag[player]) || (tc[player] < 0))){
 				tc[player]++;
 				if(tc[player] == vs_goal - 1) PlaySE(WAVE_SE_LVSTOP);
@@ -6925,7 +6646,7 @@ void statBlock(int32_t player) {
 
 	if((gameMode[player] == 4) || (item_mode[player])){
 		// アイテムゲージ上昇 #1.60c7n1
-		if( (!noitem) && ( (!ismiss[player]) || ((gameMode[player] != 4) && (repversw >= 62)) ) ) item_g[player]++;
+		if( (!noitem) && ( (!ismiss[player]) || ((gameMode[player] != 4) && (rules->missItemGauge)) ) ) item_g[player]++;
 
 		// 効果時間
 		if(IsBig[player] || isfmirror[player] || isrollroll[player] || isxray[player] || iscolor[player] ||
@@ -6950,8 +6671,8 @@ void statBlock(int32_t player) {
 	padRepeat(player);
 
 	// ↓を離している場合、下入れ制限解除#1.60c7n6
-	if((!getPressState(player, 1-(1*((isUDreverse[player]) && (repversw>=44)) ))) && (repversw >= 10)) down_flag[player] = 0;
-	if(!getPressState(player, 0+(1*((isUDreverse[player]) && (repversw>=44)) ))) up_flag[player] = 0;
+	if((!getPressState(player, 1-(1*((isUDreverse[player]) && (rules->udReverseFlags)) ))) && (rules->releaseDownFlag)) down_flag[player] = 0;
+	if(!getPressState(player, 0+(1*((isUDreverse[player]) && (rules->udReverseFlags)) ))) up_flag[player] = 0;
 
 	// T-SPIN権利初期化 #1.60c7n6
 	tspin_flag[player] = 0;
@@ -6961,9 +6682,10 @@ void statBlock(int32_t player) {
 	dhold2[player] = 0;
 
 	nextc[player] = (nextc[player] + 1) % 1400;
+	refillNextBlocks(player);
 	// correction for shorter sequences.
 	// safe because it will never reach 1400 before these hit.
-	if ((repversw>65) && ((gameMode[player]!=6) || (randommode[player]))) // exception fo tomoyo mode, because it loves to replace the piece sequence without telling you.
+	if ((rules->shortNextFix) && ((gameMode[player]!=6) || (randommode[player]))) // exception fo tomoyo mode, because it loves to replace the piece sequence without telling you.
 	{
 		if (nextblock==10) // sega poweron pattern
 		{
@@ -6993,7 +6715,7 @@ void statBlock(int32_t player) {
 		PlaySE(WAVE_SE_LVSTOP);
 		itemappear_c[player]=30;
 		if(use_item[player] == 0){//ALL
-			if(repversw >=51){
+			if(rules->itemReroll){
 				do{
 					tmp2[player] = gameRand(item_pronum,player);
 					tmp[player] = 1;
@@ -7082,7 +6804,7 @@ void statBlock(int32_t player) {
 
 	// 対戦モードでのブロック数制のアイテム効果終了
 	if((gameMode[player] == 4) || (item_mode[player])) {
-		if( (isfmirror[player]) && (item_t[player] > 3 - (repversw >=47)) ) {
+		if( (isfmirror[player]) && (item_t[player] > rules->mirrorBlocks) ) {
 			// MIRROR
 			isfmirror[player] = 0;
 			stopmirror_flag[player] = 0;
@@ -7230,7 +6952,7 @@ void statBlock(int32_t player) {
 	if( (!checkGameOver(player)) && (judgeBlock(player, bx[player], by[player] + 1, blk[player], rt[player]) != 0) ) {
 		if( (!isWRule(player)) || (world_drop_snd >= 1) ) PlaySE(WAVE_SE_KON);
 	}
-	if(repversw >= 59){				// このバージョンから同一フレーム内に移動処理開始
+	if(rules->sameFrameMove){		// このバージョンから同一フレーム内に移動処理開始
 		statusc[player * 10 + 6] = 1;	// 同一フレームでは回転＆HOLDさせないYO
 		if(status[player] != 5) return;
 		else statMove(player);		// 移動処理
@@ -7356,9 +7078,10 @@ void checkSecretGrade(int32_t player) {
 // #1.60c7j3
 void doIRS(int32_t player) {
 	int32_t bak;
+	const RulesProfile *rules = getRulesProfile();
 	if((disable_irs) || (isrotatelock[player]) || (heboGB[player]>0)) return;
 
-	if(repversw >= 43){	//新Ver
+	if(rules->newIrs){	//新Ver
 	if( getPressState(player, APP_BUTTON_A) || getPressState(player, APP_BUTTON_B) || getPressState(player, APP_BUTTON_C) ) {
 		PlaySE(WAVE_SE_SHAKI);
 
@@ -7521,6 +7244,7 @@ void doIRS2plus(int32_t player) {
 }
 // ブロック出現位置を設定　From LITE Ver
 void setBlockSpawnPosition(int32_t player) {
+	const RulesProfile *rules = getRulesProfile();
 	if((spawn_y_type) && (heboGB[player]==0)) {
 		// 枠外
 		if(IsBig[player]) {
@@ -7547,15 +7271,15 @@ void setBlockSpawnPosition(int32_t player) {
 		if(IsBig[player]) {
 			// BIG
 			bx[player] = 2;
-			by[player] = (( isWRule(player) && (blk[player] != 0) ) * 2)  - 2 * ((blk[player] == 0 ) && ((rotspl[player] == 8) && ((segacheat == 2) || (heboGB[player] != 2) || repversw < 66)));
+			by[player] = (( isWRule(player) && (blk[player] != 0) ) * 2)  - 2 * ((blk[player] == 0 ) && ((rotspl[player] == 8) && ((segacheat == 2) || (heboGB[player] != 2) || !rules->segaRules)));
 		} else {
 			// 通常
 			bx[player] = 3;
-			by[player] = 1 + ( (blk[player] != 0) && isWRule(player) ) - 1 * ((blk[player] == 0 ) && ((rotspl[player] == 8) && ((segacheat == 2) || (heboGB[player] != 2) || repversw < 66)));
+			by[player] = 1 + ( (blk[player] != 0) && isWRule(player) ) - 1 * ((blk[player] == 0 ) && ((rotspl[player] == 8) && ((segacheat == 2) || (heboGB[player] != 2) || !rules->segaRules)));
 		}
 	}
 	// D.R.Sの先行移動
-	if(rotspl[player] == 8 && ((segacheat == 2) || (heboGB[player] != 2) || repversw < 66)){
+	if(rotspl[player] == 8 && ((segacheat == 2) || (heboGB[player] != 2) || !rules->segaRules)){
 		if(getPressState(player, APP_BUTTON_LEFT) && (judgeBlock(player, bx[player] - 1 - (1 * (IsBig[player] && BigMove[player])), by[player], blk[player], rt[player]) == 0)){
 			bx[player] = bx[player] - 1 - (1 * (IsBig[player] && BigMove[player]));
 			if(movesound) PlaySE(WAVE_SE_MOVE);
@@ -7573,6 +7297,7 @@ void setBlockSpawnPosition(int32_t player) {
 //▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
 void statMove(int32_t player) {
 	int32_t tmp;
+	const RulesProfile *rules = getRulesProfile();
 	// 注意：実際の処理はこのファイルにはありません。
 	// ワールドルールの場合はworld.c、クラシックルールの場合はclassic.cに分岐します。
 
@@ -7606,20 +7331,20 @@ void statMove(int32_t player) {
 		ndelay[player] = 1;
 
 	if(rotspl[player] == 2) {
-		statWMove( player,  10 -2 + (repversw >= 16) , 8);	// world.c
+		statWMove( player,  10 -2 + rules->kickLimitAdd , 8);	// world.c
 	} else if(rotspl[player] == 3) {
-		statWMove( player, 128 -2 + (repversw >= 16) - (108*(gameMode[player] == 4)),128 - (108*(gameMode[player] == 4)));	// WORLD2 #1.60c7o
+		statWMove( player, 128 -2 + rules->kickLimitAdd - (108*(gameMode[player] == 4)),128 - (108*(gameMode[player] == 4)));	// WORLD2 #1.60c7o
 	} else if(rotspl[player] == 4) {
-		statAMove( player, 128 -2 + (repversw >= 16) - (108*(gameMode[player] == 4)),128 - (108*(gameMode[player] == 4)));	// ARS #1.60c7q2ex
+		statAMove( player, 128 -2 + rules->kickLimitAdd - (108*(gameMode[player] == 4)),128 - (108*(gameMode[player] == 4)));	// ARS #1.60c7q2ex
 	} else if(rotspl[player] == 5) {
-		statAMove( player, 128 -2 + (repversw >= 16) - (113*(gameMode[player] == 4)),128 - (108*(gameMode[player] == 4)));	// ARS2 #1.60c7q2ex
+		statAMove( player, 128 -2 + rules->kickLimitAdd - (113*(gameMode[player] == 4)),128 - (108*(gameMode[player] == 4)));	// ARS2 #1.60c7q2ex
 	} else if(rotspl[player] == 6) {
 		statWMove( player, -1 +(14*(gameMode[player] == 4)),-1+(14*(gameMode[player] == 4)));						// WORLD3 #1.60c7r2
 	} else if(rotspl[player] == 7) {
-		if(repversw < 39)
-			statWMove( player, 128 -2 + (repversw >= 16),128);	// SRS-X 38まで
+		if(rules->srsxOldKick)
+			statWMove( player, 128 -2 + rules->kickLimitAdd,128);	// SRS-X 38まで
 		else
-			statWMove( player, 18 + (6 * (repversw >= 40)) -1 - (8*(gameMode[player] == 4)),12);	// SRS-X
+			statWMove( player, rules->srsxKickLimit - (8*(gameMode[player] == 4)),12);	// SRS-X
 	} else if(rotspl[player] == 8 ) {
 		statDMove(player);	// D.R.S
 	} else {
@@ -7628,7 +7353,7 @@ void statMove(int32_t player) {
 	if(spawn_y_type)// フィールド枠
 		viewFldFrame(1,player);
 
-	if((status[player] != 5) && (repversw >= 57)) return;
+	if((status[player] != 5) && (rules->lockFrameNoTime)) return;
 
 	if(timeOn[player]) {
 		timeN[player]++;	//gradeup3で使う
@@ -7641,6 +7366,7 @@ void statMove(int32_t player) {
 // HOLDする処理 #1.60c7j3
 void doHold(int32_t player, int32_t ihs) {
 	int32_t tmp,first;
+	const RulesProfile *rules = getRulesProfile();
 	first = 0;
 	if((disable_hold) || (isholdlock[player] == 1) || (death_plus[player])||(hebo_plus[player])||(heboGB[player])) return;
 
@@ -7652,6 +7378,7 @@ void doHold(int32_t player, int32_t ihs) {
 			hold[player] = blk[player];
 			blk[player] = next[player];
 			nextc[player] = (nextc[player] + 1) % 1400;
+			refillNextBlocks(player);
 			next[player] = nextb[nextc[player] + player * 1400];
 			hold_used[player] = 1; // 回数 #1.60c7i1
 
@@ -7714,39 +7441,39 @@ void doHold(int32_t player, int32_t ihs) {
 		 		ndelay[player] = 0;
 		}
 
-		if(((!first) && !((ihs) && (ace_irs == 2))) || ((!ace_irs) && (repversw >=47)))
+		if(((!first) && !((ihs) && (ace_irs == 2))) || ((!ace_irs) && (rules->holdRotateReset)))
 			rt[player] = 0;
-		if(repversw >= 21){
+		if(rules->holdGravityReset){
 		bs[player] = 0;			// ブロック落下をリセット C7T7.101
 		bk[player] = 0;			// ブロック落下をリセット C7T7.101
 		bk_D[player] = 0;
 		}
 
-		if((item[player] != 0) && (gameMode[player] == 4) && (item[player] != fldihardno) && (item[player] != 36) && ((!first) || (repversw < 48))) {
+		if((item[player] != 0) && (gameMode[player] == 4) && (item[player] != fldihardno) && (item[player] != 36) && ((!first) || (!rules->holdFirstItemKeep))) {
 			item[player] = 0;	// アイテム消去 #1.60c7n1
 			scanItem(player);
 		}
 		// #1.60c7j3からIHSでないタイミングでもIRSを受け付ける
-		if((!ihs) && (repversw >= 7)) {
+		if((!ihs) && (rules->holdIrs)) {
 			if(ace_irs != 1){
 				doIRS(player);
 			}
 
 			// もう一度blockseを鳴らす #1.60c7o1
-			if((ishidenext[player] == 0) && ((repversw < 64) || (isfakenext[player] == 0))){
+			if((ishidenext[player] == 0) && ((!rules->holdFakeNextSilent) || (isfakenext[player] == 0))){
 				PlaySE(WAVE_SE_BLOCK1 + next[player]);
 			}
 			if(isfakenext[player] == 1){//FAKENEXTの時は適当な音
 				PlaySE(WAVE_SE_BLOCK1 + gameRand(6,player));
 			}
 			// 横方向の先行移動を無効にする #1.60c7o9
-			if(repversw >= 11) {
+			if(rules->holdDasReset) {
 				statusc[player * 10 + 4] = (fastlrmove == 0);
 				if(rotspl[player] == 8) statusc[player * 10 + 4] = 0;
 			}
 
 			// 固定までの時間をリセット #1.60c7p5
-			if(repversw >= 13){
+			if(rules->holdLockReset){
 				bk[player] = 0;
 				bk_D[player] = 0;
 			}
@@ -7754,12 +7481,12 @@ void doHold(int32_t player, int32_t ihs) {
 
 		// ブロックがめり込んでいたらゲームオーバー #1.60c7l2
 		// ゲームオーバーなっていない＆接地している場合は音を鳴らす
-		if( (!ihs || repversw < 67) && (!checkGameOver(player)) && (judgeBlock(player, bx[player], by[player] + 1, blk[player], rt[player]) != 0) ) {
+		if( (!ihs || !rules->ihsSameFrame) && (!checkGameOver(player)) && (judgeBlock(player, bx[player], by[player] + 1, blk[player], rt[player]) != 0) ) {
 			if( (!isWRule(player)) || (world_drop_snd >= 1) ) PlaySE(WAVE_SE_KON);
 		}
 
 		// Don't allow rotation on the same frame as hold.
-		if (repversw >= 67) {
+		if (rules->ihsSameFrame) {
 			statusc[player * 10 + 6] = 1;
 		}
 	}
@@ -7930,12 +7657,7 @@ int32_t blockEraseJudge(int32_t player) {
 	// ラインが埋まってるか判定
 	ret = 0;
 	for(i = 0; i <= fldsizeh[player]; i++) {
-		sr = 1;
-		for(j = 0; j < fldsizew[player]; j++)
-			if(fld[j + i * fldsizew[player] + player * 220] == 0) {//揃ってないので消えません
-				sr = 0;
-				break;
-			}
+		sr = (getFieldRowCount(player, i) == fldsizew[player]);	//揃ってないと消えません
 		erase[i + player * 22] = sr;
 		if (sr) ret++;	//消去あり
 	}
@@ -8098,10 +7820,10 @@ void statRelayselect(int32_t player) {
 							objectCreate(player, 1, (i + 15 + 24 * player - 12 * maxPlay) * 8,(j + 3) * 8, (i - 5) * 120 + 20 - SDL_rand(40), - 1900 + SDL_rand(150) + 1 * 250, fld[i+ j * fldsizew[player] + player * 220], 100);
 						}
 
-						fld[i+ j * fldsizew[player] + player * 220] = 0;
+						setFieldBlock(i+ j * fldsizew[player] + player * 220, 0);
 						fldt[i+ j * fldsizew[player] + player * 220] = 0;		// #1.60c7j5
 						fldi[i+ j * fldsizew[player] + player * 220] = 0;		// #1.60c7n1
-						flds[i+ j * fldsizew[player] + player * 220] = 0;		// #1.60c7n1
+						setFieldSquare(i+ j * fldsizew[player] + player * 220, 0);		// #1.60c7n1
 					}
 				}
 			}
@@ -8147,9 +7869,9 @@ void statRelayselect(int32_t player) {
 							c = fld[j + block * 10 + player * 220];
 							if(c != 0) {
 								if((c >= 9) || (c < 0))
-									fld[j + block * 10 + player * 220] = 10;
+									setFieldBlock(j + block * 10 + player * 220, 10);
 								else
-									fld[j + block * 10 + player * 220] = 1;
+									setFieldBlock(j + block * 10 + player * 220, 1);
 							}
 						}
 					} else {
@@ -8174,10 +7896,10 @@ void statRelayselect(int32_t player) {
 			statusc[player * 10] = 0;
 			for(i = 0; i < 10; i++)
 				for(j = 0; j < 22; j++) {
-					fld[i + j * 10 + player * 220] = 0;
+					setFieldBlock(i + j * 10 + player * 220, 0);
 					fldt[i + j * 10 + player * 220] = 0;	// #1.60c7j5
 					fldi[i + j * 10 + player * 220] = 0;	// #1.60c7n1
-					flds[i + j * 10 + player * 220] = 0;
+					setFieldSquare(i + j * 10 + player * 220, 0);
 				}
 			if(std_opt[player] == 0){
 				if(statusc[player * 10 + 3] == 0)
@@ -8297,6 +8019,7 @@ void statRelayselect(int32_t player) {
 // ブロック上昇する?
 void UpLineBlockJudge(int32_t player) {
 	int32_t	j;
+	const RulesProfile *rules = getRulesProfile();
 	// せり上がりラインが残っているときはせり上げる
 	if(upLines[player] > 0) {
 		// 対戦では本家っぽく着地直後のみせり上げてみる
@@ -8307,11 +8030,11 @@ void UpLineBlockJudge(int32_t player) {
 		by[player] = by[player] - (by[player] >= 0);
 
 		// 枠内出現は22段目のブロックを消す C7U0
-		if((!spawn_y_type) || (repversw <= 27)){
+		if((!spawn_y_type) || (!rules->spawnRowKeep)){
 		for(j = 0; j < fldsizew[player]; j++) {
-			fld[j + 0 * fldsizew[player] + player * 220] = 0;
+			setFieldBlock(j + 0 * fldsizew[player] + player * 220, 0);
 			fldt[j + 0 * fldsizew[player] + player * 220] = 0;
-			flds[j + 0 * fldsizew[player] + player * 220] = 0;
+			setFieldSquare(j + 0 * fldsizew[player] + player * 220, 0);
 		}
 		// ブロックが重なってしまったときは、ムリヤリ上げる
 		if(status[player] == 5)
@@ -8326,6 +8049,7 @@ void UpLineBlock(int32_t player) {
 	// #1.60c7j5
 	// BIG専用処理を削除（BIGの仕様変更で不要に）#1.60c7o9
 	int32_t		i, j,newhole,h1,h2,riseT;
+	const RulesProfile *rules = getRulesProfile();
 
 	riseT = upLineT[player];
 	if((gameMode[player] == 8) && (mission_type[c_mission] == 21) && (status[player] == 6))
@@ -8334,27 +8058,19 @@ void UpLineBlock(int32_t player) {
 	if((gameMode[player] == 6) || ((gameMode[player] == 8) && (mission_type[c_mission] == 6))){	// TOMOYO
 		PlaySE(WAVE_SE_UP);
 		//上にずらす
-		for(i = 1; i <= fldsizeh[player]; i++) {
-			for(j = 0; j < fldsizew[player]; j++) {
-				fld[j + (i - 1) * fldsizew[player] + player * 220] = fld[j + i * fldsizew[player] + player * 220];
-				fldt[j + (i - 1) * fldsizew[player] + player * 220] = fldt[j + i * fldsizew[player] + player * 220];
-				fldi[j + (i - 1) * fldsizew[player] + player * 220] = fldi[j + i * fldsizew[player] + player * 220];
-				flds[j + (i - 1) * fldsizew[player] + player * 220] = flds[j + i * fldsizew[player] + player * 220];
-			}
-			erase[(i - 1) + player * 22] = erase[i + player * 22];
-		}
+		shiftFieldRowsUp(player, FIELD_LAYER_ALL);
 
 		// せり上がりフィールドの読み込み
-		fld[0 + fldsizew[player] * fldsizeh[player] + player * 220] = tomoyo_rise_fld[0+(1*upLineNo[player] * fldsizew[player])+player*200];
-		fld[1 + fldsizew[player] * fldsizeh[player] + player * 220] = tomoyo_rise_fld[1+(1*upLineNo[player] * fldsizew[player])+player*200];
-		fld[2 + fldsizew[player] * fldsizeh[player] + player * 220] = tomoyo_rise_fld[2+(1*upLineNo[player] * fldsizew[player])+player*200];
-		fld[3 + fldsizew[player] * fldsizeh[player] + player * 220] = tomoyo_rise_fld[3+(1*upLineNo[player] * fldsizew[player])+player*200];
-		fld[4 + fldsizew[player] * fldsizeh[player] + player * 220] = tomoyo_rise_fld[4+(1*upLineNo[player] * fldsizew[player])+player*200];
-		fld[5 + fldsizew[player] * fldsizeh[player] + player * 220] = tomoyo_rise_fld[5+(1*upLineNo[player] * fldsizew[player])+player*200];
-		fld[6 + fldsizew[player] * fldsizeh[player] + player * 220] = tomoyo_rise_fld[6+(1*upLineNo[player] * fldsizew[player])+player*200];
-		fld[7 + fldsizew[player] * fldsizeh[player] + player * 220] = tomoyo_rise_fld[7+(1*upLineNo[player] * fldsizew[player])+player*200];
-		fld[8 + fldsizew[player] * fldsizeh[player] + player * 220] = tomoyo_rise_fld[8+(1*upLineNo[player] * fldsizew[player])+player*200];
-		fld[9 + fldsizew[player] * fldsizeh[player] + player * 220] = tomoyo_rise_fld[9+(1*upLineNo[player] * fldsizew[player])+player*200];
+		setFieldBlock(0 + fldsizew[player] * fldsizeh[player] + player * 220, tomoyo_rise_fld[0+(1*upLineNo[player] * fldsizew[player])+player*200]);
+		setFieldBlock(1 + fldsizew[player] * fldsizeh[player] + player * 220, tomoyo_rise_fld[1+(1*upLineNo[player] * fldsizew[player])+player*200]);
+		setFieldBlock(2 + fldsizew[player] * fldsizeh[player] + player * 220, tomoyo_rise_fld[2+(1*upLineNo[player] * fldsizew[player])+player*200]);
+		setFieldBlock(3 + fldsizew[player] * fldsizeh[player] + player * 220, tomoyo_rise_fld[3+(1*upLineNo[player] * fldsizew[player])+player*200]);
+		setFieldBlock(4 + fldsizew[player] * fldsizeh[player] + player * 220, tomoyo_rise_fld[4+(1*upLineNo[player] * fldsizew[player])+player*200]);
+		setFieldBlock(5 + fldsizew[player] * fldsizeh[player] + player * 220, tomoyo_rise_fld[5+(1*upLineNo[player] * fldsizew[player])+player*200]);
+		setFieldBlock(6 + fldsizew[player] * fldsizeh[player] + player * 220, tomoyo_rise_fld[6+(1*upLineNo[player] * fldsizew[player])+player*200]);
+		setFieldBlock(7 + fldsizew[player] * fldsizeh[player] + player * 220, tomoyo_rise_fld[7+(1*upLineNo[player] * fldsizew[player])+player*200]);
+		setFieldBlock(8 + fldsizew[player] * fldsizeh[player] + player * 220, tomoyo_rise_fld[8+(1*upLineNo[player] * fldsizew[player])+player*200]);
+		setFieldBlock(9 + fldsizew[player] * fldsizeh[player] + player * 220, tomoyo_rise_fld[9+(1*upLineNo[player] * fldsizew[player])+player*200]);
 
 		for(j = 0; j < fldsizew[player]; j++) {
 			fldt[j + fldsizew[player] * fldsizeh[player] + player * 220] = (fld[j + fldsizew[player] * fldsizeh[player] + player * 220] != 0) * -1;
@@ -8380,24 +8096,16 @@ void UpLineBlock(int32_t player) {
 		PlaySE(WAVE_SE_UP);
 
 		// フィールドを上にずらす
-		for(i = 1; i <= fldsizeh[player]; i++) {
-			for(j = 0; j < fldsizew[player]; j++) {
-				fld[j + (i - 1) * fldsizew[player] + player * 220] = fld[j + i * fldsizew[player] + player * 220];
-				fldt[j + (i - 1) * fldsizew[player] + player * 220] = fldt[j + i * fldsizew[player] + player * 220];
-				fldi[j + (i - 1) * fldsizew[player] + player * 220] = fldi[j + i * fldsizew[player] + player * 220];
-				flds[j + (i - 1) * fldsizew[player] + player * 220] = flds[j + i * fldsizew[player] + player * 220];
-			}
-			erase[(i - 1) + player * 22] = erase[i + player * 22];
-		}
+		shiftFieldRowsUp(player, FIELD_LAYER_ALL);
 
 		// 下から2番目を一番下にコピーする
 		for(j = 0; j < fldsizew[player]; j++) {
-			fld[j + fldsizew[player] * fldsizeh[player] + player * 220] = (fld[j +fldsizew[player] * (fldsizeh[player] - 1) + player * 220] != 0);
+			setFieldBlock(j + fldsizew[player] * fldsizeh[player] + player * 220, (fld[j +fldsizew[player] * (fldsizeh[player] - 1) + player * 220] != 0));
 			fldt[j + fldsizew[player] * fldsizeh[player] + player * 220] = (fld[j + fldsizew[player] * fldsizeh[player] + player * 220] != 0) * -1;
 			if(hidden[player] == 8) fldt[j + fldsizeh[player] * fldsizew[player] + player * 220] = -60;
 				// アイテムを増殖させない #1.60c7o6
 				fldi[j + fldsizew[player] * fldsizeh[player] + player * 220] = 0;
-				flds[j + fldsizew[player] * fldsizeh[player] + player * 220] = 0;
+				setFieldSquare(j + fldsizew[player] * fldsizeh[player] + player * 220, 0);
 		}
 
 		erase[fldsizeh[player] + player * 22] = 0;
@@ -8423,34 +8131,26 @@ void UpLineBlock(int32_t player) {
 		PlaySE(WAVE_SE_UP);
 
 		// フィールドを上にずらす
-		for(i = 1; i <= fldsizeh[player]; i++) {
-			for(j = 0; j < fldsizew[player]; j++) {
-				fld[j + (i - 1) * fldsizew[player] + player * 220] = fld[j + i * fldsizew[player] + player * 220];
-				fldt[j + (i - 1) * fldsizew[player] + player * 220] = fldt[j + i * fldsizew[player] + player * 220];
-				fldi[j + (i - 1) * fldsizew[player] + player * 220] = fldi[j + i * fldsizew[player] + player * 220];
-				flds[j + (i - 1) * fldsizew[player] + player * 220] = flds[j + i * fldsizew[player] + player * 220];
-			}
-			erase[(i - 1) + player * 22] = erase[i + player * 22];
-		}
+		shiftFieldRowsUp(player, FIELD_LAYER_ALL);
 
 		// せり上がりフィールドの読み込み
-		fld[0 + fldsizew[player] * fldsizeh[player] + player * 220] = upFld[upLineNo[player] * 2] / 10000 % 10;
-		fld[1 + fldsizew[player] * fldsizeh[player] + player * 220] = upFld[upLineNo[player] * 2] / 1000 % 10;
-		fld[2 + fldsizew[player] * fldsizeh[player] + player * 220] = upFld[upLineNo[player] * 2] / 100 % 10;
-		fld[3 + fldsizew[player] * fldsizeh[player] + player * 220] = upFld[upLineNo[player] * 2] / 10 % 10;
-		fld[4 + fldsizew[player] * fldsizeh[player] + player * 220] = upFld[upLineNo[player] * 2] % 10;
-		fld[5 + fldsizew[player] * fldsizeh[player] + player * 220] = upFld[upLineNo[player] * 2 + 1] / 10000 % 10;
-		fld[6 + fldsizew[player] * fldsizeh[player] + player * 220] = upFld[upLineNo[player] * 2 + 1] / 1000 % 10;
-		fld[7 + fldsizew[player] * fldsizeh[player] + player * 220] = upFld[upLineNo[player] * 2 + 1] / 100 % 10;
-		fld[8 + fldsizew[player] * fldsizeh[player] + player * 220] = upFld[upLineNo[player] * 2 + 1] / 10 % 10;
-		fld[9 + fldsizew[player] * fldsizeh[player] + player * 220] = upFld[upLineNo[player] * 2 + 1] % 10;
+		setFieldBlock(0 + fldsizew[player] * fldsizeh[player] + player * 220, upFld[upLineNo[player] * 2] / 10000 % 10);
+		setFieldBlock(1 + fldsizew[player] * fldsizeh[player] + player * 220, upFld[upLineNo[player] * 2] / 1000 % 10);
+		setFieldBlock(2 + fldsizew[player] * fldsizeh[player] + player * 220, upFld[upLineNo[player] * 2] / 100 % 10);
+		setFieldBlock(3 + fldsizew[player] * fldsizeh[player] + player * 220, upFld[upLineNo[player] * 2] / 10 % 10);
+		setFieldBlock(4 + fldsizew[player] * fldsizeh[player] + player * 220, upFld[upLineNo[player] * 2] % 10);
+		setFieldBlock(5 + fldsizew[player] * fldsizeh[player] + player * 220, upFld[upLineNo[player] * 2 + 1] / 10000 % 10);
+		setFieldBlock(6 + fldsizew[player] * fldsizeh[player] + player * 220, upFld[upLineNo[player] * 2 + 1] / 1000 % 10);
+		setFieldBlock(7 + fldsizew[player] * fldsizeh[player] + player * 220, upFld[upLineNo[player] * 2 + 1] / 100 % 10);
+		setFieldBlock(8 + fldsizew[player] * fldsizeh[player] + player * 220, upFld[upLineNo[player] * 2 + 1] / 10 % 10);
+		setFieldBlock(9 + fldsizew[player] * fldsizeh[player] + player * 220, upFld[upLineNo[player] * 2 + 1] % 10);
 
 		for(j = 0; j < fldsizew[player]; j++) {
 			fldt[j + fldsizew[player] * fldsizeh[player] + player * 220] = (fld[j + fldsizew[player] * fldsizeh[player] + player * 220] != 0) * -1;
 			if(hidden[player] == 8) fldt[j + fldsizeh[player] * fldsizew[player] + player * 220] = 0;
 			// アイテムを増殖させない #1.60c7o6
 			fldi[j + fldsizew[player] * fldsizeh[player] + player * 220] = 0;
-			flds[j + fldsizew[player] * fldsizeh[player] + player * 220] = 0;
+			setFieldSquare(j + fldsizew[player] * fldsizeh[player] + player * 220, 0);
 		}
 
 		erase[fldsizeh[player] + player * 22] = 0;
@@ -8469,22 +8169,14 @@ void UpLineBlock(int32_t player) {
 			h1 = (hole[player] / 2) * 2;
 			h2 = h1 + 1;
 		}
-		for(i = 1; i <= fldsizeh[player]; i++) {
-			for(j = 0; j < fldsizew[player]; j++) {
-				fld[j + (i - 1) * fldsizew[player] + player * 220] = fld[j + i * fldsizew[player] + player * 220];
-				fldt[j + (i - 1) * fldsizew[player] + player * 220] = fldt[j + i * fldsizew[player] + player * 220];
-				fldi[j + (i - 1) * fldsizew[player] + player * 220] = fldi[j + i * fldsizew[player] + player * 220];
-				flds[j + (i - 1) * fldsizew[player] + player * 220] = flds[j + i * fldsizew[player] + player * 220];
-			}
-			erase[(i - 1) + player * 22] = erase[i + player * 22];
-		}
+		shiftFieldRowsUp(player, FIELD_LAYER_ALL);
 
 		for(j = 0; j < fldsizew[player]; j++) {
-			fld[j + fldsizew[player] * fldsizeh[player] + player * 220] = ((j != h1) && (j != h2));
+			setFieldBlock(j + fldsizew[player] * fldsizeh[player] + player * 220, ((j != h1) && (j != h2)));
 			fldt[j + fldsizew[player] * fldsizeh[player] + player * 220] = (fld[j + fldsizew[player] * fldsizeh[player] + player * 220] != 0) * -1;
 			// アイテムを増殖させない #1.60c7o6
 			 fldi[j + fldsizew[player] * fldsizeh[player] + player * 220] = 0;
-			 flds[j + fldsizew[player] * fldsizeh[player] + player * 220] = 0;
+			 setFieldSquare(j + fldsizew[player] * fldsizeh[player] + player * 220, 0);
 			 if(hidden[player] == 8) fldt[j + fldsizeh[player] * fldsizew[player] + player * 220] = -60;
 		}
 
@@ -8493,7 +8185,7 @@ void UpLineBlock(int32_t player) {
 		// DS風に3割の確立で穴の位置が変わる C7T3.2EX
 		// MISSIONでは8割の確率
 		if(gameMode[player] != 4){
-			if( gameRand(10,player) > 6 - ( (4 + (repversw >= 55) )*(gameMode[player] == 8)) ){
+			if( gameRand(10,player) > 6 - ( (rules->missionHoleShift)*(gameMode[player] == 8)) ){
 				do {
 					newhole = gameRand(10,player);
 				} while(newhole == hole[player]);
@@ -8515,22 +8207,14 @@ void UpLineBlock(int32_t player) {
 			h1 = (hole[player] / 2) * 2;
 			h2 = h1 + 1;
 		}
-		for(i = 1; i <= fldsizeh[player]; i++) {
-			for(j = 0; j < fldsizew[player]; j++) {
-				fld[j + (i - 1) * fldsizew[player] + player * 220] = fld[j + i * fldsizew[player] + player * 220];
-				fldt[j + (i - 1) * fldsizew[player] + player * 220] = fldt[j + i * fldsizew[player] + player * 220];
-				fldi[j + (i - 1) * fldsizew[player] + player * 220] = fldi[j + i * fldsizew[player] + player * 220];
-				flds[j + (i - 1) * fldsizew[player] + player * 220] = flds[j + i * fldsizew[player] + player * 220];
-			}
-			erase[(i - 1) + player * 22] = erase[i + player * 22];
-		}
+		shiftFieldRowsUp(player, FIELD_LAYER_ALL);
 
 		for(j = 0; j < fldsizew[player]; j++) {
-			fld[j + fldsizew[player] * fldsizeh[player] + player * 220] = ((j != h1) && (j != h2));
+			setFieldBlock(j + fldsizew[player] * fldsizeh[player] + player * 220, ((j != h1) && (j != h2)));
 			fldt[j + fldsizew[player] * fldsizeh[player] + player * 220] = (fld[j + fldsizew[player] * fldsizeh[player] + player * 220] != 0) * -1;
 			// アイテムを増殖させない #1.60c7o6
 			 fldi[j + fldsizew[player] * fldsizeh[player] + player * 220] = 0;
-			 flds[j + fldsizew[player] * fldsizeh[player] + player * 220] = 0;
+			 setFieldSquare(j + fldsizew[player] * fldsizeh[player] + player * 220, 0);
 			 if(hidden[player] == 8) fldt[j + fldsizeh[player] * fldsizew[player] + player * 220] = -60;
 		}
 
@@ -8540,24 +8224,16 @@ void UpLineBlock(int32_t player) {
 	} else {
 		PlaySE(WAVE_SE_UP);
 		// フィールドを上にずらす
-		for(i = 1; i <= fldsizeh[player]; i++) {
-			for(j = 0; j < fldsizew[player]; j++) {
-				fld[j + (i - 1) * fldsizew[player] + player * 220] = fld[j + i * fldsizew[player] + player * 220];
-				fldt[j + (i - 1) * fldsizew[player] + player * 220] = fldt[j + i * fldsizew[player] + player * 220];
-				fldi[j + (i - 1) * fldsizew[player] + player * 220] = fldi[j + i * fldsizew[player] + player * 220];
-				flds[j + (i - 1) * fldsizew[player] + player * 220] = flds[j + i * fldsizew[player] + player * 220];
-			}
-			erase[(i - 1) + player * 22] = erase[i + player * 22];
-		}
+		shiftFieldRowsUp(player, FIELD_LAYER_ALL);
 		for(j = 0; j < fldsizew[player]; j++) {
 			fldt[j + fldsizew[player] * fldsizeh[player] + player * 220] = (fld[j + fldsizew[player] * fldsizeh[player] + player * 220] != 0) * -1;
 			// アイテムを増殖させない #1.60c7o6
 			fldi[j + fldsizew[player] * fldsizeh[player] + player * 220] = 0;
-			flds[j + fldsizew[player] * fldsizeh[player] + player * 220] = 0;
+			setFieldSquare(j + fldsizew[player] * fldsizeh[player] + player * 220, 0);
 		}
 		// せり上がりフィールドの一番上のラインをコピー
 		for( j = 0 ; j < fldsizew[player] ; j++ ) {
-			fld[j + fldsizeh[player] * fldsizew[player] + player * 220] = fldu[j + 0 * fldsizew[player] + player * 220];
+			setFieldBlock(j + fldsizeh[player] * fldsizew[player] + player * 220, fldu[j + 0 * fldsizew[player] + player * 220]);
 			fldt[j + fldsizeh[player] * fldsizew[player] + player * 220] = (fld[j + fldsizeh[player] * fldsizew[player] + player * 220] != 0) * -1;
 			if(hidden[player] == 8) fldt[j + fldsizeh[player] * fldsizew[player] + player * 220] = -60;
 		}
@@ -8578,6 +8254,7 @@ void UpLineBlock(int32_t player) {
 //▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
 void statErase(int32_t player) {
 	int32_t		i, j, tmp_s[2],y;
+	const RulesProfile *rules = getRulesProfile();
 
 	padRepeat(player);
 
@@ -8589,7 +8266,7 @@ void statErase(int32_t player) {
 	}
 
 	if(statusc[player * 10 + 3] != 0){
-		if(repversw >= 57){
+		if(rules->eraseRedraw){
 			drawCBlock(player, 0, 0, 10, 0);
 			if(spawn_y_type) viewFldFrame(1,player);
 		}
@@ -8598,12 +8275,12 @@ void statErase(int32_t player) {
 
 	if(ace_irs) doIRS2(player);
 
-	if((repversw >= 48) && (dhold[player] != disable_hold) && (!ishidenext[player])&& (!isfakenext[player]))
+	if((rules->holdEnableAtLock) && (dhold[player] != disable_hold) && (!ishidenext[player])&& (!isfakenext[player]))
 		dhold[player] = disable_hold;		// hold使用可能に	#1.60c
 
 	// ↓を離している場合、下入れ制限解除#1.60c7n6
-	if((!getPressState(player, 1-(1*((isUDreverse[player]) && (repversw>=44)) ))) && (repversw >= 10)) down_flag[player] = 0;
-	if(!getPressState(player, 0+(1*((isUDreverse[player]) && (repversw>=44)) ))) up_flag[player] = 0;
+	if((!getPressState(player, 1-(1*((isUDreverse[player]) && (rules->udReverseFlags)) ))) && (rules->releaseDownFlag)) down_flag[player] = 0;
+	if(!getPressState(player, 0+(1*((isUDreverse[player]) && (rules->udReverseFlags)) ))) up_flag[player] = 0;
 
 	if((gameMode[player] == 6) && (!ending[player])) {
 		// tomoyoモードでクリアフラグが1になっていたらステージクリア #1.60c7l8
@@ -8649,7 +8326,7 @@ void statErase(int32_t player) {
 			PlaySE(WAVE_SE_REGRET);
 	}
 
-	if(((repversw >= 46) && ((repversw < 48))) && (statusc[player * 10] == wait1[player]) && (!ishidenext[player])&& (!isfakenext[player]))
+	if((rules->holdEnableAtAre) && (statusc[player * 10] == wait1[player]) && (!ishidenext[player])&& (!isfakenext[player]))
 		dhold[player] = disable_hold;		// hold使用可能に	#1.60c
 
 	if((isthunder[player]) && (statusc[player * 10] == wait1[player])){
@@ -8699,7 +8376,7 @@ void statErase(int32_t player) {
 				statusc[player * 10 + 1] = 3;	// Ready
 				statusc[player * 10 + 2] = 0;
 				statusc[player * 10 + 3] = 0;
-				if((repversw >= 41) && ((heboGB[player] > 0) || (mission_end[c_mission - 1] == 3))){
+				if((rules->gbEndingStatus) && ((heboGB[player] > 0) || (mission_end[c_mission - 1] == 3))){
 					status[player] = 35;
 					statusc[player * 10] = -wait1[player];
 					statusc[player * 10 + 2] = mission_erase[c_mission - 1];
@@ -8941,7 +8618,7 @@ void statErase(int32_t player) {
 		//エンディング突入よりも優先するように
 		//（機能しなくなるから）C7U1
 		// せりあがり処理（ミラー中はせり上げない）
-		if(fmirror_cnt[player] == -20+(20*(repversw <= 17)))
+		if(fmirror_cnt[player] == rules->mirrorUpLineCount)
 			if(UpLineShirase(player)) return;
 
 		// フィールドミラー化処理 #1.60c7j5
@@ -8952,7 +8629,7 @@ void statErase(int32_t player) {
 			status[player] = 13;
 
 			// ステータスカウンタ初期化 #1.60c7r3
-			if(repversw >= 15) {
+			if(rules->eraseStatusReset) {
 				for(i = 0; i < 10; i++) statusc[i + player * 10] = 0;
 			}
 			if((gameMode[player] == 9) && (relaymode[player])){
@@ -8971,7 +8648,7 @@ void statErase(int32_t player) {
 			LevelUp(player);
 
 			// このバージョンから固定→次を2フレーム縮める #1.60c7h2
-			if(repversw < 4)
+			if(!rules->areShortcut)
 				status[player] = statusc[player * 10 + 1];
 			else {
 				// REメダル
@@ -9021,14 +8698,14 @@ void statErase(int32_t player) {
 						}
 				}
 				// ステータスカウンタ初期化 #1.60c7r3
-				if(repversw >= 61)
+				if(rules->statusResetBeforeBlock)
 					for(i = 0; i < 10; i++) statusc[i + player * 10] = 0;
 				// 落下開始
 				ofs_x[player] = 0;
 				ofs_x2[player] = 0;
 				statBlock(player);
 			}
-			if(repversw < 61)
+			if(!rules->statusResetBeforeBlock)
 				for(i = 0; i < 10; i++) statusc[i + player * 10] = 0;
 		}
 
@@ -9037,7 +8714,8 @@ void statErase(int32_t player) {
 
 /* フィールドミラー */
 int32_t fldMirrorProc(int32_t player) {
-	int32_t		i, j;
+	int32_t		j, layers, clearLayers;
+	const RulesProfile *rules = getRulesProfile();
 	if((stopmirror_flag[player] == 1) && (fmirror_cnt[player] == -20)){
 		isfmirror[player] = 0;
 		stopmirror_flag[player] = 0;
@@ -9047,52 +8725,39 @@ int32_t fldMirrorProc(int32_t player) {
 	}
 
 
-	if((repversw <= 17) && (fmirror_cnt[player] < 0))	//c7t2.9以前のリプレイはフィールド回転無し
+	if((rules->oldFieldMirror) && (fmirror_cnt[player] < 0))	//c7t2.9以前のリプレイはフィールド回転無し
 		fmirror_cnt[player] = 0;
 
 	// fmirrorをplayerごとに #1.60c7l7
 	if((isfmirror[player]) && (p_fmirror_interval > 0) && ((gameMode[player] >= 4) || (item_mode[player]))) {
 		if( (((gameMode[player] == 4) || (item_mode[player]))&&(bdowncnt[player] % 1 == 0)) || (bdowncnt[player] % p_fmirror_interval == 0) || (gameMode[player] == 8) ) {
 			if(fmirror_cnt[player] <= p_fmirror_timer) {
-				if(((repversw >= 18) && (fmirror_cnt[player] == -20)) || ((repversw <= 17) && (fmirror_cnt[player] == 0))) {
+				if(fmirror_cnt[player] == rules->mirrorUpLineCount) {
 //					APP_PlayWave(WAVE_SE_UP);
 					// フィールドをバッファに確保
-					for(i = 0; i <= fldsizeh[player]; i++) {
-						for(j = 0; j < fldsizew[player]; j++) {
-							fldbuf[j + i * fldsizew[player] + player * 220] = fld[j + i * fldsizew[player] + player * 220];
-							if(repversw >= 18) fld[j + i * fldsizew[player] + player * 220] = 0;	//旧式はフィールドを消さない
-							fldtbuf[j + i * fldsizew[player] + player * 220] = fldt[j + i * fldsizew[player] + player * 220];
-							if(repversw >= 18) fldt[j + i * fldsizew[player] + player * 220] = 0;	//旧式はフィールドを消さない
-							if((gameMode[player] == 4) || (item_mode[player])){
-								fldibuf[j + i * fldsizew[player] + player * 220] = fldi[j + i * fldsizew[player] + player * 220];
-								fldi[j + i * fldsizew[player] + player * 220] = 0;
-							}
-							fldsbuf[j + i * 10 + player * 220] = flds[j + i * 10 + player * 220];
-							flds[j + i * 10 + player * 220] = 0;
-						}
-					}
+					layers = FIELD_LAYER_BLOCK | FIELD_LAYER_TIMER | FIELD_LAYER_SQUARE;
+					if((gameMode[player] == 4) || (item_mode[player])) layers |= FIELD_LAYER_ITEM;
+					clearLayers = layers & ~(FIELD_LAYER_BLOCK | FIELD_LAYER_TIMER);
+					if(!rules->oldFieldMirror) clearLayers = layers;	//旧式はフィールドを消さない
+					saveFieldBuffer(player, layers, clearLayers);
 				} else {
 					if((fmirror_cnt[player] > 0) && (fmirror_cnt[player] % (p_fmirror_timer / fldsizew[player]) == 0)) {
-						for(i = 0; i <= fldsizeh[player]; i++) {
-							j = (fmirror_cnt[player]) / (p_fmirror_timer / fldsizew[player]) - 1;
-							fld[(fldsizew[player] - j - 1) + i * fldsizew[player] + player * 220] = fldbuf[j + i * fldsizew[player] + player * 220];
-							fldt[(fldsizew[player] - j - 1) + i * fldsizew[player] + player * 220] = fldtbuf[j + i * fldsizew[player] + player * 220];
-							flds[(fldsizew[player] - j - 1) + i * fldsizew[player] + player * 220] = fldsbuf[j + i * fldsizew[player] + player * 220];
-							if((gameMode[player] == 4) || (item_mode[player]))
-								fldi[(fldsizew[player] - j - 1) + i * fldsizew[player] + player * 220] = fldibuf[j + i * fldsizew[player] + player * 220];
-						}
+						j = (fmirror_cnt[player]) / (p_fmirror_timer / fldsizew[player]) - 1;
+						layers = FIELD_LAYER_BLOCK | FIELD_LAYER_TIMER | FIELD_LAYER_SQUARE;
+						if((gameMode[player] == 4) || (item_mode[player])) layers |= FIELD_LAYER_ITEM;
+						mirrorFieldColumn(player, j, layers);
 						ExBlt(PLANE_MIRROR_EFFECT_TAP, 120+ ((fldsizew[player] - j - 1) * 8) + 192 * player - 96 * maxPlay, 40);
 					}
 				}
 				fmirror_cnt[player]++;
 				if((fastmirror) && (fmirror_cnt[player] <= 0)) fmirror_cnt[player]++;
 				return 1;
-			} else if((repversw >= 18) && (fmirror_cnt[player] <= p_fmirror_timer + 10-(6*(repversw >= 25)) + 10*(fastmirror))) {
+			} else if((!rules->oldFieldMirror) && (fmirror_cnt[player] <= p_fmirror_timer + rules->mirrorEndWait + 10*(fastmirror))) {
 				fmirror_cnt[player]++;
 				return 1;
 			}
 			fmirror_cnt[player] = -20;
-			if(repversw <= 17)	//c7t2.9以前のリプレイはフィールド回転無し
+			if(rules->oldFieldMirror)	//c7t2.9以前のリプレイはフィールド回転無し
 			fmirror_cnt[player] = 0;
 		}
 	}
@@ -9101,9 +8766,10 @@ int32_t fldMirrorProc(int32_t player) {
 
 /* せり上がり */
 int32_t UpLineShirase(int32_t player) {
+	const RulesProfile *rules = getRulesProfile();
 
 	// 旧式せり上がり（リプレイの互換性のため残されている）
-	if(repversw < 6) {
+	if(rules->oldShirase) {
 		if((p_shirase[player] == 1) && (tc[player] >= shirase[player]) && (tc[player] >= level_shirase_start + raise_shirase_interval) ) {
 			shirase[player] = (tc[player] / raise_shirase_interval + 1) * raise_shirase_interval;
 			if(tc[player] < shirase[player])
@@ -9117,7 +8783,7 @@ int32_t UpLineShirase(int32_t player) {
 			shirase[player] = shirase[player] + raise_shirase_interval;
 		}
 	// DEVILランダムせり上がり C7U4.9
-	} else if((gameMode[player] == 3) && (devil_randrise) && (repversw >= 44) && (!devil_minus[player])){
+	} else if((gameMode[player] == 3) && (devil_randrise) && (rules->devilRandomRise) && (!devil_minus[player])){
 		if((devil_nextrise[player] <= 0) && (devil_rise_min[tgmRank[player] / 10] > 0) && (devil_rise_max[tgmRank[player] / 10] > 0)) {
 			do {
 				devil_nextrise[player] = gameRand( devil_rise_max[tgmRank[player] / 10] + 1,player);
@@ -9152,107 +8818,31 @@ int32_t UpLineShirase(int32_t player) {
 	UpLineBlockJudge(player);
 	if(upLines[player]) return 1;
 
-	if(repversw >= 47) pinchCheck(player);
+	if(rules->risePinchCheck) pinchCheck(player);
 
 	return 0;
 }
 
 /* レベルアップ */
 void LevelUp(int32_t player) {
-	// レベルアップ判定にTGMルール追加 #1.60c3
-	if(gameMode[player] == 0) {
-		// ビギナーモードのレベルアップ判定
-		if(tc[player] / 10 > tgmRank[player]) {
-			tgmRank[player]++;
-			recSectionTime(player);
+	const SpeedSchedule *schedule = &speedSchedule[player];
 
-			// スタッフロールでないならスピード値とwait値を変える #1.60c7j8
-			if(!ending[player]) {
-				if(tgmRank[player] < 101){
-					if(repversw < 40)sp[player] = lvTableBeg39[tgmRank[player]];
-					else sp[player] = lvTableBeg[tgmRank[player]];
-				}
-				if(tgmRank[player] % 10 == 0) {
-					PlaySE(WAVE_SE_LEVELUP);
-					bgfadesw = 1;
-					if(fadelv[player] != 0) {
-						bgmlv++;
-						changeBGM(player);
-					}
-				}
-			}
-		}
-	} else if((gameMode[player] == 1)||(gameMode[player] == 2)) {
+	// 速度とwait値はsetStartLevel()で引いたスケジュールから
+	updateSpeedSchedule(player);
+
+	// レベルアップ判定にTGMルール追加 #1.60c3
+	if((gameMode[player] == 1)||(gameMode[player] == 2)) {
 		// マスターモード,20Gのレベルアップ判定
-		if(((enable_grade[player] != 4)||(repversw<=23))) {
+		if(!schedule->tgm2) {
 			if(tc[player] / 10 > tgmRank[player]) {
 				tgmRank[player]++;
 				recSectionTime(player);
 				if(!ending[player]) {
-					if(repversw <= 20){//リプレイが20以下
-						if(tgmRank[player] < 51) sp[player] = lvTableTgm20[tgmRank[player]];
-					}else if(repversw > 20){
-						if(tgmRank[player] < 51){
-							if(gameMode[player] == 2){
-							//20G
-								sp[player] = 1200;
-							}else{
-							//MASTER
-							 	sp[player] = lvTableTgm[tgmRank[player]];//前半は10ごとに上がる
-							}
-						}
-					}
-					if(tgmRank[player] % 10 == 0) {
-						if(((enable_grade[player] != 1)||(repversw<=23))){
-							if(repversw<29){//28まで
-								if((tgmRank[player] >= 50) && (tgmRank[player] <= 100)) {
-									wait1[player] = wait1_master_tbl28[(tgmRank[player] - 50) / 10 * 2];
-									wait2[player] = wait2_master_tbl28[(tgmRank[player] - 50) / 10 * 2];
-									wait3[player] = wait3_master_tbl28[(tgmRank[player] - 50) / 10 * 2];
-									waitt[player] = waitt_master_tbl28[(tgmRank[player] - 50) / 10 * 2];
-								}
-							}else if((repversw>=29) && (repversw<35)){//34まで
-								if((tgmRank[player] >= 50) && (tgmRank[player] <= 100)) {
-									wait1[player] = wait1_master_tbl34[(tgmRank[player] - 50) / 10 * 2];
-									wait2[player] = wait2_master_tbl34[(tgmRank[player] - 50) / 10 * 2];
-									wait3[player] = wait3_master_tbl34[(tgmRank[player] - 50) / 10 * 2];
-									waitt[player] = waitt_master_tbl34[(tgmRank[player] - 50) / 10 * 2];
-								}
-							}else if((repversw>=35) && (repversw<54)){
-								if((tgmRank[player] >= 50) && (tgmRank[player] <= 100)) {
-									wait1[player] = wait1_master_tbl53[(tgmRank[player] - 50) / 10 * 2];
-									wait2[player] = wait2_master_tbl53[(tgmRank[player] - 50) / 10 * 2];
-									wait3[player] = wait3_master_tbl53[(tgmRank[player] - 50) / 10 * 2];
-									waitt[player] = waitt_master_tbl53[(tgmRank[player] - 50) / 10 * 2];
-								}
-							}else{
-								if((tgmRank[player] >= 50) && (tgmRank[player] <= 100)) {
-									wait1[player] = wait1_master_tbl[(tgmRank[player] - 50) / 10 * 2];
-									wait2[player] = wait2_master_tbl[(tgmRank[player] - 50) / 10 * 2];
-									wait3[player] = wait3_master_tbl[(tgmRank[player] - 50) / 10 * 2];
-									waitt[player] = waitt_master_tbl[(tgmRank[player] - 50) / 10 * 2];
-								}
-							}
-						}else if(((enable_grade[player] == 1)&&(repversw>24))||((hebo_plus[player])&&(repversw>=34))){
-							if((tgmRank[player] >= 50) && (tgmRank[player] <= 100)) {
-							sp[player] = 1200;
-							wait1[player] =	26;
-							wait2[player] = 40;
-							wait3[player] = 28;
-							waitt[player] = 15;
-							}
-						}
-					PlaySE(WAVE_SE_LEVELUP);
-					bgfadesw = 1;
-					hebop_interval[player]--;
-						if((fadelv[player] != 0) && (!ending[player])) {
-							bgmlv++;
-							changeBGM(player);
-						}
-					}
+					applySpeedStep(player, tgmRank[player]);
+					if(tgmRank[player] % 10 == 0) hebop_interval[player]--;
 				}
 			}
-		} if((enable_grade[player] == 4)&&(repversw >= 24)) {//grade4用速度アップ用
+		} else {//grade4用速度アップ用
 			if(tc[player] / 10 > tgmRank[player]) {//tcはレベル trは10ごとに1ずつ増える
 				tgmRank[player]++;
 				tr2[player]++;
@@ -9265,206 +8855,53 @@ void LevelUp(int32_t player) {
 						if(gup3sp_adjust[player] == 2){
 							tr2[player] = tr2[player] + 10;//skip
 						}
-						if((gup3sp_adjust[player] == 0) && ((regretcancel[player] == 0) || (repversw < 41))){
+						if((gup3sp_adjust[player] == 0) && ((regretcancel[player] == 0) || (!schedule->regretCancel))){
 							tr2[player] = tr2[player] - 10;//やり直し
 						}
 					}
-					if(tr2[player] < 51){
-						if(gameMode[player] == 2){
-						//20G
-							sp[player] = 1200;
-						}else{
-						//MASTER
-						 	sp[player] = lvTableTgm[tr2[player]];//前半は10ごとに上がる
-						}
-					}
+					// tr2はtgmRankと一緒に上がって10ずつ増減するので、セクションの区切りも同じ
+					applySpeedStep(player, tr2[player]);
 					if(tgmRank[player] % 10 == 0) {
-						if((tr2[player] >= 50) && (tr2[player] <= 200) && ((tr2[player] <= 150) || (repversw < 60))) {
-							if(repversw<29){//29以前
-								if((tr2[player] >= 50) && (tr2[player] <= 200)) {
-									sp[player] = 1200;
-									wait1[player] = wait1_master_tbl28[(tr2[player] - 50) / 10 * 2];
-									wait2[player] = wait2_master_tbl28[(tr2[player] - 50) / 10 * 2];
-									wait3[player] = wait3_master_tbl28[(tr2[player] - 50) / 10 * 2];
-									waitt[player] = waitt_master_tbl28[(tr2[player] - 50) / 10 * 2];
-								}
-							} else if((repversw >=29) && (repversw < 35)){//29以降
-								if((tr2[player] >= 50) && (tr2[player] <= 200)) {
-									sp[player] = 1200;
-									wait1[player] = wait1_master_tbl34[(tr2[player] - 50) / 10 * 2];
-									wait2[player] = wait2_master_tbl34[(tr2[player] - 50) / 10 * 2];
-									wait3[player] = wait3_master_tbl34[(tr2[player] - 50) / 10 * 2];
-									waitt[player] = waitt_master_tbl34[(tr2[player] - 50) / 10 * 2];
-								}
-							} else if((repversw >=35) && (repversw < 54)){//35以降
-								if((tr2[player] >= 50) && (tr2[player] <= 200)) {
-									sp[player] = 1200;
-									wait1[player] = wait1_master_tbl53[(tr2[player] - 50) / 10 * 2];
-									wait2[player] = wait2_master_tbl53[(tr2[player] - 50) / 10 * 2];
-									wait3[player] = wait3_master_tbl53[(tr2[player] - 50) / 10 * 2];
-									waitt[player] = waitt_master_tbl53[(tr2[player] - 50) / 10 * 2];
-								}
-							} else if(repversw >=54){//54以降
-								if((tr2[player] >= 50) && (tr2[player] <= 200)) {
-									sp[player] = 1200;
-									wait1[player] = wait1_master_tbl[(tr2[player] - 50) / 10 * 2];
-									wait2[player] = wait2_master_tbl[(tr2[player] - 50) / 10 * 2];
-									wait3[player] = wait3_master_tbl[(tr2[player] - 50) / 10 * 2];
-									waitt[player] = waitt_master_tbl[(tr2[player] - 50) / 10 * 2];
-								}
-							}
-						}
-						PlaySE(WAVE_SE_LEVELUP);
 						reset_gradeup3(player);//gradeup3に使う変数を一気にリセット
-						bgfadesw = 1;
 						hebop_interval[player]--;
-						if((fadelv[player] != 0) && (!ending[player])) {
-							bgmlv++;
-							changeBGM(player);
-						}
 					}
 				}
 			}
 		}
 	} else if(gameMode[player] == 3) {
 		// デビルモードのレベルアップ判定
-		if(repversw < 18){//17以前
-			if(tc[player] / 10 > tgmRank[player]) {
-				tgmRank[player]++;
-				recSectionTime(player);
+		if(tc[player] / 10 > tgmRank[player]) {
+			tgmRank[player]++;
+			recSectionTime(player);
 
-				if( (!ending[player]) && (tgmRank[player] % 10 == 0) ) {
-					if(tgmRank[player] <= 120) {	// LV1200まで #1.60c7j5
-						wait1[player] = wait1_devil_tbl17[tgmRank[player] / 10];
-						wait2[player] = wait2_devil_tbl17[tgmRank[player] / 10];
-						wait3[player] = wait3_devil_tbl17[tgmRank[player] / 10];
-						waitt[player] = waitt_devil_tbl17[tgmRank[player] / 10];
+			if( (!ending[player]) && (tgmRank[player] % 10 == 0) ) {
+				applySpeedStep(player, tgmRank[player]);
 
-						if(grade[player] < 13) grade[player] = tgmRank[player] / 10; // Grade設定 #1.60c7j7
+				if(tgmRank[player] <= 120) {	// LV1200まで #1.60c7j5
+					// Grade設定 #1.60c7j7
+					if(schedule->devilGrade == DEVIL_GRADE_FLASH) {
+						if(grade[player] < 13) grade[player] = tgmRank[player] / 10;
 						gflash[player]=120;
-					}
-					PlaySE(WAVE_SE_LEVELUP);
-					bgfadesw = 1;
-					if((fadelv[player] != 0) && (!ending[player])) {
-						bgmlv++;
-						changeBGM(player);
-					}
-				}
-			}
-		}else if(repversw == 18){//18-19
-			if(tc[player] / 10 > tgmRank[player]) {
-				tgmRank[player]++;
-				recSectionTime(player);
-
-				if( (!ending[player]) && (tgmRank[player] % 10 == 0) ) {
-					if(tgmRank[player] <= 120) {	// LV1200まで #1.60c7j5
-						wait1[player] = wait1_devil_tbl18[tgmRank[player] / 10];
-						wait2[player] = wait2_devil_tbl18[tgmRank[player] / 10];
-						wait3[player] = wait3_devil_tbl18[tgmRank[player] / 10];
-						waitt[player] = waitt_devil_tbl18[tgmRank[player] / 10];
-
-						if(grade[player] < 13) grade[player] = tgmRank[player] / 10; // Grade設定 #1.60c7j7
+					} else if(schedule->devilGrade == DEVIL_GRADE_RAISE) {
+						if(grade[player] < 13) {
+							grade[player] = tgmRank[player] / 10;
+							gflash[player]=120;
+						}
+					} else if((tgmRank[player] == 50) && (schedule->devilGrade >= DEVIL_GRADE_MINUS)) {//m
+						PlaySE(WAVE_SE_TTCLEAR);
+						grade[player]=14;
+						gflash[player]=120;
+					} else if((tgmRank[player] == 100) && (schedule->devilGrade == DEVIL_GRADE_DEATH)) {
+						PlaySE(WAVE_SE_TTCLEAR);
+						grade[player]=15;
 						gflash[player]=120;
-					}
-					PlaySE(WAVE_SE_LEVELUP);
-					bgfadesw = 1;
-					if((fadelv[player] != 0) && (!ending[player])) {
-						bgmlv++;
-						changeBGM(player);
 					}
 				}
-			}
-		}else if(repversw >= 19){//19以降
-			if(tc[player] / 10 > tgmRank[player]) {
-				tgmRank[player]++;
-				recSectionTime(player);
-
-				if( (!ending[player]) && (tgmRank[player] % 10 == 0) ) {
-					if((((enable_grade[player] == 1) && (repversw < 42)) || (devil_minus[player]))&&(gameMode[player] == 3)&&(repversw >= 31)){//devil-
-						if(tgmRank[player] <= 120) {	// LV1200まで #1.60c7j5
-							wait1[player] = wait1_devil_m_tbl[tgmRank[player] / 10];
-							wait2[player] = wait2_devil_m_tbl[tgmRank[player] / 10];
-							wait3[player] = wait3_devil_m_tbl[tgmRank[player] / 10];
-							waitt[player] = waitt_devil_m_tbl[tgmRank[player] / 10];
-
-							if(!devil_minus[player]){
-								if(grade[player] < 13){//ノーマル
-									grade[player] = tgmRank[player] / 10; // Grade設定 #1.60c7j7
-									gflash[player]=120;
-								}
-							}else{
-								if(tgmRank[player]==50){//m
-									grade[player]=14;
-									PlaySE(WAVE_SE_TTCLEAR);
-									gflash[player]=120;
-								}
-							}
-						}
-					}else if(repversw < 33){	//32
-						if(tgmRank[player] <= 120) {	// LV1200まで #1.60c7j5
-							wait1[player] = wait1_devil_tbl32[tgmRank[player] / 10];
-							wait2[player] = wait2_devil_tbl32[tgmRank[player] / 10];
-							wait3[player] = wait3_devil_tbl32[tgmRank[player] / 10];
-							waitt[player] = waitt_devil_tbl32[tgmRank[player] / 10];
-
-							if(grade[player] < 13){
-								grade[player] = tgmRank[player] / 10; // Grade設定 #1.60c7j7
-								gflash[player]=120;
-							}
-						}
-					}else{
-						if(tgmRank[player] <= 120) {	// LV1200まで #1.60c7j5
-							if(repversw < 60){
-								wait1[player] = wait1_devil_tbl[tgmRank[player] / 10];
-								wait2[player] = wait2_devil_tbl[tgmRank[player] / 10];
-								wait3[player] = wait3_devil_tbl[tgmRank[player] / 10];
-								waitt[player] = waitt_devil_tbl[tgmRank[player] / 10];
-							}else if(repversw < 62){
-								wait1[player] = wait1_doom_tbl61[tgmRank[player] / 10];
-								wait2[player] = wait2_doom_tbl61[tgmRank[player] / 10];
-								wait3[player] = wait3_doom_tbl61[tgmRank[player] / 10];
-								waitt[player] = waitt_doom_tbl61[tgmRank[player] / 10];
-							}else{
-								wait1[player] = wait1_doom_tbl[tgmRank[player] / 10];
-								wait2[player] = wait2_doom_tbl[tgmRank[player] / 10];
-								wait3[player] = wait3_doom_tbl[tgmRank[player] / 10];
-								waitt[player] = waitt_doom_tbl[tgmRank[player] / 10];
-							}
-							if((!devil_minus[player]) && (!death_plus[player])){
-								//ノーマル
-								if(grade[player] < 13) grade[player] = tgmRank[player] / 10; // Grade設定 #1.60c7j7
-								gflash[player]=120;
-							}else{
-								if(tgmRank[player]==50){
-									PlaySE(WAVE_SE_TTCLEAR);
-									grade[player]=14;
-									gflash[player]=120;
-								}
-								if(tgmRank[player]==100){
-									PlaySE(WAVE_SE_TTCLEAR);
-									grade[player]=15;
-									gflash[player]=120;
-								}
-								if(tgmRank[player]==130){
-									PlaySE(WAVE_SE_TTCLEAR);
-									grade[player]=16;
-									gflash[player]=120;
-								}
-							}
-						}
-					}
-					PlaySE(WAVE_SE_LEVELUP);
-					bgfadesw = 1;
-					if((devil_randrise) && (repversw >= 44)){
-						if((devil_nextrise[player] <= 0) && (devil_rise_min[tgmRank[player] / 10] > 0) && (devil_rise_max[tgmRank[player] / 10] > 0) && (!devil_minus[player])) {
-							do {
-								devil_nextrise[player] = gameRand( devil_rise_max[tgmRank[player] / 10] + 1,player);
-							} while(devil_nextrise[player] < devil_rise_min[tgmRank[player] / 10]);
-						}
-					}
-					if((fadelv[player] != 0) && (!ending[player])) {
-						bgmlv++;
-						changeBGM(player);
+				if(schedule->randomRise) {
+					if((devil_nextrise[player] <= 0) && (devil_rise_min[tgmRank[player] / 10] > 0) && (devil_rise_max[tgmRank[player] / 10] > 0) && (!devil_minus[player])) {
+						do {
+							devil_nextrise[player] = gameRand( devil_rise_max[tgmRank[player] / 10] + 1,player);
+						} while(devil_nextrise[player] < devil_rise_min[tgmRank[player] / 10]);
 					}
 				}
 			}
@@ -9474,9 +8911,7 @@ void LevelUp(int32_t player) {
 		if(tc[player] / 10 > tgmRank[player]) {
 			tgmRank[player]++;
 
-			if( (!ending[player]) && (tgmRank[player] % 10 == 0) ) {
-				PlaySE(WAVE_SE_LEVELUP);
-			}
+			if(!ending[player]) applySpeedStep(player, tgmRank[player]);
 
 		}
 		if(wintype==0){
@@ -9513,86 +8948,39 @@ void LevelUp(int32_t player) {
 		}
 	} else if(gameMode[player] == 6) {
 		// TOMOYOモードのレベルアップ判定 #1.60c7m1
+		// F-Pointでは古いテーブルの方が速ければそちらにする
+		bool fpoint;
+
 		if(!fpbas_mode[player]) {
 			if(tc[player] / 10 > tgmRank[player]) {
 				tgmRank[player]++;
 
-				if(tgmRank[player] < 31){
-					if((repversw < 25) || ((stage[player] >= 100) && (lvTabletomoyo24[tgmRank[player]] > sp[player])))
-						sp[player] = lvTabletomoyo24[tgmRank[player]];
-					else if(lvTabletomoyo[tgmRank[player]] > sp[player])
-						sp[player] = lvTabletomoyo[tgmRank[player]];
-				}
-
-				if(tgmRank[player] % 10 == 0) {
-					PlaySE(WAVE_SE_LEVELUP);
-					bgfadesw = 1;
-				}
+				fpoint = (stage[player] >= 100) && (tgmRank[player] < 31) && (lvTabletomoyo24[tgmRank[player]] > sp[player]);
+				applySpeedStep(player, tgmRank[player]);
+				if(fpoint) sp[player] = lvTabletomoyo24[tgmRank[player]];
 			}
 		} else {
 			if(lc[player] > 100) {
 				lc[player] = lc[player] - 100;
 				lv[player]++;
 
-				if(lv[player] < 20){
-					if((repversw < 25) || ((stage[player] >= 100) && (lvTabletomoyo24[lv[player]] > sp[player])))
-						sp[player] = lvTabletomoyohebo[lv[player]];
-					else if(lvTabletomoyo[lv[player]] > sp[player])
-						sp[player] = lvTabletomoyohebo[lv[player]];
-				}
-
-				if(lv[player] % 2 == 0) {
-					PlaySE(WAVE_SE_LEVELUP);
-					bgfadesw = 1;
-				}
+				fpoint = (stage[player] >= 100) && (lv[player] < 20) && (lvTabletomoyo24[lv[player]] > sp[player]);
+				applySpeedStep(player, lv[player]);
+				if(fpoint) sp[player] = lvTabletomoyohebo[lv[player]];
 			}
 		}
 	} else if(gameMode[player] == 7) {
 		// ACEモードのレベルアップ判定
 		if( (li[player] >= lv[player] * 10) && (!ending[player]) && ( anothermode[player] == 0)) {
 			lv[player]++;
-			if(repversw < 56)
-				sp[player] = lvTableAce55[lv[player]-1];
-			else
-				sp[player] = lvTableAce[lv[player]-1];
+			applySpeedStep(player, lv[player]);
 			ltime[player] = timeLimitAce[lv[player]-1];
-
-			PlaySE(WAVE_SE_RANKUP);
-			StopSE(WAVE_SE_HURRYUP);
-			bgfadesw = 1;
 			timeOn[player] = 0;		// タイムを一時的に止める
-
-			if(fadelv[player] != 0) {
-				ace_bgmchange[player]++;
-				bgmlv = ace_bgmlist[ace_bgmchange[player]];
-				changeBGM(player);
-			}
 		} else if( (li[player] >= lv[player] * 10) && (!ending[player]) && ( anothermode[player] == 1)) {
 			// アナザー
 			lv[player]++;
-			sp[player] = lvTableAcea[lv[player]-1];
+			applySpeedStep(player, lv[player]);
 			ltime[player] = timeLimitAcea[lv[player]-1];
-			if(repversw<36){
-				wait1[player] = wait1_Acea_tbl35[lv[player] - 1];
-				wait2[player] = wait2_Acea_tbl35[lv[player] - 1];
-				wait3[player] = wait3_Acea_tbl35[lv[player] - 1];
-				waitt[player] = waitt_Acea_tbl35[lv[player] - 1];
-			} else if(repversw>=36){
-				wait1[player] = wait1_Acea_tbl[lv[player] - 1];
-				wait2[player] = wait2_Acea_tbl[lv[player] - 1];
-				wait3[player] = wait3_Acea_tbl[lv[player] - 1];
-				waitt[player] = waitt_Acea_tbl[lv[player] - 1];
-			}
-
-			PlaySE(WAVE_SE_RANKUP);
-			StopSE(WAVE_SE_HURRYUP);
-			bgfadesw = 1;
-
-			if(fadelv[player] != 0) {
-				ace_bgmchange[player]++;
-				bgmlv = ace_bgmlist[ace_bgmchange[player] + 3];
-				changeBGM(player);
-			}
 		} else if( (li[player] >= lv[player] * 10) && (!ending[player]) && ( anothermode[player] == 2)) {
 			// アナザー2
 			lv[player]++;
@@ -9601,172 +8989,52 @@ void LevelUp(int32_t player) {
 			else if((lv[player] >= 8) && (lv[player] < 16)) hidden[player] = 5;
 			else hidden[player] = 0;
 			ltime[player] = timeLimitAcea2[lv[player]-1];
-
-			PlaySE(WAVE_SE_RANKUP);
-			StopSE(WAVE_SE_HURRYUP);
-			if((lv[player] >= 11) || (lv[player]%2==1)) bgfadesw = 1;
-
-			if(fadelv[player] != 0) {
-				ace_bgmchange[player]++;
-				bgmlv = ace_bgmlist[ace_bgmchange[player] + 6];
-				changeBGM(player);
-			}
+			applySpeedStep(player, lv[player]);
 		} else if( (lc[player] > 100) && (!ending[player]) && ( anothermode[player] == 3)) {
 			lc[player] = 0;
 			// アナザー3
 			lv[player]++;
-			int uppedlevel = lv[player]; // correct level speed, but not for past replays
-			if (repversw > 65) // new version
-				uppedlevel++; // one higer, cuz we are subtracting later.
-			if(heboGB[player] == 2){
-				if(lv[player]<19){
-					if (repversw > 65) // new version
-						sp[player] = lvTablesegahebo[uppedlevel-1];  // use better table
-					else
-						sp[player] = lvTabletomoyohebo[uppedlevel-1];
-				}
-			}else{
-				if(lv[player]<=15){
-					sp[player] = lvTableHeboGB[uppedlevel-1];
-					wait3[player] = wait3_HeboGB_tbl[uppedlevel-1];
-					waitt[player] = waitt_HeboGB_tbl[uppedlevel-1];
-				}
-			}
-
-			PlaySE(WAVE_SE_RANKUP);
-			StopSE(WAVE_SE_HURRYUP);
-			// only do changes at proper levels
-			if (heboGB[player]==1) bgfadesw = 1;	  // change anyway
-			if (lv[player]==2) bgfadesw = 1;	  // change on level 2
-			if (lv[player]==4) bgfadesw = 1;	  // change on level 4
-			if (lv[player]==6) bgfadesw = 1;	  // change on level 6
-			if (lv[player]==8) bgfadesw = 1;	  // change on level 8
-			if (lv[player]==9) bgfadesw = 1;	  // change on level 9
-			if (lv[player]==10) bgfadesw = 1;	  // change on level 10
-			if (lv[player]==11) bgfadesw = 1;	  // change on level 11
-			if (lv[player]==13) bgfadesw = 1;	  // change on level 13
-			if (lv[player]==15) bgfadesw = 1;	  // change on level 15
-			if (lv[player]==50) bgfadesw = 1;	  // change at level 50, to use background 11.
-			if (lv[player]==99) bgfadesw = 1;	  // change when level counter is "maxed" at 99, to use background 12.
-			if(fadelv[player] != 0) {
-				ace_bgmchange[player]++;
-				bgmlv = ace_bgmlist[ace_bgmchange[player] + 9];
-				changeBGM(player);
-			}
+			applySpeedStep(player, lv[player]);
 		}
 	} else if(gameMode[player] == 9){
 		if( (c_norm[player] >= lv[player] * 10) && (!ending[player]) && ( std_opt[player] == 2)) {
 			lv[player]++;
 			c_norm[player] = c_norm[player]-((lv[player]-1) * 10);
-			if(repversw < 56)
-				sp[player] = lvTableAce55[lv[player]-1];
-			else
-				sp[player] = lvTableAce[lv[player]-1];
-
-			PlaySE(WAVE_SE_RANKUP);
-			StopSE(WAVE_SE_HURRYUP);
-			bgfadesw = 1;
+			applySpeedStep(player, lv[player]);
 			timeOn[player] = 0;		// タイムを一時的に止める
-
-			if(fadelv[player] != 0) {
-				ace_bgmchange[player]++;
-				bgmlv = ace_bgmlist[ace_bgmchange[player]];
-				changeBGM(player);
-			}
 		} else if(( c_norm[player] >= lv[player] * 5) && (!ending[player]) && ( std_opt[player] == 3)) {
 			//
 			lv[player]++;
 			c_norm[player] = c_norm[player]-((lv[player]-1) * 5);
-			if(repversw < 56)
-				sp[player] = lvTableAce55[lv[player]-1];
-			else
-				sp[player] = lvTableAce[lv[player]-1];
-
-			PlaySE(WAVE_SE_RANKUP);
-			StopSE(WAVE_SE_HURRYUP);
-			bgfadesw = 1;
-
-			if(fadelv[player] != 0) {
-				ace_bgmchange[player]++;
-				bgmlv = ace_bgmlist[ace_bgmchange[player] + 3];
-				changeBGM(player);
-			}
+			applySpeedStep(player, lv[player]);
 		}
 	} else if(gameMode[player]==10){
 		if(lc[player] > 100) {
 			lc[player] = lc[player] - 100;
 			lv[player]++;
 			recSectionTime(player);
-			if(ori_opt[player]==0) {
-				if(!ending[player]) {
-					if(lv[player] < 101) sp[player] = lvTableBeg39[lv[player]];
-
-					if(lv[player] % 10 == 0) {
-						PlaySE(WAVE_SE_LEVELUP);
-						bgfadesw = 1;
-						if(fadelv[player] != 0) {
-							bgmlv++;
-							changeBGM(player);
-						}
-					}
-				}
-			}else if((ori_opt[player]==1)||(ori_opt[player]==2)){
-				if(!ending[player]) {
-					if(lv[player] < 31) {
-						sp[player] = orimasterlvTable[lv[player]];
-					}
-					if(ori_opt[player]==2)
-						sp[player] = 1200;
-					if(lv[player] % 6 == 0) {
-						PlaySE(WAVE_SE_LEVELUP);
-						if((lv[player] >= 30) && (lv[player] <= 60)) {
-							wait1[player] = wait1_orimaster_tbl[(lv[player] - 30) / 3];
-							wait2[player] = wait2_orimaster_tbl[(lv[player] - 30) / 3];
-							wait3[player] = wait3_orimaster_tbl[(lv[player] - 30) / 3];
-							waitt[player] = waitt_orimaster_tbl[(lv[player] - 30) / 3];
-						}
-						bgfadesw = 1;
-						if((fadelv[player] != 0) && (!ending[player])) {
-							bgmlv++;
-							changeBGM(player);
-						}
-					}
-				}
-			}else if(ori_opt[player]==3){
-			sp[player] = 1200;
-				if( (!ending[player]) && (lv[player] % 3 == 0) ) {
-					PlaySE(WAVE_SE_LEVELUP);
-					if(lv[player] <= 30) {		// LV40まで #1.60c7j5 LV30まで #1.60c7j7
-						wait1[player] = wait1_oridevil_tbl[lv[player] / 3];
-						wait2[player] = wait2_oridevil_tbl[lv[player] / 3];
-						wait3[player] = wait3_oridevil_tbl[lv[player] / 3];
-						waitt[player] = waitt_oridevil_tbl[lv[player] / 3];
-
-						if(grade[player] < 13)
-							grade[player] = lv[player] / 3; // Grade設定 #1.60c7j7
-					}
-					bgfadesw = 1;
-						if((fadelv[player] != 0) && (!ending[player])) {
-							bgmlv++;
-							changeBGM(player);
-						}
-//					APP_PlayWave(WAVE_SE_RANKUP);
+			if(!ending[player]) {
+				applySpeedStep(player, lv[player]);
+				if((ori_opt[player] == 3) && (lv[player] % 3 == 0) && (lv[player] <= 30)) {	// LV30まで #1.60c7j7
+					if(grade[player] < 13)
+						grade[player] = lv[player] / 3; // Grade設定 #1.60c7j7
 				}
+			} else if(ori_opt[player] == 3) {
+				// DEVILはスタッフロール中でも速度だけは戻す
+				sp[player] = getSpeedStep(schedule, lv[player])->gravity;
 			}
 		}
 	} else{
-		// 他のモードではレベルアップ音だけ鳴らす
+		// ビギナーモードと他のモード (他のモードではレベルアップ音だけ鳴らす)
 		if(tc[player] / 10 > tgmRank[player]) {
 			tgmRank[player]++;
 			recSectionTime(player);
 
-			if( (!ending[player]) && (tgmRank[player] % 10 == 0) ) {
-				PlaySE(WAVE_SE_LEVELUP);
-			}
+			// スタッフロールでないならスピード値とwait値を変える #1.60c7j8
+			if(!ending[player]) applySpeedStep(player, tgmRank[player]);
 		}
 	}
 }
-
 /* ラップタイムとスプリットタイム記録（#1.60c7j7 〜） */
 //LevelUpから独立 #1.60c7j8
 void recSectionTime(int32_t player) {
@@ -9981,9 +9249,9 @@ void statGameOver(int32_t player) {
 					c = fld[j + block * 10 + player * 220];
 					if(c != 0) {
 						if((c >= 9) || (c < 0))
-							fld[j + block * 10 + player * 220] = 10;
+							setFieldBlock(j + block * 10 + player * 220, 10);
 						else
-							fld[j + block * 10 + player * 220] = 1;
+							setFieldBlock(j + block * 10 + player * 220, 1);
 					}
 				}
 			} else {
@@ -10010,10 +9278,11 @@ void statGameOver(int32_t player) {
 // Big対応 waitの扱いを忠実にした#1.60c7 バグ取り #1.60c7b
 void statEraseBlock(int32_t player) {
 	int32_t		i, k, l, x, y, ty, lines, wait, hardblock,hardblock2,tmp_s[2];
+	const RulesProfile *rules = getRulesProfile();
 	hardblock = 0;
 	hardblock2 = 0;
 
-	if(repversw >= 17) padRepeat(player);	// #1.60c7s6
+	if(rules->erasePadRepeat) padRepeat(player);	// #1.60c7s6
 
 	if(ace_irs) doIRS2(player);	// ACE式IRS C7U1.5
 
@@ -10033,8 +9302,8 @@ void statEraseBlock(int32_t player) {
 //	UpLineBlockJudge(player);
 
 	// ↓を離している場合、下入れ制限解除#1.60c7n6
-	if((!getPressState(player, 1-(1* ((isUDreverse[player]) && (repversw>=44)) ))) && (repversw >= 10)) down_flag[player] = 0;
-	if(!getPressState(player, 0+(1*((isUDreverse[player]) && (repversw>=44)) ))) up_flag[player] = 0;
+	if((!getPressState(player, 1-(1* ((isUDreverse[player]) && (rules->udReverseFlags)) ))) && (rules->releaseDownFlag)) down_flag[player] = 0;
+	if(!getPressState(player, 0+(1*((isUDreverse[player]) && (rules->udReverseFlags)) ))) up_flag[player] = 0;
 
 	if(statusc[player * 10] < wait) {
 		y = fldsizeh[player];
@@ -10054,7 +9323,7 @@ void statEraseBlock(int32_t player) {
 						if (tomoyo_domirror[0] && (player == 0) && (tomoyo_ehfinal_c[0] > 219))
 							objectCreate(player, 1, (x + 15 + 24 * 1 - 12 * maxPlay) * 8, (i + 3) * 8, (x - 5) * 120 + 20 - SDL_rand(40), -1900 + SDL_rand(150) + lines * 250, fld[x + i * 10 + player * 220], 100);
 					}
-					fld[x + i * 10 + player * 220] = 0;
+					setFieldBlock(x + i * 10 + player * 220, 0);
 					fldt[x + i * 10 + player * 220] = 0;	// #1.60c7j5
 
 				} else {
@@ -10127,10 +9396,10 @@ void statEraseBlock(int32_t player) {
 						}
 
 						if(!hardblock){
-							fld[x + i * 10 + player * 220] = 0;
+							setFieldBlock(x + i * 10 + player * 220, 0);
 							fldt[x + i * 10 + player * 220] = 0;	// #1.60c7j5
 							grayoutLackedBlock(player, flds[x + i * 10 + player * 220]);
-							flds[x + i * 10 + player * 220] = 0;
+							setFieldSquare(x + i * 10 + player * 220, 0);
 						}
 						hardblock = 0;
 						fldi[x + i * fldsizew[player] + player * 220] = 0;	// #1.60c7n1
@@ -10140,7 +9409,7 @@ void statEraseBlock(int32_t player) {
 					if(ty == 0) ty = i * (IsBig[player] + 1);
 
 					tomoyoCheckStageClear(player);	//ステージクリア判定 #1.60c7l8
-					if((item[player] != 0) && (item[player] != fldihardno) && (repversw >= 55))
+					if((item[player] != 0) && (item[player] != fldihardno) && (rules->tomoyoItemWait))
 						item_waiting[player] = item[player];
 				}
 			}
@@ -10165,7 +9434,7 @@ void statEraseBlock(int32_t player) {
 		} else if(statusc[player * 10] == 0) {
 			// BIGモードの場合、消去ライン数を2で割る #1.60c7m6
 			if( (IsBig[player]) && (BigMove[player] == 1) && (lines >= 2) ) lines = lines / 2;
-			if((tspin_flag[player] == 2) && (lines > 3) && (repversw >= 59)) lines = 3;
+			if((tspin_flag[player] == 2) && (lines > 3) && (rules->tspinLineLimit)) lines = 3;
 
 			if((lines < 4) && (tspin_flag[player] < 2)){	//Back to Back終了
 				b_to_b_flag[player]=0;
@@ -10323,7 +9592,7 @@ void statEraseBlock(int32_t player) {
 					b_to_b_flag[player]=lines+1; //Back to Back判定開始
 					if (heboGB[player]>0)      // old stlye hass no back to back
 						b_to_b_flag[player]=0; // turn it back off, it's not scored anyway.
-					if ((gameMode[player]==9)&& (repversw>65))   // in simple, t-spins DON'T give back to back, only Heboris!  but works with hold replays.
+					if ((gameMode[player]==9)&& (rules->simpleTspinNoB2B))   // in simple, t-spins DON'T give back to back, only Heboris!  but works with hold replays.
 						b_to_b_flag[player]=0; // this chang actually make t-spins better
 				}
 				else{ //B to B T-Spin erase
@@ -10337,7 +9606,7 @@ void statEraseBlock(int32_t player) {
 		}
 	}
 
-	if(statusc[player * 10] >= wait2[player] + (repversw < 27)) {
+	if(statusc[player * 10] >= wait2[player] + rules->lineDelayAdd) {
 		y = fldsizeh[player];
 		lines = 0;
 
@@ -10345,21 +9614,21 @@ void statEraseBlock(int32_t player) {
 			if(erase[y + player * 22]) {
 				for(k = y; k > 0; k--) {
 					for(l = 0; l < fldsizew[player]; l++) {
-						fld[l + k * fldsizew[player] + player * 220] = fld[l + (k - 1) * fldsizew[player] + player * 220];
+						setFieldBlock(l + k * fldsizew[player] + player * 220, fld[l + (k - 1) * fldsizew[player] + player * 220]);
 						// #1.60c7j5
 						fldt[l + k * fldsizew[player] + player * 220] = fldt[l + (k - 1) * fldsizew[player] + player * 220];
 						// #1.60c7n1
 						fldi[l + k * fldsizew[player] + player * 220] = fldi[l + (k - 1) * fldsizew[player] + player * 220];
-						flds[l + k * fldsizew[player] + player * 220] = flds[l + (k - 1) * fldsizew[player] + player * 220];
+						setFieldSquare(l + k * fldsizew[player] + player * 220, flds[l + (k - 1) * fldsizew[player] + player * 220]);
 
 					}
 					erase[k + player * 22] = erase[(k - 1) + player * 22];
 				}
 				for(l = 0; l < fldsizew[player]; l++) {
-					fld[l + player * 220] = 0;
+					setFieldBlock(l + player * 220, 0);
 					fldt[l + player * 220] = 0;		// #1.60c7j5
 					fldi[l + player * 220] = 0;		// #1.60c7n1
-					flds[l + player * 220] = 0;
+					setFieldSquare(l + player * 220, 0);
 
 				}
 				erase[player * 22] = 0;
@@ -10407,7 +9676,7 @@ void statEraseBlock(int32_t player) {
 		}
 		statusc[player * 10]++;
 	}
-	if((repversw >= 55) && (ending[player] == 4) && (gameMode[player] != 8)){
+	if((rules->endingCheer) && (ending[player] == 4) && (gameMode[player] != 8)){
 		PlaySE(WAVE_SE_CHEER);
 		status[player] = 13;
 		for(i = 0; i < 10; i++) statusc[i + player * 10] = 0;
@@ -10424,8 +9693,8 @@ void grayoutLackedBlock(int32_t player, int32_t no) {
 	for(j = 0; j < 22; j++) {
 		for(i = 0; i < fldsizew[player]; i++) {
 			if((fld[i + j * 10 + player * 220] >= 1)&&  (flds[i + j * 10 + player * 220] == no)) {
-				flds[i + j * 10 + player * 220] = 0;	// 破片にする
-				if(squaremode[player]) fld[i + j * 10 + player * 220] = 1;	// 灰色ブロックにする
+				setFieldSquare(i + j * 10 + player * 220, 0);	// 破片にする
+				if(squaremode[player]) setFieldBlock(i + j * 10 + player * 220, 1);	// 灰色ブロックにする
 			}
 		}
 	}
@@ -10439,11 +9708,11 @@ void grayoutAllBlock(int32_t player) {
 	for(j = 0; j < 22; j++) {
 		for(i = 0; i < fldsizew[player]; i++) {
 			if(fld[i + j * 10 + player * 220] >= 1) {
-				flds[i + j * 10 + player * 220] = 0;	// 破片にする
+				setFieldSquare(i + j * 10 + player * 220, 0);	// 破片にする
 				if((fldi[i + j * 10 + player * 220] == fldigsno) || (fldi[i + j * 10 + player * 220] == fldisno)){
 					fldi[i + j * 10 + player * 220] = 0;	//正方形解除
 				}
-				if(squaremode[player]) fld[i + j * 10 + player * 220] = 1;	// 灰色ブロックにする
+				if(squaremode[player]) setFieldBlock(i + j * 10 + player * 220, 1);	// 灰色ブロックにする
 			}
 		}
 	}
@@ -10503,12 +9772,80 @@ int32_t checkSquare(int32_t player, int32_t x, int32_t y, int32_t gold) {
 }
 
 // 正方形を作る
+#ifdef APP_REPLAY_BENCHMARK
+// ベンチマークでは、前回から変わったマスの周りだけ調べた結果が
+// 全部の位置を調べた結果と同じか確かめる
+// The full scan runs on flds directly, as the field summary only has to
+// track the gated scan's writes, then the field is put back as it was.
+static int32_t expectedSquareResult, expectedSquareCount;
+static int32_t expectedFlds[220], expectedFldi[220];
+
+static void makeSquareFullScan(int32_t player) {
+	int32_t i, j, k, l, savedFlds[220], savedFldi[220];
+
+	SDL_memcpy(savedFlds, &flds[player * 220], sizeof(savedFlds));
+	SDL_memcpy(savedFldi, &fldi[player * 220], sizeof(savedFldi));
+	expectedSquareResult = 0;
+	expectedSquareCount = squarecnt[player];
+
+	for(i = 0; i < 22 - 3; i++) {
+		for(j = 0; j < 10 - 3; j++) {
+			if(checkSquare(player, j, i, 1)) {
+				if(expectedSquareResult < 2) expectedSquareResult = 2;
+				expectedSquareCount += 2;
+				for(k = 0; k < 4; k++)
+					for(l = 0; l < 4; l++) {
+						fldi[(k + j) + (l + i) * 10 + player * 220] = fldigsno;
+						flds[(k + j) + (l + i) * 10 + player * 220] = -1;
+					}
+			} else if(checkSquare(player, j, i, 0)) {
+				if(expectedSquareResult < 1) expectedSquareResult = 1;
+				expectedSquareCount++;
+				for(k = 0; k < 4; k++)
+					for(l = 0; l < 4; l++) {
+						fldi[(k + j) + (l + i) * 10 + player * 220] = fldisno;
+						flds[(k + j) + (l + i) * 10 + player * 220] = -1;
+					}
+			}
+		}
+	}
+
+	SDL_memcpy(expectedFlds, &flds[player * 220], sizeof(expectedFlds));
+	SDL_memcpy(expectedFldi, &fldi[player * 220], sizeof(expectedFldi));
+	SDL_memcpy(&flds[player * 220], savedFlds, sizeof(savedFlds));
+	SDL_memcpy(&fldi[player * 220], savedFldi, sizeof(savedFldi));
+}
+
+static void checkSquareScan(int32_t player, int32_t result) {
+	if(
+		(result == expectedSquareResult) && (squarecnt[player] == expectedSquareCount) &&
+		!SDL_memcmp(expectedFlds, &flds[player * 220], sizeof(expectedFlds)) &&
+		!SDL_memcmp(expectedFldi, &fldi[player * 220], sizeof(expectedFldi))
+	) return;
+
+	APP_SetError(
+		"makeSquare() differs from the full scan for player %d (result %d, expected %d; count %d, expected %d)",
+		(int)player + 1, (int)result, (int)expectedSquareResult, (int)squarecnt[player], (int)expectedSquareCount
+	);
+	APP_Exit(SDL_APP_FAILURE);
+}
+#endif
+
 int32_t makeSquare(int32_t player) {
 	int32_t i, j, k, l, result;
 	result = 0;
 
+#ifdef APP_REPLAY_BENCHMARK
+	makeSquareFullScan(player);
+#endif
+
+	// 前回から変わったマスの周りだけ調べる
+	beginSquareCheck(player);
+
 	for(i = 0; i < 22 - 3; i++) {
 		for(j = 0; j < 10 - 3; j++) {
+			if(!isSquareCheckNeeded(player, j, i)) continue;
+
 			if(checkSquare(player, j, i, 1)) {
 				// 金色
 				if(result < 2) result = 2;
@@ -10518,7 +9855,7 @@ int32_t makeSquare(int32_t player) {
 				for(k = 0; k < 4; k++) {
 					for(l = 0; l < 4; l++) {
 						fldi[(k + j) + (l + i) * 10 + player * 220] = fldigsno;//定数
-						flds[(k + j) + (l + i) * 10 + player * 220] = -1;
+						setFieldSquare((k + j) + (l + i) * 10 + player * 220, -1);
 					}
 				}
 			} else if(checkSquare(player, j, i, 0)) {
@@ -10530,13 +9867,17 @@ int32_t makeSquare(int32_t player) {
 				for(k = 0; k < 4; k++) {
 					for(l = 0; l < 4; l++) {
 						fldi[(k + j) + (l + i) * 10 + player * 220] = fldisno;
-						flds[(k + j) + (l + i) * 10 + player * 220] = -1;
+						setFieldSquare((k + j) + (l + i) * 10 + player * 220, -1);
 					}
 				}
 			}
 		} /* for(j = 0; j < 6; j++) */
 	} /* for(i = 0; i < 18; i++) */
 
+#ifdef APP_REPLAY_BENCHMARK
+	checkSquareScan(player, result);
+#endif
+
 	return result;
 }
 // 正方形用
@@ -10553,7 +9894,8 @@ int32_t isComboMode(int32_t player){
 }
 /* スコア計算 #1.60c7j9 */
 void calcScore(int32_t player, int32_t lines) {
-	int32_t		i, j, k, l, x, y, bo[2], bai, all[2], tcbuf = 0,btmup;
+	int32_t		i, j, k, l, x, y, bo[2] = {0, 0}, bai, all[2], tcbuf = 0,btmup;
+	const RulesProfile *rules = getRulesProfile();
 
 		/* 全消し処理 */
 		all[player] = 1;
@@ -10622,9 +9964,9 @@ void calcScore(int32_t player, int32_t lines) {
 		}
 
 					/* スコア計算 */
-			if(((rotspl[player] == 3) || (rotspl[player] == 4) || (rotspl[player] == 5) || (rotspl[player] == 6)) && (repversw >= 20))
+			if(((rotspl[player] == 3) || (rotspl[player] == 4) || (rotspl[player] == 5) || (rotspl[player] == 6)) && (rules->slowDropHalfBonus))
 				qdrop[player] = qdrop[player] / 2;		//高速落下速度の遅いルールは、ドロップボーナス半減
-			if(((rotspl[player] == 7) || (rotspl[player] == 8)) && (repversw >= 45))
+			if(((rotspl[player] == 7) || (rotspl[player] == 8)) && (rules->fastDropBonus))
 				qdrop[player] = qdrop[player] + (qdrop[player] / 2);		//高速落下速度が速いルールは、ドロップボーナス5割増
 
 			bai = 1 + ( sp[player] >= 20 ) + ( sp[player] >= 60 ) + ( sp[player] >= 240 ) + ( sp[player] >= 600 );
@@ -10636,9 +9978,9 @@ void calcScore(int32_t player, int32_t lines) {
 			li[player] = li[player] + lines;
 		if((gameMode[player]==7)&&(anothermode[player]==3)){
 					/* スコア計算 */
-			if(((rotspl[player] == 3) || (rotspl[player] == 4) || (rotspl[player] == 5) || (rotspl[player] == 6)) && (repversw >= 20))
+			if(((rotspl[player] == 3) || (rotspl[player] == 4) || (rotspl[player] == 5) || (rotspl[player] == 6)) && (rules->slowDropHalfBonus))
 				qdrop[player] = qdrop[player] / 2;		//高速落下速度の遅いルールは、ドロップボーナス半減
-			if(((rotspl[player] == 7) || (rotspl[player] == 8)) && (repversw >= 45))
+			if(((rotspl[player] == 7) || (rotspl[player] == 8)) && (rules->fastDropBonus))
 				qdrop[player] = qdrop[player] + (qdrop[player] / 2);		//高速落下速度が速いルールは、ドロップボーナス5割増
 			sc[player]=sc[player] + sdrop[player] + qdrop[player];
 			if(lines==1)bo[player] = 100;
@@ -10679,9 +10021,9 @@ void calcScore(int32_t player, int32_t lines) {
 	} else if( gameMode[player] != 6 ) {
 		if( gameMode[player] != 4 ) {
 			/* スコア計算 */
-			if(((rotspl[player] == 3) || (rotspl[player] == 4) || (rotspl[player] == 5) || (rotspl[player] == 6)) && (repversw >= 20))
+			if(((rotspl[player] == 3) || (rotspl[player] == 4) || (rotspl[player] == 5) || (rotspl[player] == 6)) && (rules->slowDropHalfBonus))
 				qdrop[player] = qdrop[player] / 2;		//高速落下速度の遅いルールは、ドロップボーナス半減
-			if(((rotspl[player] == 7) || (rotspl[player] == 8)) && (repversw >= 45))
+			if(((rotspl[player] == 7) || (rotspl[player] == 8)) && (rules->fastDropBonus))
 				qdrop[player] = qdrop[player] + (qdrop[player] / 2);		//高速落下速度が速いルールは、ドロップボーナス5割増
 			bo[player] = (tc[player] + lines) / 4 + sdrop[player] + qdrop[player];
 			bai = (lines * 2 - 1 + cmbpts[player] - (lines * 2 - 2)) * lines;
@@ -10717,7 +10059,7 @@ void calcScore(int32_t player, int32_t lines) {
 			}
 
 			/* ライン加算 */
-			if((!ismiss[player]) || (repversw < 62)){
+			if((!ismiss[player]) || (rules->missLineScore)){
 				sc[player] = sc[player] + bo[player]*bai;
 				li[player] = li[player] + lines;
 
@@ -10820,7 +10162,7 @@ void calcScore(int32_t player, int32_t lines) {
 		if(disrise)//せりあがり禁止
 			upLines[1 - player] = 0;
 		if((!noitem) && (disrise)){		//アイテムオンリーではゲージ上昇
-			item_g[player] = item_g[player] + lines * (1 + ((tspin_flag[player] == 2) && (repversw >= 62)));
+			item_g[player] = item_g[player] + lines * (1 + ((tspin_flag[player] == 2) && (rules->tspinItemGauge)));
 			if(item_g[player] > item_inter[player])
 				item_g[player] = item_inter[player];
 		}
@@ -10883,7 +10225,7 @@ void calcScore(int32_t player, int32_t lines) {
 		}
 		upLines_waiting[1 - player] = 0;
 		if((!noitem) && (disrise)){		//アイテムオンリーではゲージ上昇
-			item_g[player] = item_g[player] + lines * (1 + ((tspin_flag[player] == 2) && (repversw >= 62)));
+			item_g[player] = item_g[player] + lines * (1 + ((tspin_flag[player] == 2) && (rules->tspinItemGauge)));
 			if(item_g[player] > item_inter[player])
 				item_g[player] = item_inter[player];
 		}
@@ -10916,7 +10258,7 @@ void calcScore(int32_t player, int32_t lines) {
 		// tgmカウンタ ライン分上昇(3, 4列消しでボーナス加算) #1.60c
 		// レベルアップボーナスがTIの場合のみプラスする #1.60c7g3
 
-		if(repversw >= 50){
+		if(rules->lvupBonusAuto){
 			if(lvupbonus==2){//自動調整
 				if(novice_mode[player]||( ((gameMode[player]==1)||(gameMode[player]==2)) &&(enable_grade[player]!=4))
 				||(devil_minus[player])){tc[player] = tc[player] + lines;
@@ -10932,15 +10274,15 @@ void calcScore(int32_t player, int32_t lines) {
 				tc[player] = tc[player] + lines+ ((lines > 2) * (lines - 2));	// tgmカウンタ ライン分上昇
 
 		}
-		if((ismiss[player]) && (repversw >= 62)) tc[player] = tcbuf;
+		if((ismiss[player]) && (!rules->missLevelUp)) tc[player] = tcbuf;
 
 		if((!fpbas_mode[player])&&(gameMode[player]<=6)) lv[player] = tc[player];
 
 		// レベルストップ音を鳴らす #1.60c7j8
-		if((gameMode[player] == 4) && (repversw >= 61) && (wintype==0) && (vs_goal != 0)){
+		if((gameMode[player] == 4) && (rules->vsGoalStop) && (wintype==0) && (vs_goal != 0)){
 			if(tc[player] == vs_goal - 1) PlaySE(WAVE_SE_LVSTOP);
 		}else if((!fpbas_mode[player])&&(gameMode[player]<=6)) {
-			if((repversw > 4) && (gameMode[player] >= 3))
+			if((rules->levelStop99) && (gameMode[player] >= 3))
 				i = 99;
 			else
 				i = 99 -  (tc[player] > 900);
@@ -10958,6 +10300,7 @@ void calcScore(int32_t player, int32_t lines) {
 
 /* エンディング突入判定 */
 void checkEnding(int32_t player, int32_t tcbuf) {
+	const RulesProfile *rules = getRulesProfile();
 
 	// MASTERと20GではTGMレベルが999に達したらフラグON
 	if((gameMode[player] >= 1) && (gameMode[player] <= 2) && (tc[player] >= 999)) {
@@ -10999,7 +10342,7 @@ void checkEnding(int32_t player, int32_t tcbuf) {
 		tc[player] = 999;
 		lv[player] = tc[player];
 		timeOn[player] = 0;
-		if((enable_grade[player] == 1) || ((hebo_plus[player]) && (repversw >= 58))){
+		if((enable_grade[player] == 1) || ((hebo_plus[player]) && (rules->heboPlusRoll))){
 			ending[player] = 6;
 		}else {
 			ending[player] = 1;
@@ -11010,13 +10353,13 @@ void checkEnding(int32_t player, int32_t tcbuf) {
 		// スタッフロール用wait値セット#1.60c7j5
 		sp[player] = speed_master_roll;
 
-		if(((repversw > 24)&&(enable_grade[player] == 1))||((hebo_plus[player]==1)&&(repversw>=34)&&(repversw<42)&&(gameMode[player] ==1))){
+		if(((rules->grade1BeginnerRoll)&&(enable_grade[player] == 1))||((hebo_plus[player]==1)&&(rules->heboPlusBeginnerRoll)&&(gameMode[player] ==1))){
 			//特別なモードの時はかえない
 			wait1[player] = wait1_beginner_roll;
 			wait2[player] = wait2_beginner_roll;
 			wait3[player] = wait3_beginner_roll;
 			waitt[player] = waitt_beginner_roll;
-		}else if(repversw <= 38) {//38まで
+		}else if(rules->masterRoll38) {//38まで
 			wait1[player] = wait1_master_roll38;
 			wait2[player] = wait2_master_roll38;
 			wait3[player] = wait3_master_roll38;
@@ -11086,7 +10429,7 @@ void checkEnding(int32_t player, int32_t tcbuf) {
 			bgfadesw = 1;
 		}
 	// DEVIL-なら1000で終了させる#1.60c7u0.9
-	} else if((((enable_grade[player] == 1) && (repversw < 42)) || (devil_minus[player]))&&(gameMode[player] == 3)&&(repversw >= 31) && (tc[player] >= 1000)) {
+	} else if(isDevilMinusWaits(player) && (tc[player] >= 1000)) {
 
 		//APP_PlayWave(WAVE_SE_TTCLEAR);
 		tc[player] = 1000;
@@ -11097,11 +10440,8 @@ void checkEnding(int32_t player, int32_t tcbuf) {
 		ending[player] = 6;
 		end_f[player] = 0;//ラインなし
 		// スタッフロール用wait値セット#1.60c7j5
-		if(repversw >= 54){
-			wait1[player] = wait1_devil_tbl[8];
-			wait2[player] = wait2_devil_tbl[8];
-			wait3[player] = wait3_devil_tbl[8];
-			waitt[player] = waitt_devil_tbl[8];
+		if(rules->devilEndWaits){
+			setWaits(player, &devilWaits, 8);
 		}
 	// DEVILなら1300で終了させる#1.60c7f3
 	} else if((gameMode[player] == 3) && (tc[player] >= 1300)) {
@@ -11125,19 +10465,19 @@ void checkEnding(int32_t player, int32_t tcbuf) {
 		end_f[player] = 1;
 
 		// スタッフロール用wait値セット#1.60c7j5
-		if(repversw >= 57){
+		if(rules->devilRollWaits == DEVIL_ROLL_WAITS_LATEST){
 			sp[player] = speed_devil_roll;
 			wait1[player] = wait1_devil_roll;
 			wait2[player] = wait2_devil_roll;
 			wait3[player] = wait3_devil_roll;
 			waitt[player] = waitt_devil_roll;
-		}else if(repversw >= 39){
+		}else if(rules->devilRollWaits == DEVIL_ROLL_WAITS_56){
 			sp[player] = speed_devil_roll;
 			wait1[player] = wait1_devil_roll56;
 			wait2[player] = wait2_devil_roll56;
 			wait3[player] = wait3_devil_roll56;
 			waitt[player] = waitt_devil_roll56;
-		}else if(repversw>18){
+		}else if(rules->devilRollWaits == DEVIL_ROLL_WAITS_38){
 			sp[player] = speed_devil_roll;
 			wait1[player] = wait1_devil_roll38;
 			wait2[player] = wait2_devil_roll38;
@@ -11152,11 +10492,11 @@ void checkEnding(int32_t player, int32_t tcbuf) {
 		}
 
 		// このバージョンから強制BIG化#1.60c7h5
-		if(repversw > 4) {
+		if(rules->devilRollBig) {
 			IsBig[player] = 1;
 		}
 		// DEVIL-の500で終了させる#1.60c7v0
-	} else if(  (devil_minus[player])&&(gameMode[player] == 3)&&(repversw >= 52) && (tc[player] >= 500) && (tcbuf < 500) &&
+	} else if(  (devil_minus[player])&&(gameMode[player] == 3)&&(rules->devilMinus500) && (tc[player] >= 500) && (tcbuf < 500) &&
 			( ((gametime[player] > timelimitm[player]) && (timelimitm[player] > 0) && ( !isWRule(player) )) ||	// TGM,Ti
 			  ((gametime[player] > timelimitmw[player]) && (timelimitmw[player] > 0) && (isWRule(player) )) )  ) {
 
@@ -11166,11 +10506,8 @@ void checkEnding(int32_t player, int32_t tcbuf) {
 		timeOn[player] = 0;
 		ending[player] = 6;
 		end_f[player] = 0;//ラインなし
-		if(repversw >= 54){
-			wait1[player] = wait1_devil_m_tbl[8];
-			wait2[player] = wait2_devil_m_tbl[8];
-			wait3[player] = wait3_devil_m_tbl[8];
-			waitt[player] = waitt_devil_m_tbl[8];
+		if(rules->devilEndWaits){
+			setWaits(player, &devilMinusWaits, 8);
 		}
 	// 500で足きり#1.60c7g7
 	} else if(((gameMode[player] == 1) || (gameMode[player] == 2)) && //マスター20G
@@ -11758,6 +11095,7 @@ void statNameEntry(int32_t player) {
 //▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
 void statEnding(int32_t player) {
 	int32_t	i, j, k;
+	const RulesProfile *rules = getRulesProfile();
 //SDL_snprintf(string[0], STRING_LENGTH,"END %2d %2d",ending[player],gameMode[player]);
 //printFont(0, 0, string[0], (count % 4 / 2) * digitc[rots[i]]);
 	if ( (ending[player] == 1) || (ending[player] == 4) ){
@@ -11771,7 +11109,7 @@ bgmteisiflg = 1;
 }
 //SDL_snprintf(string[0], STRING_LENGTH,"-STOP- %2d %2d",ending[player],gameMode[player]);
 //printFont(0, 1, string[0], (count % 4 / 2) * digitc[rots[i]]);
-		if((onRecord[player]) && (repversw >= 59)) padRepeat(player);
+		if((onRecord[player]) && (rules->endingPadRepeat)) padRepeat(player);
 
 		//上に移動
 		if((gameMode[player] == 6) && (stage[player] == 199)){
@@ -11792,18 +11130,17 @@ bgmteisiflg = 1;
 					objectCreate(player, 1, (i + 15 + 24 * 1 - 12 * maxPlay) * 8, (j + 3) * 8, (i - 5) * 120 + 20 - SDL_rand(40), -1900 + SDL_rand(150) + 1 * 250, fld[i + j * fldsizew[player] + player * 220], 100);
 				}
 
-				fld[i+ j * fldsizew[player] + player * 220] = 0;
+				setFieldBlock(i+ j * fldsizew[player] + player * 220, 0);
 				fldt[i+ j * fldsizew[player] + player * 220] = 0;		// #1.60c7j5
 				fldi[i+ j * fldsizew[player] + player * 220] = 0;		// #1.60c7n1
-				flds[i+ j * fldsizew[player] + player * 220] = 0;		// #1.60c7n1
+				setFieldSquare(i+ j * fldsizew[player] + player * 220, 0);		// #1.60c7n1
 			}
 			}
 		}
 
 		// アニメ終了
 		if(statusc[player * 10] == 132) {
-			if(repversw >= 33) edrec[player] = 125;
-			else edrec[player] = 123;
+			edrec[player] = rules->rollStartEdrec;
 			if(ending[player] ==1) {
 				// TOMOYOクリア #1.60c7l9
 				if(gameMode[player] >= 6) {
@@ -11811,7 +11148,7 @@ bgmteisiflg = 1;
 					ending[player] = 3;
 					if((gameMode[player] == 6) && (stage[player] == 44) && (!t_training[player])){
 						// スタッフロール開始
-						if(repversw >= 40){
+						if(rules->tomoyoStaffRoll){
 							sp[player] = 1200;
 							wait1[player] = wait1_master_rollG4;
 							wait2[player] = wait2_master_rollG4;
@@ -11834,7 +11171,7 @@ bgmteisiflg = 1;
 						if(mission_end[c_mission] >= 5)
 							hidden[player] = 8;
 						if(mission_end[c_mission] == 6){
-							if(repversw >= 57){
+							if(rules->devilRollWaits == DEVIL_ROLL_WAITS_LATEST){
 								sp[player] = speed_devil_roll;
 								wait1[player] = wait1_devil_roll;
 								wait2[player] = wait2_devil_roll;
@@ -11869,7 +11206,7 @@ fadelv[player] = 0;
 fadelv[player] = 0;
 //SDL_snprintf(string[0], STRING_LENGTH,"-3- %2d %2d PLAY56",ending[player],gameMode[player]);
 //printFont(0, 4, string[0], (count % 4 / 2) * digitc[rots[i]]);
-					if((repversw<=23)||(enable_grade[player]!=1)){
+					if((!rules->grade1PlainRoll)||(enable_grade[player]!=1)){
 						if((gameMode[player] >= 1) && (gameMode[player] <= 2) && (hidden[player] != 8)) {
 							if((enable_grade[player]==4)&&(grade[player]>=23)){
 								hidden[player]=10;//ちょっと早く消える
@@ -11898,7 +11235,7 @@ fadelv[player] = 0;
 fadelv[player] = 0;
 		bgmteisiflg = 0;
 		status[player] = 4;
-		if(repversw >= 54) statBlock(player);
+		if(rules->rollStartBlock) statBlock(player);
 	}
 	else if ( ending[player] == 3 )
 	{
@@ -12050,10 +11387,10 @@ fadelv[player] = 0;
 			}
 		}
 	}else if ( ending[player] == 6 ){//そのままロール突入
-		if(repversw <= 49){
+		if(rules->rollAnimation){
 			ending[player] =1;
 		}
-		if((gameMode[player]!=1) || ((hebo_plus[player]) && (repversw >= 58))){//MASTER以外高速化
+		if((gameMode[player]!=1) || ((hebo_plus[player]) && (rules->heboPlusRoll))){//MASTER以外高速化
 			fastroll[player]=1;
 		}
 		if(!gameMode[player]){//ボーナスの文字表示
@@ -12102,10 +11439,10 @@ fadelv[player] = 0;
 					objectCreate(player, 1, (i + 15 + 24 * player - 12 * maxPlay) * 8,(j + 3) * 8, (i - 5) * 120 + 20 - SDL_rand(40), - 1900 + SDL_rand(150) + 1 * 250, fld[i+ j * fldsizew[player] + player * 220], 100);
 				}
 
-				fld[i+ j * fldsizew[player] + player * 220] = 0;
+				setFieldBlock(i+ j * fldsizew[player] + player * 220, 0);
 				fldt[i+ j * fldsizew[player] + player * 220] = 0;		// #1.60c7j5
 				fldi[i+ j * fldsizew[player] + player * 220] = 0;		// #1.60c7n1
-				flds[i+ j * fldsizew[player] + player * 220] = 0;		// #1.60c7n1
+				setFieldSquare(i+ j * fldsizew[player] + player * 220, 0);		// #1.60c7n1
 				}
 			}
 		}
@@ -13164,14 +12501,14 @@ void winner() {
 			}else if(!playback){
 				for(i = 0; i < 10; i++)
 					for(j = 0; j < 22; j++) {
-						fld[i + j * 10 + 0 * 220] = 0;
+						setFieldBlock(i + j * 10 + 0 * 220, 0);
 						fldt[i + j * 10 + 0 * 220] = 0;
 						fldi[i + j * 10 + 0 * 220] = 0;
-						flds[i + j * 10 + 0 * 220] = 0;
-						fld[i + j * 10 + 1 * 220] = 0;
+						setFieldSquare(i + j * 10 + 0 * 220, 0);
+						setFieldBlock(i + j * 10 + 1 * 220, 0);
 						fldt[i + j * 10 + 1 * 220] = 0;
 						fldi[i + j * 10 + 1 * 220] = 0;
-						flds[i + j * 10 + 1 * 220] = 0;
+						setFieldSquare(i + j * 10 + 1 * 220, 0);
 					}
 				status[0] = 38;	// 1Pはりプレイ保存画面へ
 				statusc[0] = 0;
@@ -13215,9 +12552,9 @@ void winner() {
 								c = fld[j + block * 10 + player * 220];
 								if(c != 0) {
 									if(c >= 9)
-										fld[j + block * 10 + player * 220] = 10;
+										setFieldBlock(j + block * 10 + player * 220, 10);
 									else
-										fld[j + block * 10 + player * 220] = 1;
+										setFieldBlock(j + block * 10 + player * 220, 1);
 								}
 							}
 						} else {
@@ -13416,9 +12753,9 @@ void winner2() {
 								c = fld[j + block * 10 + player * 220];
 								if(c != 0) {
 									if(c >= 9)
-										fld[j + block * 10 + player * 220] = 10;
+										setFieldBlock(j + block * 10 + player * 220, 10);
 									else
-										fld[j + block * 10 + player * 220] = 1;
+										setFieldBlock(j + block * 10 + player * 220, 1);
 								}
 							}
 						} else {
@@ -13447,6 +12784,7 @@ void winner2() {
 void eraseItem(int32_t player, int32_t type) {
 	int32_t i, enemy, attack;
 	int32_t bx2, by2;
+	const RulesProfile *rules = getRulesProfile();
 
 	if((type <= 0) || (type >= fldihardno) || (gameMode[player] > 5)) return;
 	attack = 0;
@@ -13456,19 +12794,19 @@ void eraseItem(int32_t player, int32_t type) {
 	} else {
 		enemy = player;
 	}
-	if((type != 13) && (type != 17) && (type != 18) && (type != 19) && ((type != 26) || (repversw >= 65)) && (type != 27) &&
+	if((type != 13) && (type != 17) && (type != 18) && (type != 19) && ((type != 26) || (rules->shuffleFieldAttack)) && (type != 27) &&
 	   (type != 28) && (type != 29) && (type != 30) && (type != 32) && (type != 33) && (type != 35) &&
-	   ((type != 36) || (repversw < 58))){
+	   ((type != 36) || (!rules->missSelfItem))){
 		attack = 1;
 	}
 	// 攻撃対象のアイテムを全て解除（攻撃アイテムのみ）
 	if( attack ){
 		statusClear(enemy);
-		if((!isfever[enemy]) && (repversw >= 44)){
+		if((!isfever[enemy]) && (rules->attackItemReset)){
 			item_t[enemy] = 0;
 			item_timer[enemy] = 0;
 		}
-		if((!isfever[enemy]) && (isreflect[enemy]) && (gameMode[enemy] != 4) && (repversw >= 65) && (type != 24) && (type != 37)){
+		if((!isfever[enemy]) && (isreflect[enemy]) && (gameMode[enemy] != 4) && (rules->reflectItem) && (type != 24) && (type != 37)){
 			PlaySE(WAVE_SE_PLATINAERASE);
 			objectCreate2(enemy, 10, 1, 0, 0, 2, 33, 0);
 			isreflect[enemy] = 0;
@@ -13486,7 +12824,7 @@ void eraseItem(int32_t player, int32_t type) {
 	}
 
 	if(!isfever[enemy]){		//攻撃アイテム（FEVER中は無効）
-		if(repversw < 44){
+		if(!rules->attackItemReset){
 			item_t[enemy] = 0;
 			item_timer[enemy] = 0;
 		}
@@ -13526,7 +12864,7 @@ void eraseItem(int32_t player, int32_t type) {
 			rt_nblk[4 + 6 * enemy] = gameRand(4,enemy);
 			rt_nblk[5 + 6 * enemy] = gameRand(4,enemy);
 			thunder_timer = 30;
-			item_timer[enemy] = 600 / (1+ ((sp[enemy] >= 180) && (repversw >= 40)) );//3G以上で半減
+			item_timer[enemy] = 600 / (1+ ((sp[enemy] >= 180) && (rules->itemTimerSpeed)) );//3G以上で半減
 			if(cpu_flag[enemy]) {
 				cpuCheckBestSpot(enemy);
 			}
@@ -13536,7 +12874,7 @@ void eraseItem(int32_t player, int32_t type) {
 		//HIDE NEXT
 		if( type == 7 ) {
 			ishidenext[enemy] = 1;
-			item_timer[enemy] = 900 - ( ((sp[enemy] >= 1200) && (repversw >= 40)) * 300);
+			item_timer[enemy] = 900 - ( ((sp[enemy] >= 1200) && (rules->itemTimerSpeed)) * 300);
 		}
 		//MAGNET BLOCK
 		if( type == 8 ) {
@@ -13562,7 +12900,7 @@ void eraseItem(int32_t player, int32_t type) {
 		//BOOST FIRE
 		if( type == 12 ) {
 			isboost[enemy] = 1;
-			item_timer[enemy] = 600 / (1+ ((sp[enemy] >= 1200) && (repversw >= 54)) );
+			item_timer[enemy] = 600 / (1+ ((sp[enemy] >= 1200) && (rules->boostTimer20G)) );
 			if((gameMode[enemy] == 3) && (tc[player] >= 300))
 				item_timer[enemy] = 180 - (60 * (tc[player] >= 500));
 		}
@@ -13706,14 +13044,14 @@ void eraseItem(int32_t player, int32_t type) {
 	}
 	//REFLECT
 	if( type == 33 ) {
-		if(repversw >= 65){
+		if(rules->reflectItem){
 			statusClear(player);
 			item_t[player] = 0;
 		}
 		misstimer[player] = 0;
 		isreflect[player] = 1;
 		item_timer[player] = 600;
-		if((gameMode[player] != 4) && (repversw >= 65))
+		if((gameMode[player] != 4) && (rules->reflectItem))
 			item_timer[player] = 1800;
 	}
 	if(type == 35){
@@ -13727,9 +13065,9 @@ void eraseItem(int32_t player, int32_t type) {
 	 && ((type < 27) || (type > 30)) && (!isfever[enemy])&& (type != 32)
 	 && (type != 33) && (type != 34) && (type != 35) && (type != 36)) {
 		// 弾け飛ぶアニメーション #1.60c7o6
-		if(!((type==9) && (repversw >= 35))){
+		if(!((type==9) && (rules->timeStop))){
 			for(i = 0; i < 4; i++) {
-				if(rotspl[enemy] == 8 && ((segacheat == 2) || (heboGB[enemy] != 2) || repversw < 66)) {
+				if(rotspl[enemy] == 8 && ((segacheat == 2) || (heboGB[enemy] != 2) || !rules->segaRules)) {
 					bx2 = (bx[enemy] + blkDDataX[blk[enemy] * 16 + rt[enemy] * 4 + i]);
 					by2 = (by[enemy] + blkDDataY[blk[enemy] * 16 + rt[enemy] * 4 + i]);
 				} else if(isWRule(enemy)) {
@@ -13746,7 +13084,7 @@ void eraseItem(int32_t player, int32_t type) {
 			dhold[player] = disable_hold;		// hold使用可能に
 			statusc[enemy * 10 + 0] = 60;		// 待ち時間
 		}
-		if( (type == 9) && (repversw < 35) ) {				//TIME STOP停止時間
+		if( (type == 9) && (!rules->timeStop) ) {				//TIME STOP停止時間
 			statusc[enemy * 10 + 0] = 300;
 		}
 		if( type == 21) {	//LASER(操作中)
@@ -13812,7 +13150,7 @@ void eraseItem(int32_t player, int32_t type) {
 	}
 	// フィールド上に残っているアイテムを全て消す #1.60c7n1
 	for(i = 0; i < 220; i++) {
-		if((fldi[i + player * 220] < fldihardno) || (repversw < 32))	//ハードブロックも消えていた問題を修正 C7U1.5
+		if((fldi[i + player * 220] < fldihardno) || (!rules->hardItemKeep))	//ハードブロックも消えていた問題を修正 C7U1.5
 			fldi[i + player * 220] = 0;
 	}
 	scanItem(player);
@@ -13929,8 +13267,9 @@ void statGameOver2(int32_t player) {
 // statusc[player * 10 + 4]：↑使用時のせり上がりタイプ
 void statNothing(int32_t player) {
 	int32_t i;
+	const RulesProfile *rules = getRulesProfile();
 
-	if(repversw >= 30) padRepeat(player);
+	if(rules->itemPadRepeat) padRepeat(player);
 	if(ace_irs) doIRS2(player);	// ACE式IRS C7U1.5
 
 	statusc[player * 10 + 2]++;
@@ -13949,7 +13288,7 @@ void statNothing(int32_t player) {
 			}
 			return;
 		}
-		if(repversw >= 48){
+		if(rules->itemRiseStatus){
 			if((fmirror_cnt[player] == -20) && (gameMode[player] != 8) && (gameMode[player] >= 4))
 				if(UpLineShirase(player)) return;
 			if(fldMirrorProc(player)) return;
@@ -13969,15 +13308,16 @@ void statNothing(int32_t player) {
 // statusc[player * 10 + 2]：終了後にステージ読み込み(0=なし 1=あり）
 void statDelField(int32_t player) {
 	int32_t i, j, y,k,l,waitA;
+	const RulesProfile *rules = getRulesProfile();
 
 	statusc[player * 10]++;
 
-	if((repversw < 64) || (statusc[player * 10 + 2]))
+	if((!rules->delFieldEffect) || (statusc[player * 10 + 2]))
 		waitA = 1;
 	else
-		waitA = 9 - 4 * ((wait2[player] <= 12) && ((timeOn[player]) || (ending[player] == 2) || (repversw >= 65)) );
+		waitA = 9 - 4 * ((wait2[player] <= 12) && ((timeOn[player]) || (ending[player] == 2) || (rules->delFieldEffectFast)) );
 
-	if(repversw >= 30) padRepeat(player);
+	if(rules->itemPadRepeat) padRepeat(player);
 	if(ace_irs) doIRS2(player);	// ACE式IRS C7U1.5
 
 	if(statusc[player * 10] < 15+(wait1[player] * 2)) {
@@ -13985,16 +13325,16 @@ void statDelField(int32_t player) {
 			if(erase[i + player * 22]) {
 				if(statusc[player * 10] == wait1[player] + 1) {
 					if(i >= 2) {
-						objectCreate(player, 13, (15 + 24 * player - 12 * maxPlay) * 8, (i + 3) * 8, 0, 0, 0, ((!statusc[player * 10 + 2]) && (repversw >= 64)));
+						objectCreate(player, 13, (15 + 24 * player - 12 * maxPlay) * 8, (i + 3) * 8, 0, 0, 0, ((!statusc[player * 10 + 2]) && (rules->delFieldEffect)));
 					}
 				}
 				if(statusc[player * 10] == wait1[player] + waitA) {
 					for(j = 0; j < fldsizew[player]; j++){
-						fld[j + i * fldsizew[player] + player * 220] = 0;
+						setFieldBlock(j + i * fldsizew[player] + player * 220, 0);
 						fldt[j + i * fldsizew[player] + player * 220] = 0;
 						fldi[j + i * fldsizew[player] + player * 220] = 0;
 						grayoutLackedBlock(player, flds[j + i * 10 + player * 220]);
-						flds[j + i * fldsizew[player] + player * 220] = 0;
+						setFieldSquare(j + i * fldsizew[player] + player * 220, 0);
 					}
 				}
 			}
@@ -14015,7 +13355,7 @@ void statDelField(int32_t player) {
 				if(erase[y + player * 22]) {
 					for(k = y; k > 0; k--) {
 						for(l = 0; l < fldsizew[player]; l++) {
-							fld[l + k * fldsizew[player] + player * 220] = fld[l + (k - 1) * fldsizew[player] + player * 220];
+							setFieldBlock(l + k * fldsizew[player] + player * 220, fld[l + (k - 1) * fldsizew[player] + player * 220]);
 							// #1.60c7j5
 							fldt[l + k * fldsizew[player] + player * 220] = fldt[l + (k - 1) * fldsizew[player] + player * 220];
 							// #1.60c7n1
@@ -14025,7 +13365,7 @@ void statDelField(int32_t player) {
 						erase[k + player * 22] = erase[(k - 1) + player * 22];
 					}
 					for(l = 0; l < fldsizew[player]; l++) {
-						fld[l + player * 220] = 0;
+						setFieldBlock(l + player * 220, 0);
 						fldt[l + player * 220] = 0;		// #1.60c7j5
 						if((gameMode[player] == 4) || (item_mode[player])) fldi[l + player * 220] = 0;		// #1.60c7n1
 						erase[player * 22] = 0;
@@ -14042,7 +13382,7 @@ void statDelField(int32_t player) {
 		status[player] = statusc[player * 10 + 1];
 		statusc[player * 10] = 0;
 		statusc[player * 10 + 1] = 0;
-		if(repversw >= 48){
+		if(rules->itemRiseStatus){
 			statusc[player * 10 + 1] = status[player];
 			status[player] = 22;
 		}
@@ -14066,10 +13406,11 @@ void statDelField(int32_t player) {
 // statusc[player * 10 + 1]：終了後に移動するステータス
 // statusc[player * 10 + 2]：16tか？
 void statLaser(int32_t player) {
-	int32_t i,j,waitA,waitB;
+	int32_t i,j,waitA,waitB,squares[10];
+	const RulesProfile *rules = getRulesProfile();
 
 //	dolaser[player] = 0;
-	if(repversw < 63){
+	if(rules->oldItemWaits){
 		waitA = 120;
 		waitB = 180;
 	}else{
@@ -14133,12 +13474,8 @@ void statLaser(int32_t player) {
 					for(j = 0; j <= fldsizeh[player]; j++){
 						if(fld[laserpos[i + 4 * player] + j * fldsizew[player] + player * 220] != 0){
 							objectCreate(player, 1, (laserpos[i + 4 * player] + 15 + 24 * player - 12 * maxPlay) * 8, (j + 3) * 8, (laserpos[i + 4 * player] - 5) * 120 + 20 - SDL_rand(40), - 1900 + SDL_rand(150), fld[laserpos[i + 4 * player] + j * 10 + player * 220], 100);
-							fld[laserpos[i + 4 * player] + j * fldsizew[player] + player * 220] = 0;
-							fldt[laserpos[i + 4 * player] + j * fldsizew[player] + player * 220] = 0;
-							fldi[laserpos[i + 4 * player] + j * fldsizew[player] + player * 220] = 0;
-							grayoutLackedBlock(player, flds[laserpos[i + player * 4] + j * 10 + player * 220]);
-							flds[laserpos[i + 4 * player] + j * fldsizew[player] + player * 220] = 0;
-
+							clearFieldCells(player, j, 1u << laserpos[i + 4 * player], squares);
+							grayoutLackedBlock(player, squares[laserpos[i + 4 * player]]);
 						}
 					}
 				}
@@ -14178,22 +13515,16 @@ void statLaser(int32_t player) {
 					if((j - 1 >= 0) && (j - 1 <= fldsizeh[player])){
 						if(fld[laserpos[i + 4 * player] + (j-1) * fldsizew[player] + player * 220] != 0){
 						//	objectCreate(player, 1, (laserpos[i + 4 * player] + 15 + 24 * player - 12 * maxPlay) * 8, (j + 2) * 8, (laserpos[i + 4 * player] - 5) * 120 + 20 - APP_Rand(40), - 1900 + APP_Rand(150), fld[laserpos[i + 4 * player] + j * 10 + player * 220], 100);
-							fld[laserpos[i + 4 * player] + (j-1) * fldsizew[player] + player * 220] = 0;
-							fldt[laserpos[i + 4 * player] + (j-1) * fldsizew[player] + player * 220] = 0;
-							fldi[laserpos[i + 4 * player] + (j-1) * fldsizew[player] + player * 220] = 0;
-							grayoutLackedBlock(player, flds[laserpos[i + player * 4] + (j-1) * 10 + player * 220]);
-							flds[laserpos[i + 4 * player] + (j-1) * fldsizew[player] + player * 220] = 0;
+							clearFieldCells(player, j - 1, 1u << laserpos[i + 4 * player], squares);
+							grayoutLackedBlock(player, squares[laserpos[i + 4 * player]]);
 							PlaySE(2);
 						}
 					}
 					if((j >= 0) && (j <= fldsizeh[player])){
 						if(fld[laserpos[i + 4 * player] + j * fldsizew[player] + player * 220] != 0){
 						//	objectCreate(player, 1, (laserpos[i + 4 * player] + 15 + 24 * player - 12 * maxPlay) * 8, (j + 3) * 8, (laserpos[i + 4 * player] - 5) * 120 + 20 - APP_Rand(40), - 1900 + APP_Rand(150), fld[laserpos[i + 4 * player] + j * 10 + player * 220], 100);
-							fld[laserpos[i + 4 * player] + j * fldsizew[player] + player * 220] = 0;
-							fldt[laserpos[i + 4 * player] + j * fldsizew[player] + player * 220] = 0;
-							fldi[laserpos[i + 4 * player] + j * fldsizew[player] + player * 220] = 0;
-							grayoutLackedBlock(player, flds[laserpos[i + player * 4] + j * 10 + player * 220]);
-							flds[laserpos[i + 4 * player] + j * fldsizew[player] + player * 220] = 0;
+							clearFieldCells(player, j, 1u << laserpos[i + 4 * player], squares);
+							grayoutLackedBlock(player, squares[laserpos[i + 4 * player]]);
 							PlaySE(2);
 						}
 					}
@@ -14211,7 +13542,7 @@ void statLaser(int32_t player) {
 			statusc[player * 10] = 0;
 			statusc[player * 10 + 1] = 0;
 			statusc[player * 10 + 2] = 0;
-			if(repversw >= 48){
+			if(rules->itemRiseStatus){
 				statusc[player * 10 + 1] = status[player];
 				status[player] = 22;
 			}
@@ -14225,10 +13556,12 @@ void statLaser(int32_t player) {
 // statusc[player * 10 + 0]：カウンタ
 // statusc[player * 10 + 1]：終了後に移動するステータス
 void statNegafield(int32_t player) {
-	int32_t i,y,waitA;
+	int32_t i,y,waitA,timer;
+	uint32_t fill,changed;
+	const RulesProfile *rules = getRulesProfile();
 
 //	donega[player] = 0;
-	if(repversw < 63)
+	if(rules->oldItemWaits)
 		waitA = 120;
 	else
 		waitA = 90 + wait1[player];
@@ -14245,25 +13578,21 @@ void statNegafield(int32_t player) {
 		if(statusc[player * 10 + 0] <= 88){
 		if(statusc[player * 10 + 0] % 4 == 0){
 			y = 22 - (statusc[player * 10 + 0] / 4);
+			fill = 0;
+			for(i = 0;i < 10; i++)
+				if(y >= nega_pos[i + 10 * player]) fill |= 1u << i;
+			timer = -1;
+			if((hidden[player] == 8) && (m_roll_blockframe))
+				timer = -60;
+			else if(hidden[player] == 8)
+				timer = 0;
+			// ブロックを空白に、空白をブロックに
+			changed = negateFieldRow(player, y, fill, (y % 7) + 2, timer);
+			if(changed) PlaySE(WAVE_SE_MOVE);
 			for(i = 0;i < 10; i++){
-				if(fld[i + y * fldsizew[player] + player * 220] != 0){	// ブロックを空白に
-					PlaySE(WAVE_SE_MOVE);
-					fld[i + y * fldsizew[player] + player * 220] = 0;
-					fldt[i + y * fldsizew[player] + player * 220] = 0;
-					fldi[i + y * fldsizew[player] + player * 220] = 0;
-					grayoutLackedBlock(player, flds[i + y * 10 + player * 220]);
-					flds[i + y * fldsizew[player] + player * 220] = 0;
-				} else if(y >= nega_pos[i + 10 * player]){			// 空白をブロックに
-					PlaySE(WAVE_SE_MOVE);
-					fld[i + y * fldsizew[player] + player * 220] = (y % 7) + 2;
-					fldt[i + y * fldsizew[player] + player * 220] = -1;
-					grayoutLackedBlock(player, flds[i + y * 10 + player * 220]);
-					flds[i + y * fldsizew[player] + player * 220] = 0;
-					if((hidden[player] == 8) && (m_roll_blockframe))
-						fldt[i + y * fldsizew[player] + player * 220] = -60;
-					else if(hidden[player] == 8)
-						fldt[i + y * fldsizew[player] + player * 220] = 0;
-				}
+				if(!(changed & (1u << i))) continue;
+				grayoutLackedBlock(player, flds[i + y * 10 + player * 220]);
+				setFieldSquare(i + y * fldsizew[player] + player * 220, 0);
 			}
 			scanItem(player);
 		}
@@ -14273,7 +13602,7 @@ void statNegafield(int32_t player) {
 			status[player] = statusc[player * 10 + 1];
 			statusc[player * 10] = 0;
 			statusc[player * 10 + 1] = 0;
-			if(repversw >= 48){
+			if(rules->itemRiseStatus){
 				statusc[player * 10 + 1] = status[player];
 				status[player] = 22;
 			}
@@ -14288,13 +13617,14 @@ void statNegafield(int32_t player) {
 // statusc[player * 10 + 0]：カウンタ
 // statusc[player * 10 + 1]：終了後に移動するステータス
 void statShotgun(int32_t player) {
-	int32_t i,j,x,shotLimit,waitA,waitB;
+	int32_t i,j,x,shotLimit,waitA,waitB,square;
+	const RulesProfile *rules = getRulesProfile();
 	j = 0;
 
 //	doshotgun[player] = 0;
 	shotLimit = 0;
 
-	if(repversw < 63){
+	if(rules->oldItemWaits){
 		waitA = 60;
 		waitB = 120;
 	}else{
@@ -14329,11 +13659,9 @@ void statShotgun(int32_t player) {
 			for(i = checkFieldTop(player); i < 22; i++){
 				if(fld[shotgunpos[i + 22 * player] + i * fldsizew[player] + player * 220] != 0){
 					objectCreate(player, 1, (shotgunpos[i + 22 * player] + 15 + 24 * player - 12 * maxPlay) * 8, (i + 3) * 8, (shotgunpos[i + 22 * player] - 5) * 120 + 20 - SDL_rand(40), - 1900 + SDL_rand(150), fld[shotgunpos[i + 22 * player] + i * 10 + player * 220], 100);
-					fld[shotgunpos[i + 22 * player] + i * fldsizew[player] + player * 220] = 0;
-					fldt[shotgunpos[i + 22 * player] + i * fldsizew[player] + player * 220] = 0;
-					fldi[shotgunpos[i + 22 * player] + i * fldsizew[player] + player * 220] = 0;
-					grayoutLackedBlock(player, flds[j + i * 10 + player * 220]);
-					flds[shotgunpos[i + 22 * player] + i * fldsizew[player] + player * 220] = 0;
+					square = flds[j + i * 10 + player * 220];
+					clearFieldCells(player, i, 1u << shotgunpos[i + 22 * player], NULL);
+					grayoutLackedBlock(player, square);
 				}
 			}
 			scanItem(player);
@@ -14343,7 +13671,7 @@ void statShotgun(int32_t player) {
 			status[player] = statusc[player * 10 + 1];
 			statusc[player * 10] = 0;
 			statusc[player * 10 + 1] = 0;
-			if(repversw >= 48){
+			if(rules->itemRiseStatus){
 				statusc[player * 10 + 1] = status[player];
 				status[player] = 22;
 			}
@@ -14360,6 +13688,7 @@ void statShotgun(int32_t player) {
 // statusc[player * 10 + 3]：自分は交換しない（フィールドコピー）
 void statExchangefield(int32_t player) {
 	int32_t i,j,enemy;
+	const RulesProfile *rules = getRulesProfile();
 
 	doexchg[player] = 0;
 	docopyfld[player] = 0;
@@ -14373,7 +13702,7 @@ void statExchangefield(int32_t player) {
 	if(statusc[player * 10 + 0] == 0){	//最初
 		if( ((status[enemy] == 29) && (statusc[enemy * 10 + 2] == 1)) || (item_mode[player]) ){	//同期チェック
 			// フィールドをバッファに確保（変更前）
-			if(repversw < 48){
+			if(!rules->exchangeFieldLate){
 				for(i = 0; i <= fldsizeh[player]; i++) {
 					for(j = 0; j < fldsizew[player]; j++) {
 						fldbuf[j + i * fldsizew[player] + player * 220] = fld[j + i * fldsizew[player] + player * 220];
@@ -14388,7 +13717,7 @@ void statExchangefield(int32_t player) {
 		statusc[player * 10 + 2] = 1;
 	} else {
 		// 相手フィールドを自分のバッファに確保（交換開始直前に変更）
-		if((statusc[player * 10 + 0] == 58) && (repversw >= 48)){
+		if((statusc[player * 10 + 0] == 58) && (rules->exchangeFieldLate)){
 			for(i = 0; i < 220; i++) {
 				fldbuf[i + player * 220] = fld[i + enemy * 220];
 				fldtbuf[i + player * 220] = fldt[i + enemy * 220];
@@ -14400,12 +13729,12 @@ void statExchangefield(int32_t player) {
 		if((statusc[player * 10 + 0] >= 60) && (statusc[player * 10 + 0] < 70) && (!statusc[player * 10 + 3])){
 			for(i = 0; i < 22; i++) {
 				j = statusc[player * 10 + 0] - 60;
-				fld[j + i * 10 + player * 220] = fldbuf[j + i * 10 + player * 220];
+				setFieldBlock(j + i * 10 + player * 220, fldbuf[j + i * 10 + player * 220]);
 				fldt[j + i * 10 + player * 220] = fldtbuf[j + i * 10 + player * 220];
 				fldi[j + i * 10 + player * 220] = fldibuf[j + i * 10 + player * 220];
-				flds[j + i * 10 + player * 220] = fldsbuf[j + i * 10 + player * 220];
+				setFieldSquare(j + i * 10 + player * 220, fldsbuf[j + i * 10 + player * 220]);
 				if((fld[j + i * 10 + player * 220] < 0) && (rotspl[player] != 6))
-					fld[j + i * 10 + player * 220] = 8;
+					setFieldBlock(j + i * 10 + player * 220, 8);
 			}
 		ExBlt(PLANE_MIRROR_EFFECT_TAP, 120+ ((statusc[player * 10 + 0] - 60) * 8) + 192 * player - 96 * maxPlay, 40);
 		scanItem(player);
@@ -14419,7 +13748,7 @@ void statExchangefield(int32_t player) {
 			statusc[player * 10 + 1] = 0;
 			statusc[player * 10 + 2] = 0;
 			statusc[player * 10 + 3] = 0;
-			if(repversw >= 48){
+			if(rules->itemRiseStatus){
 				statusc[player * 10 + 1] = status[player];
 				status[player] = 22;
 			}
@@ -14612,11 +13941,12 @@ void statExamination(int32_t player){
 // statusc[player * 10 + 2]：発動アイテム
 void statItemRulet(int32_t player) {
 	int32_t i,j,y,waitA;
+	const RulesProfile *rules = getRulesProfile();
 
 	padRepeat(player);
 	if(ace_irs) doIRS2(player);	// ACE式IRS C7U1.5
 
-	if(repversw < 63){
+	if(rules->oldItemWaits){
 		waitA = 180;
 	}else{
 		waitA = 150 + wait1[player];
@@ -14635,18 +13965,18 @@ void statItemRulet(int32_t player) {
 		if(statusc[player * 10 + 0] == 120){//決定
 			PlaySE(WAVE_SE_KETTEI);
 			statusc[player * 10 + 2] = gameRand(item_num,player) + 1;
-			if(repversw < 48)
+			if(!rules->rouletteMiss)
 				eraseItem(player, statusc[player * 10 + 2]);
 			else if((gameRand(10,player) < 1) || (statusc[player * 10 + 2] == item_num + 1)){	//スカ
 				statusc[player * 10 + 2] = 36;
 				PlaySE(WAVE_SE_REGRET);
-				if(repversw >= 54){
+				if(rules->rouletteMissSelf){
 					eraseItem(player, statusc[player * 10 + 2]);
 					item_t[player] = item_interval / 4;
 				}
 			}else{//何かか決定
 				eraseItem(player, statusc[player * 10 + 2]);
-				if((repversw >= 54) && (statusc[player * 10 + 2] == 36)){
+				if((rules->rouletteMissSelf) && (statusc[player * 10 + 2] == 36)){
 					PlaySE(WAVE_SE_REGRET);
 					misstimer[player] = item_interval / 4;
 				}
@@ -14656,7 +13986,7 @@ void statItemRulet(int32_t player) {
 				statusc[player * 10 + 1] = status[player];
 				status[player] = 31;
 			}
-			if((dorulet[player]) && (repversw >= 48) && (repversw < 62)){
+			if((dorulet[player]) && (rules->rouletteRepeat)){
 				dorulet[player] = 0;
 				eraseItem(player, gameRand(item_num,player) + 1);
 			}
@@ -14675,11 +14005,11 @@ void statItemRulet(int32_t player) {
 		ExBltRect(PLANE_ITEM,(5 + 24 * player + 12 * (!maxPlay))*8, 178, 0, (statusc[player * 10 + 2] - 1) * 16, 48, 16);
 		statusc[player * 10 + 0]++;
 		if(statusc[player * 10 + 0] >= waitA){
-			if(repversw >= 48){
+			if(rules->itemRiseStatus){
 				if(fmirror_cnt[player] == -20)
 					if(UpLineShirase(player)) return;
 				if(fldMirrorProc(player)) return;
-			}else if(repversw >= 40)
+			}else if(rules->itemEndMirror)
 				if(fldMirrorProc(player)) return;
 			status[player] = statusc[player * 10 + 1];
 			statusc[player * 10] = 0;
@@ -14864,7 +14194,8 @@ void statItemRulet(int32_t player) {
 // statusc[player * 10 + 1]：終了後に移動するステータス
 // statusc[player * 10 + 2]：再せり上がり時の穴の位置
 void statFreefall(int32_t player) {
-	int32_t i,j,x,y = 0,l,k,tmp;
+	int32_t i,j,x,y = 0;
+	const RulesProfile *rules = getRulesProfile();
 
 	padRepeat(player);
 	if(ace_irs) doIRS2(player);	// ACE式IRS C7U1.5
@@ -14882,29 +14213,7 @@ void statFreefall(int32_t player) {
 			ofs_y[player] = 0;
 			ofs_y2[player] = 0;
 			PlaySE(2);
-			for(y = fldsizeh[player] - 1;y >= 0;y--){	//最下段は調べない
-				for(i = 0;i < fldsizew[player];i++){
-					if((fld[i + y * fldsizew[player] + player * 220] != 0) && (fld[i + (y + 1) * fldsizew[player] + player * 220] == 0)){	//ブロックかつ1段下が空白なら
-						tmp = y;
-						do{
-							if(tmp + 1 > fldsizeh[player]) break;	//最下段に到達
-							j = fld[i + tmp * fldsizew[player] + player * 220];
-							fld[i + tmp * fldsizew[player] + player * 220] = 0;
-							fld[i + (tmp + 1) * fldsizew[player] + player * 220] = j;
-							j = fldt[i + tmp * fldsizew[player] + player * 220];
-							fldt[i + tmp * fldsizew[player] + player * 220] = 0;
-							fldt[i + (tmp + 1) * fldsizew[player] + player * 220] = j;
-							j = fldi[i + tmp * fldsizew[player] + player * 220];
-							fldi[i + tmp * fldsizew[player] + player * 220] = 0;
-							fldi[i + (tmp + 1) * fldsizew[player] + player * 220] = j;
-							j = flds[i + tmp * fldsizew[player] + player * 220];
-							flds[i + tmp * fldsizew[player] + player * 220] = 0;
-							flds[i + (tmp + 1) * fldsizew[player] + player * 220] = j;
-							tmp++;
-						}while(fld[i + (tmp + 1) * fldsizew[player] + player * 220] == 0);
-					}
-				}
-			}
+			compactFieldDown(player);
 		}
 	}
 	if(statusc[player * 10 + 0] == (wait1[player] * 2) + 30){	//消去判定（なければ次のステータスへ）
@@ -14941,11 +14250,11 @@ void statFreefall(int32_t player) {
 							}
 						}
 
-						fld[x + i * fldsizew[player] + player * 220] = 0;
+						setFieldBlock(x + i * fldsizew[player] + player * 220, 0);
 						fldt[x + i * fldsizew[player] + player * 220] = 0;	// #1.60c7j5
 						fldi[x + i * fldsizew[player] + player * 220] = 0;	// #1.60c7n1
 						grayoutLackedBlock(player, flds[x + i * 10 + player * 220]);
-						flds[x + i * fldsizew[player] + player * 220] = 0;
+						setFieldSquare(x + i * fldsizew[player] + player * 220, 0);
 					}
 				}
 			}
@@ -14965,23 +14274,8 @@ void statFreefall(int32_t player) {
 		y = fldsizeh[player];
 		for(i = 0; i <= fldsizeh[player]; i++) {
 			if(erase[y + player * 22]) {
-				for(k = y; k > 0; k--) {
-					for(l = 0; l < fldsizew[player]; l++) {
-						fld[l + k * fldsizew[player] + player * 220] = fld[l + (k - 1) * fldsizew[player] + player * 220];
-						// #1.60c7j5
-						fldt[l + k * fldsizew[player] + player * 220] = fldt[l + (k - 1) * fldsizew[player] + player * 220];
-						// #1.60c7n1
-						if((gameMode[player] == 4) || (item_mode[player]))
-						fldi[l + k * fldsizew[player] + player * 220] = fldi[l + (k - 1) * fldsizew[player] + player * 220];
-					}
-					erase[k + player * 22] = erase[(k - 1) + player * 22];
-				}
-				for(l = 0; l < fldsizew[player]; l++) {
-					fld[l + player * 220] = 0;
-					fldt[l + player * 220] = 0;		// #1.60c7j5
-					if((gameMode[player] == 4) || (item_mode[player])) fldi[l + player * 220] = 0;		// #1.60c7n1
-					erase[player * 22] = 0;
-				}
+				// fldtは#1.60c7j5、fldiは#1.60c7n1から
+				shiftFieldRowsDown(player, y, FIELD_LAYER_BLOCK | FIELD_LAYER_TIMER | (((gameMode[player] == 4) || (item_mode[player])) ? FIELD_LAYER_ITEM : 0));
 			} else {
 				y--;
 			}
@@ -14999,19 +14293,10 @@ void statFreefall(int32_t player) {
 	if(statusc[player * 10 + 0] < 0){
 		if(Ff_rerise[player] != 0){	//再せり上がり
 			PlaySE(WAVE_SE_UP);
-			for(i = 1; i <= fldsizeh[player]; i++) {
-				for(j = 0; j < fldsizew[player]; j++) {
-					fld[j + (i - 1) * fldsizew[player] + player * 220] = fld[j + i * fldsizew[player] + player * 220];
-					fldt[j + (i - 1) * fldsizew[player] + player * 220] = fldt[j + i * fldsizew[player] + player * 220];
-					flds[j + (i - 1) * fldsizew[player] + player * 220] = flds[j + i * fldsizew[player] + player * 220];
-					if((gameMode[player] == 4) || (item_mode[player]))
-						fldi[j + (i - 1) * fldsizew[player] + player * 220] = fldi[j + i * fldsizew[player] + player * 220];
-				}
-				erase[(i - 1) + player * 22] = erase[i + player * 22];
-			}
+			shiftFieldRowsUp(player, FIELD_LAYER_BLOCK | FIELD_LAYER_TIMER | FIELD_LAYER_SQUARE | (((gameMode[player] == 4) || (item_mode[player])) ? FIELD_LAYER_ITEM : 0));
 
 			for(j = 0; j < fldsizew[player]; j++) {
-				fld[j + fldsizew[player] * fldsizeh[player] + player * 220] = ((j != statusc[player * 10 + 2]) && (j != statusc[player * 10 + 3])) * (gameRand(7,player) + 2);
+				setFieldBlock(j + fldsizew[player] * fldsizeh[player] + player * 220, ((j != statusc[player * 10 + 2]) && (j != statusc[player * 10 + 3])) * (gameRand(7,player) + 2));
 				fldt[j + fldsizew[player] * fldsizeh[player] + player * 220] = (fld[j + fldsizew[player] * fldsizeh[player] + player * 220] != 0) * -1;
 				// アイテムを増殖させない #1.60c7o6
 				if((gameMode[player] == 4) || (item_mode[player])) fldi[j + fldsizew[player] * fldsizeh[player] + player * 220] = 0;
@@ -15023,7 +14308,7 @@ void statFreefall(int32_t player) {
 			isFreefall[player] = 0;
 			status[player] = statusc[player * 10 + 1];
 			statusc[player * 10 + 1] = 0;
-			if((repversw >= 48) && (statusc[player * 10 + 0] == -99)){
+			if((rules->itemRiseStatus) && (statusc[player * 10 + 0] == -99)){
 				statusc[player * 10 + 1] = status[player];
 				status[player] = 22;
 			}
@@ -15040,8 +14325,7 @@ void statFreefall(int32_t player) {
 // statusc[player * 10 + 0]：カウンタ
 // statusc[player * 10 + 1]：終了後に移動するステータス
 void statMovfield(int32_t player) {
-	int32_t i,j,y,tmp;
-
+	const RulesProfile *rules = getRulesProfile();
 	padRepeat(player);
 	if(ace_irs) doIRS2(player);	// ACE式IRS C7U1.5
 
@@ -15058,56 +14342,8 @@ void statMovfield(int32_t player) {
 			ofs_x[player] = 0;
 			ofs_x2[player] = 0;
 			PlaySE(2);
-			if(isLmovfield[player]){ //←MOV FIELD
-				for(i = 1;i < fldsizew[player];i++){
-					for(y = 0;y <= fldsizeh[player];y++){
-						if((fld[i + y * fldsizew[player] + player * 220] != 0) && (fld[(i - 1) + y * fldsizew[player] + player * 220] == 0)){
-							tmp = i;
-							do{
-								if(tmp - 1 < 0) break;	//左端に到達
-								j = fld[tmp + y * fldsizew[player] + player * 220];
-								fld[tmp + y * fldsizew[player] + player * 220] = 0;
-								fld[(tmp - 1) + y * fldsizew[player] + player * 220] = j;
-								j = fldt[tmp + y * fldsizew[player] + player * 220];
-								fldt[tmp + y * fldsizew[player] + player * 220] = 0;
-								fldt[(tmp - 1) + y * fldsizew[player] + player * 220] = j;
-								j = fldi[tmp + y * fldsizew[player] + player * 220];
-								fldi[tmp + y * fldsizew[player] + player * 220] = 0;
-								fldi[(tmp - 1) + y * fldsizew[player] + player * 220] = j;
-								j = flds[tmp + y * fldsizew[player] + player * 220];
-								flds[tmp + y * fldsizew[player] + player * 220] = 0;
-								flds[(tmp - 1) + y * fldsizew[player] + player * 220] = j;
-								tmp--;
-							}while(fld[(tmp - 1) + y * fldsizew[player] + player * 220] == 0);
-						}
-					}
-				}
-			}
-			if(isRmovfield[player]){ //→MOV FIELD
-				for(i = fldsizew[player] - 2;i >= 0;i--){
-					for(y = 0;y <= fldsizeh[player];y++){
-						if((fld[i + y * fldsizew[player] + player * 220] != 0) && (fld[(i + 1) + y * fldsizew[player] + player * 220] == 0)){
-							tmp = i;
-							do{
-								if(tmp + 1 >= fldsizew[player]) break;	//右端に到達
-								j = fld[tmp + y * fldsizew[player] + player * 220];
-								fld[tmp + y * fldsizew[player] + player * 220] = 0;
-								fld[(tmp + 1) + y * fldsizew[player] + player * 220] = j;
-								j = fldt[tmp + y * fldsizew[player] + player * 220];
-								fldt[tmp + y * fldsizew[player] + player * 220] = 0;
-								fldt[(tmp + 1) + y * fldsizew[player] + player * 220] = j;
-								j = fldi[tmp + y * fldsizew[player] + player * 220];
-								fldi[tmp + y * fldsizew[player] + player * 220] = 0;
-								fldi[(tmp + 1) + y * fldsizew[player] + player * 220] = j;
-								j = flds[tmp + y * fldsizew[player] + player * 220];
-								flds[tmp + y * fldsizew[player] + player * 220] = 0;
-								flds[(tmp + 1) + y * fldsizew[player] + player * 220] = j;
-								tmp++;
-							}while(fld[(tmp + 1) + y * fldsizew[player] + player * 220] == 0);
-						}
-					}
-				}
-			}
+			if(isLmovfield[player]) compactFieldRows(player, true);	//←MOV FIELD
+			if(isRmovfield[player]) compactFieldRows(player, false);	//→MOV FIELD
 		}
 	}
 
@@ -15120,7 +14356,7 @@ void statMovfield(int32_t player) {
 		statusc[player * 10] = 0;
 		statusc[player * 10 + 1] = 0;
 		statusc[player * 10 + 2] = 0;
-		if(repversw >= 48){
+		if(rules->itemRiseStatus){
 			statusc[player * 10 + 1] = status[player];
 			status[player] = 22;
 		}
@@ -15133,14 +14369,15 @@ void statMovfield(int32_t player) {
 // statusc[player * 10 + 0]：カウンタ
 // statusc[player * 10 + 1]：終了後に移動するステータス
 void stat180field(int32_t player) {
-	int32_t i,j,waitA;
+	int32_t waitA;
+	const RulesProfile *rules = getRulesProfile();
 
 	padRepeat(player);
 	if(ace_irs) doIRS2(player);	// ACE式IRS C7U1.5
 
-	if(repversw < 63){
+	if(rules->oldItemWaits){
 		waitA = wait1[player] + 40;
-	}else if(repversw < 65){
+	}else if(rules->oldItem180Wait){
 		waitA = wait1[player] * 2;
 	}else{
 		waitA = 20 + wait1[player] + (wait1[player] / 2);
@@ -15160,24 +14397,7 @@ void stat180field(int32_t player) {
 		if(statusc[player * 10 + 0] == waitA + 50){	//処理
 			ofs_y[player] = 0;
 			statusc[player * 10 + 2] = checkFieldTop(player);
-			for(i = 0; i <= fldsizeh[player]; i++) {	// バッファへ
-				for(j = 0; j < fldsizew[player]; j++) {
-					fldbuf[j + i * fldsizew[player] + player * 220] = fld[j + i * fldsizew[player] + player * 220];
-					fldtbuf[j + i * fldsizew[player] + player * 220] = fldt[j + i * fldsizew[player] + player * 220];
-					fldibuf[j + i * fldsizew[player] + player * 220] = fldi[j + i * fldsizew[player] + player * 220];
-					fldsbuf[j + i * fldsizew[player] + player * 220] = flds[j + i * fldsizew[player] + player * 220];
-				}
-			}
-			for(i = 0; i <= fldsizeh[player]; i++) {	// ひっくり返す
-				for(j = 0; j < fldsizew[player]; j++) {
-					if(i + statusc[player * 10 + 2] > fldsizeh[player]) break;
-					fld[j + (i + statusc[player * 10 + 2]) * fldsizew[player] + player * 220] = fldbuf[j + (fldsizeh[player] - i) * fldsizew[player] + player * 220];
-					fldt[j + (i + statusc[player * 10 + 2]) * fldsizew[player] + player * 220] = fldtbuf[j + (fldsizeh[player] - i) * fldsizew[player] + player * 220];
-					fldi[j + (i + statusc[player * 10 + 2]) * fldsizew[player] + player * 220] = fldibuf[j + (fldsizeh[player] - i) * fldsizew[player] + player * 220];
-					flds[j + (i + statusc[player * 10 + 2]) * fldsizew[player] + player * 220] = fldsbuf[j + (fldsizeh[player] - i) * fldsizew[player] + player * 220];
-
-				}
-			}
+			flipFieldRows(player, statusc[player * 10 + 2]);	// バッファへ退避してひっくり返す
 		}
 		if((statusc[player * 10 + 0] > waitA + 50) && (statusc[player * 10 + 0] < waitA + 50 + 15)){
 			ofs_y2[player] = ofs_y2[player] + 20;
@@ -15195,7 +14415,7 @@ void stat180field(int32_t player) {
 		statusc[player * 10] = 0;
 		statusc[player * 10 + 1] = 0;
 		statusc[player * 10 + 2] = 0;
-		if(repversw >= 48){
+		if(rules->itemRiseStatus){
 			statusc[player * 10 + 1] = status[player];
 			status[player] = 22;
 		}
@@ -15212,11 +14432,12 @@ void stat180field(int32_t player) {
 // statusc[player * 10 + 3]：カウンタ2
 void statDelfromUpper(int32_t player) {
 	int32_t i, j, waitA;
+	const RulesProfile *rules = getRulesProfile();
 
 	padRepeat(player);
 	if(ace_irs) doIRS2(player);	// ACE式IRS C7U1.5
 
-	if((repversw < 63) || (gameMode[player] == 8)){
+	if((rules->oldItemWaits) || (gameMode[player] == 8)){
 		waitA = -160;
 	}else{
 		waitA = -100 - (wait1[player] * 2);
@@ -15240,13 +14461,9 @@ void statDelfromUpper(int32_t player) {
 			for(i = 0; i < 10; i++) {
 				if(fld[i + j * 10 + player * 220]) {
 						objectCreate(player, 1, (i + 15 + 24 * player - 12 * maxPlay) * 8, (j + 3) * 8, (i - 5) * 120 + 20 - SDL_rand(40), - 1900 + SDL_rand(150), fld[i + j * 10 + player * 220], 100);
-
-					fld[i + j * 10 + player * 220] = 0;
-					fldt[i + j * 10 + player * 220] = 0;
-					fldi[i + j * 10 + player * 220] = 0;
-					flds[i + j * 10 + player * 220] = 0;
 				}
 			}
+			clearFieldCells(player, j, 0x3FF, NULL);
 		}
 		statusc[player * 10 + 3]++;
 	}
@@ -15292,10 +14509,10 @@ void statBanana(int32_t player){
 				chgs[j] = flds[j + y * fldsizew[player] + player * 220];
 			}
 			for(j = 0; j < fldsizew[player]; j++){
-				fld[j + y * fldsizew[player] + player * 220] = chg[banana_pos[j + 10 * player]];
+				setFieldBlock(j + y * fldsizew[player] + player * 220, chg[banana_pos[j + 10 * player]]);
 				fldt[j + y * fldsizew[player] + player * 220] = chgt[banana_pos[j + 10 * player]];
 				fldi[j + y * fldsizew[player] + player * 220] = chgi[banana_pos[j + 10 * player]];
-				flds[j + y * fldsizew[player] + player * 220] = chgs[banana_pos[j + 10 * player]];
+				setFieldSquare(j + y * fldsizew[player] + player * 220, chgs[banana_pos[j + 10 * player]]);
 			}
 		}
 		if((y > 1) && (y <= 7))
@@ -15378,28 +14595,15 @@ int32_t getModeAdd(int32_t player){
 }
 // フィールドの最上段を返す
 int32_t checkFieldTop(int32_t player) {
-	int32_t i, j;
-
-	for(i = 0; i <= fldsizeh[player]; i++)
-		for(j = 0; j < fldsizew[player]; j++)
-			if(fld[j + i * fldsizew[player] + player * 220])
-				return i;
-
-	// 空っぽの場合
-	return 22;
+	// 空っぽの場合は22
+	return getFieldTop(player);
 }
 
 // フィールドの最上段を返す
 // x軸を指定出来るバージョン
 int32_t checkFieldTop2(int32_t player,int32_t x) {
-	int32_t i;
-
-	for(i = 0; i <= fldsizeh[player]; i++)
-		if(fld[x + i * fldsizew[player] + player * 220])
-			return i;
-
-	// 空っぽの場合
-	return 22;
+	// 空っぽの場合は22
+	return getFieldColumnTop(player, x);
 }
 //▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
 //   表示するアイテム名を決定
@@ -16147,32 +15351,14 @@ int quitNow() {
 //  ブロックのあたり判定
 //▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
 int32_t judgeBlock(int32_t player, int32_t bx1, int32_t by1, int32_t kind, int32_t rotate) {
-	int32_t		i, bx2, by2; //, result
-
 	if(IsBig[player]) {
 		// BIGの場合は専用の判定処理を行う #1.60c7m6
 		return judgeBigBlock(player, bx1, by1, kind, rotate);
 	}
 
-	for(i = 0; i < 4; i++) {
-		if(rotspl[player] == 8 && ((segacheat == 2) || (heboGB[player] != 2) || repversw < 66)) {
-			bx2 = (bx1 + blkDDataX[kind * 16 + rotate * 4 + i]);
-			by2 = (by1 + blkDDataY[kind * 16 + rotate * 4 + i]);
-		}else if( isWRule(player) ) {
-			bx2 = (bx1 + blkWDataX[kind * 16 + rotate * 4 + i]);
-			by2 = (by1 + blkWDataY[kind * 16 + rotate * 4 + i]);
-		} else {
-			bx2 = (bx1 + blkDataX[kind * 16 + rotate * 4 + i]);
-			by2 = (by1 + blkDataY[kind * 16 + rotate * 4 + i]);
-		}
-		if((by2 < 2) && (heboGB[player] == 2)) {
-			return -1;
-		}
-
-		if(((bx2 < 0) || (bx2 >= fldsizew[player]) ||
-			(by2 > fldsizeh[player])) || ((fld[bx2 + by2 * fldsizew[player] + player * 220] != 0) && (by2 >= 0))) {
-			return -1;
-		}
+	// ブロックの形のマスクをフィールドの各段と比べる
+	if(isBlockMaskBlocked(player, bx1, by1, getBlockMask(player, kind, rotate))) {
+		return -1;
 	}
 
 	return 0;
@@ -16184,6 +15370,7 @@ int32_t judgeBlock(int32_t player, int32_t bx1, int32_t by1, int32_t kind, int32
 void setBlock(int32_t player, int32_t bx1, int32_t by1, int32_t kind, int32_t rotate) {
 	int32_t		i, bx2, by2;
 	int32_t		puted;
+	const RulesProfile *rules = getRulesProfile();
 
 	if(IsBig[player]) {
 		// BIGの場合は専用の設置処理を行う #1.60c7m6
@@ -16194,7 +15381,7 @@ void setBlock(int32_t player, int32_t bx1, int32_t by1, int32_t kind, int32_t ro
 	puted = 0;
 
 	for(i = 0; i < 4; i++) {
-		if(rotspl[player] == 8 && ((segacheat == 2) || (heboGB[player] != 2) || repversw < 66)) {
+		if(rotspl[player] == 8 && ((segacheat == 2) || (heboGB[player] != 2) || !rules->segaRules)) {
 			bx2 = (bx1 + blkDDataX[kind * 16 + rotate * 4 + i]);
 			by2 = (by1 + blkDDataY[kind * 16 + rotate * 4 + i]);
 		}else if( isWRule(player) ) {
@@ -16204,12 +15391,12 @@ void setBlock(int32_t player, int32_t bx1, int32_t by1, int32_t kind, int32_t ro
 			bx2 = (bx1 + blkDataX[kind * 16 + rotate * 4 + i]);
 			by2 = (by1 + blkDataY[kind * 16 + rotate * 4 + i]);
 		}
-		if((bx2 >= 0) && (bx2 < fldsizew[player]) && (by2 >= 0+(1*((repversw <= 27) || (!spawn_y_type)))) && (by2 <= fldsizeh[player])) {
-			if((by2 >= 2) || (repversw <= 27))puted++;
+		if((bx2 >= 0) && (bx2 < fldsizew[player]) && (by2 >= 0+(1*((rules->oldPutRows) || (!spawn_y_type)))) && (by2 <= fldsizeh[player])) {
+			if((by2 >= 2) || (rules->oldPutRows))puted++;
 
-			fld[bx2 + by2 * fldsizew[player] + player * 220] = c_cblk_r[player] + 1;
+			setFieldBlock(bx2 + by2 * fldsizew[player] + player * 220, c_cblk_r[player] + 1);
 			if((c_cblk_r[player] + 1 == 9) && (heboGB[player] == 1))
-				fld[bx2 + by2 * fldsizew[player] + player * 220] = 10;
+				setFieldBlock(bx2 + by2 * fldsizew[player] + player * 220, 10);
 
 			// シャドウタイマーセット #1.60c7j5
 			if((hidden[player] == 8) && (m_roll_blockframe))
@@ -16223,12 +15410,12 @@ void setBlock(int32_t player, int32_t bx1, int32_t by1, int32_t kind, int32_t ro
 
 			// アイテム設置 #1.60c7n1
 			fldi[bx2 + by2 * fldsizew[player] + player * 220] = item[player];
-			flds[bx2 + by2 * fldsizew[player] + player * 220] = bdowncnt[player] + 1;
+			setFieldSquare(bx2 + by2 * fldsizew[player] + player * 220, bdowncnt[player] + 1);
 		}
 	}
 
 	// 完全に画面外に置いたら死亡 #1.60c7s2
-	if(((spawn_y_type) || (repversw >= 57)) && (!puted)) {
+	if(((spawn_y_type) || (rules->outsideLockDeath)) && (!puted)) {
 		setGameOver(player);
 	}
 }
@@ -16237,9 +15424,10 @@ void setBlock(int32_t player, int32_t bx1, int32_t by1, int32_t kind, int32_t ro
 int32_t judgeBigBlock(int32_t player, int32_t bx1, int32_t by1, int32_t kind, int32_t rotate) {
 	int32_t		i, bx2, by2; //, result
 	int32_t		k, l, bx3, by3;
+	const RulesProfile *rules = getRulesProfile();
 
 	for(i = 0; i < 4; i++) {
-		if(rotspl[player] == 8 && ((segacheat == 2) || (heboGB[player] != 2) || repversw < 66)) {
+		if(rotspl[player] == 8 && ((segacheat == 2) || (heboGB[player] != 2) || !rules->segaRules)) {
 			bx2 = (bx1 + blkDDataX[kind * 16 + rotate * 4 + i] * 2);
 			by2 = (by1 + blkDDataY[kind * 16 + rotate * 4 + i] * 2);
 		}else if( isWRule(player) ) {
@@ -16272,11 +15460,12 @@ void setBigBlock(int32_t player, int32_t bx1, int32_t by1, int32_t kind, int32_t
 	int32_t		i, bx2, by2;
 	int32_t		k, l, bx3, by3;
 	int32_t		puted;
+	const RulesProfile *rules = getRulesProfile();
 
 	puted = 0;
 
 	for(i = 0; i < 4; i++) {
-		if(rotspl[player] == 8 && ((segacheat == 2) || (heboGB[player] != 2) || repversw < 66)) {
+		if(rotspl[player] == 8 && ((segacheat == 2) || (heboGB[player] != 2) || !rules->segaRules)) {
 			bx2 = (bx1 + blkDDataX[kind * 16 + rotate * 4 + i] * 2);
 			by2 = (by1 + blkDDataY[kind * 16 + rotate * 4 + i] * 2);
 		}else if( isWRule(player) ) {
@@ -16292,12 +15481,12 @@ void setBigBlock(int32_t player, int32_t bx1, int32_t by1, int32_t kind, int32_t
 			bx3 = bx2 + k;
 			by3 = by2 + l;
 
-		if((bx3 >= 0) && (bx3 < fldsizew[player]) && (by3 >= 0+(1*((repversw <= 27) || (!spawn_y_type)))) && (by3 <= fldsizeh[player])) {
-				if((repversw <= 2) || (by3 >= 2)) puted = 1;
+		if((bx3 >= 0) && (bx3 < fldsizew[player]) && (by3 >= 0+(1*((rules->oldPutRows) || (!spawn_y_type)))) && (by3 <= fldsizeh[player])) {
+				if((rules->bigPutAnyRow) || (by3 >= 2)) puted = 1;
 
-				fld[bx3 + by3 * fldsizew[player] + player * 220] = c_cblk_r[player] + 1;
+				setFieldBlock(bx3 + by3 * fldsizew[player] + player * 220, c_cblk_r[player] + 1);
 				if((c_cblk_r[player] + 1 == 9) && (heboGB[player] == 1))
-					fld[bx3 + by3 * fldsizew[player] + player * 220] = 10;
+					setFieldBlock(bx3 + by3 * fldsizew[player] + player * 220, 10);
 
 				if((hidden[player] == 8) && (m_roll_blockframe))	//TI風消えロールにも使用
 					fldt[bx3 + by3 * fldsizew[player] + player * 220] = -60;
@@ -16310,19 +15499,20 @@ void setBigBlock(int32_t player, int32_t bx1, int32_t by1, int32_t kind, int32_t
 
 				// アイテム設置 #1.60c7n1
 				fldi[bx3 + by3 * fldsizew[player] + player * 220] = item[player];
-				flds[bx3 + by3 * fldsizew[player] + player * 220] = bdowncnt[player] + 1;
+				setFieldSquare(bx3 + by3 * fldsizew[player] + player * 220, bdowncnt[player] + 1);
 			}
 		}
 	}
 
 	// 完全に画面外に置いたら死亡 #1.60c7s2
-	if(((spawn_y_type) || (repversw >= 57)) && (!puted)) {
+	if(((spawn_y_type) || (rules->outsideLockDeath)) && (!puted)) {
 		setGameOver(player);
 	}
 }
 // ブロックを消す　MOVE ERASED せり上がり用
 void removeBlock(int32_t player, int32_t bx1, int32_t by1, int32_t kind, int32_t rotate) {
 	int32_t		i, bx2, by2;
+	const RulesProfile *rules = getRulesProfile();
 
 	if(IsBig[player]) {
 		// BIGの場合は専用処理を行う #1.60c7m6
@@ -16331,7 +15521,7 @@ void removeBlock(int32_t player, int32_t bx1, int32_t by1, int32_t kind, int32_t
 	}
 
 	for(i = 0; i < 4; i++) {
-		if(rotspl[player] == 8 && ((segacheat == 2) || (heboGB[player] != 2) || repversw < 66)) {
+		if(rotspl[player] == 8 && ((segacheat == 2) || (heboGB[player] != 2) || !rules->segaRules)) {
 			bx2 = (bx1 + blkDDataX[kind * 16 + rotate * 4 + i]);
 			by2 = (by1 + blkDDataY[kind * 16 + rotate * 4 + i]);
 		}else if( isWRule(player) ) {
@@ -16342,7 +15532,7 @@ void removeBlock(int32_t player, int32_t bx1, int32_t by1, int32_t kind, int32_t
 			by2 = (by1 + blkDataY[kind * 16 + rotate * 4 + i]);
 		}
 		if( ( bx2 >= 0 ) && ( bx2 <= 9 ) && ( by2 >= 0 + (!spawn_y_type) ) && ( by2 <= fldsizeh[player] ) ) {
-			fld[bx2 + by2 * fldsizew[player] + player * 220] = 0;
+			setFieldBlock(bx2 + by2 * fldsizew[player] + player * 220, 0);
 			fldt[bx2 + by2 * fldsizew[player] + player * 220] = 0;
 
 		}
@@ -16353,9 +15543,10 @@ void removeBlock(int32_t player, int32_t bx1, int32_t by1, int32_t kind, int32_t
 void removeBigBlock(int32_t player, int32_t bx1, int32_t by1, int32_t kind, int32_t rotate) {
 	int32_t		i, bx2, by2;
 	int32_t		k, l, bx3, by3;
+	const RulesProfile *rules = getRulesProfile();
 
 	for(i = 0 ; i < 4 ; i++) {
-		if(rotspl[player] == 8 && ((segacheat == 2) || (heboGB[player] != 2) || repversw < 66)) {
+		if(rotspl[player] == 8 && ((segacheat == 2) || (heboGB[player] != 2) || !rules->segaRules)) {
 			bx2 = (bx1 + blkDDataX[kind * 16 + rotate * 4 + i] * 2);
 			by2 = (by1 + blkDDataY[kind * 16 + rotate * 4 + i] * 2);
 		}else if( isWRule(player) ) {
@@ -16372,7 +15563,7 @@ void removeBigBlock(int32_t player, int32_t bx1, int32_t by1, int32_t kind, int3
 			by3 = by2 + l;
 
 			if( ( bx3 >= 0 ) && ( bx3 <= 9 ) && ( by3 >= 0 + (!spawn_y_type) ) && ( by3 <= fldsizeh[player] ) ) {
-				fld[bx3 + by3 * 10 + player * 220] = 0;
+				setFieldBlock(bx3 + by3 * 10 + player * 220, 0);
 				fldt[bx3 + by3 * 10 + player * 220] = 0;
 			}
 		}
@@ -16585,7 +15776,10 @@ void LoadTitle() {
 	}
 }
 
-void LoadBackground(int32_t plane, const char *nameStr) {
+// framesは動画のコマ数（0なら静止画）
+// 動画は1コマずつのファイル（back01_000, back01_001…）があれば少しずつ読み込み、
+// なければ従来通り全コマを並べた1枚の画像を読み込む
+void LoadBackground(int32_t plane, const char *nameStr, int32_t frames) {
 	if(skip_viewbg) return;
 
 	if ( getDrawRate() == 1 )
@@ -16593,11 +15787,13 @@ void LoadBackground(int32_t plane, const char *nameStr) {
 	else
 		SDL_snprintf(string[0], STRING_LENGTH, "res/bg/highDetail/%s", nameStr);
 
+	if((frames > 0) && APP_LoadPlaneStream(plane, string[0], frames)) return;
+
 	APP_LoadPlane(plane, string[0]);
 }
 
 void loadGraphics(int32_t players) {
-	if (!load && getLastDrawRate() == getDrawRate()) {
+	if (!(load & LOAD_GRAPHICS) && getLastDrawRate() == getDrawRate()) {
 		return;
 	}
 
@@ -16796,25 +15992,25 @@ void loadBG(int32_t players){
 	int32_t i, j, k, tr,max;
 	int32_t movframe, framemax, tmp1, tmp2;
 
-	if (load || getLastDrawRate() != getDrawRate()) {
+	if ((load & LOAD_GRAPHICS) || getLastDrawRate() != getDrawRate()) {
 		/* プレーン10〜にバックを読み込み */
-		LoadBackground(PLANE_BACK01, "back01");
-		LoadBackground(PLANE_BACK02, "back02");
-		LoadBackground(PLANE_BACK03, "back03");
-		LoadBackground(PLANE_BACK04, "back04");
-		LoadBackground(PLANE_BACK05, "back05");
-		LoadBackground(PLANE_BACK06, "back06");
-		LoadBackground(PLANE_BACK07, "back07");
-		LoadBackground(PLANE_BACK08, "back08");
-		LoadBackground(PLANE_BACK09, "back09");
-		LoadBackground(PLANE_BACK10, "back10");
-		LoadBackground(PLANE_BACK11, "back11");
-		LoadBackground(PLANE_BACK12, "back12");
+		LoadBackground(PLANE_BACK01, "back01", back_mov_f[0]);
+		LoadBackground(PLANE_BACK02, "back02", back_mov_f[1]);
+		LoadBackground(PLANE_BACK03, "back03", back_mov_f[2]);
+		LoadBackground(PLANE_BACK04, "back04", back_mov_f[3]);
+		LoadBackground(PLANE_BACK05, "back05", back_mov_f[4]);
+		LoadBackground(PLANE_BACK06, "back06", back_mov_f[5]);
+		LoadBackground(PLANE_BACK07, "back07", back_mov_f[6]);
+		LoadBackground(PLANE_BACK08, "back08", back_mov_f[7]);
+		LoadBackground(PLANE_BACK09, "back09", back_mov_f[8]);
+		LoadBackground(PLANE_BACK10, "back10", back_mov_f[9]);
+		LoadBackground(PLANE_BACK11, "back11", back_mov_f[10]);
+		LoadBackground(PLANE_BACK12, "back12", back_mov_f[11]);
 
 		if(vsbg == 1)
-			LoadBackground(PLANE_BACK, "back_vs");
+			LoadBackground(PLANE_BACK, "back_vs", back_mov_f[12]);
 		else
-			LoadBackground(PLANE_BACK, "back01");
+			LoadBackground(PLANE_BACK, "back01", back_mov_f[0]);
 	}
 
 	max = 22;
@@ -16872,7 +16068,7 @@ void loadBG(int32_t players){
 /* 効果音読み込み */
 // initializeから独立 #1.60c7o5
 void loadWaves(void) {
-	if (!load) {
+	if (!(load & LOAD_SE)) {
 		return;
 	}
 
@@ -16944,13 +16140,13 @@ void loadBGM(void) {
 	APP_StopMusic();
 
 	if (wavebgm & WAVE_BGM_SIMPLE) {
-		if (load) {
+		if (load & LOAD_BGM) {
 			APP_LoadMusic("res/bgm/bgm_leadin", "res/bgm/bgm");
 		}
 		APP_SetMusicVolume(bgmvolume);
 		APP_PlayMusic();
 	}
-	else if (load) {
+	else if (load & LOAD_BGM) {
 		APP_LoadWave(WAVE_BGM_BGM01, "res/bgm/bgm01_leadin", "res/bgm/bgm01", true, true);					// bgmlv 0 プレイ中（MASTER   0〜499）playwave(50)
 		APP_LoadWave(WAVE_BGM_BGM02, "res/bgm/bgm02_leadin", "res/bgm/bgm02", true, true);					// bgmlv 1 プレイ中（MASTER 500〜899）
 		APP_LoadWave(WAVE_BGM_BGM03, "res/bgm/bgm03_leadin", "res/bgm/bgm03", true, true);					// bgmlv 2 プレイ中（MASTER 900〜998、DEVIL 0〜499）
@@ -17058,62 +16254,7 @@ void shutDown() {
 //  halt;
 //▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
 void spriteTime() {
-#if		0
-	int32_t ReSize, i, j;
-
-	if(IsPushKey(ssKey)) {			// スナップショット #1.60c
-		SDL_snprintf(string[0], STRING_LENGTH, "ss\\ss_%04d.png", ssc);
-		if( screenMode < 4 ) {
-			SwapToSecondary(PLANE_TEMP);
-			SaveBitmap(string[0], PLANE_TEMP, 0, 0, sw, sh);
-			SwapToSecondary(PLANE_TEMP);
-		} else {
-			SaveBitmap(string[0], PLANE_TEMP, 0, 0, sw, sh);
-		}
-		ssc++;
-	}
-
-	if(oncap && !(count % capi)) {	// 連続スナップ
-		SDL_snprintf(string[0], STRING_LENGTH, "cap\\hc%06d.png", capc);
-		SwapToSecondary(PLANE_TEMP);
-		SaveBitmap(string[0], PLANE_TEMP, capx, capy, capw, caph);
-		SwapToSecondary(PLANE_TEMP);
-		capc++;
-	}
-	if(IsPushKey(capKey)) oncap = !oncap;
-
-	if( screenMode >= 4 ) {
-		if(screenMode == 4) { ReSize = 25; }
-		else if(screenMode == 5) { ReSize = 32; }
-		else if(screenMode == 6) { ReSize = 40; }
-		else { ReSize = 10; }
-		SwapToSecondary(PLANE_TEMP);		// セカンダリプレーンを、ダミーでプレーン9と入れ替える
-		ExBltRectScaled(PLANE_TEMP, 0, 0, 0, 0, 320, 240, (65536 * ReSize) / 10 / getDrawRate(), (65536 * ReSize) / 10 / getDrawRate());
-		SwapToSecondary(PLANE_TEMP);
-		ExBltFast(PLANE_TEMP, 0, 0);
-	}
-
-	// ESCキーが押されたら即刻終了
-	if(IsPushQuit()) {
-		//RankingSave();
-		//ST_RankingSave();
-		maxPlay = tmp_maxPlay;
-		if(playback){
-			restoreSetups();
-			if(!tmp_maxPlay)
-				maxPlay = 0;
-		}
-		SaveConfig();
-		Quit();
-	}
-
-	halt;
-
-	PlayAllSE();
-
-	ClearSecondary();
-#endif
-
+	advanceHudStrings();
 	if (quitNow() || !APP_Update()) {
 		shutDown();
 		mainLoopState = MAIN_QUIT;
@@ -17124,6 +16265,17 @@ void spriteTime() {
 
 	#ifdef APP_ENABLE_KEYBOARD_INPUT
 	updateEscapeFrames();
+
+	// 連続スナップの開始/終了
+	if(APP_IsPushKey(capKey)) {
+		if(APP_IsCapturing()) {
+			capc = APP_StopCapture();
+		} else {
+			if(!APP_StartCapture(capi, capx * getDrawRate(), capy * getDrawRate(), capw * getDrawRate(), caph * getDrawRate(), capc))
+				SDL_Log("Could not start frame capture: %s", SDL_GetError());
+		}
+		oncap = APP_IsCapturing();
+	}
 	#endif
 
 	switch (lastInputType = APP_GetLastInputType()) {
@@ -5,10 +5,16 @@
 //  外部ライブラリのインポート
 //▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
 #include "app/APP.h"
+#include "randomizer.h"
+#include "speed.h"
 
 #define 	TEXT_LAYER_COUNT	16
 #define		STRING_LENGTH		512
 #define		STRING_COUNT		200
+#ifndef OBJECT_MAX
+#define		OBJECT_MAX		400	// 同時に出せるエフェクトオブジェクトの数
+#endif
+#define		OBJECT_TYPE_COUNT	14	// エフェクトオブジェクトの種類の数
 #define		loop			while ( loopFlag )
 #define		halt			spriteTime()
 #define		ctime			cgametime
@@ -19,7 +25,7 @@
 #define		waitt			gamewaitt
 
 void loadBG(int32_t players);
-void LoadBackground(int32_t plane,const char *nameStr);
+void LoadBackground(int32_t plane,const char *nameStr,int32_t frames);
 void LoadTitle();
 void loadBGM(void);
 void loadWaves(void);
@@ -110,14 +116,8 @@ void winner();
 int32_t doGiveup();
 int32_t gameRand(int32_t max,int32_t player);
 int32_t isWRule(int32_t player);
-void tgmNextInit(int32_t player);
-void tgm3NextInit(int32_t player);
-void SakuraNextInit(int32_t player);
-int32_t MostDroughtedPiece(int32_t histogram[7]);
-void guidelineNextInit(int32_t player);
-int32_t TGMPiece(uint32_t *tgmgseed);
-uint32_t LCGRand(uint32_t *lcgseed);
-int32_t TGMConvert(int32_t piece);
+void startNextGenerator(int32_t player, NextAlgorithm algorithm, int32_t params);
+void refillNextBlocks(int32_t player);
 void playerInitial(int32_t player);
 void setNextBlockColors(int32_t player,int32_t first);
 void gameAllInit(void);
@@ -125,6 +125,10 @@ void versusInit(int32_t player);
 void enterMissionMode(void);
 void enterPracticeMode(void);
 void setStartLevel(int32_t pl);
+void setWaits(int32_t player, const WaitTable *table, int32_t index);
+void updateSpeedSchedule(int32_t player);
+void applySpeedStep(int32_t player, int32_t index);
+int32_t isDevilMinusWaits(int32_t player);
 void enterVersusMode(void);
 void enterSoloMode(int32_t player);
 void padRepeat2(int32_t player);
@@ -182,6 +186,12 @@ typedef enum EMainLoopState {
 	MAIN_CONFIG,
 	MAIN_SOUND_TEST,
 	MAIN_TEST_MENU,
+	#ifdef APP_REPLAY_BENCHMARK
+	MAIN_REPLAY_BENCHMARK,
+	#endif
+	#ifdef APP_REPLAY_RENDER
+	MAIN_REPLAY_RENDER,
+	#endif
 	#ifdef APP_ENABLE_KEYBOARD_INPUT
 	MAIN_RESET_KEYBOARD,
 	#endif
@@ -196,6 +206,7 @@ extern uint32_t SegaSeed[2];
 extern uint32_t BloxeedSeed[2];
 extern uint32_t SavedSeed[2];
 extern uint32_t PieceSeed;
+extern NextGenerator nextGenerator[2];
 extern bool inmenu;
 extern APP_InputType lastInputType;
 extern APP_InputType lastPlayerInputType[2];
@@ -366,6 +377,7 @@ extern int32_t border_time59[20];
 extern int32_t border_time[20];
 extern int32_t border_rank[2];
 extern int32_t tr2[2];
+extern SpeedSchedule speedSchedule[2];
 extern int32_t skillflag[2];
 extern int32_t qualityflag[2];
 extern int32_t gup3sp_adjust[2];
@@ -596,7 +608,7 @@ extern int32_t b_waitt[2];
 extern int32_t b_wait3[2];
 extern int32_t b_wait2[2];
 extern int32_t b_wait1[2];
-extern int32_t objp[100];
+extern int32_t objp[OBJECT_MAX];
 extern int32_t dead_blockframe;
 extern int32_t p_goaltypenumlist[10];
 extern int32_t p_goaltypenum;
@@ -778,7 +790,7 @@ extern int32_t nextc[2];
 extern int32_t nextb[1400 *2];
 extern int32_t upLines[2];
 extern int32_t lc[2],sp[2];
-extern int32_t obj[100],objx[100],objy[100],objv[100],objw[100],objj[100],objc[100],obja[100];
+extern int32_t obj[OBJECT_MAX],objx[OBJECT_MAX],objy[OBJECT_MAX],objv[OBJECT_MAX],objw[OBJECT_MAX],objj[OBJECT_MAX],objc[OBJECT_MAX],obja[OBJECT_MAX];
 extern int32_t erase[22 *2];
 extern int32_t mps[2 *2];
 extern int32_t mp[2],mpc[2];
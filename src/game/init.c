@@ -185,7 +185,7 @@ void gameInit() {
 	//**********************************************************
 	// 連続スナップ
 	//**********************************************************
-	// 注意：HEBORIS.EXEがあるフォルダ以下にcapフォルダを作らないと動作しません。
+	// 書き込み先のcapフォルダに hc000000.png から連番で保存されます。
 	capKey = SDL_SCANCODE_PRINTSCREEN;	//開始/終了キー
 	capi = 2;	//取得間隔(フレーム単位)
 	capx = 0;	//取得領域の左上X座標
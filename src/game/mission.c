@@ -1216,10 +1216,7 @@ void missionSetStatus() {
 	} else if((mission_type[c_mission] == 10) || (mission_type[c_mission] == 23)) {
 		// アナザー&耐久
 		sp[0] = 1200;
-		wait1[0] = wait1_Acea_tbl[mission_lv[c_mission]];
-		wait2[0] = wait2_Acea_tbl[mission_lv[c_mission]];
-		wait3[0] = wait3_Acea_tbl[mission_lv[c_mission]];
-		waitt[0] = waitt_Acea_tbl[mission_lv[c_mission]];
+		setWaits(0, &aceaWaits, mission_lv[c_mission]);
 	} else if(((mission_type[c_mission] >= 11) && (mission_type[c_mission] <= 18)) || (mission_type[c_mission] == 21)) {
 		// X-RAY以降。テキトー
 		if((repversw < 56) || (mission_file == 6))
@@ -1233,29 +1230,17 @@ void missionSetStatus() {
 	} else if(mission_type[c_mission] == 19) {
 		// DEVIL 800
 		sp[0] = 1200;
-		wait1[0] = wait1_devil_tbl32[8];
-		wait2[0] = wait2_devil_tbl32[8];
-		wait3[0] = wait3_devil_tbl32[8];
-		waitt[0] = waitt_devil_tbl32[8];
+		setWaits(0, &devilWaits32, 8);
 	} else if(mission_type[c_mission] == 20) {
 		// DEVIL 1200
 		sp[0] = 1200;
 		if(!mission_opt_3[c_mission]){
-			wait1[0] = wait1_devil_tbl32[12];
-			wait2[0] = wait2_devil_tbl32[12];
-			wait3[0] = wait3_devil_tbl32[12];
-			waitt[0] = waitt_devil_tbl32[12];
+			setWaits(0, &devilWaits32, 12);
 		} else {
 			if(repversw < 60){
-				wait1[0] = wait1_devil_tbl[12];
-				wait2[0] = wait2_devil_tbl[12];
-				wait3[0] = wait3_devil_tbl[12];
-				waitt[0] = waitt_devil_tbl[12];
+				setWaits(0, &devilWaits, 12);
 			}else{
-				wait1[0] = wait1_doom_tbl[12];
-				wait2[0] = wait2_doom_tbl[12];
-				wait3[0] = wait3_doom_tbl[12];
-				waitt[0] = waitt_doom_tbl[12];
+				setWaits(0, &doomWaits, 12);
 			}
 		}
 	} else if(mission_type[c_mission] == 22) {
@@ -1280,21 +1265,12 @@ void missionSetStatus() {
 	//+
 	if((mission_lv[c_mission] >= 15) && (mission_type[c_mission] != 20)){
 		sp[0] = 1200;
-		wait1[0] = wait1_Acea_tbl[mission_lv[c_mission] - 15];
-		wait2[0] = wait2_Acea_tbl[mission_lv[c_mission] - 15];
-		wait3[0] = wait3_Acea_tbl[mission_lv[c_mission] - 15];
-		waitt[0] = waitt_Acea_tbl[mission_lv[c_mission] - 15];
+		setWaits(0, &aceaWaits, mission_lv[c_mission] - 15);
 		if(mission_type[c_mission] == 19){
 			if(repversw < 60){
-				wait1[0] = wait1_devil_tbl[8];
-				wait2[0] = wait2_devil_tbl[8];
-				wait3[0] = wait3_devil_tbl[8];
-				waitt[0] = waitt_devil_tbl[8];
+				setWaits(0, &devilWaits, 8);
 			}else{
-				wait1[0] = wait1_doom_tbl[8];
-				wait2[0] = wait2_doom_tbl[8];
-				wait3[0] = wait3_doom_tbl[8];
-				waitt[0] = waitt_doom_tbl[8];
+				setWaits(0, &doomWaits, 8);
 			}
 		}
 	}
@@ -1550,25 +1526,20 @@ statusc[0 * 10 + 6] = mission_opt_3[c_mission];
 /* ロード */
 void loadMissionData(int32_t number) {
 	int32_t i;
-
-	SDL_memset(saveBuf, 0, 50000 * 4);
-
-	SDL_snprintf(string[0], STRING_LENGTH, "config/mission/mission%02d.sav", number);
-
-	APP_ReadFile32(string[0], saveBuf, 930, 0);
+	const int32_t *data = getMissionData(number);
 
 	// 問題データを読み込み
 	for(i = 0; i < 30; i++) {
-		mission_type[i]  = saveBuf[(i + 1) * 20 + 0];	// 種類
-		mission_norm[i]  = saveBuf[(i + 1) * 20 + 1];	// ノルマ
-		mission_time[i]  = saveBuf[(i + 1) * 20 + 2];	// 制限時間
-		mission_end[i]   = saveBuf[(i + 1) * 20 + 3];	// 終了フラグ
-		mission_lv[i]    = saveBuf[(i + 1) * 20 + 4];	// レベル
-		mission_erase[i] = saveBuf[(i + 1) * 20 + 5];	// クリア時に上から消去するライン数
-		mission_opt_1[i] = saveBuf[(i + 1) * 20 + 6];	// 追加情報１（下限）
-		mission_opt_2[i] = saveBuf[(i + 1) * 20 + 7];	// 追加情報２（上限）
-		mission_opt_3[i] = saveBuf[(i + 1) * 20 + 8];	// 追加情報３（イレイサーだと本数、SHIRASE800はせり上がり間隔、他は未使用）
-		mission_bgm[i]   = saveBuf[(i + 1) * 20 + 9];	// BGM
+		mission_type[i]  = data[(i + 1) * 20 + 0];	// 種類
+		mission_norm[i]  = data[(i + 1) * 20 + 1];	// ノルマ
+		mission_time[i]  = data[(i + 1) * 20 + 2];	// 制限時間
+		mission_end[i]   = data[(i + 1) * 20 + 3];	// 終了フラグ
+		mission_lv[i]    = data[(i + 1) * 20 + 4];	// レベル
+		mission_erase[i] = data[(i + 1) * 20 + 5];	// クリア時に上から消去するライン数
+		mission_opt_1[i] = data[(i + 1) * 20 + 6];	// 追加情報１（下限）
+		mission_opt_2[i] = data[(i + 1) * 20 + 7];	// 追加情報２（上限）
+		mission_opt_3[i] = data[(i + 1) * 20 + 8];	// 追加情報３（イレイサーだと本数、SHIRASE800はせり上がり間隔、他は未使用）
+		mission_bgm[i]   = data[(i + 1) * 20 + 9];	// BGM
 	}
 }
 
@@ -1576,7 +1547,7 @@ void loadMissionData(int32_t number) {
 void saveMissionData(int32_t number) {
 	int32_t i;
 
-	SDL_memset(saveBuf, 0, 50000 * 4);
+	SDL_memset(saveBuf, 0, MISSION_DATA_SIZE * sizeof(int32_t));
 
 	// ヘッダ
 	saveBuf[0] = 1;
@@ -1595,6 +1566,5 @@ void saveMissionData(int32_t number) {
 		saveBuf[(i + 1) * 20 + 9] = mission_bgm[i];		// BGM
 	}
 
-	SDL_snprintf(string[0], STRING_LENGTH, "config/mission/mission%02d.sav", number);
-	APP_WriteFile32(string[0], saveBuf, 930);
+	putMissionData(number, saveBuf);
 }
@@ -110,4 +110,14 @@ typedef enum PlaneNum
 	PLANE_COUNT
 } PlaneNum;
 
+// キャッシュレイヤー（変化の少ない描画をまとめて保持する）
+typedef enum CacheLayerNum
+{
+	CACHE_LAYER_FIELD1,
+	CACHE_LAYER_FIELD2,
+	CACHE_LAYER_BACK,
+
+	CACHE_LAYER_COUNT
+} CacheLayerNum;
+
 #endif
@@ -950,7 +950,7 @@ void statSelectLevel(int32_t player) {
 				loadTomoyoStage(0,p_stage);	// 読み込み
 			} else {
 				for(i=0;i<220;i++) {
-					fld[i] = 0;
+					setFieldBlock(i, 0);
 					fldt[i] = -1;
 				}
 			}
@@ -1135,11 +1135,11 @@ void PracticeOver(void) {
 	// 1Pの結果を2Pにコピー (from hogeパッチ)
 	if(maxPlay){
 		for(i = 0; i < 220; i++) {// hoge
-			fld[i + 220] = fld[i];// 1Pのフィールドを2P側(RESULT)にコピー
+			setFieldBlock(i + 220, fld[i]);// 1Pのフィールドを2P側(RESULT)にコピー
 			fldt[i + 220] = (fld[i] > 0) * -1 ;// 1Pのフィールドを2P側(RESULT)にコピー
 			fldi[i + 220] = fldi[i];
 			fldu[i + 220] = 0;
-			flds[i + 220] = flds[i];
+			setFieldSquare(i + 220, flds[i]);
 		}
 
 		sc[1] = sc[0];				// hoge 1Pの成績等を2P側にコピー
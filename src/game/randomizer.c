@@ -0,0 +1,418 @@
+#include "randomizer.h"
+
+// LCG.  may be used to avoid storing whole piece sequences. ALL TGM games appear to use it :) Slight bias for I piece, since 0=I. Aren't we nice?
+uint32_t LCGRand(uint32_t *lcgseed)
+{
+	uint32_t lcgadd=12345; // default for all TGM games, as far as I know
+
+	uint32_t lcgmultiply=0x41c64e6d; // default for TAP/TI? Good enough for Arika, good enough for us.
+	*lcgseed=(*lcgseed)*lcgmultiply+lcgadd; // happily ignore overflow
+	return (*lcgseed>>10) & 0x7fff; //return 15 bits after discarding 10 least significant, which provides mostly balanced mod 7 distribution, in theory. :)
+}
+// convert pieces from tgm numbers to heboris numbers. Use on pieces you get from LCGRand to duplicate real TGM seeds.
+int32_t TGMConvert(int32_t piece)
+{
+	int32_t retval;
+	switch (piece)	  //
+	{
+	case 1: retval = 3; break;
+	case 2: retval = 6; break;
+	case 3: retval = 5; break;
+	case 4: retval = 1; break;
+	case 5: retval = 2; break;
+	case 6: retval = 4; break;
+	default: retval = piece; break; // I is correct
+	}
+	return retval;
+
+}
+// combine them into one function and mod 7 :)
+int32_t TGMPiece(uint32_t *tgmseed)
+{
+	return TGMConvert(LCGRand(tgmseed)%7); // already a pointer
+}
+
+int32_t MostDroughtedPiece(int32_t histogram[7])
+{
+	int32_t DroughtedPiece = 0; // assume it's an i until we know otherwise
+	int32_t DroughtLength = 0; // get drought length  of I piece
+	for (int32_t position = 0; position < 7; position++)
+	{
+		if (histogram[position] > DroughtLength)
+		{
+			DroughtedPiece = position;
+			DroughtLength = histogram[position];
+		}
+	}
+	return DroughtedPiece; // don't need to convert
+}
+
+// 初手生成
+// next_adjustが動作してなかったのでとりあえず修正 #1.60c7i4
+static int32_t tgmFirstPiece(TGMRandomizer *randomizer) {
+	int32_t block;
+
+	if (randomizer->nextAdjust) {
+		do {
+			block = TGMPiece(&randomizer->seed);
+		} while ((block == 2) || (block == 3) || (block == 6));
+	}
+	else {
+		block = TGMPiece(&randomizer->seed);
+	}
+	return block;
+}
+
+static void tgmPushHistory(TGMRandomizer *randomizer, int32_t block) {
+	int32_t j;
+
+	// 履歴をずらす
+	for (j = 0; j < 3; j++) {
+		randomizer->history[3 - j] = randomizer->history[3 - (j + 1)];
+	}
+
+	// 履歴に新しいブロックを入れる
+	randomizer->history[0] = block;
+}
+
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  TGM風なNEXT生成処理#1.60c7h4
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+void tgmRandomizerInit(TGMRandomizer *randomizer, uint32_t seed, bool nextAdjust) {
+	randomizer->seed = seed;
+	randomizer->nextAdjust = nextAdjust;
+	randomizer->first = true;
+
+	//	for(i = 0; i < 4; i++) history[i] = 3; // 履歴を緑で埋める
+
+		// Z S Z Sで埋める c7t3.1
+	randomizer->history[0] = 3;
+	randomizer->history[1] = 6;
+	randomizer->history[2] = 3;
+	randomizer->history[3] = 6;
+}
+
+int32_t tgmRandomizerNext(TGMRandomizer *randomizer) {
+	int32_t j;
+	int32_t block;
+	int32_t *history = randomizer->history;
+
+	if (randomizer->first) {
+		block = tgmFirstPiece(randomizer);
+		randomizer->first = false;
+	}
+	else {
+		// ツモを引く
+
+		// 引いたツモが履歴にあったら最大4回引き直し→6回に変更c7t3.1	これもリプレイには影響なし？
+		for (j = 0; j < 6; j++) {
+			block = TGMPiece(&randomizer->seed); //  tap bug. this is supposed to be above the loop.
+
+			// 4つの履歴に無かったらその場で抜ける
+			if ((block != history[0]) && (block != history[1]) && (block != history[2]) && (block != history[3]))
+				break;
+			block = TGMPiece(&randomizer->seed); // the actual intended reroll.
+		}
+	}
+
+	// 初手生成時に履歴がずれていなかった LITE30.20より C7U1.5
+	tgmPushHistory(randomizer, block);
+
+	return block;
+}
+
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  TGM3 NEXT
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+void tgm3RandomizerInit(TGMRandomizer *randomizer, uint32_t seed, bool nextAdjust) {
+	static const int32_t dp_bag[35] = { 0,0,0,0,0,3,3,3,3,3,6,6,6,6,6,5,5,5,5,5,1,1,1,1,1,2,2,2,2,2,4,4,4,4,4 }; // used to tryand prevent droughts  i,z,s,j,l,o,t
+	int32_t i;
+
+	tgmRandomizerInit(randomizer, seed, nextAdjust);	// init history to Z S Z S
+	for (i = 0; i < 7; i++) randomizer->histogram[i] = 4;
+	for (i = 0; i < 35; i++) randomizer->bag[i] = dp_bag[i];
+}
+
+int32_t tgm3RandomizerNext(TGMRandomizer *randomizer) {
+	int32_t j;
+	int32_t block,bagpos,bugdrought,droughtlength,maxdroughtlength;
+	int32_t *history = randomizer->history;
+	int32_t *histogram = randomizer->histogram;
+	int32_t *dp_bag = randomizer->bag;
+
+	if (randomizer->first) {
+		// next_adjust
+		block = tgmFirstPiece(randomizer);
+		randomizer->first = false;
+
+		// piece falls off history
+		// queue the non s/z/o piece in it
+		tgmPushHistory(randomizer, block);
+		// update histogram
+		// increment all seven
+		for (j = 0; j < 7; j++) histogram[j]++;
+		histogram[block] = 0; // zero the piece we just saw. will be duplicated later
+		return block;
+	}
+
+	for (j = 0; j < 6; j++) {
+		bugdrought = -1; // start with no bug.
+
+		bagpos = LCGRand(&randomizer->seed)%35;  //  initial roll
+		block = dp_bag[bagpos];
+
+		// is piece in history?
+		if ((block != history[0]) && (block != history[1]) && (block != history[2]) && (block != history[3]))
+			break;  // out of the loop if not
+		// it was in history, so we replace it with the most droughted piece for the reroll.
+		dp_bag[bagpos] = MostDroughtedPiece(histogram);
+		bugdrought= MostDroughtedPiece(histogram);
+		// same bug from tap here. previos roll should have been outside the loop.
+		bagpos = LCGRand(&randomizer->seed) % 35;  //  initial roll
+		block = dp_bag[bagpos];
+
+	}
+	// now we have our current piece
+	// but we must check the bug.
+	// calculate highest drought length before update the histogram
+	droughtlength = 0;
+	for (int32_t position = 0; position < 7; position++)
+	{
+		if (histogram[position] > droughtlength)
+		{
+			droughtlength = histogram[position];
+		}
+	}
+	maxdroughtlength = droughtlength;  // remember for later check.
+
+	// update histogram
+	// increment all seven
+	for (j = 0; j < 7; j++) histogram[j]++;
+	histogram[block] = 0; // zero the piece we just saw.
+	// now for the bug.
+	// if two pieces shared the same drought length, one of them will have incremented.
+	for (int32_t position = 0; position < 7; position++)
+	{
+		if (histogram[position] > droughtlength)
+		{
+			droughtlength = histogram[position];
+		}
+	}
+	if (bugdrought < 0)
+	{
+		// no reroll happened, update the bag regardless
+		dp_bag[bagpos] = MostDroughtedPiece(histogram);
+	}
+	else if (droughtlength > maxdroughtlength)
+	{
+		// no bug, time to update
+		dp_bag[bagpos] = MostDroughtedPiece(histogram);
+	}
+	// update history
+	tgmPushHistory(randomizer, block);
+
+	return block;
+}
+
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  Sakura風NEXT
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+void sakuraRandomizerInit(SakuraRandomizer *randomizer, uint32_t seed) {
+	int32_t i;
+
+	randomizer->seed = seed;
+
+	// empty history. piece can never be a seven, so that's placeholder.
+	for (i = 0; i < 6; i++) randomizer->history[i] = 7;
+}
+
+// by Arika's superplay, next adjust doesn't happen.
+// a bit different from normal memory 4
+int32_t sakuraRandomizerNext(SakuraRandomizer *randomizer) {
+	int32_t j;
+	int32_t block;
+	int32_t *history = randomizer->history;
+
+	// pick random block
+	block = TGMPiece(&randomizer->seed);
+
+	// four rerolls, with special roll for 5
+	if((block == history[0]) || (block == history[1]) || (block == history[2]) || (block == history[3]) || (block == history[4]) || (block == history[5])) {
+		for(j = 0; j < 4; j++) {
+			block = TGMPiece(&randomizer->seed);
+
+			// 4つの履歴に無かったらその場で抜ける
+			if((block != history[0]) && (block != history[1]) && (block != history[2]) &&(block != history[3]) &&(block != history[4]) && (block != history[5]))
+				break;
+		}
+	}
+	// if still in history.
+	if((block == history[0]) || (block == history[1]) || (block == history[2]) || (block == history[3]) || (block == history[4]) || (block == history[5]))
+	{
+		// flip a coin between second and sixth.
+		block=history[LCGRand(&randomizer->seed)%2*4+1]; // can't use shortcut.
+	}
+	// if that was a 7, because it wasn't initialized yet
+	if (block==7)
+	{
+		// then pick a random piece
+		block = TGMPiece(&randomizer->seed); // no more repeat checks.
+	}
+	// push up history
+	for(j=0;j<5;j++) {
+		history[5 - j] = history[5 - (j + 1)];
+	}
+
+	// add block to history.
+	history[0] = block;
+
+	return block;
+}
+
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  ガイドライン対応ゲーム風なNEXT生成処理
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+void guidelineRandomizerInit(GuidelineRandomizer *randomizer, uint32_t seed, bool nextAdjust) {
+	randomizer->seed = seed;
+	randomizer->nextAdjust = nextAdjust;
+	randomizer->first = true;
+	randomizer->count = 0;
+}
+
+int32_t guidelineRandomizerNext(GuidelineRandomizer *randomizer) {
+	int32_t j;
+	int32_t tmp;
+	int32_t *block = randomizer->block;
+
+	if(randomizer->first) {
+		randomizer->first = false;
+
+		//初手　ガイドライン風にもnextadjustを適用
+		if(randomizer->nextAdjust) {
+			//初期化
+			for(j = 0; j < 7; j++) block[j] = 0;
+
+			do {
+				tmp = TGMPiece(&randomizer->seed);
+			} while((tmp == 2) || (tmp == 3) || (tmp == 6));
+
+			// ブロックが出たフラグON
+			block[tmp] = 1;
+			randomizer->count = 1;
+			return tmp;
+		}
+	}
+
+	// 初期化	nextadjust適用時、最初は初期化しない
+	if(randomizer->count == 0)
+		for(j = 0; j < 7; j++) block[j] = 0;
+
+	// ツモ作成
+	do {
+		tmp = TGMPiece(&randomizer->seed);	// ツモを引く
+	} while(block[tmp] == 1);
+
+	// ブロックが出たフラグON
+	block[tmp] = 1;
+	randomizer->count = (randomizer->count + 1) % 7;
+	return tmp;
+}
+
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  nextblock 1～7のNEXT生成処理
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+void historyRandomizerInit(HistoryRandomizer *randomizer, uint32_t seed, bool nextAdjust, int32_t shu, int32_t limit) {
+	randomizer->seed = seed;
+	randomizer->nextAdjust = nextAdjust;
+	randomizer->first = true;
+	randomizer->shu = shu;
+	randomizer->limit = limit;
+	randomizer->same = limit;
+	randomizer->mae = -1;
+	randomizer->count = 0;
+}
+
+int32_t historyRandomizerNext(HistoryRandomizer *randomizer) {
+	int32_t j, k, temp;
+	int32_t *nextwork = randomizer->work;
+
+	if(randomizer->count == 0) {
+		for(j = 0; j < 7; j++) nextwork[j] = 0;
+		randomizer->same = randomizer->same - (randomizer->same > 0);
+	}
+
+	do {
+		//初手
+		if(randomizer->first && randomizer->nextAdjust) {
+			do {
+				temp = TGMPiece(&randomizer->seed);
+			} while((temp != 0) && (temp != 1) && (temp != 4) && (temp != 5));
+		} else
+			temp = TGMPiece(&randomizer->seed);
+
+		if((randomizer->same == 0) && (randomizer->mae == temp)) {
+			k = 1;
+			randomizer->same = randomizer->limit;
+		}
+		else k = 0;
+
+	} while(((nextwork[temp] != 0) || (randomizer->mae == temp)) && (k == 0));
+
+	nextwork[temp] = 1;
+	randomizer->mae = temp;
+	randomizer->first = false;
+	randomizer->count = (randomizer->count + 1) % randomizer->shu;
+	return temp;
+}
+
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  ツモ生成器
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+bool nextGeneratorInit(NextGenerator *generator, NextAlgorithm algorithm, uint32_t seed, int32_t params) {
+	bool nextAdjust = (params & 1) != 0;
+	int32_t shu = (params >> 8) & 0xff;
+	int32_t limit = (params >> 16) & 0xffff;
+
+	generator->algorithm = algorithm;
+	generator->startSeed = seed;
+	generator->params = params;
+
+	switch(algorithm) {
+	case NEXT_ALGORITHM_HISTORY:
+		if((shu < 1) || (shu > 7)) break;
+		historyRandomizerInit(&generator->state.history, seed, nextAdjust, shu, limit);
+		return true;
+	case NEXT_ALGORITHM_TGM:
+		tgmRandomizerInit(&generator->state.tgm, seed, nextAdjust);
+		return true;
+	case NEXT_ALGORITHM_TGM3:
+		tgm3RandomizerInit(&generator->state.tgm, seed, nextAdjust);
+		return true;
+	case NEXT_ALGORITHM_SAKURA:
+		sakuraRandomizerInit(&generator->state.sakura, seed);
+		return true;
+	case NEXT_ALGORITHM_GUIDELINE:
+		guidelineRandomizerInit(&generator->state.guideline, seed, nextAdjust);
+		return true;
+	default:
+		break;
+	}
+	generator->algorithm = NEXT_ALGORITHM_NONE;
+	return false;
+}
+
+#define NEXT_GENERATOR_FILL(next, randomizer) \
+	for(i = 0; i < count; i++) pieces[i] = next(&generator->state.randomizer)
+
+void nextGeneratorFill(NextGenerator *generator, int32_t *pieces, int32_t count) {
+	int32_t i;
+
+	switch(generator->algorithm) {
+	case NEXT_ALGORITHM_HISTORY:   NEXT_GENERATOR_FILL(historyRandomizerNext, history); break;
+	case NEXT_ALGORITHM_TGM:       NEXT_GENERATOR_FILL(tgmRandomizerNext, tgm); break;
+	case NEXT_ALGORITHM_TGM3:      NEXT_GENERATOR_FILL(tgm3RandomizerNext, tgm); break;
+	case NEXT_ALGORITHM_SAKURA:    NEXT_GENERATOR_FILL(sakuraRandomizerNext, sakura); break;
+	case NEXT_ALGORITHM_GUIDELINE: NEXT_GENERATOR_FILL(guidelineRandomizerNext, guideline); break;
+	default: break;
+	}
+}
@@ -0,0 +1,113 @@
+#ifndef randomizer_h_
+#define randomizer_h_
+
+// TGM系のツモ生成
+// ゲーム本体以外（シード探索ツールなど）からも使えるよう、SDLやゲームの変数には依存しない
+// TGM style piece randomizers. These don't depend on SDL or any game state, so
+// tools outside the game (like the seed search tool) can share them.
+// Every randomizer here is driven only by the LCG seed, so a sequence can be
+// regenerated from its seed and parameters at any time.
+
+#include <stdint.h>
+#include <stdbool.h>
+
+uint32_t LCGRand(uint32_t *lcgseed);
+int32_t TGMConvert(int32_t piece);
+int32_t TGMPiece(uint32_t *tgmseed);
+int32_t MostDroughtedPiece(int32_t histogram[7]);
+
+// The state of a TGM/TGM3 randomizer, advanced one piece at a time. The seed
+// is the LCG state, the same as PieceSeed in the game.
+typedef struct TGMRandomizer {
+	uint32_t seed;
+	bool nextAdjust;		// 初手にS・Z・Oを出さない
+	bool first;
+	int32_t history[4];
+	int32_t histogram[7];	// TGM3のみ
+	int32_t bag[35];		// TGM3のみ
+} TGMRandomizer;
+
+// TGM (memory 4, 6 rolls, including TAP's reroll bug)
+void tgmRandomizerInit(TGMRandomizer *randomizer, uint32_t seed, bool nextAdjust);
+int32_t tgmRandomizerNext(TGMRandomizer *randomizer);
+
+// TGM3 (35 piece drought bag, including TI's histogram bug)
+void tgm3RandomizerInit(TGMRandomizer *randomizer, uint32_t seed, bool nextAdjust);
+int32_t tgm3RandomizerNext(TGMRandomizer *randomizer);
+
+// Sakura (memory 6, 4 rolls, then a coin flip between the 2nd and 6th history)
+typedef struct SakuraRandomizer {
+	uint32_t seed;
+	int32_t history[6];
+} SakuraRandomizer;
+
+void sakuraRandomizerInit(SakuraRandomizer *randomizer, uint32_t seed);
+int32_t sakuraRandomizerNext(SakuraRandomizer *randomizer);
+
+// ガイドライン風 (7種1巡)
+typedef struct GuidelineRandomizer {
+	uint32_t seed;
+	bool nextAdjust;
+	bool first;
+	int32_t count;			// 今の1巡で何個出たか
+	int32_t block[7];		// ブロックが出たかどうかのフラグ
+} GuidelineRandomizer;
+
+void guidelineRandomizerInit(GuidelineRandomizer *randomizer, uint32_t seed, bool nextAdjust);
+int32_t guidelineRandomizerNext(GuidelineRandomizer *randomizer);
+
+// nextblock 1～7の、shu個ずつの組で同じブロックを出さないツモ
+// limitは同じブロックが続くのを許すまでの組の数
+typedef struct HistoryRandomizer {
+	uint32_t seed;
+	bool nextAdjust;
+	bool first;
+	int32_t shu;
+	int32_t limit;
+	int32_t same;
+	int32_t mae;
+	int32_t count;			// 今の組で何個出たか
+	int32_t work[7];
+} HistoryRandomizer;
+
+void historyRandomizerInit(HistoryRandomizer *randomizer, uint32_t seed, bool nextAdjust, int32_t shu, int32_t limit);
+int32_t historyRandomizerNext(HistoryRandomizer *randomizer);
+
+// ツモ生成器
+// A piece generator: one of the randomizers above, picked by an algorithm ID
+// that replays store together with the seed and parameters. Pieces are
+// produced in batches by nextGeneratorFill(), which switches on the algorithm
+// once per batch, so each algorithm gets its own loop with its step inlined.
+// The IDs are saved in replays; don't renumber them.
+typedef enum NextAlgorithm {
+	NEXT_ALGORITHM_NONE = 0,	// 生成器なし（パターン・完全ランダム・旧リプレイなど）
+	NEXT_ALGORITHM_HISTORY = 1,
+	NEXT_ALGORITHM_TGM = 2,
+	NEXT_ALGORITHM_TGM3 = 3,
+	NEXT_ALGORITHM_SAKURA = 4,
+	NEXT_ALGORITHM_GUIDELINE = 5
+} NextAlgorithm;
+
+// パラメータを1つの値にまとめる（リプレイ保存用）
+#define NEXT_GENERATOR_PARAMS(nextAdjust, shu, limit) ((int32_t)(((nextAdjust) ? 1 : 0) | ((shu) << 8) | ((limit) << 16)))
+
+typedef struct NextGenerator {
+	NextAlgorithm algorithm;
+	uint32_t startSeed;		// 生成開始時のシード
+	int32_t params;			// NEXT_GENERATOR_PARAMS
+	union {
+		TGMRandomizer tgm;
+		SakuraRandomizer sakura;
+		GuidelineRandomizer guideline;
+		HistoryRandomizer history;
+	} state;
+} NextGenerator;
+
+// Returns false for an unknown algorithm, leaving the generator as
+// NEXT_ALGORITHM_NONE.
+bool nextGeneratorInit(NextGenerator *generator, NextAlgorithm algorithm, uint32_t seed, int32_t params);
+
+// 続きのcount個をpiecesに生成する
+void nextGeneratorFill(NextGenerator *generator, int32_t *pieces, int32_t count);
+
+#endif
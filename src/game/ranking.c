@@ -22,7 +22,7 @@ void RankingInit(void) {
 void RankingConvert(void) {
 	int32_t	i, j, temp;
 
-	APP_ReadFile32("config/data/RANKING.SAV", saveBuf, 328, 0);
+	APP_LoadFile32("config/data/RANKING.SAV", saveBuf, 328);
 	for(i = 0; i < 40; i++) {
 		temp = (i + 1) << 3;
 		rksc[i] = saveBuf[temp + 0];
@@ -293,7 +293,7 @@ int32_t RankingView(void) {
 int32_t RankingSave(void) {
 	int32_t i, temp;
 
-	SDL_memset(saveBuf, 0, 50000 * 4);
+	SDL_memset(saveBuf, 0, 328 * 4);
 
 	// ファイルフォーマット (4byte単位)
 	//   0〜    3 ヘッダ
@@ -319,7 +319,7 @@ int32_t RankingSave(void) {
 		saveBuf[temp + 5] = rkfl[i];
 	}
 
-	APP_WriteFile32("config/data/RANKING.SAV", saveBuf, 328);
+	APP_SaveFile32("config/data/RANKING.SAV", saveBuf, 328);
 
 	return (0);
 }
@@ -327,9 +327,8 @@ int32_t RankingSave(void) {
 int32_t RankingLoad(void) {
 	int32_t i, temp;
 
-	SDL_memset(saveBuf, 0, 50000 * 4);
-
-	APP_ReadFile32("config/data/RANKING.SAV", saveBuf, 4, 0);
+	// 全部読み込み
+	APP_LoadFile32("config/data/RANKING.SAV", saveBuf, 328);
 
 	if(saveBuf[0] != 0x4F424548) return (1);
 	if(saveBuf[1] != 0x20534952) return (1);
@@ -338,8 +337,6 @@ int32_t RankingLoad(void) {
 	if(saveBuf[3] == 0x31764353) return (2);
 	else if(saveBuf[3] != 0x32764353) return (1);
 
-	APP_ReadFile32("config/data/RANKING.SAV", saveBuf, 328, 0);
-
 	for(i = 0; i < 40; i++) {
 		temp = (i + 1) << 3;
 		rksc[i] = saveBuf[temp + 0];
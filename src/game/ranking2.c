@@ -414,7 +414,7 @@ void RankingView2() {//5位まで
 void RankingSave2() {
 	int32_t i;
 
-	SDL_memset(saveBuf, 0, 5000 * 4);
+	SDL_memset(saveBuf, 0, 1654 * 4);
 
 	// ヘッダ
 	saveBuf[0] = 0x4F424549;
@@ -453,16 +453,15 @@ void RankingSave2() {
 		saveBuf[4 + i + (5 * 15 * 2) * 10] = rkrots[i];//11
 	}
 
-	APP_WriteFile32("config/data/RANKING2.SAV", saveBuf, 1654);//1654=4+(5*15*2*11)
+	APP_SaveFile32("config/data/RANKING2.SAV", saveBuf, 1654);//1654=4+(5*15*2*11)
 }
 
 // ランキングを読み込み
 int32_t RankingLoad2() {
 	int32_t i;
 
-	// ヘッダだけ読み込み
-	SDL_memset(saveBuf, 0, 5000 * 4);
-	APP_ReadFile32("config/data/RANKING2.SAV", saveBuf, 4, 0);
+	// 全部読み込み
+	APP_LoadFile32("config/data/RANKING2.SAV", saveBuf, 1654);
 
 	// バージョン違いなら初期化
 	if(saveBuf[0] != 0x4F424549) return 1;
@@ -470,9 +469,6 @@ int32_t RankingLoad2() {
 	if(saveBuf[2] != 0x48474949) return 1;
 	if(saveBuf[3] != 0x34764354) return 1;
 
-	// 全部読み込み
-	APP_ReadFile32("config/data/RANKING2.SAV", saveBuf, 1654, 0);
-
 	for(i = 0; i < (5 * 15 * 2); i++) {
 		// 名前
 		rkname[i][0] = (char)((saveBuf[4 + i] >>  0) & 0xFF);
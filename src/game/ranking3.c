@@ -474,7 +474,7 @@ void RankingView3() {//3位まで
 void RankingSave3() {
 	int32_t i;
 
-	SDL_memset(saveBuf, 0, 5000 * 4);
+	SDL_memset(saveBuf, 0, (6*14*2*11+4) * 4);
 
 	// ヘッダ
 	saveBuf[0] = 0x4F424501;
@@ -513,25 +513,21 @@ void RankingSave3() {
 		saveBuf[4 + i + ( 6*14*2) * 10] = rkrots3[i];//11
 	}
 
-	APP_WriteFile32("config/data/RANKING3.SAV", saveBuf, (6*14*2*11)+4);//
+	APP_SaveFile32("config/data/RANKING3.SAV", saveBuf, (6*14*2*11)+4);//
 }
 
 // ランキングを読み込み
 int32_t RankingLoad3() {
 	int32_t i;
 
-	// ヘッダだけ読み込み
-	SDL_memset(saveBuf, 0, 5000 * 4);
-	APP_ReadFile32("config/data/RANKING3.SAV", saveBuf, 4, 0);
+	// 全部読み込み
+	APP_LoadFile32("config/data/RANKING3.SAV", saveBuf, 6*14*2*11+4);
 	//
 	if(saveBuf[0] != 0x4F424501) return 1;
 	if(saveBuf[1] != 0x20534901) return 1;
 	if(saveBuf[2] != 0x48474901) return 1;
 	if(saveBuf[3] != 0x34764301) return 1;
 
-	// 全部読み込み
-	APP_ReadFile32("config/data/RANKING3.SAV", saveBuf, 6*14*2*11+4, 0);
-
 	for(i = 0; i < ( 6*14*2); i++) {
 		// 名前
 		rkname3[i][0] = (char)((saveBuf[4 + i] >>  0) & 0xFF);
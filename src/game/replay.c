@@ -32,6 +32,7 @@ void ReplaySaveCheck(int32_t player, int32_t statnumber) {
 //▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
 void saveReplayData(int32_t pl, int32_t number) {
 	int32_t i, j, temp1, max;
+	int32_t nextbuf[1400];
 
 	if(gameMode[pl] == 4){	// VSはフォーマットが一部異なる
 		saveReplay_VS(number);
@@ -54,7 +55,11 @@ void saveReplayData(int32_t pl, int32_t number) {
 	// 208　　　　足きりタイム
 	// 209　　　　15分モード
 
-	// 234〜289   空き
+	// 269〜270   ツモ生成のシード
+	// 271        ツモ生成器の種類 (0なら5〜179のネクストブロックを使う)
+	// 272        ツモ生成器のシード
+	// 273        ツモ生成器のパラメータ
+	// 274〜289   空き
 	// 290        スムーズモード
 	// 291        ナナメ移動許可
 	// 292        高速落下モード
@@ -67,10 +72,24 @@ void saveReplayData(int32_t pl, int32_t number) {
 	saveBuf[2] = 0x4C504552;
 	saveBuf[3] = 0x31765941;
 
+	// シードで決まるツモは生成器の種類とシードとパラメータを保存し、再生時に作り直す
+	// 長いゲームではnextbが続きで上書きされているので、ネクストブロック欄には最初の1400個を作り直して入れる
+	// (旧バージョンでも再生できるように)
+	if(nextGenerator[pl].algorithm != NEXT_ALGORITHM_NONE) {
+		NextGenerator generator;
+		nextGeneratorInit(&generator, nextGenerator[pl].algorithm, nextGenerator[pl].startSeed, nextGenerator[pl].params);
+		nextGeneratorFill(&generator, nextbuf, 1400);
+		saveBuf[271] = nextGenerator[pl].algorithm;
+		saveBuf[272] = nextGenerator[pl].startSeed;
+		saveBuf[273] = nextGenerator[pl].params;
+	} else {
+		for(i = 0; i < 1400; i++) nextbuf[i] = nextb[i + pl * 1400];
+	}
+
 	for(i = 0; i < 175; i++) {
 		temp1 = 0;
 		for(j = 0; j < 8; j++) {
-			temp1 = temp1 | (nextb[(i << 3) + j + pl * 1400] << (j * 4));
+			temp1 = temp1 | (nextbuf[(i << 3) + j] << (j * 4));
 		}
 		saveBuf[i + 5] = temp1;
 	}
@@ -382,6 +401,13 @@ int32_t loadReplayData(int32_t pl, int32_t number) {
 		}
 	}
 
+	// ツモ生成器が保存されていれば、シードから作り直す
+	nextGenerator[pl].algorithm = NEXT_ALGORITHM_NONE;
+	if(saveBuf[271] != NEXT_ALGORITHM_NONE) {
+		if(nextGeneratorInit(&nextGenerator[pl], saveBuf[271], saveBuf[272], saveBuf[273]))
+			nextGeneratorFill(&nextGenerator[pl], &nextb[pl * 1400], 1400);
+	}
+
 	gameMode[pl] = saveBuf[201];
 	start[pl] = saveBuf[205];		// 開始レベルのロード #1.60c3
 
@@ -630,6 +656,8 @@ int32_t loadReplay_VS(int32_t number) {
 	for(i=0;i<1400;i++) {
 		nextb[i + 1400] = nextb[i];
 	}
+	nextGenerator[0].algorithm = NEXT_ALGORITHM_NONE;
+	nextGenerator[1].algorithm = NEXT_ALGORITHM_NONE;
 
 //	max = (saveBuf[200] + 3730) / 2 + 1;
 	gameMode[0] = saveBuf[201];
@@ -0,0 +1,95 @@
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  リプレイ動画書き出し
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+// APP_REPLAY_RENDER を有効にしてビルドすると、タイトルの代わりにここへ来る。
+// replay/REPLAYxx.SAV を順番に再生し、ソフトウェア描画した画面を
+// movie/REPLAYxx.y4m に、効果音とBGMのミックスを movie/REPLAYxx.wav に書き出す。
+// フレームレート待ちをしないので、実時間より速く書き出せる。
+
+#include "common.h"
+
+#ifdef APP_REPLAY_RENDER
+
+#define RENDER_REPLAY_MAX	40
+
+static int32_t	renderNumber;		// 書き出し中のリプレイ番号（0なら未開始）
+static uint64_t	renderFrames, renderStartNS;
+static int32_t	renderRuns;
+
+// 次のリプレイの書き出しを開始（なければfalse）
+static bool renderStartNextReplay(void) {
+	int32_t header[4];
+
+	while(++renderNumber <= RENDER_REPLAY_MAX) {
+		SDL_snprintf(string[0], STRING_LENGTH, "replay/REPLAY%02d.SAV", renderNumber);
+		if(!APP_FileExists(string[0])) continue;
+
+		SDL_memset(header, 0, sizeof(header));
+		APP_ReadFile32(string[0], header, 4, 0);
+		if(
+			(header[0] != 0x4F424548) || (header[1] != 0x20534952) ||
+			(header[2] != 0x4C504552) || (header[3] != 0x31765941)
+		) {
+			SDL_Log("REPLAY %02d: invalid header, skipped", (int)renderNumber);
+			continue;
+		}
+
+		// 前のリプレイの音が残らないように止める
+		StopAllBGM();
+		APP_StopWave(APP_WAVE_NUM_ALL);
+
+		// リプレイ選択画面で選んだときと同じ手順で開始する
+		flag = renderNumber;
+		init = false;
+		ReplaySelectProc();
+		mainLoopState = MAIN_REPLAY_RENDER;
+		init = true;
+
+		SDL_snprintf(string[1], STRING_LENGTH, "movie/REPLAY%02d.y4m", renderNumber);
+		SDL_snprintf(string[2], STRING_LENGTH, "movie/REPLAY%02d.wav", renderNumber);
+		if(!APP_OpenMovie(string[1], string[2])) {
+			APP_Exit(SDL_APP_FAILURE);
+		}
+		renderFrames = 0;
+		renderStartNS = SDL_GetTicksNS();
+		return true;
+	}
+	return false;
+}
+
+void replayRenderProc(void) {
+	if(init && (renderNumber == 0)) {
+		renderRuns = 0;
+		if(!renderStartNextReplay()) {
+			SDL_Log("No replays found in replay/");
+			APP_Exit(SDL_APP_FAILURE);
+		}
+	}
+
+	// 1フレーム分のゲーム処理（書き出しはAPP_Updateで行われる）
+	gameExecute();
+	renderFrames++;
+
+	// 再生が終わるとタイトルへ戻ろうとする
+	if(mainLoopState == MAIN_REPLAY_RENDER) return;
+
+	if(!APP_CloseMovie()) {
+		APP_Exit(SDL_APP_FAILURE);
+	}
+	const uint64_t ns = SDL_GetTicksNS() - renderStartNS;
+	SDL_Log(
+		"REPLAY %02d: %8u frames  %9.3f s  %6.1fx real time",
+		(int)renderNumber, (unsigned)renderFrames, ns / 1e9,
+		ns ? (renderFrames * 1e9 / APP_GetFPS()) / ns : 0.0
+	);
+	renderRuns++;
+
+	freeReplayData();
+	mainLoopState = MAIN_REPLAY_RENDER;
+	if(renderStartNextReplay()) return;
+
+	SDL_Log("%d replays written to movie/", (int)renderRuns);
+	APP_Exit(SDL_APP_SUCCESS);
+}
+
+#endif
@@ -0,0 +1,10 @@
+#ifndef replayrender_h_
+#define replayrender_h_
+
+#include "app/APP.h"
+
+#ifdef APP_REPLAY_RENDER
+void replayRenderProc(void);
+#endif
+
+#endif
@@ -0,0 +1,170 @@
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  リプレイのバージョンごとの動作
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+
+#include "common.h"
+
+static RulesProfile rulesProfile = { .version = -1 };
+
+static void resolveRulesProfile(RulesProfile *rules, int32_t v) {
+	rules->version = v;
+
+	if(v >= 64) rules->holdTiming = HOLD_TIMING_FIRST;
+	else if(v >= 35) rules->holdTiming = HOLD_TIMING_LAST;
+	else rules->holdTiming = HOLD_TIMING_AFTER_GRAVITY;
+	rules->holdRotateLock = (v >= 59);
+	rules->rollRollTimer = (v >= 44);
+	rules->segaRules = (v > 65);
+
+	rules->groundKick = (v >= 8);
+	rules->landingReset = (v >= 35);
+	rules->arsSlideLanding = (v >= 44);
+	rules->rotateCount = (v >= 40);
+	rules->kickLimitLock = (v >= 30);
+	rules->srsx180 = (v >= 23);
+	rules->big180Kick = (v >= 48);
+	rules->dsWorldDas = (v >= 19);
+	rules->dsWorldDasDelay = 10 - (v >= 64);
+	rules->classicDDasDelay = 10 - (2 * (v >= 64));
+
+	rules->firstFrameWait = (v >= 27);
+	rules->slowSoftDrop = (v >= 20);
+	rules->srsxSoftDrop = (v >= 44);
+	rules->softDropAdd = (v >= 44);
+	rules->softDrop20G = (v >= 42);
+	rules->heboSoftDrop = (v >= 52);
+	rules->magnetGravity = (v >= 41);
+	rules->oneG = 60 - (v > 65);
+
+	rules->softDropLock = (v >= 9);
+	rules->downLockBoost = (v >= 30);
+	rules->gravityLock = (v >= 15);
+	rules->nanameDownLock = (v >= 61);
+	rules->upLockHold = (v >= 43);
+	rules->upFlag = (v >= 12);
+	rules->upLockLimit = (v >= 14);
+	rules->releaseDownFlag = (v >= 10);
+	rules->lockFlags = (v >= 54);
+	rules->classicDLockFlags = (v >= 61);
+
+	rules->superSkip = (v >= 57);
+	rules->classicSuperSkip = (v >= 59);
+	rules->classicDSuperSkip = (v >= 57) && (v < 61);
+	rules->lockFlashFrames = 2 - (v >= 9);
+	rules->eraseJudge = (v >= 9);
+	rules->eraseShortcut = (v >= 54);
+	rules->aceIrs = (v >= 35);
+	rules->endingHanabi = (v <= 37);
+
+	rules->missLevelUp = (v < 62);
+	rules->levelStop99 = (v > 4);
+	rules->vsGoalStop = (v >= 61);
+	rules->missItemGauge = (v >= 62);
+	rules->udReverseFlags = (v >= 44);
+	rules->shortNextFix = (v > 65);
+	rules->itemReroll = (v >= 51);
+	rules->mirrorBlocks = 3 - (v >= 47);
+	rules->sameFrameMove = (v >= 59);
+	rules->kickLimitAdd = (v >= 16);
+	rules->srsxOldKick = (v < 39);
+	rules->srsxKickLimit = 18 + (6 * (v >= 40)) - 1;
+	rules->lockFrameNoTime = (v >= 57);
+	rules->holdRotateReset = (v >= 47);
+	rules->holdGravityReset = (v >= 21);
+	rules->holdFirstItemKeep = (v >= 48);
+	rules->holdIrs = (v >= 7);
+	rules->holdFakeNextSilent = (v >= 64);
+	rules->holdDasReset = (v >= 11);
+	rules->holdLockReset = (v >= 13);
+	rules->ihsSameFrame = (v >= 67);
+	rules->eraseRedraw = (v >= 57);
+	rules->holdEnableAtLock = (v >= 48);
+	rules->holdEnableAtAre = (v >= 46) && (v < 48);
+	rules->gbEndingStatus = (v >= 41);
+	rules->mirrorUpLineCount = -20 + (20 * (v <= 17));
+	rules->eraseStatusReset = (v >= 15);
+	rules->areShortcut = (v >= 4);
+	rules->statusResetBeforeBlock = (v >= 61);
+	rules->erasePadRepeat = (v >= 17);
+	rules->tomoyoItemWait = (v >= 55);
+	rules->tspinLineLimit = (v >= 59);
+	rules->simpleTspinNoB2B = (v > 65);
+	rules->lineDelayAdd = (v < 27);
+	rules->endingCheer = (v >= 55);
+	rules->oldPutRows = (v <= 27);
+	rules->bigPutAnyRow = (v <= 2);
+	rules->outsideLockDeath = (v >= 57);
+
+	rules->timeStop = (v >= 35);
+	rules->devilMinus = (v >= 31);
+	rules->grade1DevilMinus = (v < 42);
+	rules->rollTimeRollOnly = (v >= 33);
+	rules->fastRollTime = (v >= 50);
+	rules->rollKickLimit = (v >= 55);
+	rules->stageFpBonus = (v >= 47);
+	rules->missionKickLimit = (v >= 40);
+	rules->missionKickCount = 8 - (4 * (v >= 43));
+	rules->replayReadyStyle = (v < 37);
+	rules->devilRandomRise = (v >= 44);
+	rules->missionReadyStatus = (v >= 54);
+	rules->tomoyoRandPlatinum = (v >= 58);
+	rules->tomoyoMinSpeed = (v >= 25);
+	rules->tomoyoWaits20G = (v >= 50);
+	rules->tomoyoWaitsBoost = (v >= 54);
+	rules->readyRepeatOnce = (v >= 57);
+	rules->newIrs = (v >= 43);
+	rules->spawnRowKeep = (v > 27);
+	rules->missionHoleShift = 4 + (v >= 55);
+	rules->oldFieldMirror = (v <= 17);
+	rules->mirrorEndWait = 10 - (6 * (v >= 25));
+	rules->oldShirase = (v < 6);
+	rules->risePinchCheck = (v >= 47);
+	rules->slowDropHalfBonus = (v >= 20);
+	rules->fastDropBonus = (v >= 45);
+	rules->missLineScore = (v < 62);
+	rules->tspinItemGauge = (v >= 62);
+	rules->lvupBonusAuto = (v >= 50);
+	rules->heboPlusRoll = (v >= 58);
+	rules->grade1BeginnerRoll = (v > 24);
+	rules->heboPlusBeginnerRoll = (v >= 34) && (v < 42);
+	rules->masterRoll38 = (v <= 38);
+	rules->devilEndWaits = (v >= 54);
+	if(v >= 57) rules->devilRollWaits = DEVIL_ROLL_WAITS_LATEST;
+	else if(v >= 39) rules->devilRollWaits = DEVIL_ROLL_WAITS_56;
+	else if(v > 18) rules->devilRollWaits = DEVIL_ROLL_WAITS_38;
+	else rules->devilRollWaits = DEVIL_ROLL_WAITS_17;
+	rules->devilRollBig = (v > 4);
+	rules->devilMinus500 = (v >= 52);
+	rules->endingPadRepeat = (v >= 59);
+	rules->rollStartEdrec = 123 + (2 * (v >= 33));
+	rules->tomoyoStaffRoll = (v >= 40);
+	rules->grade1PlainRoll = (v >= 24);
+	rules->rollStartBlock = (v >= 54);
+	rules->rollAnimation = (v <= 49);
+
+	rules->shuffleFieldAttack = (v >= 65);
+	rules->missSelfItem = (v >= 58);
+	rules->attackItemReset = (v >= 44);
+	rules->reflectItem = (v >= 65);
+	rules->itemTimerSpeed = (v >= 40);
+	rules->boostTimer20G = (v >= 54);
+	rules->hardItemKeep = (v >= 32);
+	rules->itemPadRepeat = (v >= 30);
+	rules->itemRiseStatus = (v >= 48);
+	rules->itemEndMirror = (v >= 40);
+	rules->delFieldEffect = (v >= 64);
+	rules->delFieldEffectFast = (v >= 65);
+	rules->oldItemWaits = (v < 63);
+	rules->oldItem180Wait = (v < 65);
+	rules->exchangeFieldLate = (v >= 48);
+	rules->rouletteMiss = (v >= 48);
+	rules->rouletteMissSelf = (v >= 54);
+	rules->rouletteRepeat = (v >= 48) && (v < 62);
+}
+
+// repverswはゲーム開始時・リプレイ読み込み時・プレイ中の退避からの復帰で書き換わるので、
+// 書き換えた所で解決するのではなく、使う時に1回比べる
+const RulesProfile *getRulesProfile(void) {
+	if(rulesProfile.version != repversw) resolveRulesProfile(&rulesProfile, repversw);
+	return &rulesProfile;
+}
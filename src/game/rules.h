@@ -0,0 +1,188 @@
+#ifndef rules_h_
+#define rules_h_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// リプレイのバージョンごとの動作
+// What each replay version (repversw) changes in the piece movement handlers
+// (statWMove, statAMove, statCMove and statDMove) and in the per-piece paths of
+// gamestart.c (statBlock, statMove, doHold, statErase, statEraseBlock and the
+// block set/judge/remove functions), and in its per-frame timers, READY, rise,
+// scoring, ending and item functions, resolved into flags once per game instead
+// of comparing repversw against every version on every frame.
+// Game start (setStartLevel, the speed schedule), the mode select menu and the
+// ranking still read repversw directly, since they run once per game.
+// The comment on each flag is the condition it replaces.
+
+typedef enum HoldTiming {
+	HOLD_TIMING_AFTER_GRAVITY,	// repversw < 35
+	HOLD_TIMING_LAST,			// 35 <= repversw < 64 ブロックを描いた後
+	HOLD_TIMING_FIRST			// repversw >= 64 フレームの最初
+} HoldTiming;
+
+typedef enum DevilRollWaits {
+	DEVIL_ROLL_WAITS_17,		// repversw <= 18
+	DEVIL_ROLL_WAITS_38,		// 18 < repversw < 39
+	DEVIL_ROLL_WAITS_56,		// 39 <= repversw < 57
+	DEVIL_ROLL_WAITS_LATEST		// repversw >= 57
+} DevilRollWaits;
+
+typedef struct RulesProfile {
+	int32_t version;			// 解決済みのrepversw
+
+	HoldTiming holdTiming;
+	bool holdRotateLock;		// >= 59 HOLDしたフレームは回転しない
+	bool rollRollTimer;			// >= 44 ロールロールをエンディング・ステージ20以降の時間で回す
+	bool segaRules;				// >= 66 heboGB 2の回転方向・下入れ・横溜め
+
+	bool groundKick;			// >= 8  接地していない場合は蹴らない
+	bool landingReset;			// >= 35 接地中の回転・移動でも固定時間リセット
+	bool arsSlideLanding;		// >= 44 ARSの横移動で接地中を判定
+	bool rotateCount;			// >= 40 接地中の回転回数をkickc3で数える
+	bool kickLimitLock;			// >= 30 回転・移動の回数制限で即接着
+	bool srsx180;				// >= 23 SRS-Xの180°回転
+	bool big180Kick;			// >= 48 BIGで180°回転の補正量も2倍
+	bool dsWorldDas;			// >= 19 DS-WORLDの横溜め
+	int32_t dsWorldDasDelay;	// 10 - (>= 64)
+	int32_t classicDDasDelay;	// 10 - 2 * (>= 64)
+
+	bool firstFrameWait;		// >= 27 最初の1フレームは操作しない
+	bool slowSoftDrop;			// >= 20 高速落下を遅く
+	bool srsxSoftDrop;			// >= 44 SRS-Xは1G以上でも高速落下
+	bool softDropAdd;			// >= 44 DEATHの高速落下を落下速度に足す
+	bool softDrop20G;			// >= 42 DEATHは1G以上でも高速落下
+	bool heboSoftDrop;			// >= 52 HEBO系の高速落下
+	bool magnetGravity;			// >= 41 マグネットブロック
+	int32_t oneG;				// 60 - (>= 66) 1マス落ちる落下量
+
+	bool softDropLock;			// >= 9  CLASSICの下入れ即接着
+	bool downLockBoost;			// >= 30 下入れで固定時間を速く進める
+	bool gravityLock;			// >= 15 落下中の接地でも下入れ・上入れで接着
+	bool nanameDownLock;		// >= 61 DEATHの下入れ接着はnanamedownに従う
+	bool upLockHold;			// >= 43 上入れ即接着を押しっぱなしで判定
+	bool upFlag;				// >= 12 上入れ制限
+	bool upLockLimit;			// >= 14 上入れ制限を即接着にも適用
+	bool releaseDownFlag;		// >= 10 接着中に↓を離したら下入れ制限解除
+	bool lockFlags;				// >= 54 接着中も下入れ・上入れ制限をかける
+	bool classicDLockFlags;		// >= 61 同上 (DEATH)
+
+	bool superSkip;				// >= 57 接着したフレームで灰色化へ進む
+	bool classicSuperSkip;		// >= 59 同上 (CLASSICのフレームの最後)
+	bool classicDSuperSkip;		// 57 <= x < 61 同上 (DEATHのフレームの最後)
+	int32_t lockFlashFrames;	// 2 - (>= 9) 接着時の灰色化
+	bool eraseJudge;			// >= 9  接着時にブロック消去を判断
+	bool eraseShortcut;			// >= 54 接着と同じフレームで消去・ARE処理
+	bool aceIrs;				// >= 35 ACEカスタム式IRS
+	bool endingHanabi;			// <= 37 エンディング中に花火を上げる
+
+	// gamestart.c
+	bool missLevelUp;			// < 62  ミスしてもレベルが上がる
+	bool levelStop99;			// > 4   モード3以降もレベルストップ
+	bool vsGoalStop;			// >= 61 対戦のゴールでレベルストップ
+	bool missItemGauge;			// >= 62 対戦以外はミスしてもアイテムゲージが上がる
+	bool udReverseFlags;		// >= 44 上下反転中の下入れ・上入れ制限
+	bool shortNextFix;			// > 65  短いNEXTの並びの補正
+	bool itemReroll;			// >= 51 アイテムを確率表から選ぶ
+	int32_t mirrorBlocks;		// 3 - (>= 47) MIRRORが終わるブロック数
+	bool sameFrameMove;			// >= 59 出現と同じフレームで移動処理を始める
+	int32_t kickLimitAdd;		// (>= 16) 回転・移動の回数制限に足す
+	bool srsxOldKick;			// < 39  SRS-Xの回数制限が128
+	int32_t srsxKickLimit;		// 18 + 6 * (>= 40) - 1 SRS-Xの回数制限
+	bool lockFrameNoTime;		// >= 57 接着したフレームは時間を進めない
+	bool holdRotateReset;		// >= 47 ACE式IRSでなければHOLDで向きを戻す
+	bool holdGravityReset;		// >= 21 HOLDで落下と固定時間をリセット
+	bool holdFirstItemKeep;		// >= 48 最初のHOLDではアイテムを消さない
+	bool holdIrs;				// >= 7  IHS以外のHOLDでもIRS
+	bool holdFakeNextSilent;	// >= 64 フェイクNEXT中はHOLDで音を鳴らさない
+	bool holdDasReset;			// >= 11 HOLDで横方向の先行移動を無効に
+	bool holdLockReset;			// >= 13 HOLDで固定までの時間をリセット
+	bool ihsSameFrame;			// >= 67 IHSのフレームは接地音なし・回転しない
+	bool eraseRedraw;			// >= 57 消去中にブロックを描き直す
+	bool holdEnableAtLock;		// >= 48 接着でHOLDを使えるように
+	bool holdEnableAtAre;		// 46 <= x < 48 ARE中にHOLDを使えるように
+	bool gbEndingStatus;		// >= 41 heboGB・ミッション終了はステータス35へ
+	int32_t mirrorUpLineCount;	// -20 + 20 * (<= 17) フィールド回転・せり上がりを始めるfmirror_cnt
+	bool eraseStatusReset;		// >= 15 消去後にステータスカウンタ初期化
+	bool areShortcut;			// >= 4  固定→次を2フレーム縮める
+	bool statusResetBeforeBlock;	// >= 61 落下開始の前にステータスカウンタ初期化
+	bool erasePadRepeat;		// >= 17 消去中も横溜め
+	bool tomoyoItemWait;		// >= 55 TOMOYOのアイテムを次のステージへ持ち越す
+	bool tspinLineLimit;		// >= 59 T-SPINの消去ライン数は3まで
+	bool simpleTspinNoB2B;		// > 65  SIMPLEのT-SPINはBack to Backにしない
+	int32_t lineDelayAdd;		// (< 27) ライン消去の待ち時間に足す
+	bool endingCheer;			// >= 55 エンディングに入る時の歓声
+	bool oldPutRows;			// <= 27 上の2段にもブロックを置く
+	bool bigPutAnyRow;			// <= 2  BIGは上の2段に置いても置いたことにする
+	bool outsideLockDeath;		// >= 57 完全に画面外に置いたら死亡
+
+	// gamestart.c (時間・READY・せり上がり・得点・エンディング)
+	bool timeStop;				// >= 35 TIME STOP中はブロックを描いて止める・弾け飛ばない
+	bool devilMinus;			// >= 31 DEVIL-は1000で終了
+	bool grade1DevilMinus;		// < 42  段位1のDEVILはDEVIL-と同じ
+	bool rollTimeRollOnly;		// >= 33 エンディング経過時間はロール中だけ進める
+	bool fastRollTime;			// >= 50 高速ロールは経過時間も2倍速
+	bool rollKickLimit;			// >= 55 ロール中の無限回転対策
+	bool stageFpBonus;			// >= 47 F-Pointボーナスはステージで決めて操作中だけ減らす
+	bool missionKickLimit;		// >= 40 耐久ミッションの接地中の回転回数制限
+	int32_t missionKickCount;	// 8 - 4 * (>= 43) 同上の回転回数
+	bool replayReadyStyle;		// < 37  リプレイでもREADY GOの設定に従う
+	bool devilRandomRise;		// >= 44 DEVILのランダムせり上がり
+	bool missionReadyStatus;	// >= 54 最初のミッションの設定をREADY中に行う
+	bool tomoyoRandPlatinum;	// >= 58 EHステージのプラチナブロックをランダムに置く
+	bool tomoyoMinSpeed;		// >= 25 TOMOYOの最低速度
+	bool tomoyoWaits20G;		// >= 50 tomoyo_waitsで20G
+	bool tomoyoWaitsBoost;		// >= 54 tomoyo_waitsで最低速度なしならBOOST
+	bool readyRepeatOnce;		// >= 57 スタート時のキーリピートは最初のフレームだけ記録・再生
+	bool newIrs;				// >= 43 新VerのIRS
+	bool spawnRowKeep;			// > 27  枠内出現では22段目のブロックを消さない
+	int32_t missionHoleShift;	// 4 + (>= 55) MISSIONのせり上がりで穴の位置を変える確率の補正
+	bool oldFieldMirror;		// <= 17 c7t2.9以前のフィールド回転 (回転無し・フィールドを消さない)
+	int32_t mirrorEndWait;		// 10 - 6 * (>= 25) フィールド回転後の待ち時間
+	bool oldShirase;			// < 6   旧式せり上がり
+	bool risePinchCheck;		// >= 47 せり上がりの後でピンチ判定
+	bool slowDropHalfBonus;		// >= 20 高速落下の遅いルールはドロップボーナス半減
+	bool fastDropBonus;			// >= 45 高速落下の速いルールはドロップボーナス5割増
+	bool missLineScore;			// < 62  ミスしてもライン消去の得点が入る
+	bool tspinItemGauge;		// >= 62 T-SPINではアイテムゲージが2倍上がる
+	bool lvupBonusAuto;			// >= 50 レベルアップボーナスの自動調整
+	bool heboPlusRoll;			// >= 58 HEBO+はそのままロール突入・高速ロール
+	bool grade1BeginnerRoll;	// > 24  段位1のロールはビギナーのwait値
+	bool heboPlusBeginnerRoll;	// 34 <= x < 42 HEBO+のMASTERのロールはビギナーのwait値
+	bool masterRoll38;			// <= 38 ロールのwait値が旧式
+	bool devilEndWaits;			// >= 54 DEVIL-の終了でwait値を変える
+	DevilRollWaits devilRollWaits;
+	bool devilRollBig;			// > 4   DEVILのロールは強制BIG
+	bool devilMinus500;			// >= 52 DEVIL-は500で終了
+	bool endingPadRepeat;		// >= 59 エンディングのアニメ中も横溜め
+	int32_t rollStartEdrec;		// 123 + 2 * (>= 33) アニメ終了時のエンディング経過時間
+	bool tomoyoStaffRoll;		// >= 40 EH最終ステージのスタッフロールは20G
+	bool grade1PlainRoll;		// >= 24 段位1は見えロール・消えロールにしない
+	bool rollStartBlock;		// >= 54 ロール開始と同じフレームでブロックを出す
+	bool rollAnimation;			// <= 49 そのままロール突入でもアニメを挟む
+
+	// gamestart.c (アイテム)
+	bool shuffleFieldAttack;	// >= 65 SHUFFLE FIELDも攻撃アイテム
+	bool missSelfItem;			// >= 58 MISSは攻撃アイテムにしない
+	bool attackItemReset;		// >= 44 攻撃を受けたら先にアイテムの効果を消す
+	bool reflectItem;			// >= 65 REFLECTで攻撃を跳ね返す・対戦以外は30秒
+	bool itemTimerSpeed;		// >= 40 速い時はアイテムの効果時間を短く
+	bool boostTimer20G;			// >= 54 20GではBOOSTの効果時間半減
+	bool hardItemKeep;			// >= 32 アイテムを全部消す時にハードブロックは残す
+	bool itemPadRepeat;			// >= 30 アイテム発動中も横溜め
+	bool itemRiseStatus;		// >= 48 アイテムの後でせり上がり・フィールド回転 (ステータス22)
+	bool itemEndMirror;			// >= 40 同上の前はアイテムの後でフィールド回転だけ処理
+	bool delFieldEffect;		// >= 64 DEL FIELDで1段ずつ消す演出
+	bool delFieldEffectFast;	// >= 65 同上を時間が止まっていても速く
+	bool oldItemWaits;			// < 63  アイテムの演出の待ち時間が旧式
+	bool oldItem180Wait;		// < 65  180°FIELDの待ち時間はwait1の2倍
+	bool exchangeFieldLate;		// >= 48 EXCHANGE FIELDは交換直前に相手のフィールドを確保
+	bool rouletteMiss;			// >= 48 ROULETTEにはずれがある
+	bool rouletteMissSelf;		// >= 54 ROULETTEのMISSは自分にかける
+	bool rouletteRepeat;		// 48 <= x < 62 ROULETTEが重なったらもう1つ引く
+} RulesProfile;
+
+// repverswが変わっていたら解決し直す
+const RulesProfile *getRulesProfile(void);
+
+#endif
@@ -131,7 +131,7 @@ void ST_RankingUpdate(int32_t player, int32_t rmode, int32_t end) {
 void ST_RankingSave(void) {//12345 6789
 	int32_t i;
 
-	SDL_memset(saveBuf, 0, 5000 * 4);
+	SDL_memset(saveBuf, 0, 400 * 4);
 
 	saveBuf[0] = st_version;
 
@@ -142,25 +142,20 @@ void ST_RankingSave(void) {//12345 6789
 		saveBuf[i + 277] = st_others[i];
 	}
 
-	APP_WriteFile32("config/data/STRANKING.SAV", saveBuf, 400);
+	APP_SaveFile32("config/data/STRANKING.SAV", saveBuf, 400);
 }
 
 // ロード
 int32_t ST_RankingLoad(void) {
 	int32_t i;
 
-	SDL_memset(saveBuf, 0, 5000 * 4);
-
-	// バージョンを見る
-	APP_ReadFile32("config/data/STRANKING.SAV", saveBuf, 1, 0);
+	// 全体を読み込んでバージョンを見る
+	APP_LoadFile32("config/data/STRANKING.SAV", saveBuf, 400);
 
 	if(saveBuf[0] != st_version) {
 		return 1;
 	}
 
-	// 全体を読み込む
-	APP_ReadFile32("config/data/STRANKING.SAV", saveBuf, 400, 0);
-
 	for(i=0;i<90;i++) {
 		st_time[i] = saveBuf[i + 10];
 		st_end[i] = saveBuf[i + 99];
@@ -436,7 +431,7 @@ void ST_RankingView() {
 void PlayerdataSave(void) {//12345 6789
 	int32_t i,j;
 
-	SDL_memset(saveBuf, 0, 500 * 4);
+	SDL_memset(saveBuf, 0, 100 * 4);
 
 	saveBuf[0] = 0x4F424503;
 
@@ -452,25 +447,20 @@ void PlayerdataSave(void) {//12345 6789
 		saveBuf[1 +17]=BloxeedSeed[1];
 	}
 
-	APP_WriteFile32("config/data/PLAYERDATA.SAV", saveBuf, 100);
+	APP_SaveFile32("config/data/PLAYERDATA.SAV", saveBuf, 100);
 }
 
 // プレイヤーデータロード
 int32_t PlayerdataLoad(void) {
 	int32_t i,j;
 
-	SDL_memset(saveBuf, 0, 500 * 4);
-
-	// バージョンを見る
-	APP_ReadFile32("config/data/PLAYERDATA.SAV", saveBuf, 1, 0);
+	// 全体を読み込んでバージョンを見る
+	APP_LoadFile32("config/data/PLAYERDATA.SAV", saveBuf, 100);
 
 	if(saveBuf[0] != 0x4F424503) {
 		return 1;
 	}
 
-	// 全体を読み込む
-	APP_ReadFile32("config/data/PLAYERDATA.SAV", saveBuf, 100, 0);
-
 	for( j = 0 ; j < 2 ; j++){
 		for(i=0;i<5;i++) {
 			grade_his[i+j*5]=saveBuf[1 + i + 5 * j];
@@ -251,6 +251,7 @@ void bgmFadeout(void) {
 
 		// BGMフェードアウト処理
 		if(fadelv[player] != 0) {
+			prefetchBGM(player);
 			fadelv[player] += fade_seed;
 			if(fadelv[player] > 10000) fadelv[player] = 10000;
 			APP_SetWaveVolume(WAVE_BGM_START+bgmlv, (int)(bgmvolume * ((10000 - fadelv[player]) / 10000.0f)));
@@ -320,6 +321,74 @@ void checkMasterFadeout(int32_t player) {
 		}
 	}
 }
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  次に流れるBGMの予測 (-1:不明)
+//  フェードアウト中に、フェードが終わった後の曲を
+//  LevelUp()・checkEnding()・missionの切り替えと同じ条件で求める
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+int32_t getNextBGM(int32_t player) {
+	int32_t i;
+
+	// エンディング中のフェードはゲームオーバーへのもので、次の曲はない
+	if(ending[player]) return -1;
+
+	if(gameMode[player] == 0) {
+		// BEGINNERは次のレベルアップが終了レベル(NOVICEは300、他は200)なら、
+		// checkEnding()が先に終了させるのでロールの曲になる
+		if((tc[player] / 100 + 1) * 100 < (novice_mode[player] ? 300 : 200))
+			return bgmlv + 1;
+		if(novice_mode[player])
+			return 1;		// ending==6でbgmlv = 1
+		if(beginner_rollbgm == 0)
+			return WAVE_BGM_ENDING_B - WAVE_BGM_START;
+		if(beginner_rollbgm == 1)
+			return WAVE_BGM_BGM02 - WAVE_BGM_START;
+		return WAVE_BGM_ENDING - WAVE_BGM_START;
+	}
+
+	if(((gameMode[player] >= 1) && (gameMode[player] <= 3)) || (gameMode[player] == 10)) {
+		// MASTER・20G・DEVIL・ORIは次の段階の曲
+		// DEVILの足切りや1000でのロール突入もbgmlv = 3、5で同じ曲になる
+		if(bgmlv + 1 >= WAVE_BGM_COUNT) return -1;
+		return bgmlv + 1;
+	}
+
+	if(gameMode[player] == 7) {
+		// ACEモードではace_bgmlistの次の曲
+		// 最後の曲でのフェードはライン数による終了へのもので、エンディングに曲はない
+		if(ace_bgmchange[player] + 1 >= 3) return -1;
+		return ace_bgmlist[ace_bgmchange[player] + 1 + anothermode[player] * 3];
+	}
+
+	if(gameMode[player] == 8) {
+		// MISSIONでは曲なし(-1)の課題のあと、曲のある課題に進んだときに切り替わる
+		// 途中で終了するか、EXに進むかが課題の結果次第になるところから先は分からない
+		for(i = c_mission; i < 29; i++) {
+			if(mission_end[i] != 0) return -1;
+			if(mission_bgm[i + 1] != -1) return mission_bgm[i + 1];
+		}
+		return -1;
+	}
+
+	// VS(10)・TOMOYO(9、19のEX面)・PRACTICEなどは曲をフェードせずに切り替えるので、
+	// ここに来るのはゲームオーバーのフェードだけ
+	return -1;
+}
+
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  次のBGMの先読み
+//  フェードアウト中に次の曲の頭をデコードしておき、
+//  changeBGM()で途切れずに切り替わるようにする
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+void prefetchBGM(int32_t player) {
+	int32_t next;
+
+	if(wavebgm & WAVE_BGM_SIMPLE) return;
+
+	next = getNextBGM(player);
+	if((next >= 0) && (next != bgmlv)) APP_PrepareWave(WAVE_BGM_START + next);
+}
+
 //▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
 //  BGMの切り替え
 //▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
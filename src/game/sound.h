@@ -93,6 +93,8 @@ typedef enum WaveNum
 #define WAVE_BGM_SIMPLE 0x80
 
 void SoundTestProc(void);
+int32_t getNextBGM(int32_t player);
+void prefetchBGM(int32_t player);
 void changeBGM(int32_t player);
 void checkMasterFadeout(int32_t player);
 void checkFadeout(int32_t pl);
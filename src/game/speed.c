@@ -583,3 +583,259 @@ int32_t		waitt_HeboGB_tbl[15] =	// 横溜め
 //	 1,  2, 3, 4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15
 	 15,15,14,14, 14, 13, 13, 13, 12, 12, 11, 11, 10, 10, 10
 };
+
+#define TABLE_LENGTH(table) ((int32_t)(sizeof(table) / sizeof((table)[0])))
+
+// wait値のテーブルの組
+#define WAIT_TABLE(name) { wait1_##name, wait2_##name, wait3_##name, waitt_##name, TABLE_LENGTH(wait1_##name) }
+
+const WaitTable masterWaits = WAIT_TABLE(master_tbl);
+const WaitTable masterWaits53 = WAIT_TABLE(master_tbl53);
+const WaitTable masterWaits34 = WAIT_TABLE(master_tbl34);
+const WaitTable masterWaits28 = WAIT_TABLE(master_tbl28);
+const WaitTable doomWaits = WAIT_TABLE(doom_tbl);
+const WaitTable doomWaits61 = WAIT_TABLE(doom_tbl61);
+const WaitTable devilWaits = WAIT_TABLE(devil_tbl);
+const WaitTable devilWaits32 = WAIT_TABLE(devil_tbl32);
+const WaitTable devilWaits17 = WAIT_TABLE(devil_tbl17);
+const WaitTable devilWaits18 = WAIT_TABLE(devil_tbl18);
+const WaitTable devilMinusWaits = WAIT_TABLE(devil_m_tbl);
+const WaitTable orimasterWaits = WAIT_TABLE(orimaster_tbl);
+const WaitTable oridevilWaits = WAIT_TABLE(oridevil_tbl);
+const WaitTable aceaWaits = WAIT_TABLE(Acea_tbl);
+const WaitTable aceaWaits35 = WAIT_TABLE(Acea_tbl35);
+
+const WaitTable *getMasterWaits(int32_t version) {
+	if(version < 29) return &masterWaits28;
+	if(version < 35) return &masterWaits34;
+	if(version < 54) return &masterWaits53;
+	return &masterWaits;
+}
+
+const WaitTable *getDevilWaits(int32_t version, bool minus) {
+	if(version < 18) return &devilWaits17;
+	if(version == 18) return &devilWaits18;
+	if(minus) return &devilMinusWaits;
+	if(version < 33) return &devilWaits32;
+	if(version < 60) return &devilWaits;
+	if(version < 62) return &doomWaits61;
+	return &doomWaits;
+}
+
+const WaitTable *getAceaWaits(int32_t version) {
+	if(version < 36) return &aceaWaits35;
+	return &aceaWaits;
+}
+
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  レベルアップのスケジュール
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+// テーブルの範囲内なら落下速度を入れる
+#define STEP_GRAVITY(step, table, index) \
+	do { \
+		if(((index) >= 0) && ((index) < TABLE_LENGTH(table))) (step)->gravity = (table)[(index)]; \
+	} while(0)
+
+static void setStepWaits(SpeedStep *step, const WaitTable *table, int32_t index) {
+	if((index < 0) || (index >= table->length)) return;
+	step->are = table->are[index];
+	step->lineDelay = table->lineDelay[index];
+	step->lockDelay = table->lockDelay[index];
+	step->das = table->das[index];
+}
+
+// MASTER・20G (tgmRank、段位4ではtr2で引く)
+static void compileMasterStep(SpeedSchedule *schedule, const SpeedSettings *settings, SpeedStep *step, int32_t i) {
+	const int32_t version = settings->version;
+
+	if(schedule->tgm2) {
+		if((settings->mode == 2) && (i < 51)) step->gravity = 1200;
+		else if(settings->mode != 2) STEP_GRAVITY(step, lvTableTgm, i);
+		if((i % 10 == 0) && (i >= 50) && (i <= 200) && ((i <= 150) || (version < 60))) {
+			step->gravity = 1200;
+			setStepWaits(step, getMasterWaits(version), (i - 50) / 10 * 2);
+		}
+	} else {
+		if(version <= 20) STEP_GRAVITY(step, lvTableTgm20, i);
+		else if((settings->mode == 2) && (i < 51)) step->gravity = 1200;
+		else if(settings->mode != 2) STEP_GRAVITY(step, lvTableTgm, i);
+		if((i % 10 == 0) && (i >= 50) && (i <= 100)) {
+			if((settings->grade != 1) || (version <= 23)) {
+				setStepWaits(step, getMasterWaits(version), (i - 50) / 10 * 2);
+			} else if(version > 24) {
+				// 段位1 (HEBO+もここだったがver34以降なので同じ条件に含まれる)
+				step->gravity = 1200;
+				step->are = 26;
+				step->lineDelay = 40;
+				step->lockDelay = 28;
+				step->das = 15;
+			}
+		}
+	}
+	if(i % 10 == 0) step->cue = SPEED_CUE_LEVELUP | SPEED_CUE_BGFADE | SPEED_CUE_BGM;
+}
+
+// ACE (lv)
+static void compileAceStep(const SpeedSettings *settings, SpeedStep *step, int32_t i) {
+	const int32_t version = settings->version;
+
+	step->cue = SPEED_CUE_RANKUP | SPEED_CUE_BGFADE | SPEED_CUE_BGM;
+	if(settings->option == 0) {
+		if(version < 56) STEP_GRAVITY(step, lvTableAce55, i - 1);
+		else STEP_GRAVITY(step, lvTableAce, i - 1);
+	} else if(settings->option == 1) {
+		// アナザー
+		STEP_GRAVITY(step, lvTableAcea, i - 1);
+		setStepWaits(step, getAceaWaits(version), i - 1);
+	} else if(settings->option == 2) {
+		// アナザー2
+		if((i < 11) && (i % 2 == 0)) step->cue &= ~SPEED_CUE_BGFADE;
+	} else if(settings->option == 3) {
+		// アナザー3 ver66以降は1つ先のレベルの速度を使う
+		const int32_t upped = (version > 65) ? i + 1 : i;
+
+		if(settings->heboGB == 2) {
+			if(i < 19) {
+				if(version > 65) STEP_GRAVITY(step, lvTablesegahebo, upped - 1);
+				else STEP_GRAVITY(step, lvTabletomoyohebo, upped - 1);
+			}
+		} else if(i <= 15) {
+			STEP_GRAVITY(step, lvTableHeboGB, upped - 1);
+			if((upped - 1 >= 0) && (upped - 1 < TABLE_LENGTH(wait3_HeboGB_tbl))) {
+				step->lockDelay = wait3_HeboGB_tbl[upped - 1];
+				step->das = waitt_HeboGB_tbl[upped - 1];
+			}
+		}
+		// 背景は決まったレベルだけで切り替える
+		if(
+			(settings->heboGB != 1) &&
+			(i != 2) && (i != 4) && (i != 6) && (i != 8) && (i != 9) && (i != 10) &&
+			(i != 11) && (i != 13) && (i != 15) && (i != 50) && (i != 99)
+		) step->cue &= ~SPEED_CUE_BGFADE;
+	} else {
+		step->cue = 0;
+	}
+}
+
+// ORIGINAL (lv)
+static void compileOriginalStep(const SpeedSettings *settings, SpeedStep *step, int32_t i) {
+	if(settings->option == 0) {
+		if(i < 101) STEP_GRAVITY(step, lvTableBeg39, i);
+		if(i % 10 == 0) step->cue = SPEED_CUE_LEVELUP | SPEED_CUE_BGFADE | SPEED_CUE_BGM;
+	} else if((settings->option == 1) || (settings->option == 2)) {
+		if(settings->option == 2) step->gravity = 1200;
+		else STEP_GRAVITY(step, orimasterlvTable, i);
+		if(i % 6 == 0) {
+			if((i >= 30) && (i <= 60)) setStepWaits(step, &orimasterWaits, (i - 30) / 3);
+			step->cue = SPEED_CUE_LEVELUP | SPEED_CUE_BGFADE | SPEED_CUE_BGM;
+		}
+	} else if(settings->option == 3) {
+		step->gravity = 1200;
+		if(i % 3 == 0) {
+			if(i <= 30) setStepWaits(step, &oridevilWaits, i / 3);
+			step->cue = SPEED_CUE_LEVELUP | SPEED_CUE_BGFADE | SPEED_CUE_BGM;
+		}
+	}
+}
+
+void compileSpeedSchedule(SpeedSchedule *schedule, const SpeedSettings *settings) {
+	const int32_t version = settings->version;
+	// DEVIL-用のwait値を使うか
+	const bool devilMinusWaits =
+		(settings->mode == 3) && (version >= 31) &&
+		(((settings->grade == 1) && (version < 42)) || settings->devilMinus);
+
+	schedule->settings = *settings;
+	schedule->compiled = true;
+	// ACEとSQUAREはace_bgmlistのオプションごとの位置から曲を選ぶ
+	if((settings->mode == 7) && (settings->option >= 0) && (settings->option <= 3))
+		schedule->bgmList = settings->option * 3;
+	else if((settings->mode == 9) && ((settings->option == 2) || (settings->option == 3)))
+		schedule->bgmList = (settings->option - 2) * 3;
+	else
+		schedule->bgmList = -1;
+	schedule->tgm2 = ((settings->mode == 1) || (settings->mode == 2)) && (settings->grade == 4) && (version >= 24);
+	schedule->regretCancel = version >= 41;
+	schedule->randomRise = settings->randomRise && (version >= 44);
+
+	if(settings->mode != 3)
+		schedule->devilGrade = DEVIL_GRADE_NONE;
+	else if(version < 19)
+		schedule->devilGrade = DEVIL_GRADE_FLASH;
+	else if(devilMinusWaits)
+		schedule->devilGrade = settings->devilMinus ? DEVIL_GRADE_MINUS : DEVIL_GRADE_RAISE;
+	else if(version < 33)
+		schedule->devilGrade = DEVIL_GRADE_RAISE;
+	else
+		schedule->devilGrade = settings->deathPlus ? DEVIL_GRADE_DEATH : DEVIL_GRADE_FLASH;
+
+	for(int32_t i = 0; i < SPEED_SCHEDULE_LEVELS; i++) {
+		SpeedStep *step = &schedule->step[i];
+
+		step->gravity = SPEED_KEEP;
+		step->gravityIf = 0;
+		step->are = SPEED_KEEP;
+		step->lineDelay = SPEED_KEEP;
+		step->lockDelay = SPEED_KEEP;
+		step->das = SPEED_KEEP;
+		step->cue = 0;
+
+		switch(settings->mode) {
+		case 0:		// BEGINNER
+			if(version < 40) STEP_GRAVITY(step, lvTableBeg39, i);
+			else STEP_GRAVITY(step, lvTableBeg, i);
+			if(i % 10 == 0) step->cue = SPEED_CUE_LEVELUP | SPEED_CUE_BGFADE | SPEED_CUE_BGM;
+			break;
+		case 1:		// MASTER
+		case 2:		// 20G
+			compileMasterStep(schedule, settings, step, i);
+			break;
+		case 3:		// DEVIL
+			if(i % 10 == 0) {
+				if(i <= 120) setStepWaits(step, getDevilWaits(version, devilMinusWaits), i / 10);	// LV1200まで #1.60c7j5
+				step->cue = SPEED_CUE_LEVELUP | SPEED_CUE_BGFADE | SPEED_CUE_BGM;
+			}
+			break;
+		case 6:		// TOMOYO Ver25以降は速くなるときだけ変える
+			if(!settings->option) {
+				if(version < 25) {
+					STEP_GRAVITY(step, lvTabletomoyo24, i);
+				} else if(i < TABLE_LENGTH(lvTabletomoyo)) {
+					step->gravity = lvTabletomoyo[i];
+					step->gravityIf = lvTabletomoyo[i];
+				}
+				if(i % 10 == 0) step->cue = SPEED_CUE_LEVELUP | SPEED_CUE_BGFADE;
+			} else {
+				// F-Point BASIC (lv)
+				STEP_GRAVITY(step, lvTabletomoyohebo, i);
+				if((version >= 25) && (step->gravity != SPEED_KEEP)) step->gravityIf = lvTabletomoyo[i];
+				if(i % 2 == 0) step->cue = SPEED_CUE_LEVELUP | SPEED_CUE_BGFADE;
+			}
+			break;
+		case 7:		// ACE
+			compileAceStep(settings, step, i);
+			break;
+		case 9:		// SIMPLE (lv) SQUAREとそのオプション3だけがレベルアップする
+			if((settings->option == 2) || (settings->option == 3)) {
+				if(version < 56) STEP_GRAVITY(step, lvTableAce55, i - 1);
+				else STEP_GRAVITY(step, lvTableAce, i - 1);
+				step->cue = SPEED_CUE_RANKUP | SPEED_CUE_BGFADE | SPEED_CUE_BGM;
+			}
+			break;
+		case 10:	// ORIGINAL
+			compileOriginalStep(settings, step, i);
+			break;
+		default:	// VERSUS・PRACTICE・MISSIONはレベルアップ音だけ
+			if(i % 10 == 0) step->cue = SPEED_CUE_LEVELUP;
+			break;
+		}
+	}
+}
+
+const SpeedStep *getSpeedStep(const SpeedSchedule *schedule, int32_t index) {
+	if(index < 0)
+		index = 0;
+	else if(index >= SPEED_SCHEDULE_LEVELS)
+		index = SPEED_SCHEDULE_LEVELS - SPEED_SCHEDULE_PERIOD + index % SPEED_SCHEDULE_PERIOD;
+	return &schedule->step[index];
+}
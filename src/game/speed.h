@@ -1,7 +1,8 @@
 #ifndef speed_h_
 #define speed_h_
 
-#include "app/APP.h"
+#include <stdint.h>
+#include <stdbool.h>
 
 extern int32_t waitt_HeboGB_tbl[15];
 extern int32_t wait3_HeboGB_tbl[15];
@@ -164,4 +165,110 @@ extern int32_t lvTable[31];
 extern int32_t lvTableBeg39[101];
 extern int32_t lvTableBeg[101];
 
+// wait値のテーブル
+// Each speed table set is four parallel arrays indexed the same way. A
+// WaitTable keeps them together, so a set picked for the replay version can
+// be applied with one setWaits() call.
+typedef struct WaitTable {
+	const int32_t *are;			// 固定→次 (wait1)
+	const int32_t *lineDelay;	// ブロック消去 (wait2)
+	const int32_t *lockDelay;	// 接地→固定 (wait3)
+	const int32_t *das;			// 横溜め (waitt)
+	int32_t length;
+} WaitTable;
+
+extern const WaitTable masterWaits;
+extern const WaitTable masterWaits53;
+extern const WaitTable masterWaits34;
+extern const WaitTable masterWaits28;
+extern const WaitTable doomWaits;
+extern const WaitTable doomWaits61;
+extern const WaitTable devilWaits;
+extern const WaitTable devilWaits32;
+extern const WaitTable devilWaits17;
+extern const WaitTable devilWaits18;
+extern const WaitTable devilMinusWaits;
+extern const WaitTable orimasterWaits;
+extern const WaitTable oridevilWaits;
+extern const WaitTable aceaWaits;
+extern const WaitTable aceaWaits35;
+
+// リプレイのバージョンに合ったテーブルを選ぶ
+const WaitTable *getMasterWaits(int32_t version);	// LevelUp()の後半 (tr2のSKIP・やり直し含む)
+const WaitTable *getDevilWaits(int32_t version, bool minus);	// minus: DEVIL-用のテーブルを使う (ver19以降)
+const WaitTable *getAceaWaits(int32_t version);
+
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  レベルアップのスケジュール
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+// setStartLevel()でモード・オプション・repverswに合ったテーブルを引いておき、
+// LevelUp()は上がったレベルの段をそのまま使う。
+// The speed tables that apply to a game, flattened at game start into one step
+// per level, so LevelUp() only indexes the step for the level it reached.
+// Steps are indexed by the counter each mode levels up with: tgmRank (tr2 for
+// grade system 4), or lv for TOMOYO F-Point basic, ACE, SIMPLE and ORIGINAL.
+// Past the last step the final SPEED_SCHEDULE_PERIOD steps repeat; every table
+// ends well before that, and all the sound and background cues repeat with a
+// period dividing it.
+// Grades, REGRET, tr2 and the TOMOYO F-Point course depend on how the game is
+// going, so LevelUp() still handles those itself, using the flags below.
+// PRACTICE doesn't go through setStartLevel(), and some settings change after
+// it (such as the grade system fix-up for old replays), so LevelUp() rebuilds
+// the schedule first if its settings no longer match.
+
+#define SPEED_SCHEDULE_LEVELS	1020
+#define SPEED_SCHEDULE_PERIOD	60
+#define SPEED_KEEP				(-1)	// 変えない
+
+// レベルアップ時の演出
+#define SPEED_CUE_LEVELUP		0x01	// レベルアップ音
+#define SPEED_CUE_RANKUP		0x02	// ランクアップ音 (HURRY UPは止める)
+#define SPEED_CUE_BGFADE		0x04	// 背景を切り替える
+#define SPEED_CUE_BGM			0x08	// BGMを次の曲にする
+
+typedef struct SpeedStep {
+	int32_t gravity;			// 落下速度 (sp)
+	int32_t gravityIf;			// 0以外ならspがこれより小さいときだけgravityにする
+	int32_t are;				// 固定→次 (wait1)
+	int32_t lineDelay;			// ブロック消去 (wait2)
+	int32_t lockDelay;			// 接地→固定 (wait3)
+	int32_t das;				// 横溜め (waitt)
+	int32_t cue;				// SPEED_CUE_*
+} SpeedStep;
+
+// DEVILのセクションごとの段位
+typedef enum DevilGrade {
+	DEVIL_GRADE_NONE,
+	DEVIL_GRADE_FLASH,			// 13未満なら上げる。段位表示は毎回光らせる
+	DEVIL_GRADE_RAISE,			// 13未満のときだけ上げて光らせる
+	DEVIL_GRADE_MINUS,			// DEVIL- 500でm
+	DEVIL_GRADE_DEATH			// DEATH+ 500でm、1000でGm
+} DevilGrade;
+
+// スケジュールを決める設定
+typedef struct SpeedSettings {
+	int32_t mode;				// gameMode
+	int32_t version;			// repversw
+	int32_t grade;				// enable_grade
+	int32_t option;				// TOMOYO: fpbas_mode ACE: anothermode SIMPLE: std_opt ORIGINAL: ori_opt
+	int32_t heboGB;
+	bool devilMinus;
+	bool deathPlus;
+	bool randomRise;			// devil_randrise
+} SpeedSettings;
+
+typedef struct SpeedSchedule {
+	SpeedSettings settings;		// 作ったときの設定
+	bool compiled;
+	SpeedStep step[SPEED_SCHEDULE_LEVELS];
+	int32_t bgmList;			// -1ならbgmlvを1つ進める。0以上ならace_bgmlistのこの位置から使う
+	bool tgm2;					// 段位4 (ver24以降): tr2で引き、REGRETでやり直す
+	bool regretCancel;			// ver41以降: regretcancelでやり直しを取り消す
+	bool randomRise;			// DEVILのランダムせり上がり (ver44以降)
+	DevilGrade devilGrade;
+} SpeedSchedule;
+
+void compileSpeedSchedule(SpeedSchedule *schedule, const SpeedSettings *settings);
+const SpeedStep *getSpeedStep(const SpeedSchedule *schedule, int32_t index);
+
 #endif
@@ -0,0 +1,106 @@
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  ステージ・ミッションのデータ
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+
+#include "common.h"
+
+static int32_t stageData[STAGE_DATA_COUNT][STAGE_DATA_SIZE];
+static int32_t missionData[MISSION_DATA_COUNT][MISSION_DATA_SIZE];
+static const int32_t emptyData[MISSION_DATA_SIZE] = { 0 };
+static bool stageDatabaseLoaded = false;
+static APP_WorkerJobID stageDatabaseJob = 0;
+
+// 1つのファイルを読み込む
+// ファイルがなければ空、古い形式の短いファイルなら残りを0にする
+static bool readDataFile(const char *filename, int32_t *data, size_t count) {
+	SDL_memset(data, 0, count * sizeof(int32_t));
+
+	SDL_IOStream *src = APP_OpenRead(filename);
+	if(!src) return true;
+
+	size_t size = 0;
+	while(size < count * sizeof(int32_t)) {
+		const size_t read = SDL_ReadIO(src, (uint8_t *)data + size, count * sizeof(int32_t) - size);
+		if(read == 0) break;
+		size += read;
+	}
+	const bool failed = SDL_GetIOStatus(src) == SDL_IO_STATUS_ERROR;
+	if(!SDL_CloseIO(src) || failed) {
+		SDL_SetError("Error reading file \"%s\": %s", filename, SDL_GetError());
+		return false;
+	}
+
+	for(size_t i = 0; i < count; i++) data[i] = (int32_t)SDL_Swap32LE((uint32_t)data[i]);
+	return true;
+}
+
+// ワーカーで全部のファイルを読み込む
+static bool loadStageDatabaseCallback(void *userdata) {
+	char filename[64];
+	(void)userdata;
+
+	for(int32_t i = 0; i < STAGE_DATA_COUNT; i++) {
+		SDL_snprintf(filename, sizeof(filename), "config/stage/stage%02d.sav", i);
+		if(!readDataFile(filename, stageData[i], STAGE_DATA_SIZE)) return false;
+	}
+	for(int32_t i = 0; i < MISSION_DATA_COUNT; i++) {
+		SDL_snprintf(filename, sizeof(filename), "config/mission/mission%02d.sav", i);
+		if(!readDataFile(filename, missionData[i], MISSION_DATA_SIZE)) return false;
+	}
+	return true;
+}
+
+void loadStageDatabase(void) {
+	if(stageDatabaseLoaded) return;
+
+	stageDatabaseJob = APP_SubmitWorkerJob(APP_LoadingWorker, loadStageDatabaseCallback, NULL);
+	if(!stageDatabaseJob) {
+		APP_SetError("Failed loading stage data: %s", SDL_GetError());
+		APP_Exit(SDL_APP_FAILURE);
+	}
+	stageDatabaseLoaded = true;
+}
+
+// 読み込み中なら待つ (通常はAPP_WaitToFinishLoading()で終わっている)
+static void waitStageDatabase(void) {
+	if(!stageDatabaseLoaded) {
+		loadStageDatabase();
+	}
+	if(stageDatabaseJob) {
+		if(!APP_WaitWorkerJob(APP_LoadingWorker, stageDatabaseJob)) {
+			APP_SetError("Failed loading stage data: %s", SDL_GetError());
+			APP_Exit(SDL_APP_FAILURE);
+		}
+		stageDatabaseJob = 0;
+	}
+}
+
+const int32_t *getStageData(int32_t number) {
+	waitStageDatabase();
+	if((number < 0) || (number >= STAGE_DATA_COUNT)) return emptyData;
+	return stageData[number];
+}
+
+const int32_t *getMissionData(int32_t number) {
+	waitStageDatabase();
+	if((number < 0) || (number >= MISSION_DATA_COUNT)) return emptyData;
+	return missionData[number];
+}
+
+void putStageData(int32_t number, const int32_t *data) {
+	waitStageDatabase();
+	if((number < 0) || (number >= STAGE_DATA_COUNT)) return;
+
+	SDL_memcpy(stageData[number], data, sizeof(stageData[number]));
+	SDL_snprintf(string[0], STRING_LENGTH, "config/stage/stage%02d.sav", number);
+	APP_SaveFile32(string[0], stageData[number], STAGE_DATA_SIZE);
+}
+
+void putMissionData(int32_t number, const int32_t *data) {
+	waitStageDatabase();
+	if((number < 0) || (number >= MISSION_DATA_COUNT)) return;
+
+	SDL_memcpy(missionData[number], data, sizeof(missionData[number]));
+	SDL_snprintf(string[0], STRING_LENGTH, "config/mission/mission%02d.sav", number);
+	APP_SaveFile32(string[0], missionData[number], MISSION_DATA_SIZE);
+}
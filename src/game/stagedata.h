@@ -0,0 +1,30 @@
+#ifndef stagedata_h_
+#define stagedata_h_
+
+#include "app/APP.h"
+
+// TOMOYOモードのステージとミッションのデータ
+// The TOMOYO stages (config/stage/stageNN.sav) and mission files
+// (config/mission/missionNN.sav), all held in memory. They're read once while
+// the game is loading, so stage transitions only copy from memory.
+//
+// Each record stays in its own file, because the pref path overrides the
+// bundled data file by file. Saving a record writes only that record's file.
+
+#define STAGE_DATA_COUNT	201		// stage00〜stage200
+#define STAGE_DATA_SIZE		450
+#define MISSION_DATA_COUNT	100		// mission00〜mission99
+#define MISSION_DATA_SIZE	930
+
+// 読み込みを開始する (APP_WaitToFinishLoading()で完了を待つ)
+void loadStageDatabase(void);
+
+// 範囲外の番号には空のデータを返す
+const int32_t *getStageData(int32_t number);
+const int32_t *getMissionData(int32_t number);
+
+// データを差し替えてファイルに保存する
+void putStageData(int32_t number, const int32_t *data);
+void putMissionData(int32_t number, const int32_t *data);
+
+#endif
@@ -151,7 +151,7 @@ void statTomoyoNextStage(int32_t player) {
 		if(statusc[player * 10 + 0] == 1){
 		for(i = 0; i < 10; i++)	//フィールド消去 C7T3.2
 			for(j = 0; j < 22; j++) {
-				fld[i + j * 10 + player * 220] = 0;
+				setFieldBlock(i + j * 10 + player * 220, 0);
 				fldt[i + j * 10 + player * 220] = 0;
 				fldi[i + j * 10 + player * 220] = 0;
 			}
@@ -665,7 +665,7 @@ void statTomoyoEditor(int32_t player) {
 			if(fld[bx[player] + by[player] * fldsizew[player] + player * 220] != blk[player] + 1) {
 				APP_PlayWave(WAVE_SE_KACHI);
 			}
-			fld[bx[player] + by[player] * fldsizew[player] + player * 220] = blk[player] + 1;
+			setFieldBlock(bx[player] + by[player] * fldsizew[player] + player * 220, blk[player] + 1);
 			fldt[bx[player] + by[player] * fldsizew[player] + player * 220] = -1;
 		}
 		if( !getPressState(player, APP_BUTTON_A) ) {
@@ -677,7 +677,7 @@ void statTomoyoEditor(int32_t player) {
 			if(fld[bx[player] + by[player] * fldsizew[player] + player * 220] != 0) {
 				APP_PlayWave(WAVE_SE_KACHI);
 			}
-			fld[bx[player] + by[player] * fldsizew[player] + player * 220] = 0;
+			setFieldBlock(bx[player] + by[player] * fldsizew[player] + player * 220, 0);
 			fldt[bx[player] + by[player] * fldsizew[player] + player * 220] = 0;
 		}
 
@@ -945,7 +945,7 @@ void statTomoyoSelect(int32_t player) {
 	if( getPushState(player, APP_BUTTON_B) ) {
 		for(i=0;i<220;i++) {
 			// フィールド全消去 #1.60c7m2
-			fld[i + 220 * player] = 0;
+			setFieldBlock(i + 220 * player, 0);
 			fldt[i + 220 * player] = 0;
 		}
 		status[player] = 2;					// SOLO MODEモードセレクト
@@ -1352,7 +1352,7 @@ void randPlatinum(int32_t player, int32_t tgtnum){
 	// プラチナブロックを普通のブロックにする
 	for(i = 0; i < 220; i++) {
 		if(fld[i + player * 220] >= 11) {
-			fld[i + player * 220] = fld[i + player * 220] - 9;
+			setFieldBlock(i + player * 220, fld[i + player * 220] - 9);
 		}
 	}
 
@@ -1364,7 +1364,7 @@ void randPlatinum(int32_t player, int32_t tgtnum){
 					if((fld[j + i * fldsizew[player] + player * 220] >= 2) && (fld[j + i * fldsizew[player] + player * 220] <= 8)) {
 						empty = 0;
 						if((tgtnum == 99) || (gameRand(10, player) == 0)) {
-							fld[j + i * fldsizew[player] + player * 220] = fld[j + i * fldsizew[player] + player * 220] + 9;
+							setFieldBlock(j + i * fldsizew[player] + player * 220, fld[j + i * fldsizew[player] + player * 220] + 9);
 							put_num++;
 							put_flag[i] = 1;
 							if((put_num >= tgtnum) && (tgtnum != 99)) return;
@@ -1402,62 +1402,58 @@ void randPlatinum(int32_t player, int32_t tgtnum){
 /* ステージデータをロード */
 void loadTomoyoStage(int32_t player, int32_t number) {
 	int32_t i;
-
-	SDL_memset(saveBuf, 0, 50000 * 4);
-
-	SDL_snprintf(string[0], STRING_LENGTH, "config/stage/stage%02d.sav", number);
-	APP_ReadFile32(string[0], saveBuf, 450, 0);
+	const int32_t *data = getStageData(number);
 
 	// フィールド読み込み
 	for(i=0;i<210;i++) {
-		fld[(i+10) + 220 * player] = saveBuf[i];
+		setFieldBlock((i+10) + 220 * player, data[i]);
 		// 初期配置を見えるようにする
 		fldt[(i+10) + 220 * player] = (fld[(i+10) + 220 * player] != 0) * -1;
 	}
 
 	for(i=0;i<200;i++)
-		tomoyo_rise_fld[i + 200 * player] = saveBuf[i+250];
+		tomoyo_rise_fld[i + 200 * player] = data[i+250];
 
 	if(gameMode[player] == 6) {
 		// MIRROR
-		isfmirror[player] = saveBuf[210]; // #1.60c7l7
+		isfmirror[player] = data[210]; // #1.60c7l7
 
 		// ROLL ROLL
-		rollroll_flag[player] = saveBuf[211]; // #1.60c7l7
+		rollroll_flag[player] = data[211]; // #1.60c7l7
 
 		// DEATH BLOCK #1.60c7l8
-		IsBig[player] = saveBuf[212];
+		IsBig[player] = data[212];
 
 		// X-RAY #1.60c7p9ex
-		xray_flag[player] = saveBuf[213];
+		xray_flag[player] = data[213];
 
 		// COLOR #1.60c7p9ex
-		color_flag[player] = saveBuf[214];
+		color_flag[player] = data[214];
 
 		// BLIND C7T6.5
-		blind_flag[player] = saveBuf[215];
+		blind_flag[player] = data[215];
 
 		// 最低落下速度
-		min_speed[player] = saveBuf[216];
+		min_speed[player] = data[216];
 
 		// サンダー
-		isthunder[player] = saveBuf[217];
+		isthunder[player] = data[217];
 
 
 		// NEXT隠し
-		hnext_flag[player] = saveBuf[219];
+		hnext_flag[player] = data[219];
 
-		tomoyo_waits[player] = saveBuf[220];
+		tomoyo_waits[player] = data[220];
 	}
 	// せり上がり （ミッションでも使用）
-	tomoyo_rise[player] = saveBuf[218];
+	tomoyo_rise[player] = data[218];
 }
 
 /* ステージデータをセーブ */
 void saveTomoyoStage(int32_t player, int32_t number) {
 	int32_t i;
 
-	SDL_memset(saveBuf, 0, 50000 * 4);
+	SDL_memset(saveBuf, 0, STAGE_DATA_SIZE * sizeof(int32_t));
 
 	// フィールドをセーブバッファにコピー
 	for(i=0;i<210;i++) {
@@ -1502,6 +1498,5 @@ void saveTomoyoStage(int32_t player, int32_t number) {
 	saveBuf[220] = tomoyo_waits[player];
 
 	// 保存する
-	SDL_snprintf(string[0], STRING_LENGTH, "config/stage/stage%02d.sav", number);
-	APP_WriteFile32(string[0], saveBuf, 450);
+	putStageData(number, saveBuf);
 }
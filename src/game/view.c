@@ -152,61 +152,75 @@ void getSTime(int32_t time) {
 //  ピンチかどうかチェック
 //▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
 void pinchCheck(int32_t player) {
-	int32_t		i, j;
+	int32_t		i;
 
 	pinch[player] = 0;
 	if(ending[player]) return;
 
+	// fld[2 + i * 7]〜fld[7 + i * 7]を調べる
 	for(i = 0; i <= 7; i++)
-		for(j = 2; j <= 7; j++)
-			if(fld[j + i * 7 + player * 220]) {
-				pinch[player] = 1;
-				pinch2[player] = !(pinch2[player]);
-				break;
-			}
+		if(isFieldRangeOccupied(player, 2 + i * 7, 6)) {
+			pinch[player] = 1;
+			pinch2[player] = !(pinch2[player]);
+		}
 }
 //▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
 //  ピンチ回復できたかどうかチェック2
 //▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
 void pinchCheck2(int32_t player) {
-	int32_t		i, j;
+	int32_t		i;
 
 	pinch2[player] = 1;
 
 	for(i = 0; i <= 18/*7*/; i++)
-		for(j = 2; j <= 7; j++)
-			if(fld[j + i * 7 + player * 220]) {
-				pinch2[player] = 0;
-				break;
-			}
+		if(isFieldRangeOccupied(player, 2 + i * 7, 6)) {
+			pinch2[player] = 0;
+			break;
+		}
 }
 //▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
 //  背景表示
 //▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
-void viewBack(void) {
-	int32_t i, j, tmp;
+static int32_t getBackMovNo(void) {
+	if(backno == 61) return 12;
+	return backno;
+}
 
-	if(backno == 61) tmp = 12;
-	else tmp = backno;
+// 今のコマの背景を描く
+static void drawBackImage(void) {
+	//ExBlt(PLANE_BACK01 + backno, 0, 0);
 
-	// 通常描画
-	if( (bgfadesw == 0) || (demo) ) {
-		//ExBlt(PLANE_BACK01 + backno, 0, 0);
+	if(back_mov_f[getBackMovNo()] == 0) {
+		// 静止画
+		ExBltRect(PLANE_BACK01 + backno, 0, 0, 0, 0, 320, 240);
+	} else if(APP_SetPlaneStreamFrame(PLANE_BACK01 + backno, back_acnt)) {
+		// 動画（1コマずつ読み込み）
+		ExBltRect(PLANE_BACK01 + backno, 0, 0, 0, 0, 320, 240);
+	} else {
+		// 動画（全コマを並べた1枚の画像）
+		ExBltRect(PLANE_BACK01 + backno, 0, 0, (back_acnt / 10) * 320, (back_acnt % 10) * 240, 320, 240);
+	}
+}
 
-		if(back_mov_f[tmp] == 0) {
-			// 静止画
-			ExBltRect(PLANE_BACK01 + backno, 0, 0, 0, 0, 320, 240);
-		} else {
-			// 動画
-			ExBltRect(PLANE_BACK01 + backno, 0, 0, (back_acnt / 10) * 320, (back_acnt % 10) * 240, 320, 240);
+// 背景のアニメーションを進める
+static void advanceBackAnimation(void) {
+	int32_t tmp;
 
-			if(count % back_mov_inter[tmp] == 0)
-				back_acnt++;
+	tmp = getBackMovNo();
+	if(back_mov_f[tmp] != 0) {
+		if(count % back_mov_inter[tmp] == 0)
+			back_acnt++;
 
-			if(back_acnt > back_mov_f[tmp] - 1)
-				back_acnt = 0;
-		}
+		if(back_acnt > back_mov_f[tmp] - 1)
+			back_acnt = 0;
+	}
+}
 
+void viewBack(void) {
+	// 通常描画
+	if( (bgfadesw == 0) || (demo) ) {
+		drawBackImage();
+		advanceBackAnimation();
 		return;
 	}
 
@@ -220,30 +234,14 @@ void viewBack(void) {
 			backno = bg_max;
 			bgfadesw = 0;
 		}
-		//ExBlt(PLANE_BACK01 + backno, 0, 0);
-
-		if(back_mov_f[tmp] == 0) {
-			// 静止画
-			ExBltRect(PLANE_BACK01 + backno, 0, 0, 0, 0, 320, 240);
-		} else {
-			// 動画
-			ExBltRect(PLANE_BACK01 + backno, 0, 0, (back_acnt / 10) * 320, (back_acnt % 10) * 240, 320, 240);
-
-			if(count % back_mov_inter[tmp] == 0)
-				back_acnt++;
-
-			if(back_acnt > back_mov_f[tmp] - 1)
-				back_acnt = 0;
-		}
+		drawBackImage();
+		advanceBackAnimation();
 
 		if((backno < bg_max) || (gameMode[0] == 8) || (overcount != 0)){
 		if(bgfade_cnt < 14){
 			bgfade_cnt++;
-			for(i=0;i<5*getDrawRate();i++){
-				for(j=0;j<5*getDrawRate();j++){
-					APP_DrawPlaneRect(PLANE_FADE,i*64,j*48,0,bgfade_cnt*48,64,48); // accounts for draw rate, so correct to call directly.
-				}
-			}
+			// 64x48のコマを画面全体に並べる
+			APP_DrawPlaneRectTiled(PLANE_FADE, 0, 0, 320 * getDrawRate(), 240 * getDrawRate(), 0, bgfade_cnt*48, 64, 48); // accounts for draw rate, so correct to call directly.
 			if(bgfade_cnt == 6) {
 				backno++;
 				if((overcount != 0) || (status[0] == 23)) backno = 0;
@@ -1531,13 +1529,345 @@ void viewScore(void) {
 	if(gameMode[0] == 8) viewMission();	// mission.c
 }
 
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  フィールドのブロックの描画
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+// フィールドのブロックの見た目の種類 (-1なら空白)
+static int32_t getFieldBlockImage(int32_t i, int32_t k, int32_t j, int32_t *add) {
+	int32_t fi;
+
+	fi = fld[k + j * 10 + i * 220] - 1;
+
+	// アイテムの場合は見た目を変える #1.60c7n1
+	if( fldi[k + j * 10 + i * 220] ) {
+		fi = 17 + fldi[k + j * 10 + i * 220] - 1;
+	}
+	*add = 0;
+	if(fi < -1){
+		*add = 9;
+		fi = fi + 9;
+	}
+	if((item_monochrome[i]) && (fi != -1)){	//アイテムによる[ ]
+		fi = 8;
+		*add = 0;
+	}
+	return fi;
+}
+
+// フィールドのブロックの明るさ
+// 正方形が光る演出はここで進めるので、1フレームに1回だけ呼ぶこと
+static int32_t getFieldBlockColor(int32_t i, int32_t k, int32_t j, int32_t fi) {
+	int32_t color;
+
+	if ( iscolor[i] ) {
+		// COLORモード計算 #1.60c7p9ex
+		color = k;
+		if ( color >= 5 ) color = 9 - color;
+		color = color_tbl_max - ( (((20 - j) + color) * 4 + color_counter[i]) % color_tbl_max );
+		color = (erase[j + i * 22] == 0) * (7 + 10 - color_tbl[color]);
+	} else if(thunder_timer){
+		color = SDL_rand(8)+6;
+	} else if((fldi[k + j * 10 + i * 220] == fldisno) || (fldi[k + j * 10 + i * 220] == fldigsno)) {
+	// 正方形
+		if(flds[k + j * 10 + i * 220] >= -10) {
+			color = 17 + flds[k + j * 10 + i * 220];
+			flds[k + j * 10 + i * 220]--;
+		} else if(flds[k + j * 10 + i * 220] >= -19) {
+			color = SDL_abs(flds[k + j * 10 + i * 220]) - 10 + 7;
+			flds[k + j * 10 + i * 220]--;
+		} else {
+			color = (erase[j + i * 22] == 0) * 4;
+		}
+	} else {
+		if((fi >= 10) && (fi < 17 + fldihardno - 1))
+			color = 7 + (time2[i] % 55 >= 45);
+		else
+			color = ((erase[j + i * 22] == 0) && (heboGB[i] == 0)) * 4;
+	}
+//	if(hidden[i] == 8) color = 20;
+	return color;
+}
+
+// ブロックを描画 (x, yはブロックの左上)
+static void drawFieldBlock(int32_t i, int32_t k, int32_t j, int32_t fi, int32_t add, int32_t color, int32_t x, int32_t y) {
+	int32_t fldt3, fldt4, tmp;
+
+	//シャドウタイマーでうっすらと消えていく演出に使用 #1.60c7j9
+	fldt3 = fldt[k + j * 10 + i * 220];
+	fldt4 = fldt[k + j * 10 + i * 220] * 32;
+
+	if ( ( color <= 16 ) && ( (!isxray[i]) || (xray_counter[i] % p_xray_frame == k) ) && (!isblind[i])){
+		// フィールドタイマーが1〜8ならそのブロックは半透明になる(8段階)
+		// 0ならそのブロックは完全透明となる
+		// それ以外の値なら無効(通常の描画)
+		if((!isdark[i]) || ((isdark[i]) && (item_timer[i] > 420) && (item_timer[i] % 2 == 0))){
+			if((fldt3 >= 1) && (fldt3 <= 8)) {
+				// タイマーが8以下1以上なら半透明描画で消えていく #1.60c7k2
+				if((disable_giji3D < 4) && (!iscolor[i]) && (getFieldBlock(i, k + (1-2*i), j, 0) == 0) && (add == 0) && (fi != 8) && (fi != 9) && (heboGB[i]==0)){
+					if(fi < 8) tmp=getBigBlock_add(i);
+					else tmp = 8;
+					ExBlendBltRect(PLANE_HEBOBLK_SP2, x + 8 - (10 * i), y, (fi * 2) - ((fi >= 10) * 20) + (20 * tmp), color * 8, 2, 8, fldt4);
+				}
+				ExBlendBltRect(getBlockPlaneNo(i, fi), x, y, ((fi + add) * 8) - ((fi >= 10) * 80), color * 8, 8, 8, fldt4);
+			} else if((fldt3 != 0) && (fldt3 > -10)) {
+				// タイマーが0なら無視する #1.60c7k4
+				if((disable_giji3D < 4) && (!iscolor[i]) && (getFieldBlock(i, k + (1-2*i), j, 0) == 0) && (add == 0) && (fi != 8) && (fi != 9) && (heboGB[i]==0)){
+					if(fi < 8) tmp=getBigBlock_add(i);
+					else tmp = 8;
+					ExBltRect(PLANE_HEBOBLK_SP2, x + 8 - (10 * i), y, (fi * 2) - ((fi >= 10) * 20) + (20 * tmp), color * 8, 2, 8);
+				}
+				ExBltRect(getBlockPlaneNo(i, fi), x, y, ((fi + add) * 8) - ((fi >= 10) * 80), color * 8, 8, 8);
+			}
+		}
+	}
+}
+
+// ブロックの枠線を描画 (x, yはブロックの左上)
+static void drawFieldBlockFrame(int32_t i, int32_t k, int32_t j, int32_t fi, int32_t add, int32_t x, int32_t y) {
+	int32_t fldt3, tmp[4];
+
+	fldt3 = fldt[k + j * 10 + i * 220];
+
+	// X-RAY中は一部分だけ枠を描く #1.60c7p9ex改造
+	if( (isblind[i]) || ((blockflash != 2) && ( (!isxray[i]) || ( (xray_counter[i] % p_xray_frame == k) && (!xray_drawblockframe) ) ) ) ) {
+		// PRACTICEの2P側で[]の枠線が出ないように修正#1.60c7k2
+		if( ((fi != 8)&&(fi != 9) && (add == 0)) || (isblind[i])) {
+			// シャドウタイマーが残っていたら枠を描画 #1.60c7k1
+			// タイマーが-1（せり上がりまたは初期配置）な場合も表示してみる #1.60c7k3
+			// 条件を単純化(しすぎ？) #1.60c7k6
+			// NOTE: if(fldt3 == -1、1〜8)の条件を削除するとDTET風に。
+			if( (fldt3 == -1) || ((fldt3 != 0) && (fldt3 >= 8) && (m_roll_blockframe)) || ((isblind[i]) && (fldt3 != 0)) || (fldt3 < -1) || ((gameMode[i] == 5) && (pauseGame[i]))) {
+				// 死んだとき枠を消す #1.60c7k9
+				// COLOR中は枠を描かない#1.60c7p9ex
+				if((( !color_flag[i] && ((!dead_blockframe) || (gameMode[i] == 5) || (status[i] != 7)) )&& (heboGB[i]==0)) || (isblind[i])) {
+					// フィールド端では枠の一部分を表示しない #1.60c7s5
+					if((!isdark[i]) || ((gameMode[i] == 5) && (pauseGame[i]))){
+						// 新・枠線処理
+						if(fldt3 <= -10) add = 60 + fldt3 + 20;	//TI風消えロール時
+						else if(isblind[i]) add = 10;
+						else add = 0;
+						tmp[0] = getFieldBlock(i, k - 1, j    , 0);	//左
+						tmp[1] = getFieldBlock(i, k + 1, j    , 0);	//右
+						tmp[2] = getFieldBlock(i, k    , j - 1, 0);	//上
+						tmp[3] = getFieldBlock(i, k    , j + 1, 0);	//下
+						// 左
+						if (tmp[0] == 0)
+							ExBltRect(PLANE_GUIDE, x - 1, y - 1, 63, 0 + add, 10, 10);
+						// 右
+						if (tmp[1] == 0)
+							ExBltRect(PLANE_GUIDE, x - 1, y - 1, 73, 0 + add, 10, 10);
+						// 上
+						if (tmp[2] == 0)
+							ExBltRect(PLANE_GUIDE, x - 1, y - 1, 83, 0 + add, 10, 10);
+						// 下
+						if (tmp[3] == 0)
+							ExBltRect(PLANE_GUIDE, x - 1, y - 1, 93, 0 + add, 10, 10);
+					}
+				}
+			}
+		}
+	}
+}
+
+// プレイヤーiのフィールドを描く位置 (TOMOYOのミラーでは1Pを2P側にも描く)
+// 戻り値は位置の数
+static int32_t getFieldDrawX(int32_t i, int32_t x[2]) {
+	int32_t sides = 0;
+
+	if ((i == 0) || ((!tomoyo_domirror[0]) && (i == 1)))
+		x[sides++] = (15 + 24 * i - 12 * maxPlay) * 8 + ofs_x2[i];
+	if (tomoyo_domirror[0] && (i == 0))
+		x[sides++] = (15 + 24 * 1 - 12 * maxPlay) * 8 + ofs_x2[i];
+	return sides;
+}
+
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  固定されたブロックのキャッシュ
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+// 固定されたブロックは、ブロックが置かれたりラインが消えたりしない限り見た目が変わらないので、
+// キャッシュレイヤーに描いておき、毎フレーム1回で画面に描く
+// 各ブロックの見た目を決める値をまとめたキーを覚えておき、キーが変わった段だけ描き直す
+// 毎フレーム見た目が変わるブロックのある段は、キャッシュを使わず直接描く
+#define FIELD_CACHE_PAD	2	// 枠線と擬似3Dの端がはみ出す分
+#define FIELD_CACHE_W	(10 * 8 + FIELD_CACHE_PAD * 2)
+#define FIELD_CACHE_H	(22 * 8 + FIELD_CACHE_PAD * 2)
+#define FIELD_CACHE_STATE_COUNT	10
+
+static int32_t fieldCacheKey[10 * 22 * 2];	// キャッシュに描いてあるブロックのキー (0なら空白)
+static int32_t fieldCacheState[FIELD_CACHE_STATE_COUNT * 2];
+static int32_t fieldCacheValid[2];
+
+// キャッシュを使えるか (フィールド全体が毎フレーム変わる場合は使わない)
+static int32_t isFieldCacheable(int32_t i) {
+	if(iscolor[i] || thunder_timer || isxray[i] || isdark[i]) return 0;
+	// ナビゲーション
+	if((navigation) && (gameMode[i] == 0) && (tc[i] < navigation_limitLv) && (navigation_time[i] <= navigation_limittime) && (status[i] == 5)) return 0;
+	return 1;
+}
+
+// 毎フレーム見た目が変わるブロックか
+static int32_t isFieldBlockAnimated(int32_t i, int32_t k, int32_t j, int32_t fi) {
+	int32_t fldt3;
+
+	fldt3 = fldt[k + j * 10 + i * 220];
+	// 半透明で消えていく
+	if((fldt3 >= 1) && (fldt3 <= 8)) return 1;
+	// キーに収まらない
+	if((fi >= 128) || (fldt3 < -128)) return 1;
+	// 光っている正方形
+	if((fldi[k + j * 10 + i * 220] == fldisno) || (fldi[k + j * 10 + i * 220] == fldigsno))
+		return flds[k + j * 10 + i * 220] >= -19;
+	// 点滅するブロック
+	return (fi >= 10) && (fi < 17 + fldihardno - 1);
+}
+
+// ブロックの見た目を決める値をまとめる (アニメーションしないブロックのみ)
+static int32_t getFieldCacheKey(int32_t i, int32_t k, int32_t j, int32_t fi, int32_t add) {
+	int32_t fldt3;
+
+	fldt3 = fldt[k + j * 10 + i * 220];
+	if(fldt3 > 9) fldt3 = 9;	// 9以上は見た目が同じ
+
+	return 1 | (fi << 1) | ((add != 0) << 8) | (getFieldBlockColor(i, k, j, fi) << 9) | ((fldt3 + 128) << 14) |
+		((getFieldBlock(i, k - 1, j, 0) == 0) << 22) | ((getFieldBlock(i, k + 1, j, 0) == 0) << 23) |
+		((getFieldBlock(i, k, j - 1, 0) == 0) << 24) | ((getFieldBlock(i, k, j + 1, 0) == 0) << 25) |
+		((getFieldBlock(i, k + (1-2*i), j, 0) == 0) << 26);
+}
+
+// キャッシュのstart〜end段目を描く
+static void drawFieldCacheRows(int32_t i, int32_t start, int32_t end, const int32_t *animated) {
+	int32_t b, j, k, fi, add;
+
+	for(b = 0; b < 2; b++)
+		for(j = start; j <= end; j++) {
+			if((j >= hiddeny[i]) || (animated[j])) continue;
+			for(k = 0; k < 10; k++) {
+				fi = getFieldBlockImage(i, k, j, &add);
+				if(fi == -1) continue;
+				if(!b)
+					drawFieldBlock(i, k, j, fi, add, getFieldBlockColor(i, k, j, fi), FIELD_CACHE_PAD + k * 8, FIELD_CACHE_PAD + j * 8);
+				else
+					drawFieldBlockFrame(i, k, j, fi, add, FIELD_CACHE_PAD + k * 8, FIELD_CACHE_PAD + j * 8);
+			}
+		}
+}
+
+// キーが変わった段をキャッシュに描き直す
+static void updateFieldCache(int32_t i, const int32_t *animated) {
+	int32_t j, k, fi, add, start, key[10 * 22], dirty[22], state[FIELD_CACHE_STATE_COUNT];
+
+	// フィールド全体の見た目に関わる設定
+	state[0] = rotspl[i];
+	state[1] = heboGB[i];
+	state[2] = isblind[i];
+	state[3] = disable_giji3D;
+	state[4] = m_roll_blockframe;
+	state[5] = color_flag[i];
+	state[6] = dead_blockframe;
+	state[7] = (status[i] == 7);
+	state[8] = gameMode[i];
+	state[9] = pauseGame[i];
+
+	if(ExCacheLayerBegin(CACHE_LAYER_FIELD1 + i, FIELD_CACHE_W, FIELD_CACHE_H))
+		fieldCacheValid[i] = 0;
+	if(fieldCacheValid[i] && (SDL_memcmp(state, &fieldCacheState[i * FIELD_CACHE_STATE_COUNT], sizeof(state)) != 0))
+		fieldCacheValid[i] = 0;
+	if(!fieldCacheValid[i]) {
+		// 全部描き直す
+		ExCacheLayerClear(0, 0, FIELD_CACHE_W, FIELD_CACHE_H);
+		for(j = 0; j < 10 * 22; j++) fieldCacheKey[j + i * 220] = 0;
+		SDL_memcpy(&fieldCacheState[i * FIELD_CACHE_STATE_COUNT], state, sizeof(state));
+		fieldCacheValid[i] = 1;
+	}
+
+	for(j = 0; j < 22; j++) {
+		dirty[j] = 0;
+		for(k = 0; k < 10; k++) {
+			key[k + j * 10] = 0;
+			if((j < hiddeny[i]) && (!animated[j])) {
+				fi = getFieldBlockImage(i, k, j, &add);
+				if(fi != -1) key[k + j * 10] = getFieldCacheKey(i, k, j, fi, add);
+			}
+			if(key[k + j * 10] != fieldCacheKey[k + j * 10 + i * 220]) dirty[j] = 1;
+		}
+	}
+
+	// 続いている段はまとめて描き直す
+	// 枠線は上下の段に1ドットはみ出すので、上下の段も一緒に描く
+	for(j = 0; j < 22; j++) {
+		if(!dirty[j]) continue;
+		start = j;
+		while((j + 1 < 22) && dirty[j + 1]) j++;
+
+		// 消した範囲の外には描かれない
+		ExCacheLayerClear(0, FIELD_CACHE_PAD + start * 8 - 1, FIELD_CACHE_W, (j - start + 1) * 8 + 2);
+		drawFieldCacheRows(i, (start > 0) ? start - 1 : 0, (j < 21) ? j + 1 : 21, animated);
+	}
+	APP_EndCacheLayer();
+
+	for(j = 0; j < 10 * 22; j++) fieldCacheKey[j + i * 220] = key[j];
+}
+
+// 固定されたブロックを描画
+static void viewFieldBlocks(int32_t i) {
+	int32_t b, j, k, p, fi, add, color, sides, cached, x[2], animated[22];
+
+	sides = getFieldDrawX(i, x);
+	cached = isFieldCacheable(i);
+	if(!cached) fieldCacheValid[i] = 0;
+
+	// 毎フレーム見た目が変わるブロックのある段は直接描く
+	for(j = 0; j < 22; j++) {
+		animated[j] = !cached;
+		if(cached && (j < hiddeny[i])) {
+			for(k = 0; k < 10; k++) {
+				fi = getFieldBlockImage(i, k, j, &add);
+				if((fi != -1) && isFieldBlockAnimated(i, k, j, fi)) {
+					animated[j] = 1;
+					break;
+				}
+			}
+		}
+	}
+
+	for(b = 0; b < 2; b++) {
+		// キャッシュは直接描く段のブロックと枠線の間に描く（全部直接描いた時と同じ重なり順になる）
+		if(b && cached && sides && APP_RenderThisFrame()) {
+			updateFieldCache(i, animated);
+			for(p = 0; p < sides; p++)
+				ExCacheLayerBlt(CACHE_LAYER_FIELD1 + i, x[p] - FIELD_CACHE_PAD, 3 * 8 + ofs_y2[i] - FIELD_CACHE_PAD);
+		}
+
+		for(j = 0; j < hiddeny[i]; j++) {
+			if(!animated[j]) continue;
+			for(k = 0; k < 10; k++) {
+				fi = getFieldBlockImage(i, k, j, &add);
+				if(fi != -1) {
+					if(!b) {
+						color = getFieldBlockColor(i, k, j, fi);
+						for(p = 0; p < sides; p++)
+							drawFieldBlock(i, k, j, fi, add, color, x[p] + k * 8, (j + 3) * 8 + ofs_y2[i]);
+					} else {
+						for(p = 0; p < sides; p++)
+							drawFieldBlockFrame(i, k, j, fi, add, x[p] + k * 8, (j + 3) * 8 + ofs_y2[i]);
+					}
+				}/* if(fi != -1) */
+				if((navigation) && (gameMode[i] == 0) && (tc[i] < navigation_limitLv) && (b) && (navigation_time[i] <= navigation_limittime) && (status[i] == 5)){
+					if((fld[k + j * 10 + i * 220] == 0) && (cp_fld[k + j * 10 + i * 220] == c_cblk_r[i] + 1)){
+						ExBltRect(PLANE_GUIDE, (k + 15 + 24 * i - 12 * maxPlay) * 8, (j+ 3) * 8, ((c_cblk[i]-1) * 8), (((navigation_time[i] % 20)/2) * 8)+38, 8, 8);
+					}
+				}
+			}
+		}
+	}
+}
+
 //▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
 //  フィールドの描画
 //▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
 // Big対応 #1.60c7
 void viewField(void) {
-	int32_t		b, i, j, k, fi, color, add, tmp[4];
-	int32_t		fldt3, fldt4;	//シャドウタイマーでうっすらと消えていく演出に使用 #1.60c7j9
+	int32_t		i, j, k, fi, color, tmp[4];
 	int32_t		maxPlayTemp;
 
 	maxPlayTemp = maxPlay;
@@ -1596,167 +1926,7 @@ void viewField(void) {
 					}
 		//通常
 		} else if((!pauseGame[i]) || (debug) || ((gameMode[i] == 5) && (pauseGame[i]))) {
-			for(b = 0; b < 2; b++)
-				for(j = 0; j < hiddeny[i]; j++)
-					for(k = 0; k < 10; k++) {
-						fi = fld[k + j * 10 + i * 220] - 1;
-						fldt3 = fldt[k + j * 10 + i * 220];
-						fldt4 = fldt[k + j * 10 + i * 220] * 32;
-
-						// アイテムの場合は見た目を変える #1.60c7n1
-						if( fldi[k + j * 10 + i * 220] ) {
-							fi = 17 + fldi[k + j * 10 + i * 220] - 1;
-						}
-						add = 0;
-						if(fi < -1){
-							add = 9;
-							fi = fi + 9;
-						}
-						if((item_monochrome[i]) && (fi != -1)){	//アイテムによる[ ]
-							fi = 8;
-							add = 0;
-						}
-						if(fi != -1) {
-							if(!b) {
-								if ( iscolor[i] ) {
-									// COLORモード計算 #1.60c7p9ex
-									color = k;
-									if ( color >= 5 ) color = 9 - color;
-									color = color_tbl_max - ( (((20 - j) + color) * 4 + color_counter[i]) % color_tbl_max );
-									color = (erase[j + i * 22] == 0) * (7 + 10 - color_tbl[color]);
-								} else if(thunder_timer){
-									color = SDL_rand(8)+6;
-								} else if((fldi[k + j * 10 + i * 220] == fldisno) || (fldi[k + j * 10 + i * 220] == fldigsno)) {
-								// 正方形
-									if(flds[k + j * 10 + i * 220] >= -10) {
-										color = 17 + flds[k + j * 10 + i * 220];
-										flds[k + j * 10 + i * 220]--;
-									} else if(flds[k + j * 10 + i * 220] >= -19) {
-										color = SDL_abs(flds[k + j * 10 + i * 220]) - 10 + 7;
-										flds[k + j * 10 + i * 220]--;
-									} else {
-										color = (erase[j + i * 22] == 0) * 4;
-									}
-								} else {
-									if((fi >= 10) && (fi < 17 + fldihardno - 1))
-										color = 7 + (time2[i] % 55 >= 45);
-									else
-										color = ((erase[j + i * 22] == 0) && (heboGB[i] == 0)) * 4;
-								}
-							//	if(hidden[i] == 8) color = 20;
-								if ( ( color <= 16 ) && ( (!isxray[i]) || (xray_counter[i] % p_xray_frame == k) ) && (!isblind[i])){
-									// フィールドタイマーが1〜8ならそのブロックは半透明になる(8段階)
-									// 0ならそのブロックは完全透明となる
-									// それ以外の値なら無効(通常の描画)
-									if((!isdark[i]) || ((isdark[i]) && (item_timer[i] > 420) && (item_timer[i] % 2 == 0))){
-										if((fldt3 >= 1) && (fldt3 <= 8)) {
-											// タイマーが8以下1以上なら半透明描画で消えていく #1.60c7k2
-											if((disable_giji3D < 4) && (!iscolor[i]) && (getFieldBlock(i, k + (1-2*i), j, 0) == 0) && (add == 0) && (fi != 8) && (fi != 9) && (heboGB[i]==0)){
-												if(fi < 8) tmp[0]=getBigBlock_add(i);
-												else tmp[0] = 8;
-												if ((i == 0) || ((!tomoyo_domirror[0]) && (i == 1)))
-													ExBlendBltRect(PLANE_HEBOBLK_SP2, (k + 15 + 24 * i - 12 * maxPlay) * 8 + ofs_x2[i] + 8 - (10 * i), (j + 3) * 8 + ofs_y2[i],
-														(fi * 2) - ((fi >= 10) * 20) + (20 * tmp[0]), color * 8, 2, 8, fldt4);
-												if (tomoyo_domirror[0] && (i == 0))
-												ExBlendBltRect(PLANE_HEBOBLK_SP2, (k + 15 + 24 * 1 - 12 * maxPlay) * 8 + ofs_x2[i] + 8 - (10 * i), (j + 3) * 8 + ofs_y2[i],
-													(fi * 2) - ((fi >= 10) * 20) + (20 * tmp[0]), color * 8, 2, 8, fldt4);
-											}
-											if ((i == 0) || ((!tomoyo_domirror[0]) && (i == 1)))
-												ExBlendBltRect(getBlockPlaneNo(i, fi), (k + 15 + 24 * i - 12 * maxPlay) * 8 + ofs_x2[i], (j + 3) * 8 + ofs_y2[i],
-													((fi + add) * 8) - ((fi >= 10) * 80), color * 8, 8, 8, fldt4);
-											if (tomoyo_domirror[0] && (i == 0))
-												ExBlendBltRect(getBlockPlaneNo(i, fi), (k + 15 + 24 * 1 - 12 * maxPlay) * 8 + ofs_x2[i], (j + 3) * 8 + ofs_y2[i],
-													((fi + add) * 8) - ((fi >= 10) * 80), color * 8, 8, 8, fldt4);
-										} else if((fldt3 != 0) && (fldt3 > -10)) {
-											// タイマーが0なら無視する #1.60c7k4
-											if((disable_giji3D < 4) && (!iscolor[i]) && (getFieldBlock(i, k + (1-2*i), j, 0) == 0) && (add == 0) && (fi != 8) && (fi != 9) && (heboGB[i]==0)){
-												if(fi < 8) tmp[0]=getBigBlock_add(i);
-												else tmp[0] = 8;
-												if ((i == 0) || ((!tomoyo_domirror[0]) && (i == 1)))
-													ExBltRect(PLANE_HEBOBLK_SP2, (k + 15 + 24 * i - 12 * maxPlay) * 8 + ofs_x2[i] + 8 - (10 * i), (j + 3) * 8 + ofs_y2[i],
-														(fi * 2) - ((fi >= 10) * 20) + (20 * tmp[0]), color * 8, 2, 8);
-												if (tomoyo_domirror[0] && (i == 0))
-													ExBltRect(PLANE_HEBOBLK_SP2, (k + 15 + 24 * 1 - 12 * maxPlay) * 8 + ofs_x2[i] + 8 - (10 * i), (j + 3) * 8 + ofs_y2[i],
-														(fi * 2) - ((fi >= 10) * 20) + (20 * tmp[0]), color * 8, 2, 8);
-											}
-											if ((i == 0) || ((!tomoyo_domirror[0]) && (i == 1)))
-												ExBltRect(getBlockPlaneNo(i, fi), (k + 15 + 24 * i - 12 * maxPlay) * 8 + ofs_x2[i],
-													(j + 3) * 8 + ofs_y2[i], ((fi + add) * 8) - ((fi >= 10) * 80), color * 8, 8, 8);
-											if (tomoyo_domirror[0] && (i == 0))
-												ExBltRect(getBlockPlaneNo(i, fi), (k + 15 + 24 * 1 - 12 * maxPlay) * 8 + ofs_x2[i],
-													(j + 3) * 8 + ofs_y2[i], ((fi + add) * 8) - ((fi >= 10) * 80), color * 8, 8, 8);
-										}
-									}
-								}
-							} else {
-								// X-RAY中は一部分だけ枠を描く #1.60c7p9ex改造
-								if( (isblind[i]) || ((blockflash != 2) && ( (!isxray[i]) || ( (xray_counter[i] % p_xray_frame == k) && (!xray_drawblockframe) ) ) ) ) {
-									// PRACTICEの2P側で[]の枠線が出ないように修正#1.60c7k2
-									if( ((fi != 8)&&(fi != 9) && (add == 0)) || (isblind[i])) {
-										// シャドウタイマーが残っていたら枠を描画 #1.60c7k1
-										// タイマーが-1（せり上がりまたは初期配置）な場合も表示してみる #1.60c7k3
-										// 条件を単純化(しすぎ？) #1.60c7k6
-										// NOTE: if(fldt3 == -1、1〜8)の条件を削除するとDTET風に。
-										if( (fldt3 == -1) || ((fldt3 != 0) && (fldt3 >= 8) && (m_roll_blockframe)) || ((isblind[i]) && (fldt3 != 0)) || (fldt3 < -1) || ((gameMode[i] == 5) && (pauseGame[i]))) {
-											// 死んだとき枠を消す #1.60c7k9
-											// COLOR中は枠を描かない#1.60c7p9ex
-											if((( !color_flag[i] && ((!dead_blockframe) || (gameMode[i] == 5) || (status[i] != 7)) )&& (heboGB[i]==0)) || (isblind[i])) {
-												// フィールド端では枠の一部分を表示しない #1.60c7s5
-												if((!isdark[i]) || ((gameMode[i] == 5) && (pauseGame[i]))){
-													// 新・枠線処理
-													if(fldt3 <= -10) add = 60 + fldt3 + 20;	//TI風消えロール時
-													else if(isblind[i]) add = 10;
-													else add = 0;
-													tmp[0] = getFieldBlock(i, k - 1, j    , 0);	//左
-													tmp[1] = getFieldBlock(i, k + 1, j    , 0);	//右
-													tmp[2] = getFieldBlock(i, k    , j - 1, 0);	//上
-													tmp[3] = getFieldBlock(i, k    , j + 1, 0);	//下
-													// 左
-													if (tmp[0] == 0)
-													{
-														if ((i == 0) || ((!tomoyo_domirror[0]) && (i == 1)))
-															ExBltRect(PLANE_GUIDE, (k + 15 + 24 * i - 12 * maxPlay) * 8 - 1 + ofs_x2[i], (j + 3) * 8 - 1 + ofs_y2[i], 63, 0 + add, 10, 10);
-														if (tomoyo_domirror[0] && (i == 0))
-															ExBltRect(PLANE_GUIDE, (k + 15 + 24 * 1 - 12 * maxPlay) * 8 - 1 + ofs_x2[i], (j + 3) * 8 - 1 + ofs_y2[i], 63, 0 + add, 10, 10);
-													}
-													// 右
-													if (tmp[1] == 0)
-													{
-														if ((i == 0) || ((!tomoyo_domirror[0]) && (i == 1)))
-															ExBltRect(PLANE_GUIDE, (k + 15 + 24 * i - 12 * maxPlay) * 8 - 1 + ofs_x2[i], (j + 3) * 8 - 1 + ofs_y2[i], 73, 0 + add, 10, 10);
-														if (tomoyo_domirror[0] && (i == 0))
-															ExBltRect(PLANE_GUIDE, (k + 15 + 24 * 1 - 12 * maxPlay) * 8 - 1 + ofs_x2[i], (j + 3) * 8 - 1 + ofs_y2[i], 73, 0 + add, 10, 10);
-													}
-													// 上
-													if (tmp[2] == 0)
-													{
-														if ((i == 0) || ((!tomoyo_domirror[0]) && (i == 1)))
-															ExBltRect(PLANE_GUIDE, (k + 15 + 24 * i - 12 * maxPlay) * 8 - 1 + ofs_x2[i], (j + 3) * 8 - 1 + ofs_y2[i], 83, 0 + add, 10, 10);
-														if (tomoyo_domirror[0] && (i == 0))
-															ExBltRect(PLANE_GUIDE, (k + 15 + 24 * 1 - 12 * maxPlay) * 8 - 1 + ofs_x2[i], (j + 3) * 8 - 1 + ofs_y2[i], 83, 0 + add, 10, 10);
-													}
-													// 下
-													if (tmp[3] == 0)
-													{
-														if ((i == 0) || ((!tomoyo_domirror[0]) && (i == 1)))
-															ExBltRect(PLANE_GUIDE, (k + 15 + 24 * i - 12 * maxPlay) * 8 - 1 + ofs_x2[i], (j + 3) * 8 - 1 + ofs_y2[i], 93, 0 + add, 10, 10);
-														if (tomoyo_domirror[0] && (i == 0))
-															ExBltRect(PLANE_GUIDE, (k + 15 + 24 * 1 - 12 * maxPlay) * 8 - 1 + ofs_x2[i], (j + 3) * 8 - 1 + ofs_y2[i], 93, 0 + add, 10, 10);
-													}
-													add = 0;
-												}
-											}
-										}
-									}
-								}
-							}
-						}/* if(fi != -1) */
-						if((navigation) && (gameMode[i] == 0) && (tc[i] < navigation_limitLv) && (b) && (navigation_time[i] <= navigation_limittime) && (status[i] == 5)){
-							if((fld[k + j * 10 + i * 220] == 0) && (cp_fld[k + j * 10 + i * 220] == c_cblk_r[i] + 1)){
-								ExBltRect(PLANE_GUIDE, (k + 15 + 24 * i - 12 * maxPlay) * 8, (j+ 3) * 8, ((c_cblk[i]-1) * 8), (((navigation_time[i] % 20)/2) * 8)+38, 8, 8);
-							}
-						}
-					}
+			viewFieldBlocks(i);
 
 			if(hiddenc[i] < 15) {
 				hiddenc[i]++;
@@ -1971,22 +2141,33 @@ void viewPreview(void){
 	}
 }
 /* フィールド背景を表示 #1.60c7n5 */
-void viewFldBackground(void) {
-	int32_t i, k;
+#define FLD_BACKGROUND_STATIC	1	// 毎フレーム変わらない部分
+#define FLD_BACKGROUND_SCROLL	2	// スクロールする背景 (background == 0)
 
-	for(i = 0; i <= maxPlay; i++) {
+// GBモード・オールドスタイルの白い背景
+static int32_t isWhiteFldBackground(int32_t i) {
+	return (heboGB[i]==1) || (((tc[i] >= over1000_start) || (over1000_block[i]) || ((p_over1000)&&(gameMode[i] == 5))) && (rotspl[i] == 6));
+}
+
+// XRAY・COLORのときの黒い背景
+static int32_t isBlackFldBackground(int32_t i) {
+	return ( xray_flag[i] && !xray_bgblack ) || ( color_flag[i] && !color_bgblack ) || (heboGB[i] == 2);
+}
+
+static void drawFldBackground(int32_t i, int32_t part) {
+	int32_t		k, tr;
+
+	if(part & FLD_BACKGROUND_STATIC) {
 		// ------------------------
 		// ここから C++版上部枠表示
 
-		int32_t		tr;
-
 		if(background == 2) {
 			ExBlendBltRect(PLANE_HEBOFLB0, 120 + 192 * i - 96 * maxPlay, 40, 0, 0, 80, 160, 256 - fldtr);
 		}
 
 		// GBモードでなければ上を描画
 		// グラデーション部分をなめらかにしない
-		if (!((heboGB[i]==1) || (((tc[i] >= over1000_start) || (over1000_block[i]) || ((p_over1000)&&(gameMode[i] == 5))) && (rotspl[i] == 6))))
+		if (!isWhiteFldBackground(i))
 		{
 			// グラデーション部分をなめらかに#1.60c7p9ex
 			if(!top_frame){
@@ -2010,23 +2191,16 @@ void viewFldBackground(void) {
 		// ここまで C++版上部枠表示
 		// ------------------------
 
-		if((heboGB[i]==1) || (((tc[i] >= over1000_start) || (over1000_block[i]) || ((p_over1000)&&(gameMode[i] == 5))) && (rotspl[i] == 6))){
+		if(isWhiteFldBackground(i)){
 		//フィールド背景を白く
 			ExBltRect(PLANE_HEBOFLD, 112 + ofs_x[i] + 192 * i - 96 * maxPlay, 32, 96 * 7, 0, 96, 176);
 			ExBltRect(PLANE_HEBOSPR, 110 + 192 * i - 96 * maxPlay, 8, 184, 275 + (24 * top_frame), 107, 24);
 		}
 		// XRAY・COLORのときに黒背景を描く
-		else if ( ( xray_flag[i] && !xray_bgblack ) || ( color_flag[i] && !color_bgblack ) || (heboGB[i] == 2))
+		else if (isBlackFldBackground(i))
 		{
 			ExBltRect(PLANE_HEBOFLB0, 120 + ofs_x[i] + 192 * i - 96 * maxPlay, 40 + ofs_y[i], 0, 0, 80, 160);
 		}
-		else if(background == 0)
-		{
-				if ((i == 0) || ((!tomoyo_domirror[0]) && (i == 1)))
-					ExBlendBltRect(PLANE_HEBOFLB1 + pinch[i] * 2, 120 + ofs_x[i] + 192 * i - 96 * maxPlay, 40 + ofs_y[i], count % 128 / 4, count % 256 / 8, 80, 160, 256 - fldtr);
-				if (tomoyo_domirror[0] && (i == 0))
-					ExBlendBltRect(PLANE_HEBOFLB1 + pinch[i] * 2, 120 + ofs_x[i] + 192 * 1 - 96 * maxPlay, 40 + ofs_y[i], count % 128 / 4, count % 256 / 8, 80, 160, 256 - fldtr);
-		}
 		else if(background == 1)
 		{
 			if ((i == 0) || ((!tomoyo_domirror[0]) && (i == 1)))
@@ -2035,6 +2209,101 @@ void viewFldBackground(void) {
 				ExBlendBltRect(PLANE_HEBOFLB1 + pinch[i] * 2, 120 + ofs_x[i] + 192 * 1 - 96 * maxPlay, 40 + ofs_y[i], 0, 0, 80, 160, 256 - fldtr);
 		}
 	}
+
+	if((part & FLD_BACKGROUND_SCROLL) && (background == 0) && !isWhiteFldBackground(i) && !isBlackFldBackground(i))
+	{
+		if ((i == 0) || ((!tomoyo_domirror[0]) && (i == 1)))
+			ExBlendBltRect(PLANE_HEBOFLB1 + pinch[i] * 2, 120 + ofs_x[i] + 192 * i - 96 * maxPlay, 40 + ofs_y[i], count % 128 / 4, count % 256 / 8, 80, 160, 256 - fldtr);
+		if (tomoyo_domirror[0] && (i == 0))
+			ExBlendBltRect(PLANE_HEBOFLB1 + pinch[i] * 2, 120 + ofs_x[i] + 192 * 1 - 96 * maxPlay, 40 + ofs_y[i], count % 128 / 4, count % 256 / 8, 80, 160, 256 - fldtr);
+	}
+}
+
+void viewFldBackground(void) {
+	int32_t i;
+
+	for(i = 0; i <= maxPlay; i++) {
+		drawFldBackground(i, FLD_BACKGROUND_STATIC | FLD_BACKGROUND_SCROLL);
+	}
+}
+
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  背景とフィールド背景のキャッシュ
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+// 背景とフィールド背景の変わらない部分をキャッシュレイヤーに描いておき、毎フレーム1回で画面に描く
+// 見た目を決める値をキーとして覚えておき、キーが変わった時だけ描き直す
+#define BACK_CACHE_MIN_INTER	3	// これより速くコマが変わる動画背景はキャッシュしない
+#define BACK_CACHE_KEY_COUNT	19
+
+static int32_t backCacheKey[BACK_CACHE_KEY_COUNT];
+static int32_t backCacheValid = 0;
+
+// キャッシュを使えるか
+static int32_t isBackCacheable(void) {
+	int32_t tmp;
+
+	// フェード中は毎フレーム変わる
+	if((bgfadesw != 0) && (!demo)) return 0;
+	if(skip_viewbg) return 1;
+
+	tmp = getBackMovNo();
+	return (back_mov_f[tmp] == 0) || (back_mov_inter[tmp] >= BACK_CACHE_MIN_INTER);
+}
+
+static void getBackCacheKey(int32_t *key) {
+	int32_t i;
+
+	key[0] = skip_viewbg;
+	key[1] = backno;
+	key[2] = back_mov_f[getBackMovNo()] ? back_acnt : 0;
+	key[3] = maxPlay;
+	key[4] = background;
+	key[5] = fldtr;
+	key[6] = top_frame;
+	key[7] = tomoyo_domirror[0];
+	key[8] = getDrawRate();
+	for(i = 0; i < 2; i++) {
+		if(i <= maxPlay) {
+			key[9 + i * 5 + 0] = isWhiteFldBackground(i);
+			key[9 + i * 5 + 1] = isBlackFldBackground(i);
+			key[9 + i * 5 + 2] = pinch[i];
+			key[9 + i * 5 + 3] = ofs_x[i];
+			key[9 + i * 5 + 4] = ofs_y[i];
+		} else {
+			key[9 + i * 5 + 0] = key[9 + i * 5 + 1] = key[9 + i * 5 + 2] = key[9 + i * 5 + 3] = key[9 + i * 5 + 4] = 0;
+		}
+	}
+}
+
+// 背景とフィールド背景を表示
+void viewBackground(void) {
+	int32_t i, key[BACK_CACHE_KEY_COUNT];
+
+	if(!isBackCacheable()) {
+		backCacheValid = 0;
+		// 背景非表示設定追加 #1.60c7i9
+		if(!skip_viewbg) viewBack();
+		viewFldBackground();
+		return;
+	}
+
+	if(APP_RenderThisFrame()) {
+		getBackCacheKey(key);
+		if(ExCacheLayerBegin(CACHE_LAYER_BACK, 320, 240))
+			backCacheValid = 0;
+		if(!backCacheValid || (SDL_memcmp(key, backCacheKey, sizeof(key)) != 0)) {
+			ExCacheLayerClear(0, 0, 320, 240);
+			if(!skip_viewbg) drawBackImage();
+			for(i = 0; i <= maxPlay; i++) drawFldBackground(i, FLD_BACKGROUND_STATIC);
+			SDL_memcpy(backCacheKey, key, sizeof(key));
+			backCacheValid = 1;
+		}
+		APP_EndCacheLayer();
+		ExCacheLayerBlt(CACHE_LAYER_BACK, 0, 0);
+	}
+
+	if(!skip_viewbg) advanceBackAnimation();
+	for(i = 0; i <= maxPlay; i++) drawFldBackground(i, FLD_BACKGROUND_SCROLL);
 }
 
 /* フィールド枠を表示(uponlyを1にすると上部分だけ表示) */
@@ -2216,11 +2485,210 @@ void printConKey(int32_t fontX, int32_t fontY, int32_t conPlayer, APP_ConKey* ke
 }
 #endif
 
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  文字列の描画のキャッシュ
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+// スコアやタイムなどの文字列は何フレームも同じ物が同じ位置に描かれるので、
+// (フォント, 文字列, 色, 位置)ごとに各文字の転送元と転送先を覚えておき、
+// 1つの文字列をプレーンごとに1回の描画で済ませる
+// 1フレームの間描かれなかった文字列はadvanceHudStrings()で捨てる
+#define HUD_STRING_SETS		128
+#define HUD_STRING_WAYS		2
+#define HUD_STRING_LENGTH	32		// これより長い文字列は分けて覚える
+
+typedef enum HudFont {
+	HUD_FONT_NORMAL,
+	HUD_FONT_SMALL,
+	HUD_FONT_BIG,
+	HUD_FONT_TINY
+} HudFont;
+
+typedef struct HudString {
+	bool used;
+	uint32_t hash;
+	uint32_t frame;			// 最後に描いたフレーム
+	HudFont font;
+	int32_t x, y;			// 画面上の座標
+	int32_t color, size;	// sizeはfontsize
+	int32_t length;
+	char text[HUD_STRING_LENGTH];
+
+	int32_t w, h;
+	int32_t plane[2];
+	int32_t glyphCount[2];	// glyphsの先頭からglyphCount[0]個がplane[0]、残りがplane[1]
+	APP_Glyph glyphs[HUD_STRING_LENGTH];
+} HudString;
+
+static HudString hudStrings[HUD_STRING_SETS][HUD_STRING_WAYS];
+static uint32_t hudStringFrame = 0;
+
+static uint32_t hashHudString(HudFont font, int32_t x, int32_t y, const char *text, int32_t length, int32_t color) {
+	uint32_t	hash;
+	int32_t		i, key[5];
+
+	// FNV-1a
+	hash = 2166136261u;
+	for(i = 0; i < length; i++) {
+		hash ^= (uint8_t)text[i];
+		hash *= 16777619u;
+	}
+	key[0] = font;
+	key[1] = x;
+	key[2] = y;
+	key[3] = color;
+	key[4] = fontsize;
+	for(i = 0; i < 5; i++) {
+		hash ^= (uint32_t)key[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+// ExBltText()と同じ並びのフォントの文字を並べる
+static void makeHudStringText(HudString *entry, int32_t plane, char firstChar, int32_t w, int32_t h, int32_t sheetX, int32_t sheetY, int32_t sheetW) {
+	int32_t		i, charPos;
+
+	entry->w = w;
+	entry->h = h;
+	entry->plane[0] = plane;
+	entry->glyphCount[0] = entry->length;
+	entry->glyphCount[1] = 0;
+	for(i = 0; i < entry->length; i++) {
+		charPos = (entry->text[i] - firstChar) * w;
+		entry->glyphs[i].dstX = entry->x + i * w;
+		entry->glyphs[i].dstY = entry->y;
+		entry->glyphs[i].srcX = sheetX + charPos % sheetW;
+		entry->glyphs[i].srcY = sheetY + (charPos / sheetW) * h;
+	}
+}
+
+// 小さいフォントの文字を並べる 数字はPLANE_HEBOFONT3、アルファベットはPLANE_HEBOFONT4
+static void makeHudStringSmall(HudString *entry) {
+	int32_t		i, n, stringChar;
+	APP_Glyph	*glyph;
+
+	entry->w = 6;
+	entry->h = 9;
+	entry->plane[0] = PLANE_HEBOFONT3;
+	entry->plane[1] = PLANE_HEBOFONT4;
+
+	n = 0;
+	for(i = 0; i < entry->length; i++) {
+		stringChar = entry->text[i];
+		if((stringChar == 32) || (stringChar > 64)) continue;
+		// 数字
+		glyph = &entry->glyphs[n++];
+		glyph->dstX = entry->x + 6 * i;
+		glyph->dstY = entry->y;
+		glyph->srcX = (stringChar - 48) * 6 + 132;
+		glyph->srcY = entry->color * 9 + (90 * fontsize);
+	}
+	entry->glyphCount[0] = n;
+
+	for(i = 0; i < entry->length; i++) {
+		stringChar = entry->text[i];
+		if(stringChar <= 64) continue;
+		glyph = &entry->glyphs[n++];
+		glyph->dstX = entry->x + 6 * i;
+		glyph->dstY = entry->y;
+		// 大文字
+		if(stringChar <= 96) {
+			glyph->srcX = (stringChar - 65) * 6;
+			glyph->srcY = entry->color * 18;
+		}
+		// 小文字
+		else {
+			glyph->srcX = (stringChar - 97) * 6;
+			glyph->srcY = (entry->color * 18) + 9;
+		}
+	}
+	entry->glyphCount[1] = n - entry->glyphCount[0];
+}
+
+static const HudString *getHudString(HudFont font, int32_t x, int32_t y, const char *text, int32_t length, int32_t color) {
+	uint32_t	hash;
+	int32_t		way;
+	HudString	*set, *entry;
+
+	hash = hashHudString(font, x, y, text, length, color);
+	set = hudStrings[hash % HUD_STRING_SETS];
+	for(way = 0; way < HUD_STRING_WAYS; way++) {
+		entry = &set[way];
+		if( entry->used && (entry->hash == hash) && (entry->font == font) && (entry->x == x) && (entry->y == y) &&
+			(entry->color == color) && (entry->size == fontsize) && (entry->length == length) &&
+			(SDL_memcmp(entry->text, text, length) == 0) ) {
+			entry->frame = hudStringFrame;
+			return entry;
+		}
+	}
+
+	// 空いているか、一番前に描かれた物を置き換える
+	entry = &set[0];
+	for(way = 1; way < HUD_STRING_WAYS; way++) {
+		if(!entry->used) break;
+		if(!set[way].used || (hudStringFrame - set[way].frame > hudStringFrame - entry->frame))
+			entry = &set[way];
+	}
+
+	entry->used = true;
+	entry->hash = hash;
+	entry->frame = hudStringFrame;
+	entry->font = font;
+	entry->x = x;
+	entry->y = y;
+	entry->color = color;
+	entry->size = fontsize;
+	entry->length = length;
+	SDL_memcpy(entry->text, text, length);
+
+	switch(font) {
+	case HUD_FONT_NORMAL:
+		makeHudStringText(entry, PLANE_HEBOFONT, ' ', 8, 8, 0, color * 24, 256);
+		break;
+	case HUD_FONT_SMALL:
+		makeHudStringSmall(entry);
+		break;
+	case HUD_FONT_BIG:
+		makeHudStringText(entry, PLANE_HEBOFONT3, '0', 12, 16, 0, color * 16 + 160 * fontsize, 12 * 11);
+		break;
+	case HUD_FONT_TINY:
+		makeHudStringText(entry, PLANE_HEBOFONT5, ' ', 6, 7, 0, 287, 192);
+		break;
+	}
+	return entry;
+}
+
+// 文字列を描く 座標はドット単位、charWは1文字の幅
+static void printHudString(HudFont font, int32_t x, int32_t y, const char *text, int32_t charW, int32_t color) {
+	const HudString	*entry;
+	int32_t			i, length, stringLength;
+
+	stringLength = (int32_t)SDL_strlen(text);
+	for(i = 0; i < stringLength; i += HUD_STRING_LENGTH) {
+		length = SDL_min(stringLength - i, HUD_STRING_LENGTH);
+		entry = getHudString(font, x + i * charW, y, &text[i], length, color);
+		if(entry->glyphCount[0] > 0)
+			ExBltGlyphs(entry->plane[0], entry->glyphs, entry->glyphCount[0], entry->w, entry->h);
+		if(entry->glyphCount[1] > 0)
+			ExBltGlyphs(entry->plane[1], &entry->glyphs[entry->glyphCount[0]], entry->glyphCount[1], entry->w, entry->h);
+	}
+}
+
+// 1フレームの終わりに呼ぶ
+void advanceHudStrings(void) {
+	int32_t		i, way;
+
+	for(i = 0; i < HUD_STRING_SETS; i++)
+		for(way = 0; way < HUD_STRING_WAYS; way++)
+			if(hudStrings[i][way].frame != hudStringFrame) hudStrings[i][way].used = false;
+	hudStringFrame++;
+}
+
 //▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
 //  フォントを表示する
 //▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
 void printFont(int32_t fontX, int32_t fontY, const char *fontStr, int32_t fontColor) {
-	ExBltText(PLANE_HEBOFONT, fontStr, ' ', 8, 8, fontX * 8, fontY * 8, 0, fontColor * 24, 256);
+	printHudString(HUD_FONT_NORMAL, fontX * 8, fontY * 8, fontStr, 8, fontColor);
 }
 
 // 小さいバージョン
@@ -2231,76 +2699,22 @@ void printFont(int32_t fontX, int32_t fontY, const char *fontStr, int32_t fontCo
 // >→%
 // ?→.
 void printSMALLFont(int32_t fontX, int32_t fontY, const char *fontStr, int32_t fontColor) {
-	int32_t		i, sx, sy, stringLength, stringChar;
-
-	stringLength = (int32_t)SDL_strlen(fontStr);
-	for(i = 0; i < stringLength; i++) {
-		stringChar = fontStr[i];
-
-		// スペースでない場合
-		if(stringChar != 32) {
-			// 数字
-			if(stringChar <= 64) {
-				sx = (stringChar - 48) * 6 + 132;
-				sy = fontColor * 9;
-				ExBltRect(PLANE_HEBOFONT3, fontX + 6 * i, fontY, sx, sy + (90 * fontsize), 6, 9);
-			}
-			// 大文字
-			else if(stringChar <= 96) {
-				sx = (stringChar - 65) * 6;
-				sy = fontColor * 18;
-				ExBltRect(PLANE_HEBOFONT4, fontX + 6 * i, fontY, sx, sy, 6, 9);
-			}
-			// 小文字
-			else {
-				sx = (stringChar - 97) * 6;
-				sy = (fontColor * 18) + 9;
-				ExBltRect(PLANE_HEBOFONT4, fontX + 6 * i, fontY, sx, sy, 6, 9);
-			}
-		}
-	}
+	printHudString(HUD_FONT_SMALL, fontX, fontY, fontStr, 6, fontColor);
 }
 // 6 x 9のグリッド単位で座標を指定できるバージョン
 void printSMALLFontEX(int32_t fontX, int32_t fontY, const char *fontStr, int32_t fontColor) {
-	int32_t		i, sx, sy, stringLength, stringChar;
-
-	stringLength = (int32_t)SDL_strlen(fontStr);
-	for(i = 0; i < stringLength; i++) {
-		stringChar = fontStr[i];
-
-		// スペースでない場合
-		if(stringChar != 32) {
-			// 数字
-			if(stringChar <= 64) {
-				sx = (stringChar - 48) * 6 + 132;
-				sy = fontColor * 9;
-				ExBltRect(PLANE_HEBOFONT3, (fontX + i) * 6, fontY * 9, sx, sy + (90 * fontsize), 6, 9);
-			}
-			// 大文字
-			else if(stringChar <= 96) {
-				sx = (stringChar - 65) * 6;
-				sy = fontColor * 18;
-				ExBltRect(PLANE_HEBOFONT4, (fontX + i) * 6, fontY * 9, sx, sy, 6, 9);
-			}
-			// 小文字
-			else {
-				sx = (stringChar - 97) * 6;
-				sy = (fontColor * 18) + 9;
-				ExBltRect(PLANE_HEBOFONT4, (fontX + i) * 6, fontY * 9, sx, sy, 6, 9);
-			}
-		}
-	}
+	printHudString(HUD_FONT_SMALL, fontX * 6, fontY * 9, fontStr, 6, fontColor);
 }
 
 // 大きいバージョン（数字のみ）
 void printBIGFont(int32_t fontX, int32_t fontY, const char *fontStr, int32_t fontColor) {
-	ExBltText(PLANE_HEBOFONT3, fontStr, '0', 12, 16, fontX, fontY, 0, fontColor * 16 + 160 * fontsize, 12 * 11);
+	printHudString(HUD_FONT_BIG, fontX, fontY, fontStr, 12, fontColor);
 }
 
 // とっても小さいバージョン　6x7
 // 数字、/ : < > 、アルファベット大文字が使用可能　ただし字詰め無し
 void printTinyFont(int32_t fontX, int32_t fontY, const char *fontStr) {
-	ExBltText(PLANE_HEBOFONT5, fontStr, ' ', 6, 7, fontX, fontY, 0, 287, 192);
+	printHudString(HUD_FONT_TINY, fontX, fontY, fontStr, 6, 0);
 }
 
 //▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
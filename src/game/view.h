@@ -42,8 +42,10 @@ void printConKey(int32_t fontX, int32_t fontY, int32_t conPlayer, APP_ConKey* ke
 #endif
 void printFont(int32_t fontX,int32_t fontY,const char *fontStr,int32_t fontColor);
 void printSMALLFont(int32_t fontX,int32_t fontY,const char *fontStr,int32_t fontColor);
+void advanceHudStrings(void);
 void viewScoreSmall(void);
 void viewBack(void);
+void viewBackground(void);
 void pinchCheck2(int32_t player);
 void pinchCheck(int32_t player);
 void getSTime(int32_t time);
@@ -115,6 +115,37 @@ int32_t iBlockKickTable[4 * 4 * 2 * 2] = {
 	 2, 0,		-1, 0,		-1, 1,		 2, -1,		// 2>>3
 	-2, 0,		 1, 0,		 1, 2,		-2, -1		// 3>>0
 };
+// I以外のブロック壁蹴りテーブル（4候補×4方向×2回転×2補正座標）
+int32_t otherBlockKickTable[4 * 4 * 2 * 2] = {
+	// 左回転
+	 1, 0,		 1, -1,		 0, 2,		 1, 2,		// 0>>3
+	 1, 0,		 1, 1,		 0, -2,		 1, -2,		// 1>>0
+	-1, 0,		-1, -1,		 0, 2,		-1, 2,		// 2>>1
+	-1, 0,		-1, 1,		 0, -2,		-1, -2,		// 3>>2
+
+	// 右回転
+	-1, 0,		-1, -1,		 0, 2,		-1, 2,		// 0>>1
+	 1, 0,		 1, 1,		 0, -2,		 1, -2,		// 1>>2
+	 1, 0,		 1, -1,		 0, 2,		 1, 2,		// 2>>3
+	-1, 0,		-1, 1,		 0, -2,		-1, -2		// 3>>0
+};
+
+// I型ブロック壁蹴りテーブル（world_i_rotが0の時）
+// 0, 0の候補は回転できなかった位置と同じなので必ず外れる
+int32_t iBlockOldKickTable[4 * 4 * 2 * 2] = {
+	// 左回転
+	 2, 0,		-1, 0,		-1, -2,		 0, 0,		// 0>>3
+	-1, 0,		 2, 0,		 2, -1,		 2, 2,		// 1>>0
+	 1, 0,		-2, 0,		-2, -1,		 0, 0,		// 2>>1
+	 1, 0,		-2, 0,		 1, -2,		 1, 1,		// 3>>2
+
+	// 右回転
+	-2, 0,		 1, 0,		 1, -2,		 0, 0,		// 0>>1
+	-1, 0,		 2, 0,		-1, -2,		-1, 1,		// 1>>2
+	-1, 0,		 2, 0,		 2, -1,		 0, 0,		// 2>>3
+	 1, 0,		-2, 0,		-2, -1,		-2, 2		// 3>>0
+};
+
 // SRS-X専用　180度回転壁蹴りテーブル（I以外）
 // 偶数番号は2回180°回転すれば元の位置に戻る（かもしれない）が、
 // 奇数番号は下への補正が優先される（かもしれない）
@@ -140,19 +171,20 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 	int32_t		bak, bottom, move, don, flash, kosa, rolling ,synchro,landing, fsmooth;
 	int32_t		mx, my, sx[11], sy[11], i, k, l;
 	int32_t		j,lockT;
+	const RulesProfile *rules = getRulesProfile();
 
 	fsmooth = 0;
 	don = 0;
 	synchro = 0;
 	landing = 0;
-	if((repversw >= 35) && (kickm != -1)) kickm++;
+	if((rules->landingReset) && (kickm != -1)) kickm++;
 	hiddenProc (player);
 
 	if(!statusc[player * 10 + 2]) {
 		padRepeat (player);
 
 		// Hold
-		if((repversw >= 64) && (!statusc[player * 10 + 6])){
+		if((rules->holdTiming == HOLD_TIMING_FIRST) && (!statusc[player * 10 + 6])){
 			doHold(player, 0);
 			// HOLDしてゲームオーバーになった場合はここで止める #1.60c7m2
 			if(status[player] == 7) return;
@@ -171,7 +203,7 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 		if( (spawn_y_type) && (sp[player] >= 1200) ) bs[player] = 1320;
 
 		// Hold
-		if(repversw < 35){
+		if(rules->holdTiming == HOLD_TIMING_AFTER_GRAVITY){
 			doHold(player, 0);
 			// HOLDしてゲームオーバーになった場合はここで止める #1.60c7m2
 			if(status[player] == 7) return;
@@ -181,14 +213,14 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 		rolling = 0;
 		if(isrollroll[player]) {
 			// 回るタイミングを「ステージタイムが30フレームで割り切れる」時に変更 #1.60c7m5
-			if((ending[player] == 2) && (repversw >= 44)){
+			if((ending[player] == 2) && (rules->rollRollTimer)){
 				/* エンディング・ロール */
 				if( edrec[player] % p_rollroll_timer == 0 )
 					rolling = 1;
 			} else if( gameMode[player] == 6 ) {
 				/* TOMOYO */
 				//ステージ20以降（ステージタイム無し）
-				if((repversw >= 44) && (stage[player] > 19) && (ltime[player] % p_rollroll_timer == 0))
+				if((rules->rollRollTimer) && (stage[player] > 19) && (ltime[player] % p_rollroll_timer == 0))
 					rolling = 1;
 				//ステージ19まで
 				else if( stime[player] % p_rollroll_timer == 0 )
@@ -202,13 +234,13 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 
 		// 回転
 		// 回転方向逆転設定対応#1.60c7f8
-		if((statusc[player * 10 + 6] != 0) && (repversw >= 59))
+		if((statusc[player * 10 + 6] != 0) && (rules->holdRotateLock))
 			move = 0;
 		else if(w_reverse)
 			move = (getPushState(player , 4) || getPushState(player , 6) || rolling) - (getPushState(player , 5));
 		else
 			move = (getPushState(player , 5) || rolling) - (getPushState(player , 4) || getPushState(player , 6));
-		if((rotspl[player] == 7) && (getPushState(player , 6) != 0) && (repversw >= 23) && (statusc[player * 10 + 6] == 0)) move = 2;
+		if((rotspl[player] == 7) && (getPushState(player , 6) != 0) && (rules->srsx180) && (statusc[player * 10 + 6] == 0)) move = 2;
 		if((move != 0 ) && (isrotatelock[player] == 0)) {
 				bak = (rt[player] + move);
 				if(istrance[player]){
@@ -227,7 +259,7 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 				if(bak > 3) bak = bak - 4;
 				if(bak < 0) bak = bak + 4;
 			}
-			if((repversw >= 35) && (judgeBlock (player, bx[player], by[player] + 1, blk[player], rt[player]) != 0)) landing = 1;
+			if((rules->landingReset) && (judgeBlock (player, bx[player], by[player] + 1, blk[player], rt[player]) != 0)) landing = 1;
 			if(judgeBlock (player, bx[player], by[player], k, bak) == 0) {
 				if(rotate_snd) PlaySE(WAVE_SE_ROTATE);	// 回転音設定#1.60c7f7
 				rt[player] = bak;
@@ -253,20 +285,12 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 						}
 					}
 				}else if(blk[player] != 0) {	//	I以外の時
-					/*
-					1>>0, 2: (+1, 0)>(+1, +1)>(0, -2)>(+1, -2)
-					3>>0, 2: (-1, 0)>(-1, +1)>(0, -2)>(-1, -2)
-					0, 2>>1: (-1, 0)>(-1, -1)>(0, +2)>(-1, +2)
-					0, 2>>3: (+1, 0)>(+1, -1)>(0, +2)>(+1, +2)
-					*/
-					sx[0] = co(((rt[player]==1)||(bak==3)), 1, -1);
-					sy[0] = 0;
-					sx[1] = sx[0];
-					sy[1] = co(rt[player]%2, 1, -1);
-					sx[2] = 0;
-					sy[2] = sy[1]*(-2);
-					sx[3] = sx[0];
-					sy[3] = sy[2];
+					j = (move > 0) * 32;
+
+					for(i = 0; i < 4; i++) {
+						sx[i] = otherBlockKickTable[ (i * 2) + (rt[player] * 8) + j ];
+						sy[i] = otherBlockKickTable[ (i * 2) + (rt[player] * 8) + j + 1 ];
+					}
 				} else {		//	Iの時
 					if(world_i_rot) {
 						/*
@@ -295,34 +319,27 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 						1>>2:(-1, 0)>(+2, 0)>(-1, -2)>(+2, +1)    3>>2:(+1, 0)>(-2, 0)>(+1, -2)>(-2, +1)
 						1>>0:(-1, 0)>(+2, 0)>(+2, -1)>(-1, +2)    3>>0:(+1, 0)>(-2, 0)>(-2, -1)>(+1, +2)
 						*/
-						sx[0] = co(((rt[player]==3)||(bak == 1)), 1, -1);
-						sy[0] = 0;
-						sx[1] = sx[0]*(-2);
-						sy[1] = 0;
-						sx[2] = co((rt[player]+bak==3), co(sx[0]==1, -2, -1), co(sx[0]==1, 1, 2));
-						sy[2] = co(sx[2]%2, -2, -1);
-						sx[3] = (rt[player]%2)*co(bak, sx[0], sx[1]);
-						sy[3] = (rt[player]%2)*co(bak, 1, 2);
-						if(rt[player] == 0) {		// 状態0からの回転時だけ修正
-							i = sx[0]; sx[0] = sx[1]; sx[1] = i;
+						j = (move > 0) * 32;
+
+						for(i = 0; i < 4; i++) {
+							sx[i] = iBlockOldKickTable[ (i * 2) + (rt[player] * 8) + j ];
+							sy[i] = iBlockOldKickTable[ (i * 2) + (rt[player] * 8) + j + 1 ];
 						}
 					}
 				}
 
 				// BIGでは補正量を2倍する #1.60c7m6
 				if(IsBig[player]) {
-					for(i = 0; i < 4+(7*((move == 2) && (repversw >= 48))); i++) {
+					for(i = 0; i < 4+(7*((move == 2) && (rules->big180Kick))); i++) {
 						sx[i] = sx[i] * 2;
 						sy[i] = sy[i] * 2;
 					}
 				}
 
-				for(i = 0; i < 4+(7*(move == 2)); i++) {
-					if(judgeBlock (player, bx[player]+sx[i], by[player]+sy[i], k, bak) == 0) {
-						mx = sx[i];
-						my = sy[i];
-						break;
-					}
+				i = findBlockKick(player, bx[player], by[player], k, bak, sx, sy, 4+(7*(move == 2)));
+				if(i >= 0) {
+					mx = sx[i];
+					my = sy[i];
 				}
 			}
 
@@ -343,12 +360,12 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 				statusc[player * 10 + 5]++;
 			}
 			l = judgeBlock (player, bx[player], by[player] + 1, blk[player], rt[player]);
-			if((rt[player] == bak) && ((l != 0) || ((landing) && (repversw >= 35))) && (heboGB[player]==0)) {
-				if(repversw < 40) kickc[player]++;	// 接地した状態での回転回数をカウント
+			if((rt[player] == bak) && ((l != 0) || ((landing) && (rules->landingReset))) && (heboGB[player]==0)) {
+				if(!rules->rotateCount) kickc[player]++;	// 接地した状態での回転回数をカウント
 				else kickc3[player]++;
 				if((world_drop_snd != 0) && (world_drop_snd != 3) && (l != 0))
 					PlaySE(WAVE_SE_KON);
-				if((((kickc[player] < kickm) || (kickm == -1)) && (repversw < 40)) || (kickc3[player] < kickr) || (kickr == -1)) {
+				if((((kickc[player] < kickm) || (kickm == -1)) && (!rules->rotateCount)) || (kickc3[player] < kickr) || (kickr == -1)) {
 					bk[player] = 0;		// 固定時間リセット
 				}
 				// T-SPIN権利獲得 #1.60c7n6
@@ -371,14 +388,14 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 			}
 			// BIG時、2マス単位モードの場合は移動量を2倍する #1.60c7m6
 			if(IsBig[player] && BigMove[player]) move = move * 2;
-			if((repversw >= 35) && (judgeBlock (player, bx[player], by[player] + 1, blk[player], rt[player]) != 0)) landing = 1;
-			if((mpc[player] == 1) || (mpc[player] >= waitt[player]) || ( (rotspl[player] == 6) && (mpc[player] >= 10 - (repversw >= 64)) && (repversw >= 19) ) || ((isremote[player])&&(gameMode[player] != 4)))
+			if((rules->landingReset) && (judgeBlock (player, bx[player], by[player] + 1, blk[player], rt[player]) != 0)) landing = 1;
+			if((mpc[player] == 1) || (mpc[player] >= waitt[player]) || ( (rotspl[player] == 6) && (mpc[player] >= rules->dsWorldDasDelay) && (rules->dsWorldDas) ) || ((isremote[player])&&(gameMode[player] != 4)))
 				if(judgeBlock (player, bx[player] + move, by[player], blk[player], rt[player]) == 0) {
 					bx[player] = bx[player] + move;
 					if(movesound) PlaySE(WAVE_SE_MOVE);	// 移動音設定が反映されないのを修正#1.60c7f7
 					l = judgeBlock (player, bx[player], by[player] + 1, blk[player], rt[player]);
-					if(((l != 0) || ((landing) && (repversw >= 35))) && (heboGB[player]==0)) {	// 横移動でも固定時間リセット
-						if((!synchro) || (repversw < 35)) kickc[player]++;
+					if(((l != 0) || ((landing) && (rules->landingReset))) && (heboGB[player]==0)) {	// 横移動でも固定時間リセット
+						if((!synchro) || (!rules->landingReset)) kickc[player]++;
 						if((world_drop_snd != 0) && (world_drop_snd != 3) && (l != 0))
 							PlaySE(WAVE_SE_KON);
 						if((kickc[player] < kickm) || (kickm == -1)) {
@@ -396,16 +413,16 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 
 		//	↓を離している、またはdowntypeが0の場合、下入れ制限解除#1.60c7f9
 		if((!getPressState(player, 1-(1*(isUDreverse[player])))) || (!downtype)) down_flag[player] = 0;
-		if((!getPressState(player, 0+(1*(isUDreverse[player])))) || (!downtype) || (repversw < 12)) up_flag[player] = 0;
+		if((!getPressState(player, 0+(1*(isUDreverse[player])))) || (!downtype) || (!rules->upFlag)) up_flag[player] = 0;
 
 		//	高速落下!! 下入れ改造#1.60c7f9
-		if((!move) && getPressState(player , 1-(1*(isUDreverse[player]))) && ((sp[player] < 60) || ((rotspl[player] == 7) && (repversw >= 44))) && (!down_flag[player]) && ((statusc[player * 10 + 4]) || (repversw < 27))) {
-			if((heboGB[player])&& (repversw >= 52)){
+		if((!move) && getPressState(player , 1-(1*(isUDreverse[player]))) && ((sp[player] < 60) || ((rotspl[player] == 7) && (rules->srsxSoftDrop))) && (!down_flag[player]) && ((statusc[player * 10 + 4]) || (!rules->firstFrameWait))) {
+			if((heboGB[player])&& (rules->heboSoftDrop)){
 				bs[player] = bs[player] + 20;//1/3G
-			}else if(((rotspl[player] == 3) || (rotspl[player] == 6)) && (repversw >= 20)){
+			}else if(((rotspl[player] == 3) || (rotspl[player] == 6)) && (rules->slowSoftDrop)){
 				bs[player] = bs[player] + 30;		//ACE-SRSとDS-WORLDの高速落下を遅く
 			}else{
-				if((rotspl[player] == 7) && (repversw >= 44)) bs[player] = bs[player] + 90;
+				if((rotspl[player] == 7) && (rules->srsxSoftDrop)) bs[player] = bs[player] + 90;
 				else bs[player] = 61;
 			}
 			if((gameMode[player]>=9)||((gameMode[player]==6)&&(anothermode[player]==4))||((gameMode[player]==7)&&(anothermode[player]==3))){
@@ -415,14 +432,14 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 			}
 		}
 
-		if((ismagnetblock[player]) && (repversw >= 41)) bs[player] = bs[player] + 30;
+		if((ismagnetblock[player]) && (rules->magnetGravity)) bs[player] = bs[player] + 30;
 
-		for(bottom = by[player]; judgeBlock (player, bx[player], bottom, blk[player], rt[player]) == 0; bottom++);
+		bottom = findBlockBottom(player, bx[player], by[player], blk[player], rt[player]);
 
 		//	地面にくっついた
 		if((judgeBlock (player, bx[player], by[player] + 1, blk[player], rt[player]) != 0)) {
 
-			if((ismagnetblock[player] == 1) || ((kickc[player] >= kickm) && (kickm != -1) && (rotspl[player] != 6) && (repversw >= 30)) ||
+			if((ismagnetblock[player] == 1) || ((kickc[player] >= kickm) && (kickm != -1) && (rotspl[player] != 6) && (rules->kickLimitLock)) ||
 			((kickc3[player] >= kickr) && (kickr != -1) && (rotspl[player] != 6)))
 				bk[player] = 100;
 
@@ -436,24 +453,24 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 
 			// 下入れ改造#1.60c7f9
 			if((getPressState(player , 1-(1*(isUDreverse[player])))) && (!down_flag[player])
-						&& (statusc[player * 10 + 4] || (repversw < 27)) && (!move || nanamedown)) {
+						&& (statusc[player * 10 + 4] || (!rules->firstFrameWait)) && (!move || nanamedown)) {
 				if((rotspl[player] == 7) || (heboGB[player]!=0))	// SRS-X即接着
 					bk[player] = 100;
 				else
-					bk[player] = bk[player] + 1 + ((rotspl[player] == 2) && (repversw >= 30) && (!nanamedown));
+					bk[player] = bk[player] + 1 + ((rotspl[player] == 2) && (rules->downLockBoost) && (!nanamedown));
             }
 
 			// 上入れ即接着
-			if( ( (getPressState(player , 0+(1*(isUDreverse[player]))) && (repversw >= 43)) ||
-				  (getPushState(player , 0+(1*(isUDreverse[player]))) && (repversw < 43)) )
-				 && (rotspl[player] != 7) && ( (repversw <= 13) || !up_flag[player] ) && (heboGB[player]==0)
-				 && (statusc[player * 10 + 4] || (repversw < 27)) && (!move || nanamedown)) {
+			if( ( (getPressState(player , 0+(1*(isUDreverse[player]))) && (rules->upLockHold)) ||
+				  (getPushState(player , 0+(1*(isUDreverse[player]))) && (!rules->upLockHold)) )
+				 && (rotspl[player] != 7) && ( (!rules->upLockLimit) || !up_flag[player] ) && (heboGB[player]==0)
+				 && (statusc[player * 10 + 4] || (!rules->firstFrameWait)) && (!move || nanamedown)) {
 				bk[player] = bk[player] + lockT;
 				if((rotspl[player] == 3) || (rotspl[player] == 6))	//ACE-SRSは専用のSEを鳴らす
 					PlaySE(WAVE_SE_ACE_SONIC_LOCK);
 
 				// 上入れ制限追加 #1.60c7q8
-				if( downtype && (repversw >= 14) && (repversw < 54)) up_flag[player] = 1;
+				if( downtype && (rules->upLockLimit) && (!rules->lockFlags)) up_flag[player] = 1;
 			}
 
 			if((bk[player] > lockT) || ((kickc[player] > kickm) && (kickm != -1)) || ((kickc3[player] > kickr) && (kickr != -1))) {
@@ -467,7 +484,7 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 				drawCBlock (player, 0, 0, 10, 0);
 				// 下入れ制限#1.60c7f9
 				if((getPressState(player , 1-(1*(isUDreverse[player])))) && (downtype) && (!move || nanamedown)) down_flag[player] = 1;
-				if((repversw >= 57) && (rotspl[player] != 6)) goto lockflash;	// SUPERなSKIP
+				if((rules->superSkip) && (rotspl[player] != 6)) goto lockflash;	// SUPERなSKIP
 				return;
 			}
 		} else {
@@ -477,7 +494,7 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 
 			// 上キーで一瞬で落下&固定
 			// 上入れ制限追加 #1.60c7p1
-			if(getPressState(player , 0+(1*(isUDreverse[player]))) && (!move) && (!sonicdrop) && (!up_flag[player]) && (heboGB[player]==0) && ((statusc[player * 10 + 4]) || (repversw < 27))) {
+			if(getPressState(player , 0+(1*(isUDreverse[player]))) && (!move) && (!sonicdrop) && (!up_flag[player]) && (heboGB[player]==0) && ((statusc[player * 10 + 4]) || (!rules->firstFrameWait))) {
 				if(rotspl[player] != 7){
 					if(gameMode[player]==10){//15%
 						sc[player] = sc[player] + ( bottom - by[player] - 1 ) * 23 / 20;
@@ -511,9 +528,9 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 					kickc3[player] = 0;
 					statusc[player * 10 + 2] ++;
 					drawCBlock (player, 0, 0, 10, 0);
-					if((downtype) && (repversw < 54)) up_flag[player] = 1;
+					if((downtype) && (!rules->lockFlags)) up_flag[player] = 1;
 					statusc[player * 10 + 5] = 0;	// 回転させた数リセット #1.60c7s6
-					if((repversw >= 57) && (rotspl[player] != 6)) goto lockflash;	// SUPERなSKIP
+					if((rules->superSkip) && (rotspl[player] != 6)) goto lockflash;	// SUPERなSKIP
 					return;
 				}
 				else {	//SRS-X
@@ -536,15 +553,12 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 					bs[player] = 0;
 					bk[player] = 0;
 					if(!smooth) don = 1;
-					if((downtype) && (repversw < 54)) up_flag[player] = 1;
+					if((downtype) && (!rules->lockFlags)) up_flag[player] = 1;
 					statusc[player * 10 + 5] = 0;	// 回転させた数リセット #1.60c7s6
 				}
 			}
 
-			int one_g = 60;
-			if (repversw > 65)
-				one_g--;
-			while (bs[player] > one_g) {
+			while (bs[player] > rules->oneG) {
 				bk[player] = 0;
 				tspin_flag[player] = 0;	// T-SPIN権利剥奪 #1.60c7o9
 
@@ -566,14 +580,14 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 					bs[player] = 0;
 					if(!smooth) don = 1;
 
-					if((ismagnetblock[player] == 1) || ((kickc[player] >= kickm) && (kickm != -1) && (rotspl[player] != 6) && (repversw >= 30)) ||
+					if((ismagnetblock[player] == 1) || ((kickc[player] >= kickm) && (kickm != -1) && (rotspl[player] != 6) && (rules->kickLimitLock)) ||
 					((kickc3[player] >= kickr) && (kickr != -1) && (rotspl[player] != 6)))
 						bk[player] = 100;
 
 					// 下キーで固定速度アップ #1.60c7r3
-					if( getPressState(player, 1-(1*(isUDreverse[player]))) && (!down_flag[player]) && (repversw >= 15)
-							&& (statusc[player * 10 + 4] || (repversw < 27)) && (!move || nanamedown)) {
-						if((rotspl[player] != 7) && (heboGB[player]==0)) bk[player] = bk[player] + 1 + ((rotspl[player] == 2) && (repversw >= 30) && (!nanamedown));
+					if( getPressState(player, 1-(1*(isUDreverse[player]))) && (!down_flag[player]) && (rules->gravityLock)
+							&& (statusc[player * 10 + 4] || (!rules->firstFrameWait)) && (!move || nanamedown)) {
+						if((rotspl[player] != 7) && (heboGB[player]==0)) bk[player] = bk[player] + 1 + ((rotspl[player] == 2) && (rules->downLockBoost) && (!nanamedown));
 						else {	// SRS-X即固定
 							PlaySE(WAVE_SE_KON);
 							if(heboGB[player]==0)
@@ -583,16 +597,16 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 							statusc[player * 10 + 2]++;
 							drawCBlock (player, 0, 0, 10, 0);
 							if(downtype) down_flag[player] = 1;
-							if((repversw >= 57) && (rotspl[player] != 6)) goto lockflash;	// SUPERなSKIP
+							if((rules->superSkip) && (rotspl[player] != 6)) goto lockflash;	// SUPERなSKIP
 							return;
 						}
 					}
 
 					// 上入れ即接着 #1.60c7r3
-					if( ( (getPressState(player , 0+(1*(isUDreverse[player]))) && (repversw >= 43)) ||
-						  (getPushState(player , 0+(1*(isUDreverse[player]))) && (repversw < 43)) )
-						&& (rotspl[player] != 7) &&(!up_flag[player]) && (repversw >= 15) && (heboGB[player]==0)
-						&& (statusc[player * 10 + 4] || (repversw < 27)) && (!move || nanamedown)) {
+					if( ( (getPressState(player , 0+(1*(isUDreverse[player]))) && (rules->upLockHold)) ||
+						  (getPushState(player , 0+(1*(isUDreverse[player]))) && (!rules->upLockHold)) )
+						&& (rotspl[player] != 7) &&(!up_flag[player]) && (rules->gravityLock) && (heboGB[player]==0)
+						&& (statusc[player * 10 + 4] || (!rules->firstFrameWait)) && (!move || nanamedown)) {
 						PlaySE(WAVE_SE_KACHI);
 						if((rotspl[player] == 3) || (rotspl[player] == 6))	//ACE-SRSは専用のSEを鳴らす
 							PlaySE(WAVE_SE_ACE_SONIC_LOCK);
@@ -601,8 +615,8 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 						statusc[player * 10 + 2]++;
 						drawCBlock (player, 0, 0, 10, 0);
 						if(downtype) up_flag[player] = 1;
-						if((repversw >= 57) && (rotspl[player] != 6)) goto lockflash;	// SUPERなSKIP
-						if(repversw >= 57) return;
+						if((rules->superSkip) && (rotspl[player] != 6)) goto lockflash;	// SUPERなSKIP
+						if(rules->superSkip) return;
 					}
 				} else {
 					// 回転させた数リセット #1.60c7s6
@@ -626,26 +640,26 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 		else
 			drawCBlock (player, kosa, 0 , flash, 0);
 
-		if((repversw >= 35) && (repversw < 64) && (!statusc[player * 10 + 2]) && (!statusc[player * 10 + 6])){
+		if((rules->holdTiming == HOLD_TIMING_LAST) && (!statusc[player * 10 + 2]) && (!statusc[player * 10 + 6])){
 			 doHold(player, 0);
 			// HOLDしてゲームオーバーになった場合はここで止める #1.60c7m2
 			if(status[player] == 7) return;
 		}
 
 		statusc[player * 10 + 6] = 0;
-		if((repversw >= 57) && (statusc[player * 10 + 2] != 0)) goto lockflash;	// SUPERなSKIP
+		if((rules->superSkip) && (statusc[player * 10 + 2] != 0)) goto lockflash;	// SUPERなSKIP
 	} else {
 		lockflash:
 		statusc[player * 10 + 2] ++;
 		if((c_nblk[0 + player * 6] != 8) && (c_nblk[0 + player * 6] >= 0))drawCBlock (player, 0, 0, 10, 0);
 
 		// ↓を離している場合、下入れ制限解除#1.60c7n6
-		if((!getPressState(player, 1-(1*(isUDreverse[player])))) && (repversw >= 10)) down_flag[player] = 0;
-		else if((downtype) && (repversw >= 54)) down_flag[player] = 1;
+		if((!getPressState(player, 1-(1*(isUDreverse[player])))) && (rules->releaseDownFlag)) down_flag[player] = 0;
+		else if((downtype) && (rules->lockFlags)) down_flag[player] = 1;
 		if(!getPressState(player, 0+(1*(isUDreverse[player])))) up_flag[player] = 0;
-		else if((downtype) && (repversw >= 54)) up_flag[player] = 1;
+		else if((downtype) && (rules->lockFlags)) up_flag[player] = 1;
 
-		if(statusc[player * 10 + 2] > 2 - (repversw >= 9)) {	// 接着時の灰色化を1フレ短縮 #1.60c7k8
+		if(statusc[player * 10 + 2] > rules->lockFlashFrames) {	// 接着時の灰色化を1フレ短縮 #1.60c7k8
 			setBlock (player, bx[player], by[player], blk[player], rt[player]);
 			if(status[player] == 7) return;
 
@@ -677,14 +691,14 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 			}
 
 			// エンディング中の花火発生 #1.60c7s8
-			if( (ending[player] == 2) && (gameMode[player] == 0) && (repversw <= 37)) {
+			if( (ending[player] == 2) && (gameMode[player] == 0) && (rules->endingHanabi)) {
 				hanabi_total[player]++;
 				hanabi_waiting[player]++;
 			}
 			// ACEカスタム式IRS
-			if((ace_irs == 2) && (repversw >= 35)) doIRS2plus(player);
+			if((ace_irs == 2) && (rules->aceIrs)) doIRS2plus(player);
 			// ブロック消去判断により1フレ短縮 #1.60c7k8
-			if ((blockEraseJudge(player)) || (repversw < 9)) {
+			if ((blockEraseJudge(player)) || (!rules->eraseJudge)) {
 				status[player] = 8;
 				statusc[player * 10] = 0;
 				statusc[player * 10 + 1] = 0;
@@ -694,7 +708,7 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 				statusc[player * 10 + 5] = 0;
 				statusc[player * 10 + 6] = 0;
 				//ステータス変更と同時に次のステータス関数を実行する事で1フレ短縮　C7V2.1
-				if(repversw >= 54) statEraseBlock(player);
+				if(rules->eraseShortcut) statEraseBlock(player);
 			} else {
 				status[player] = 6;
 				statusc[player * 10] = wait1[player];
@@ -713,7 +727,7 @@ void statWMove(int32_t player, int32_t kickm, int32_t kickr) {
 				scrate[player] = 100;//oriモード用のスコアレート
 				pinchCheck(player);
 				//ステータス変更と同時に次のステータス関数を実行する事で1フレ短縮　C7V2.1
-				if(repversw >= 54) statErase(player);
+				if(rules->eraseShortcut) statErase(player);
 			}
 
 			return;
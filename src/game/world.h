@@ -16,6 +16,8 @@ void statWMove(int32_t player,int32_t kickm,int32_t kickr);
 extern int32_t iBlock180KickTable[11 *2 *4];
 extern int32_t otherBlock180KickTable[11 *2 *4];
 extern int32_t iBlockKickTable[4 *4 *2 *2];
+extern int32_t iBlockOldKickTable[4 *4 *2 *2];
+extern int32_t otherBlockKickTable[4 *4 *2 *2];
 extern int32_t wcol[7];
 extern int32_t blkWDataY[7 *4 *4];
 extern int32_t blkWDataX[7 *4 *4];
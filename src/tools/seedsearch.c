@@ -0,0 +1,381 @@
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  TGMシード探索ツール
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+// 観測したツモ列から、それを生成するPieceSeed（32ビット）を総当たりで探す。
+// Finds every 32-bit PieceSeed that generates an observed piece sequence with
+// the TGM or TGM3 randomizer, by trying the whole seed space.
+//
+// The randomizers only use bits 10-24 of the LCG state, and bits of an LCG
+// state never depend on higher bits of the seed, so only the low 25 bits of
+// the seed matter; each of the 2^25 candidates stands for 128 seeds. Seeds are
+// tried SEARCH_LANES at a time in vector registers. The TGM
+// randomizer's rerolls against the history are done with lane masks instead of
+// branches, so all lanes advance together; a group of lanes is abandoned as
+// soon as none of them still matches. The TGM3 randomizer mutates a per-seed
+// bag, which doesn't map onto lanes, so only its first piece (generated the
+// same way as TGM's) is checked in lanes. Every candidate is then checked
+// again with the game's own randomizer code, which is the final word on what
+// matches.
+//
+// Usage: seedsearch [--tgm3] [--no-adjust] [--threads N] [--max N] SEQUENCE
+// SEQUENCE is the pieces in order, from the first piece of the game, using the
+// letters I Z S J L O T, with ? for unknown pieces.
+
+#include <SDL3/SDL.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "game/randomizer.h"
+
+// 1つのベクトルレジスタに収まるレーン数
+#if defined(__AVX512F__)
+#define SEARCH_LANES		16
+#elif defined(__AVX2__)
+#define SEARCH_LANES		8
+#else
+#define SEARCH_LANES		4
+#endif
+#define SEARCH_SEED_BITS	25	// ツモに影響するシードの下位ビット数
+#define SEARCH_CHUNK_BITS	15	// 1スレッドが一度に受け持つシードの数（2^15）
+#define SEARCH_CHUNKS		(1 << (SEARCH_SEED_BITS - SEARCH_CHUNK_BITS))
+#define SEARCH_SEQUENCE_MAX	64
+#define SEARCH_UNKNOWN		7
+
+// TGMの番号（I Z S J L O T）。レーン内ではTGMConvert()の変換前の番号で比べる
+#define TGM_Z	1
+#define TGM_S	2
+#define TGM_O	5
+
+static const char heborisPieceNames[] = "ILOZTJS";
+static const int32_t heborisToTGM[7] = { 0, 4, 5, 1, 6, 3, 2 };
+
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  レーン演算
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+// Compilers with vector extensions get real vector registers. Others get plain
+// arrays, which they may still vectorize on their own. Masks are all ones in
+// the lanes where they're true.
+#if defined(__GNUC__) || defined(__clang__)
+typedef uint32_t Lanes __attribute__((vector_size(SEARCH_LANES * sizeof(uint32_t))));
+
+static inline Lanes lanesSet(uint32_t value) { return (Lanes){ 0 } + value; }
+static inline Lanes lanesIndex(uint32_t base) { Lanes r; for (int i = 0; i < SEARCH_LANES; i++) r[i] = base + i; return r; }
+static inline Lanes lanesAnd(Lanes a, Lanes b) { return a & b; }
+static inline Lanes lanesOr(Lanes a, Lanes b) { return a | b; }
+static inline Lanes lanesAndNot(Lanes a, Lanes b) { return a & ~b; }
+static inline Lanes lanesEqual(Lanes a, Lanes b) { return (Lanes)(a == b); }
+static inline Lanes lanesSelect(Lanes mask, Lanes a, Lanes b) { return (a & mask) | (b & ~mask); }
+static inline uint32_t lanesGet(Lanes a, int lane) { return a[lane]; }
+
+// LCGRand()の後に%7。15ビットの値なら (x * 18725) >> 17 が x / 7 と一致する
+static inline Lanes lanesNextPiece(Lanes *seed) {
+	*seed = *seed * 0x41c64e6du + 12345u;
+	const Lanes rand = (*seed >> 10) & 0x7fffu;
+	return rand - ((rand * 18725u) >> 17) * 7u;
+}
+#else
+typedef struct Lanes {
+	uint32_t lane[SEARCH_LANES];
+} Lanes;
+
+#define LANES_OP(result, expression) \
+	Lanes result; \
+	for (int i = 0; i < SEARCH_LANES; i++) result.lane[i] = (expression); \
+	return result
+
+static inline Lanes lanesSet(uint32_t value) { LANES_OP(r, value); }
+static inline Lanes lanesIndex(uint32_t base) { LANES_OP(r, base + i); }
+static inline Lanes lanesAnd(Lanes a, Lanes b) { LANES_OP(r, a.lane[i] & b.lane[i]); }
+static inline Lanes lanesOr(Lanes a, Lanes b) { LANES_OP(r, a.lane[i] | b.lane[i]); }
+static inline Lanes lanesAndNot(Lanes a, Lanes b) { LANES_OP(r, a.lane[i] & ~b.lane[i]); }
+static inline Lanes lanesEqual(Lanes a, Lanes b) { LANES_OP(r, 0u - (uint32_t)(a.lane[i] == b.lane[i])); }
+static inline Lanes lanesSelect(Lanes mask, Lanes a, Lanes b) { LANES_OP(r, (a.lane[i] & mask.lane[i]) | (b.lane[i] & ~mask.lane[i])); }
+static inline uint32_t lanesGet(Lanes a, int lane) { return a.lane[lane]; }
+
+static inline Lanes lanesNextPiece(Lanes *seed) {
+	Lanes piece;
+	for (int i = 0; i < SEARCH_LANES; i++) {
+		seed->lane[i] = seed->lane[i] * 0x41c64e6du + 12345u;
+		const uint32_t rand = (seed->lane[i] >> 10) & 0x7fffu;
+		piece.lane[i] = rand - ((rand * 18725u) >> 17) * 7u;
+	}
+	return piece;
+}
+#endif
+
+static inline bool lanesAny(Lanes mask) {
+	uint32_t any = 0;
+	for (int i = 0; i < SEARCH_LANES; i++) any |= lanesGet(mask, i);
+	return any != 0;
+}
+
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  探索
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+typedef struct SearchMatch {
+	uint32_t seed;
+} SearchMatch;
+
+static bool searchTGM3 = false;
+static bool searchNextAdjust = true;
+static int32_t searchSequence[SEARCH_SEQUENCE_MAX];	// heborisの番号、SEARCH_UNKNOWNは不明
+static int32_t searchSequenceTGM[SEARCH_SEQUENCE_MAX];	// TGMの番号
+static int searchLength;
+static int searchLanePieces;	// レーン内で比べるツモの数
+
+static SDL_AtomicInt searchNextChunk;
+static SDL_AtomicInt searchMatchCount;
+static SDL_Mutex* searchMatchLock;
+static SearchMatch* searchMatches;
+static int searchMaxMatches = 100;
+static int searchStoredMatches;
+
+// Runs the TGM randomizer for the SEARCH_LANES seeds starting at base, and
+// returns a mask of the lanes that match the first searchLanePieces pieces.
+static uint32_t searchLanes(uint32_t base) {
+	static const Lanes zero = { 0 };
+	Lanes seed, block, alive, pending, next, piece;
+	Lanes history[4];
+
+	seed = lanesIndex(base);
+	block = zero;
+	alive = lanesSet(~0u);
+
+	// Z S Z Sで埋める
+	history[0] = history[2] = lanesSet(TGM_Z);
+	history[1] = history[3] = lanesSet(TGM_S);
+
+	// 初手生成。next_adjustならS・Z・Oの間は引き直す
+	pending = alive;
+	do {
+		next = seed;
+		piece = lanesNextPiece(&next);
+		seed = lanesSelect(pending, next, seed);
+		block = lanesSelect(pending, piece, block);
+		if (!searchNextAdjust) break;
+		pending = lanesAnd(pending, lanesOr(lanesEqual(piece, lanesSet(TGM_O)), lanesOr(lanesEqual(piece, lanesSet(TGM_Z)), lanesEqual(piece, lanesSet(TGM_S)))));
+	} while (lanesAny(pending));
+
+	for (int i = 0; i < searchLanePieces; i++) {
+		if (i > 0) {
+			// Each lane stops rolling once it drew a piece not in its history.
+			// Until then it rolls twice per try, matching TAP's reroll bug.
+			Lanes done = zero;
+			for (int j = 0; j < 6; j++) {
+				const Lanes active = lanesAndNot(lanesSet(~0u), done);
+				next = seed;
+				piece = lanesNextPiece(&next);
+				seed = lanesSelect(active, next, seed);
+				block = lanesSelect(active, piece, block);
+
+				const Lanes inHistory = lanesOr(
+					lanesOr(lanesEqual(piece, history[0]), lanesEqual(piece, history[1])),
+					lanesOr(lanesEqual(piece, history[2]), lanesEqual(piece, history[3]))
+				);
+				done = lanesOr(done, lanesAndNot(active, inHistory));
+				const Lanes reroll = lanesAnd(active, inHistory);
+				if (!lanesAny(reroll)) break;
+
+				next = seed;
+				piece = lanesNextPiece(&next);
+				seed = lanesSelect(reroll, next, seed);
+				block = lanesSelect(reroll, piece, block);
+			}
+		}
+
+		history[3] = history[2];
+		history[2] = history[1];
+		history[1] = history[0];
+		history[0] = block;
+
+		if (searchSequenceTGM[i] != SEARCH_UNKNOWN) {
+			alive = lanesAnd(alive, lanesEqual(block, lanesSet(searchSequenceTGM[i])));
+			if (!lanesAny(alive)) return 0;
+		}
+	}
+
+	uint32_t mask = 0;
+	for (int i = 0; i < SEARCH_LANES; i++) {
+		if (lanesGet(alive, i)) mask |= 1u << i;
+	}
+	return mask;
+}
+
+// ゲームと同じツモ生成で確認する
+static bool searchVerify(uint32_t seed) {
+	TGMRandomizer randomizer;
+
+	if (searchTGM3) {
+		tgm3RandomizerInit(&randomizer, seed, searchNextAdjust);
+	}
+	else {
+		tgmRandomizerInit(&randomizer, seed, searchNextAdjust);
+	}
+	for (int i = 0; i < searchLength; i++) {
+		const int32_t block = searchTGM3 ? tgm3RandomizerNext(&randomizer) : tgmRandomizerNext(&randomizer);
+		if (searchSequence[i] != SEARCH_UNKNOWN && block != searchSequence[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static void searchAddMatch(uint32_t seed) {
+	SDL_AddAtomicInt(&searchMatchCount, 1);
+	SDL_LockMutex(searchMatchLock);
+	if (searchStoredMatches < searchMaxMatches) {
+		searchMatches[searchStoredMatches++].seed = seed;
+	}
+	SDL_UnlockMutex(searchMatchLock);
+}
+
+static int SDLCALL searchThread(void* data) {
+	(void)data;
+	int chunk;
+	while ((chunk = SDL_AddAtomicInt(&searchNextChunk, 1)) < SEARCH_CHUNKS) {
+		const uint32_t start = (uint32_t)chunk << SEARCH_CHUNK_BITS;
+		for (uint32_t offset = 0; offset < (1u << SEARCH_CHUNK_BITS); offset += SEARCH_LANES) {
+			const uint32_t mask = searchLanes(start + offset);
+			if (!mask) continue;
+			for (int lane = 0; lane < SEARCH_LANES; lane++) {
+				if ((mask & (1u << lane)) && searchVerify(start + offset + lane)) {
+					searchAddMatch(start + offset + lane);
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+static int compareMatches(const void* a, const void* b) {
+	const uint32_t seedA = ((const SearchMatch*)a)->seed;
+	const uint32_t seedB = ((const SearchMatch*)b)->seed;
+	return (seedA > seedB) - (seedA < seedB);
+}
+
+static void printUsage(const char* program) {
+	fprintf(stderr,
+		"Usage: %s [--tgm3] [--no-adjust] [--threads N] [--max N] SEQUENCE\n"
+		"Finds the PieceSeed values whose TGM randomizer sequence starts with SEQUENCE.\n"
+		"SEQUENCE uses the letters I Z S J L O T, with ? for unknown pieces.\n"
+		"  --tgm3       Use the TGM3 randomizer instead of TGM\n"
+		"  --no-adjust  The first piece may be S, Z or O (next adjust off)\n"
+		"  --threads N  Number of search threads (default: all logical cores)\n"
+		"  --max N      Maximum number of seeds to print (default: 100)\n",
+		program
+	);
+}
+
+int main(int argc, char** argv) {
+	int threadCount = SDL_GetNumLogicalCPUCores();
+	const char* sequence = NULL;
+
+	for (int i = 1; i < argc; i++) {
+		if (SDL_strcmp(argv[i], "--tgm3") == 0) {
+			searchTGM3 = true;
+		}
+		else if (SDL_strcmp(argv[i], "--no-adjust") == 0) {
+			searchNextAdjust = false;
+		}
+		else if (SDL_strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+			threadCount = SDL_atoi(argv[++i]);
+		}
+		else if (SDL_strcmp(argv[i], "--max") == 0 && i + 1 < argc) {
+			searchMaxMatches = SDL_atoi(argv[++i]);
+		}
+		else if (argv[i][0] != '-' && !sequence) {
+			sequence = argv[i];
+		}
+		else {
+			printUsage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+	if (!sequence || threadCount < 1 || searchMaxMatches < 0) {
+		printUsage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	searchLength = 0;
+	for (const char* c = sequence; *c; c++) {
+		int32_t piece = SEARCH_UNKNOWN;
+		if (*c != '?') {
+			const char* found = SDL_strchr(heborisPieceNames, SDL_toupper((unsigned char)*c));
+			if (!found) {
+				fprintf(stderr, "Invalid piece '%c' in sequence\n", *c);
+				return EXIT_FAILURE;
+			}
+			piece = (int32_t)(found - heborisPieceNames);
+		}
+		if (searchLength == SEARCH_SEQUENCE_MAX) {
+			fprintf(stderr, "Sequences are limited to %d pieces\n", SEARCH_SEQUENCE_MAX);
+			return EXIT_FAILURE;
+		}
+		searchSequence[searchLength] = piece;
+		searchSequenceTGM[searchLength] = piece == SEARCH_UNKNOWN ? SEARCH_UNKNOWN : heborisToTGM[piece];
+		searchLength++;
+	}
+	if (searchLength == 0) {
+		printUsage(argv[0]);
+		return EXIT_FAILURE;
+	}
+	searchLanePieces = searchTGM3 ? 1 : searchLength;
+
+	searchMatches = SDL_malloc(sizeof(SearchMatch) * (searchMaxMatches > 0 ? searchMaxMatches : 1));
+	searchMatchLock = SDL_CreateMutex();
+	SDL_Thread** threads = SDL_calloc(threadCount, sizeof(SDL_Thread*));
+	if (!searchMatches || !searchMatchLock || !threads) {
+		fprintf(stderr, "Failed initializing search: %s\n", SDL_GetError());
+		return EXIT_FAILURE;
+	}
+	SDL_SetAtomicInt(&searchNextChunk, 0);
+	SDL_SetAtomicInt(&searchMatchCount, 0);
+
+	printf("Searching all 2^%d %s seeds for %d pieces (next adjust %s) with %d threads\n",
+		SEARCH_SEED_BITS, searchTGM3 ? "TGM3" : "TGM", searchLength, searchNextAdjust ? "on" : "off", threadCount);
+	const uint64_t startTime = SDL_GetPerformanceCounter();
+	for (int i = 0; i < threadCount; i++) {
+		threads[i] = SDL_CreateThread(searchThread, "searchThread", NULL);
+		if (!threads[i]) {
+			fprintf(stderr, "Failed creating search thread: %s\n", SDL_GetError());
+			return EXIT_FAILURE;
+		}
+	}
+	for (int i = 0; i < threadCount; i++) {
+		SDL_WaitThread(threads[i], NULL);
+	}
+	const double seconds = (double)(SDL_GetPerformanceCounter() - startTime) / (double)SDL_GetPerformanceFrequency();
+
+	// 一致したシードと、それに続くツモを表示する
+	SDL_qsort(searchMatches, searchStoredMatches, sizeof(SearchMatch), compareMatches);
+	for (int i = 0; i < searchStoredMatches; i++) {
+		TGMRandomizer randomizer;
+		char pieces[SEARCH_SEQUENCE_MAX + 16 + 1];
+		const int count = searchLength + 16;
+
+		if (searchTGM3) {
+			tgm3RandomizerInit(&randomizer, searchMatches[i].seed, searchNextAdjust);
+		}
+		else {
+			tgmRandomizerInit(&randomizer, searchMatches[i].seed, searchNextAdjust);
+		}
+		for (int j = 0; j < count; j++) {
+			pieces[j] = heborisPieceNames[searchTGM3 ? tgm3RandomizerNext(&randomizer) : tgmRandomizerNext(&randomizer)];
+		}
+		pieces[count] = '\0';
+		printf("0x%08" SDL_PRIX32 " %.*s %s\n", searchMatches[i].seed, searchLength, pieces, pieces + searchLength);
+	}
+
+	const int matchCount = SDL_GetAtomicInt(&searchMatchCount);
+	if (matchCount > searchStoredMatches) {
+		printf("(%d more not shown)\n", matchCount - searchStoredMatches);
+	}
+	printf("%d matching seeds in %.2f s (%.1f million seeds/s)\n", matchCount, seconds, (double)(1 << SEARCH_SEED_BITS) / seconds / 1000000.0);
+	if (matchCount > 0) {
+		printf("Each seed also stands for every seed with the same low %d bits (seed + n * 0x%08X)\n", SEARCH_SEED_BITS, 1u << SEARCH_SEED_BITS);
+	}
+
+	SDL_free(threads);
+	SDL_DestroyMutex(searchMatchLock);
+	SDL_free(searchMatches);
+	return matchCount > 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,207 @@
+//▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽▼▽
+//  速度スケジュール出力ツール
+//▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲△▲
+// setStartLevel()が作るレベルアップのスケジュールを、ゲームと同じコードで作って表示する。
+// Prints the per-level speed schedules compiled at game start, using the
+// game's own compileSpeedSchedule(), so a change to the speed tables or to the
+// schedule compiler can be diffed against the output from before it.
+//
+// Usage: speeddump [--grade N] [--option N] [--hebogb N] [--devil-minus]
+//                  [--death-plus] [--random-rise] MODE VERSION
+//        speeddump --all
+// Each schedule starts with a line of its settings and flags, followed by one
+// line per step that changes something: the step index, the gravity (with the
+// speed it only replaces if slower after a slash), ARE, line delay, lock delay,
+// DAS and the cues. "-" is a value the step keeps. The last
+// SPEED_SCHEDULE_PERIOD steps printed are the first full period after the
+// tables end; every step after them repeats their cues and changes nothing
+// else.
+
+#include <SDL3/SDL.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "game/speed.h"
+
+#define DUMP_MODE_COUNT		11
+#define DUMP_VERSION_MAX	67	// 現在のrepversw
+
+static const char* const dumpModeName[DUMP_MODE_COUNT] = {
+	"BEGINNER", "MASTER", "20G", "DEVIL", "VERSUS", "PRACTICE",
+	"TOMOYO", "ACE", "MISSION", "SIMPLE", "ORIGINAL"
+};
+
+static const char* const dumpDevilGradeName[] = { "none", "flash", "raise", "minus", "death" };
+
+static void printUsage(const char* program) {
+	fprintf(stderr,
+		"Usage: %s [--grade N] [--option N] [--hebogb N] [--devil-minus] [--death-plus] [--random-rise] MODE VERSION\n"
+		"       %s --all\n"
+		"Prints the per-level speed schedule the game compiles for MODE (0-%d) and replay VERSION.\n"
+		"  --grade N      Grade system (enable_grade)\n"
+		"  --option N     TOMOYO F-Point basic, ACE another mode, SIMPLE option or ORIGINAL option\n"
+		"  --hebogb N     Old style speed for ACE another mode 3\n"
+		"  --devil-minus  DEVIL-\n"
+		"  --death-plus   DEATH+\n"
+		"  --random-rise  DEVIL random rise\n"
+		"  --all          Every mode, version 0-%d and setting that changes the schedule\n",
+		program, program, DUMP_MODE_COUNT - 1, DUMP_VERSION_MAX
+	);
+}
+
+static void printValue(int32_t value) {
+	if(value == SPEED_KEEP) printf(" %5s", "-");
+	else printf(" %5d", (int)value);
+}
+
+static void dumpSchedule(const SpeedSettings *settings) {
+	static SpeedSchedule schedule;
+	int32_t last = -1;
+
+	compileSpeedSchedule(&schedule, settings);
+	printf(
+		"%s ver %d grade %d option %d hebogb %d devil-minus %d death-plus %d random-rise %d: "
+		"bgm list %d tgm2 %d regret cancel %d random rise %d devil grade %s\n",
+		dumpModeName[settings->mode], (int)settings->version, (int)settings->grade,
+		(int)settings->option, (int)settings->heboGB,
+		settings->devilMinus, settings->deathPlus, settings->randomRise,
+		(int)schedule.bgmList, schedule.tgm2, schedule.regretCancel, schedule.randomRise,
+		dumpDevilGradeName[schedule.devilGrade]
+	);
+
+	// 値を変えるか演出が周期どおりでない最後の段と、その後の1周期分
+	for(int32_t i = 0; i < SPEED_SCHEDULE_LEVELS - SPEED_SCHEDULE_PERIOD; i++) {
+		const SpeedStep *step = &schedule.step[i];
+		if(
+			(step->gravity != SPEED_KEEP) || (step->are != SPEED_KEEP) || (step->lineDelay != SPEED_KEEP) ||
+			(step->lockDelay != SPEED_KEEP) || (step->das != SPEED_KEEP) ||
+			(step->cue != schedule.step[i + SPEED_SCHEDULE_PERIOD].cue)
+		) last = i;
+	}
+	last += SPEED_SCHEDULE_PERIOD;
+
+	for(int32_t i = 0; i <= last; i++) {
+		const SpeedStep *step = &schedule.step[i];
+		if(
+			(step->gravity == SPEED_KEEP) && (step->are == SPEED_KEEP) && (step->lineDelay == SPEED_KEEP) &&
+			(step->lockDelay == SPEED_KEEP) && (step->das == SPEED_KEEP) && !step->cue
+		) continue;
+
+		printf("%4d", (int)i);
+		if(step->gravityIf) printf(" %5d/%-5d", (int)step->gravity, (int)step->gravityIf);
+		else {
+			printValue(step->gravity);
+			printf("      ");
+		}
+		printValue(step->are);
+		printValue(step->lineDelay);
+		printValue(step->lockDelay);
+		printValue(step->das);
+		printf("%s%s%s%s\n",
+			(step->cue & SPEED_CUE_LEVELUP) ? " levelup" : "",
+			(step->cue & SPEED_CUE_RANKUP) ? " rankup" : "",
+			(step->cue & SPEED_CUE_BGFADE) ? " bgfade" : "",
+			(step->cue & SPEED_CUE_BGM) ? " bgm" : ""
+		);
+	}
+}
+
+// スケジュールが変わりうる設定の組み合わせをすべて出力する
+static void dumpAll(void) {
+	SpeedSettings settings;
+
+	for(int32_t mode = 0; mode < DUMP_MODE_COUNT; mode++) {
+		for(int32_t version = 0; version <= DUMP_VERSION_MAX; version++) {
+			SDL_zero(settings);
+			settings.mode = mode;
+			settings.version = version;
+
+			switch(mode) {
+			case 1:		// MASTER
+			case 2:		// 20G
+				for(settings.grade = 0; settings.grade <= 4; settings.grade++) dumpSchedule(&settings);
+				break;
+			case 3:		// DEVIL
+				for(int32_t flags = 0; flags < 5 * 8; flags++) {
+					settings.grade = flags / 8;
+					settings.devilMinus = (flags & 1) != 0;
+					settings.deathPlus = (flags & 2) != 0;
+					settings.randomRise = (flags & 4) != 0;
+					dumpSchedule(&settings);
+				}
+				break;
+			case 6:		// TOMOYO
+				for(settings.option = 0; settings.option <= 1; settings.option++) dumpSchedule(&settings);
+				break;
+			case 7:		// ACE
+				for(settings.option = 0; settings.option <= 3; settings.option++) {
+					for(settings.heboGB = 0; settings.heboGB <= (settings.option == 3 ? 2 : 0); settings.heboGB++)
+						dumpSchedule(&settings);
+				}
+				break;
+			case 9:		// SIMPLE
+			case 10:	// ORIGINAL
+				for(settings.option = 0; settings.option <= 3; settings.option++) dumpSchedule(&settings);
+				break;
+			default:
+				dumpSchedule(&settings);
+				break;
+			}
+		}
+	}
+}
+
+int main(int argc, char** argv) {
+	SpeedSettings settings;
+	int32_t values[2];
+	int valueCount = 0;
+	bool all = false;
+
+	SDL_zero(settings);
+	for (int i = 1; i < argc; i++) {
+		if (SDL_strcmp(argv[i], "--all") == 0) {
+			all = true;
+		}
+		else if (SDL_strcmp(argv[i], "--grade") == 0 && i + 1 < argc) {
+			settings.grade = SDL_atoi(argv[++i]);
+		}
+		else if (SDL_strcmp(argv[i], "--option") == 0 && i + 1 < argc) {
+			settings.option = SDL_atoi(argv[++i]);
+		}
+		else if (SDL_strcmp(argv[i], "--hebogb") == 0 && i + 1 < argc) {
+			settings.heboGB = SDL_atoi(argv[++i]);
+		}
+		else if (SDL_strcmp(argv[i], "--devil-minus") == 0) {
+			settings.devilMinus = true;
+		}
+		else if (SDL_strcmp(argv[i], "--death-plus") == 0) {
+			settings.deathPlus = true;
+		}
+		else if (SDL_strcmp(argv[i], "--random-rise") == 0) {
+			settings.randomRise = true;
+		}
+		else if (argv[i][0] != '-' && valueCount < 2) {
+			values[valueCount++] = SDL_atoi(argv[i]);
+		}
+		else {
+			printUsage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	if (all) {
+		if (valueCount != 0) {
+			printUsage(argv[0]);
+			return EXIT_FAILURE;
+		}
+		dumpAll();
+		return EXIT_SUCCESS;
+	}
+	if (valueCount != 2 || values[0] < 0 || values[0] >= DUMP_MODE_COUNT || values[1] < 0) {
+		printUsage(argv[0]);
+		return EXIT_FAILURE;
+	}
+	settings.mode = values[0];
+	settings.version = values[1];
+	dumpSchedule(&settings);
+	return EXIT_SUCCESS;
+}